@@ -0,0 +1,46 @@
+/**
+ * @file neon_fft.cpp
+ * @author Sravan Senthilnathan
+ * @brief NEON implementation of the FFT passes
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2023
+ * 
+ */
+#include <arm_neon.h>
+
+#include "simd_playground.h"
+#include "fft.h"
+
+/**
+ * @brief 4 lanes, complex products with FMA
+ */
+struct neon_vec {
+    static constexpr size_t W = 4;
+    using reg = float32x4_t;
+
+    static reg load(const float* p) { return vld1q_f32(p); }
+    static void store(float* p, reg a) { vst1q_f32(p, a); }
+    static reg add(reg a, reg b) { return vaddq_f32(a, b); }
+    static reg sub(reg a, reg b) { return vsubq_f32(a, b); }
+    static reg mul(reg a, reg b) { return vmulq_f32(a, b); }
+    static reg mul_add(reg a, reg b, reg c) { return vfmaq_f32(c, a, b); }
+    static reg mul_sub(reg a, reg b, reg c) { return vnegq_f32(vfmsq_f32(c, a, b)); }
+};
+
+/**
+ * @brief NEON accelerated complex FFT, see fft_forward()
+ */
+void neon_fft(const fft_plan& p, const float* in_re, const float* in_im, size_t stride,
+              float* re, float* im){
+    fft_forward<neon_vec>(p, in_re, in_im, stride, re, im);
+}
+
+/**
+ * @brief NEON accelerated spectrum product, see fft_spectrum_mul()
+ */
+void neon_spectrum_mul(const float* ar, const float* ai, const float* br, const float* bi,
+                       float* cr, float* ci, size_t n){
+    fft_spectrum_mul<neon_vec>(ar, ai, br, bi, cr, ci, n);
+}
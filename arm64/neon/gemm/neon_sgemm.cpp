@@ -0,0 +1,93 @@
+/**
+ * @file neon_sgemm.cpp
+ * @author Sravan Senthilnathan
+ * @brief NEON implementation of the blocked SGEMM
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2023
+ * 
+ */
+#include <arm_neon.h>
+
+#include "simd_playground.h"
+#include "gemm_driver.h"
+
+/**
+ * @brief 8x12 FMA micro-kernel: 24 of the 32 q registers hold accumulators,
+ * three for the B row and two for the A column, whose lanes feed the
+ * by-element FMAs so A needs no separate broadcasts
+ */
+struct neon_gemm_8x12 {
+    static constexpr size_t MR = 8, NR = 12;
+    static constexpr size_t MC = 128, KC = 256, NC = 4092;
+
+    static void kernel(size_t kc, const float* a, const float* b,
+                       float* c, size_t ldc, float alpha, float beta){
+        float32x4_t acc[MR][3];
+#pragma GCC unroll 8
+        for(size_t i = 0; i < MR; ++i){
+            acc[i][0] = vdupq_n_f32(0.0f);
+            acc[i][1] = vdupq_n_f32(0.0f);
+            acc[i][2] = vdupq_n_f32(0.0f);
+        }
+
+        for(size_t p = 0; p < kc; ++p){
+            const float32x4_t b0 = vld1q_f32(b);
+            const float32x4_t b1 = vld1q_f32(b + 4);
+            const float32x4_t b2 = vld1q_f32(b + 8);
+            const float32x4_t a0 = vld1q_f32(a);
+            const float32x4_t a1 = vld1q_f32(a + 4);
+
+            acc[0][0] = vfmaq_laneq_f32(acc[0][0], b0, a0, 0);
+            acc[0][1] = vfmaq_laneq_f32(acc[0][1], b1, a0, 0);
+            acc[0][2] = vfmaq_laneq_f32(acc[0][2], b2, a0, 0);
+            acc[1][0] = vfmaq_laneq_f32(acc[1][0], b0, a0, 1);
+            acc[1][1] = vfmaq_laneq_f32(acc[1][1], b1, a0, 1);
+            acc[1][2] = vfmaq_laneq_f32(acc[1][2], b2, a0, 1);
+            acc[2][0] = vfmaq_laneq_f32(acc[2][0], b0, a0, 2);
+            acc[2][1] = vfmaq_laneq_f32(acc[2][1], b1, a0, 2);
+            acc[2][2] = vfmaq_laneq_f32(acc[2][2], b2, a0, 2);
+            acc[3][0] = vfmaq_laneq_f32(acc[3][0], b0, a0, 3);
+            acc[3][1] = vfmaq_laneq_f32(acc[3][1], b1, a0, 3);
+            acc[3][2] = vfmaq_laneq_f32(acc[3][2], b2, a0, 3);
+
+            acc[4][0] = vfmaq_laneq_f32(acc[4][0], b0, a1, 0);
+            acc[4][1] = vfmaq_laneq_f32(acc[4][1], b1, a1, 0);
+            acc[4][2] = vfmaq_laneq_f32(acc[4][2], b2, a1, 0);
+            acc[5][0] = vfmaq_laneq_f32(acc[5][0], b0, a1, 1);
+            acc[5][1] = vfmaq_laneq_f32(acc[5][1], b1, a1, 1);
+            acc[5][2] = vfmaq_laneq_f32(acc[5][2], b2, a1, 1);
+            acc[6][0] = vfmaq_laneq_f32(acc[6][0], b0, a1, 2);
+            acc[6][1] = vfmaq_laneq_f32(acc[6][1], b1, a1, 2);
+            acc[6][2] = vfmaq_laneq_f32(acc[6][2], b2, a1, 2);
+            acc[7][0] = vfmaq_laneq_f32(acc[7][0], b0, a1, 3);
+            acc[7][1] = vfmaq_laneq_f32(acc[7][1], b1, a1, 3);
+            acc[7][2] = vfmaq_laneq_f32(acc[7][2], b2, a1, 3);
+
+            a += MR;
+            b += NR;
+        }
+
+#pragma GCC unroll 8
+        for(size_t i = 0; i < MR; ++i){
+            float* ci = c + i * ldc;
+            for(size_t j = 0; j < 3; ++j){
+                float32x4_t r = vmulq_n_f32(acc[i][j], alpha);
+                if(beta != 0.0f){
+                    r = vfmaq_n_f32(r, vld1q_f32(ci + 4 * j), beta);
+                }
+                vst1q_f32(ci + 4 * j, r);
+            }
+        }
+    }
+};
+
+/**
+ * @brief NEON accelerated SGEMM function, see sgemm()
+ */
+void neon_sgemm(bool trans_a, bool trans_b, size_t m, size_t n, size_t k,
+                float alpha, const float* a, size_t lda, const float* b, size_t ldb,
+                float beta, float* c, size_t ldc){
+    gemm_blocked<neon_gemm_8x12>(trans_a, trans_b, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+}
@@ -0,0 +1,79 @@
+/**
+ * @file neon_f64.cpp
+ * @author Sravan Senthilnathan
+ * @brief NEON implementation of double precision 4x4 Tensor arithmetic
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2023
+ * 
+ */
+#include <arm_neon.h>
+
+#include "simd_playground.h"
+#include "vector_driver.h"
+
+/**
+ * @brief NEON accelerated double precision Tensor Addition function:
+ * 
+ * every row is two q registers.
+ * 
+ * @param a first operand tensor
+ * @param b second operand tensor
+ * @param c output tensor
+ */
+void neon_add(const Tensor64 a, const Tensor64 b, Tensor64 &c){
+    for(int i = 0; i < 4; ++i){
+        vst1q_f64(c[i], vaddq_f64(vld1q_f64(a[i]), vld1q_f64(b[i])));
+        vst1q_f64(c[i] + 2, vaddq_f64(vld1q_f64(a[i] + 2), vld1q_f64(b[i] + 2)));
+    }
+}
+
+/**
+ * @brief NEON accelerated double precision Tensor Subtraction function:
+ * 
+ * @param a first operand tensor
+ * @param b second operand tensor
+ * @param c output tensor
+ */
+void neon_sub(const Tensor64 a, const Tensor64 b, Tensor64 &c){
+    for(int i = 0; i < 4; ++i){
+        vst1q_f64(c[i], vsubq_f64(vld1q_f64(a[i]), vld1q_f64(b[i])));
+        vst1q_f64(c[i] + 2, vsubq_f64(vld1q_f64(a[i] + 2), vld1q_f64(b[i] + 2)));
+    }
+}
+
+/**
+ * @brief NEON accelerated double precision Tensor Multiplication function:
+ * 
+ * the row form of neon_mul, both halves of row i of c accumulated with
+ * by-element FMAs on a[i][k].
+ * 
+ * @param a first operand tensor
+ * @param b second operand tensor
+ * @param c output tensor
+ */
+void neon_mul(const Tensor64 a, const Tensor64 b, Tensor64 &c){
+    float64x2_t Tlo[4], Thi[4];
+    for(int k = 0; k < 4; ++k){
+        Tlo[k] = vld1q_f64(b[k]);
+        Thi[k] = vld1q_f64(b[k] + 2);
+    }
+
+    for(int i = 0; i < 4; ++i){
+        const float64x2_t Ta01 = vld1q_f64(a[i]);
+        const float64x2_t Ta23 = vld1q_f64(a[i] + 2);
+
+        float64x2_t Lo = vmulq_laneq_f64(Tlo[0], Ta01, 0);
+        float64x2_t Hi = vmulq_laneq_f64(Thi[0], Ta01, 0);
+        Lo = vfmaq_laneq_f64(Lo, Tlo[1], Ta01, 1);
+        Hi = vfmaq_laneq_f64(Hi, Thi[1], Ta01, 1);
+        Lo = vfmaq_laneq_f64(Lo, Tlo[2], Ta23, 0);
+        Hi = vfmaq_laneq_f64(Hi, Thi[2], Ta23, 0);
+        Lo = vfmaq_laneq_f64(Lo, Tlo[3], Ta23, 1);
+        Hi = vfmaq_laneq_f64(Hi, Thi[3], Ta23, 1);
+
+        vst1q_f64(c[i], Lo);
+        vst1q_f64(c[i] + 2, Hi);
+    }
+}
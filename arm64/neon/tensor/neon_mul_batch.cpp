@@ -0,0 +1,80 @@
+/**
+ * @file neon_mul_batch.cpp
+ * @author Sravan Senthilnathan
+ * @brief NEON_SIMD implementation of batched Tensor Multiplication
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2023
+ * 
+ */
+#include <arm_neon.h>
+
+#include "simd_playground.h"
+
+/**
+ * @brief NEON_SIMD accelerated batched Tensor Multiplication function:
+ * 
+ * the by-element FMA row form of neon_mul, one tensor per pass; the rows
+ * of b stay in registers for the four rows of c.
+ * 
+ * @param a first operand tensors
+ * @param b second operand tensors
+ * @param c output tensors
+ * @param count number of tensors
+ */
+void neon_mul_batch(const Tensor* a, const Tensor* b, Tensor* c, size_t count){
+    for(size_t m = 0; m < count; ++m){
+        const float32x4_t Tb0 = vld1q_f32(b[m][0]);
+        const float32x4_t Tb1 = vld1q_f32(b[m][1]);
+        const float32x4_t Tb2 = vld1q_f32(b[m][2]);
+        const float32x4_t Tb3 = vld1q_f32(b[m][3]);
+
+        for(int i = 0; i < 4; ++i){
+            const float32x4_t Ta = vld1q_f32(a[m][i]);
+
+            float32x4_t Tc = vmulq_laneq_f32(Tb0, Ta, 0);
+            Tc = vfmaq_laneq_f32(Tc, Tb1, Ta, 1);
+            Tc = vfmaq_laneq_f32(Tc, Tb2, Ta, 2);
+            Tc = vfmaq_laneq_f32(Tc, Tb3, Ta, 3);
+
+            vst1q_f32(c[m][i], Tc);
+        }
+    }
+}
+
+/**
+ * @brief NEON_SIMD accelerated structure-of-arrays batched Tensor
+ * Multiplication function:
+ * 
+ * 4 tensors per pass, every element plane is one q register; the remainder
+ * goes to the scalar reference.
+ * 
+ * @param a first operand planes
+ * @param b second operand planes
+ * @param c output planes
+ * @param count number of tensors
+ * @param stride distance between the planes in elements
+ */
+void neon_mul_batch_soa(const float* a, const float* b, float* c, size_t count, size_t stride){
+    size_t m = 0;
+    for(; m + 4 <= count; m += 4){
+        for(int i = 0; i < 4; ++i){
+            const float32x4_t Ta0 = vld1q_f32(a + (4 * i + 0) * stride + m);
+            const float32x4_t Ta1 = vld1q_f32(a + (4 * i + 1) * stride + m);
+            const float32x4_t Ta2 = vld1q_f32(a + (4 * i + 2) * stride + m);
+            const float32x4_t Ta3 = vld1q_f32(a + (4 * i + 3) * stride + m);
+
+            for(int j = 0; j < 4; ++j){
+                float32x4_t Tc = vmulq_f32(Ta0, vld1q_f32(b + (0 + j) * stride + m));
+                Tc = vfmaq_f32(Tc, Ta1, vld1q_f32(b + (4 + j) * stride + m));
+                Tc = vfmaq_f32(Tc, Ta2, vld1q_f32(b + (8 + j) * stride + m));
+                Tc = vfmaq_f32(Tc, Ta3, vld1q_f32(b + (12 + j) * stride + m));
+                vst1q_f32(c + (4 * i + j) * stride + m, Tc);
+            }
+        }
+    }
+    if(m < count){
+        mul_batch_soa(a + m, b + m, c + m, count - m, stride);
+    }
+}
@@ -8,33 +8,9 @@
  * @copyright Copyright (c) 2023
  * 
  */
-#include <iostream>
 #include <arm_neon.h>
 
-// misc lib:
-#include <algorithm>
-#include <numeric>
-#include <chrono>
-
-using namespace std;
-
-// implicit Tensor Declaration:
-using Tensor = float[4][4];
-
-/**
- * @brief Standard Tensor Subtraction function:
- * 
- * @param a first operand tensor
- * @param b second operand tensor
- * @param c output tensor
- */
-void sub(const Tensor a, const Tensor b, Tensor &c){
-    for(int i = 0; i < 4; ++i){
-        for(int j = 0; j < 4; ++j){
-            c[i][j] = a[i][j] - b[i][j];
-        }
-    }
-}
+#include "simd_playground.h"
 
 /**
  * @brief NEON_SIMD accelerated Tensor Subtraction function:
@@ -59,40 +35,3 @@ void neon_sub(const Tensor a, const Tensor b, Tensor &c){
     vst1q_f32(c[2], vsubq_f32(Ta2, Tb2));
     vst1q_f32(c[3], vsubq_f32(Ta3, Tb3));
 }
-
-int main(){
-    Tensor a = {{1, 2, 3, 4}, {2, 3, 4, 5}, {3, 4, 5, 6}, {4, 5, 6, 7}};
-    Tensor b = {{1, 2, 3, 4}, {2, 3, 4, 5}, {3, 4, 5, 6}, {4, 5, 6, 7}};
-    Tensor c = {{0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}};
-
-    // normal implementation:
-    auto st1 = chrono::high_resolution_clock::now();
-    sub(a, b, c); 
-    auto sp1 = chrono::high_resolution_clock::now();
-
-    // vectorized implementation:
-    auto st2 = chrono::high_resolution_clock::now();
-    neon_sub(a, b, c); 
-    auto sp2 = chrono::high_resolution_clock::now();
-
-    cout << "------------------NEON-TENSOR-SUB------------------" << endl;
-
-    auto d1 = chrono::duration_cast<std::chrono::nanoseconds>(sp1 - st1);   
-
-    cout << "Time taken by normal function: "
-         << d1.count() << " nanoseconds" << endl;
-
-    auto d2 = chrono::duration_cast<std::chrono::nanoseconds>(sp2 - st2);
- 
-    cout << "Time taken by NEON function: "
-         << d2.count() << " nanoseconds" << endl;
-
-    const float percent = (float)d1.count()/(float)d2.count() * 100;
-
-    cout << "Speed Uplift: "
-        << percent << " %" << endl;
-
-    cout << "---------------------------------------------------" << endl;
-
-    return(0);
-}
\ No newline at end of file
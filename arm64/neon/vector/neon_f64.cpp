@@ -0,0 +1,48 @@
+/**
+ * @file neon_f64.cpp
+ * @author Sravan Senthilnathan
+ * @brief NEON implementation of double precision vector arithmetic
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2023
+ * 
+ */
+#include "simd_playground.h"
+#include "simd_vec.h"
+#include "vector_driver.h"
+
+/**
+ * @brief NEON accelerated double precision Vector Addition, see vec_binary()
+ */
+void neon_add(const double* a, const double* b, double* c, size_t n){
+    vec_binary<vec_neon<double>, vec_op::add>(a, b, c, n);
+}
+
+/**
+ * @brief NEON accelerated double precision Vector Subtraction, see vec_binary()
+ */
+void neon_sub(const double* a, const double* b, double* c, size_t n){
+    vec_binary<vec_neon<double>, vec_op::sub>(a, b, c, n);
+}
+
+/**
+ * @brief NEON accelerated double precision Vector Multiply, see vec_binary()
+ */
+void neon_mul(const double* a, const double* b, double* c, size_t n){
+    vec_binary<vec_neon<double>, vec_op::mul>(a, b, c, n);
+}
+
+/**
+ * @brief NEON accelerated double precision Vector Division, see vec_binary()
+ */
+void neon_div(const double* a, const double* b, double* c, size_t n){
+    vec_binary<vec_neon<double>, vec_op::div>(a, b, c, n);
+}
+
+/**
+ * @brief NEON accelerated double precision Vector Multiply-Add, one rounding
+ */
+void neon_mul_add(const double* a, const double* b, const double* c, double* d, size_t n){
+    vec_mul_add<vec_neon<double>>(a, b, c, d, n);
+}
@@ -0,0 +1,81 @@
+/**
+ * @file neon_half.cpp
+ * @author Sravan Senthilnathan
+ * @brief NEON_SIMD FP16/BF16 storage kernels
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2023
+ * 
+ */
+#include <arm_neon.h>
+#include <cmath>
+
+#include "simd_playground.h"
+#include "half_driver.h"
+
+/**
+ * @brief 4 lanes, FP16 through fcvtl/fcvtn (ARMv8-A, no FP16 arithmetic
+ * needed), BF16 widened by a shift and narrowed with an integer round to
+ * nearest even
+ */
+struct neon_half_vec {
+    static constexpr size_t W = 4;
+    using reg = float32x4_t;
+
+    static reg load(const float* p) { return vld1q_f32(p); }
+    static void store(float* p, reg a) { vst1q_f32(p, a); }
+    static reg zero() { return vdupq_n_f32(0.0f); }
+    static reg add(reg a, reg b) { return vaddq_f32(a, b); }
+    static reg mul(reg a, reg b) { return vmulq_f32(a, b); }
+    static reg mul_add(reg a, reg b, reg c) { return vfmaq_f32(c, a, b); }
+    static float mul_add(float a, float b, float c) { return std::fma(a, b, c); }
+
+    static reg load_fp16(const uint16_t* p) { return vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16(p))); }
+    static void store_fp16(uint16_t* p, reg a) { vst1_u16(p, vreinterpret_u16_f16(vcvt_f16_f32(a))); }
+    static reg load_bf16(const uint16_t* p) { return vreinterpretq_f32_u32(vshll_n_u16(vld1_u16(p), 16)); }
+    static void store_bf16(uint16_t* p, reg a) {
+        const uint32x4_t x = vreinterpretq_u32_f32(a);
+        const uint32x4_t lsb = vandq_u32(vshrq_n_u32(x, 16), vdupq_n_u32(1));
+        const uint32x4_t rounded = vaddq_u32(x, vaddq_u32(lsb, vdupq_n_u32(0x7fff)));
+        // NaNs keep their upper half, made quiet:
+        const uint32x4_t nan = vmvnq_u32(vceqq_f32(a, a));
+        const uint32x4_t r = vbslq_u32(nan, vorrq_u32(x, vdupq_n_u32(0x400000)), rounded);
+        vst1_u16(p, vshrn_n_u32(r, 16));
+    }
+};
+
+/**
+ * @brief NEON float to half conversion, see float_to_half()
+ */
+void neon_to_half(const float* a, uint16_t* h, size_t n, simd_half_format format){
+    half_to<neon_half_vec>(a, h, n, format);
+}
+
+/**
+ * @brief NEON half to float conversion, see half_to_float()
+ */
+void neon_from_half(const uint16_t* h, float* a, size_t n, simd_half_format format){
+    half_from<neon_half_vec>(h, a, n, format);
+}
+
+/**
+ * @brief NEON Vector Addition on half storage, see half_driver.h
+ */
+void neon_add_half(const uint16_t* a, const uint16_t* b, uint16_t* c, size_t n, simd_half_format format){
+    half_binary<neon_half_vec, false>(a, b, c, n, format);
+}
+
+/**
+ * @brief NEON Vector Multiply on half storage, see half_driver.h
+ */
+void neon_mul_half(const uint16_t* a, const uint16_t* b, uint16_t* c, size_t n, simd_half_format format){
+    half_binary<neon_half_vec, true>(a, b, c, n, format);
+}
+
+/**
+ * @brief NEON Dot Product of half operands, accumulated in float
+ */
+float neon_dot_half(const uint16_t* a, const uint16_t* b, size_t n, simd_half_format format){
+    return half_dot<neon_half_vec>(a, b, n, format);
+}
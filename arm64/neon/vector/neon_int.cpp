@@ -0,0 +1,216 @@
+/**
+ * @file neon_int.cpp
+ * @author Sravan Senthilnathan
+ * @brief NEON_SIMD integer, 8 bit dot product and quantized convolution kernels
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2023
+ * 
+ */
+#include <arm_neon.h>
+#include <cstdint>
+
+#include "simd_playground.h"
+#include "int_driver.h"
+
+// saturating add/sub are single instructions for every width (sqadd,
+// uqadd, sqsub, uqsub), saturating products are widened with smull/umull
+// and narrowed with sqxtn/uqxtn:
+
+struct neon_i8_vec {
+    static constexpr size_t W = 16;
+    using reg = int8x16_t;
+
+    static reg load(const int8_t* p) { return vld1q_s8(p); }
+    static void store(int8_t* p, reg a) { vst1q_s8(p, a); }
+    static reg add(reg a, reg b) { return vaddq_s8(a, b); }
+    static reg adds(reg a, reg b) { return vqaddq_s8(a, b); }
+    static reg sub(reg a, reg b) { return vsubq_s8(a, b); }
+    static reg subs(reg a, reg b) { return vqsubq_s8(a, b); }
+    static reg mul(reg a, reg b) { return vmulq_s8(a, b); }
+    static reg muls(reg a, reg b) {
+        return vcombine_s8(vqmovn_s16(vmull_s8(vget_low_s8(a), vget_low_s8(b))), vqmovn_s16(vmull_high_s8(a, b)));
+    }
+};
+
+struct neon_u8_vec {
+    static constexpr size_t W = 16;
+    using reg = uint8x16_t;
+
+    static reg load(const uint8_t* p) { return vld1q_u8(p); }
+    static void store(uint8_t* p, reg a) { vst1q_u8(p, a); }
+    static reg add(reg a, reg b) { return vaddq_u8(a, b); }
+    static reg adds(reg a, reg b) { return vqaddq_u8(a, b); }
+    static reg sub(reg a, reg b) { return vsubq_u8(a, b); }
+    static reg subs(reg a, reg b) { return vqsubq_u8(a, b); }
+    static reg mul(reg a, reg b) { return vmulq_u8(a, b); }
+    static reg muls(reg a, reg b) {
+        return vcombine_u8(vqmovn_u16(vmull_u8(vget_low_u8(a), vget_low_u8(b))), vqmovn_u16(vmull_high_u8(a, b)));
+    }
+};
+
+struct neon_i16_vec {
+    static constexpr size_t W = 8;
+    using reg = int16x8_t;
+
+    static reg load(const int16_t* p) { return vld1q_s16(p); }
+    static void store(int16_t* p, reg a) { vst1q_s16(p, a); }
+    static reg add(reg a, reg b) { return vaddq_s16(a, b); }
+    static reg adds(reg a, reg b) { return vqaddq_s16(a, b); }
+    static reg sub(reg a, reg b) { return vsubq_s16(a, b); }
+    static reg subs(reg a, reg b) { return vqsubq_s16(a, b); }
+    static reg mul(reg a, reg b) { return vmulq_s16(a, b); }
+    static reg muls(reg a, reg b) {
+        return vcombine_s16(vqmovn_s32(vmull_s16(vget_low_s16(a), vget_low_s16(b))), vqmovn_s32(vmull_high_s16(a, b)));
+    }
+};
+
+struct neon_i32_vec {
+    static constexpr size_t W = 4;
+    using reg = int32x4_t;
+
+    static reg load(const int32_t* p) { return vld1q_s32(p); }
+    static void store(int32_t* p, reg a) { vst1q_s32(p, a); }
+    static reg add(reg a, reg b) { return vaddq_s32(a, b); }
+    static reg adds(reg a, reg b) { return vqaddq_s32(a, b); }
+    static reg sub(reg a, reg b) { return vsubq_s32(a, b); }
+    static reg subs(reg a, reg b) { return vqsubq_s32(a, b); }
+    static reg mul(reg a, reg b) { return vmulq_s32(a, b); }
+    static reg muls(reg a, reg b) {
+        return vcombine_s32(vqmovn_s64(vmull_s32(vget_low_s32(a), vget_low_s32(b))), vqmovn_s64(vmull_high_s32(a, b)));
+    }
+};
+
+/**
+ * @brief 16 bytes per step into 4 int32 lanes: signed by signed as 16 bit
+ * products (smull) added pairwise (sadalp), unsigned by signed widened to
+ * 16 bits first (smlal)
+ */
+struct neon_dot_vec {
+    static constexpr size_t W = 16;
+    using reg = int32x4_t;
+
+    static reg zero() { return vdupq_n_s32(0); }
+    static reg dot(reg acc, const uint8_t* a, const int8_t* b) {
+        const uint8x16_t x = vld1q_u8(a);
+        const int8x16_t y = vld1q_s8(b);
+        const int16x8_t x0 = vreinterpretq_s16_u16(vmovl_u8(vget_low_u8(x))), y0 = vmovl_s8(vget_low_s8(y));
+        const int16x8_t x1 = vreinterpretq_s16_u16(vmovl_high_u8(x)), y1 = vmovl_high_s8(y);
+        acc = vmlal_s16(acc, vget_low_s16(x0), vget_low_s16(y0));
+        acc = vmlal_high_s16(acc, x0, y0);
+        acc = vmlal_s16(acc, vget_low_s16(x1), vget_low_s16(y1));
+        return vmlal_high_s16(acc, x1, y1);
+    }
+    static reg dot(reg acc, const int8_t* a, const int8_t* b) {
+        const int8x16_t x = vld1q_s8(a), y = vld1q_s8(b);
+        acc = vpadalq_s16(acc, vmull_s8(vget_low_s8(x), vget_low_s8(y)));
+        return vpadalq_s16(acc, vmull_high_s8(x, y));
+    }
+    static int64_t hsum(reg a) { return vaddlvq_s32(a); }
+};
+
+/**
+ * @brief 8 outputs per step, each tap of the pair multiplied in with
+ * smlal by lane; lo holds outputs 0-3, hi outputs 4-7
+ */
+struct neon_quant_vec {
+    static constexpr size_t W = 8;
+    using reg = int32x4_t;
+
+    static reg zero() { return vdupq_n_s32(0); }
+    static int16x8_t load(const int16_t* p) { return vld1q_s16(p); }
+    static reg taps(int16_t h0, int16_t h1) { return vdupq_n_s32((int32_t)(((uint32_t)(uint16_t)h1 << 16) | (uint16_t)h0)); }
+    static void madd(reg& lo, reg& hi, int16x8_t x0, int16x8_t x1, reg t) {
+        const int16x8_t h = vreinterpretq_s16_s32(t);
+        lo = vmlal_laneq_s16(lo, vget_low_s16(x0), h, 0);
+        lo = vmlal_laneq_s16(lo, vget_low_s16(x1), h, 1);
+        hi = vmlal_high_laneq_s16(hi, x0, h, 0);
+        hi = vmlal_high_laneq_s16(hi, x1, h, 1);
+    }
+    static int16x4_t requantize32(reg acc, float multiplier, int32_t zero_point) {
+        const float32x4_t p = vmulq_n_f32(vcvtq_f32_s32(acc), multiplier);
+        const float32x4_t clamped = vminq_f32(vmaxq_f32(p, vdupq_n_f32(-65536.0f)), vdupq_n_f32(65536.0f));
+        return vqmovn_s32(vaddq_s32(vcvtnq_s32_f32(clamped), vdupq_n_s32(zero_point)));
+    }
+    static void requantize(uint8_t* y, reg lo, reg hi, float multiplier, int32_t zero_point) {
+        const int16x8_t q = vcombine_s16(requantize32(lo, multiplier, zero_point), requantize32(hi, multiplier, zero_point));
+        vst1_u8(y, vqmovun_s16(q));
+    }
+};
+
+/**
+ * @brief NEON integer Vector Addition, see the integer add()
+ */
+void neon_add(const int8_t* a, const int8_t* b, int8_t* c, size_t n, simd_overflow overflow){
+    int_binary<neon_i8_vec, int_op::add>(a, b, c, n, overflow);
+}
+
+void neon_add(const uint8_t* a, const uint8_t* b, uint8_t* c, size_t n, simd_overflow overflow){
+    int_binary<neon_u8_vec, int_op::add>(a, b, c, n, overflow);
+}
+
+void neon_add(const int16_t* a, const int16_t* b, int16_t* c, size_t n, simd_overflow overflow){
+    int_binary<neon_i16_vec, int_op::add>(a, b, c, n, overflow);
+}
+
+void neon_add(const int32_t* a, const int32_t* b, int32_t* c, size_t n, simd_overflow overflow){
+    int_binary<neon_i32_vec, int_op::add>(a, b, c, n, overflow);
+}
+
+/**
+ * @brief NEON integer Vector Subtraction, see the integer sub()
+ */
+void neon_sub(const int8_t* a, const int8_t* b, int8_t* c, size_t n, simd_overflow overflow){
+    int_binary<neon_i8_vec, int_op::sub>(a, b, c, n, overflow);
+}
+
+void neon_sub(const uint8_t* a, const uint8_t* b, uint8_t* c, size_t n, simd_overflow overflow){
+    int_binary<neon_u8_vec, int_op::sub>(a, b, c, n, overflow);
+}
+
+void neon_sub(const int16_t* a, const int16_t* b, int16_t* c, size_t n, simd_overflow overflow){
+    int_binary<neon_i16_vec, int_op::sub>(a, b, c, n, overflow);
+}
+
+void neon_sub(const int32_t* a, const int32_t* b, int32_t* c, size_t n, simd_overflow overflow){
+    int_binary<neon_i32_vec, int_op::sub>(a, b, c, n, overflow);
+}
+
+/**
+ * @brief NEON integer Vector Multiply, see the integer mul()
+ */
+void neon_mul(const int8_t* a, const int8_t* b, int8_t* c, size_t n, simd_overflow overflow){
+    int_binary<neon_i8_vec, int_op::mul>(a, b, c, n, overflow);
+}
+
+void neon_mul(const uint8_t* a, const uint8_t* b, uint8_t* c, size_t n, simd_overflow overflow){
+    int_binary<neon_u8_vec, int_op::mul>(a, b, c, n, overflow);
+}
+
+void neon_mul(const int16_t* a, const int16_t* b, int16_t* c, size_t n, simd_overflow overflow){
+    int_binary<neon_i16_vec, int_op::mul>(a, b, c, n, overflow);
+}
+
+void neon_mul(const int32_t* a, const int32_t* b, int32_t* c, size_t n, simd_overflow overflow){
+    int_binary<neon_i32_vec, int_op::mul>(a, b, c, n, overflow);
+}
+
+/**
+ * @brief NEON 8 bit Dot Product, see the 8 bit dot()
+ */
+int64_t neon_dot(const uint8_t* a, const int8_t* b, size_t n){
+    return int_dot<neon_dot_vec>(a, b, n);
+}
+
+int64_t neon_dot(const int8_t* a, const int8_t* b, size_t n){
+    return int_dot<neon_dot_vec>(a, b, n);
+}
+
+/**
+ * @brief NEON quantized convolution of widened operands, see int_driver.h
+ */
+void neon_conv_quant(const int16_t* x, const int16_t* h, size_t m, uint8_t* y, size_t count,
+                     float multiplier, int32_t zero_point){
+    quant_conv_run<neon_quant_vec>(x, h, m, y, count, multiplier, zero_point);
+}
@@ -0,0 +1,50 @@
+/**
+ * @file neon_layer.cpp
+ * @author Sravan Senthilnathan
+ * @brief NEON fused softmax, log-softmax, layer-norm, RMS-norm and bias plus activation
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2023
+ * 
+ */
+#include "simd_playground.h"
+#include "simd_vec.h"
+#include "layer_driver.h"
+
+/**
+ * @brief NEON softmax of every row, see layer_driver.h
+ */
+void neon_softmax(const float* x, float* y, size_t rows, size_t cols){
+    layer_softmax<vec_neon<float>>(x, y, rows, cols);
+}
+
+/**
+ * @brief NEON log-softmax of every row, see layer_driver.h
+ */
+void neon_log_softmax(const float* x, float* y, size_t rows, size_t cols){
+    layer_log_softmax<vec_neon<float>>(x, y, rows, cols);
+}
+
+/**
+ * @brief NEON layer normalization of every row, see layer_driver.h
+ */
+void neon_layer_norm(const float* x, const float* gamma, const float* beta, float* y,
+                     size_t rows, size_t cols, float eps){
+    layer_layer_norm<vec_neon<float>>(x, gamma, beta, y, rows, cols, eps);
+}
+
+/**
+ * @brief NEON RMS normalization of every row, see layer_driver.h
+ */
+void neon_rms_norm(const float* x, const float* gamma, float* y, size_t rows, size_t cols, float eps){
+    layer_rms_norm<vec_neon<float>>(x, gamma, y, rows, cols, eps);
+}
+
+/**
+ * @brief NEON y = act(x + bias) on every row, see layer_driver.h
+ */
+void neon_bias_activation(const float* x, const float* bias, float* y, size_t rows, size_t cols,
+                          simd_activation act){
+    layer_bias_activation<vec_neon<float>>(x, bias, y, rows, cols, act);
+}
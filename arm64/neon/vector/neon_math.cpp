@@ -0,0 +1,69 @@
+/**
+ * @file neon_math.cpp
+ * @author Sravan Senthilnathan
+ * @brief NEON_SIMD elementwise exp, log, sin, cos, tanh, sigmoid, erf and pow
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2023
+ * 
+ */
+#include "simd_playground.h"
+#include "simd_vec.h"
+#include "math_driver.h"
+
+/**
+ * @brief NEON e^x, see math_driver.h
+ */
+void neon_exp(const float* a, float* b, size_t n, simd_math_mode mode){
+    math_unary<vec_neon<float>, math_fn::exp>(a, b, n, mode);
+}
+
+/**
+ * @brief NEON natural logarithm, see math_driver.h
+ */
+void neon_log(const float* a, float* b, size_t n, simd_math_mode mode){
+    math_unary<vec_neon<float>, math_fn::log>(a, b, n, mode);
+}
+
+/**
+ * @brief NEON sine, see math_driver.h
+ */
+void neon_sin(const float* a, float* b, size_t n, simd_math_mode mode){
+    math_unary<vec_neon<float>, math_fn::sin>(a, b, n, mode);
+}
+
+/**
+ * @brief NEON cosine, see math_driver.h
+ */
+void neon_cos(const float* a, float* b, size_t n, simd_math_mode mode){
+    math_unary<vec_neon<float>, math_fn::cos>(a, b, n, mode);
+}
+
+/**
+ * @brief NEON hyperbolic tangent, see math_driver.h
+ */
+void neon_tanh(const float* a, float* b, size_t n, simd_math_mode mode){
+    math_unary<vec_neon<float>, math_fn::tanh>(a, b, n, mode);
+}
+
+/**
+ * @brief NEON logistic function, see math_driver.h
+ */
+void neon_sigmoid(const float* a, float* b, size_t n, simd_math_mode mode){
+    math_unary<vec_neon<float>, math_fn::sigmoid>(a, b, n, mode);
+}
+
+/**
+ * @brief NEON error function, see math_driver.h
+ */
+void neon_erf(const float* a, float* b, size_t n, simd_math_mode mode){
+    math_unary<vec_neon<float>, math_fn::erf>(a, b, n, mode);
+}
+
+/**
+ * @brief NEON power function, see math_driver.h
+ */
+void neon_pow(const float* a, const float* b, float* c, size_t n, simd_math_mode mode){
+    math_pow<vec_neon<float>, vec_neon<double>>(a, b, c, n, mode);
+}
@@ -8,92 +8,18 @@
  * @copyright Copyright (c) 2023
  * 
  */
-
-#include <iostream>
-#include <arm_neon.h>
-#include <vector>
-
-// misc lib:
-#include <algorithm>
-#include <numeric>
-#include <chrono>
-
-using namespace std;
-
-/**
- * @brief Standard Vector Multiplication function:
- * 
- * @param a first operand vector 
- * @param b second operand vector
- * @param c output vector
- */
-void mul(const vector<float> a, const vector<float> b, vector<float>& c){
-    for(int i = 0; i < a.size(); ++i){
-        c[i] = a[i] * b[i];
-    }
-}
+#include "simd_playground.h"
+#include "simd_vec.h"
+#include "vector_driver.h"
 
 /**
- * @brief NEON accelerated Vector Multiplication function:
+ * @brief NEON accelerated Vector Multiply function:
  * 
- * @param a first operand vector
- * @param b second operand vector
- * @param c output vector
+ * @param a first operand array
+ * @param b second operand array
+ * @param c output array (may alias a or b)
+ * @param n number of elements
  */
-void neon_mul(const vector<float> a, const vector<float> b, vector<float>& c){
-
-    const int vectorize = (a.size() / 4u) * 4u;
-
-    int i = 0;
-
-    for(; i < vectorize; i += 4u){
-        float32x4_t aReg = vld1q_f32(a.data() + i);
-        float32x4_t bReg = vld1q_f32(b.data() + i);
-        float32x4_t cReg = vmulq_f32(aReg, bReg);
-        vst1q_f32(c.data() + i, cReg);
-    }
-    for(; i < a.size(); ++i){
-       c[i] = a[i] * b[i];
-    }
-}
-
-int main(){
-    vector<float> a(100);
-    vector<float> b(100);
-    vector<float> c(100);
-    vector<float> d(100);
-
-    iota(a.begin(), a.end(), 0.9);
-    iota(b.begin(), b.end(), 0.6);
-
-    // normal implementation:
-    auto st1 = chrono::high_resolution_clock::now();
-    mul(a, b, c); 
-    auto sp1 = chrono::high_resolution_clock::now();
-
-    // vectorized implementation:
-    auto st2 = chrono::high_resolution_clock::now();
-    neon_mul(a, b, d); 
-    auto sp2 = chrono::high_resolution_clock::now();
-
-    cout << "------------------NEON-VECTOR-MUL------------------" << endl;
-
-    auto d1 = chrono::duration_cast<std::chrono::nanoseconds>(sp1 - st1);
- 
-    cout << "Time taken by normal function: "
-         << d1.count() << " nanoseconds" << endl;
-
-    auto d2 = chrono::duration_cast<std::chrono::nanoseconds>(sp2 - st2);
- 
-    cout << "Time taken by NEON function: "
-         << d2.count() << " nanoseconds" << endl;
-
-    const float percent = (float)d1.count()/(float)d2.count() * 100;
-
-    cout << "Speed Uplift: "
-        << percent << " %" << endl;
-
-    cout << "---------------------------------------------------" << endl;
-
-    return(0);
+void neon_mul(const float* a, const float* b, float* c, size_t n){
+    vec_binary<vec_neon<float>, vec_op::mul>(a, b, c, n);
 }
@@ -0,0 +1,55 @@
+/**
+ * @file neon_reduce.cpp
+ * @author Sravan Senthilnathan
+ * @brief NEON_SIMD sum, dot product, min/max and argmin/argmax
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2023
+ * 
+ */
+#include "simd_playground.h"
+#include "simd_vec.h"
+#include "reduce_driver.h"
+
+/**
+ * @brief NEON Vector Sum, see reduce_driver.h for the modes
+ */
+float neon_sum(const float* a, size_t n, simd_sum_mode mode){
+    return reduce_sum<vec_neon<float>>(a, n, mode);
+}
+
+/**
+ * @brief NEON Dot Product, see reduce_driver.h for the modes
+ */
+float neon_dot(const float* a, const float* b, size_t n, simd_sum_mode mode){
+    return reduce_dot<vec_neon<float>>(a, b, n, mode);
+}
+
+/**
+ * @brief NEON Vector Minimum, NaNs skipped
+ */
+float neon_minimum(const float* a, size_t n){
+    return reduce_extreme<vec_neon<float>, false>(a, 0, n);
+}
+
+/**
+ * @brief NEON Vector Maximum, NaNs skipped
+ */
+float neon_maximum(const float* a, size_t n){
+    return reduce_extreme<vec_neon<float>, true>(a, 0, n);
+}
+
+/**
+ * @brief NEON Vector Argmin, the first index of the minimum
+ */
+size_t neon_argmin(const float* a, size_t n){
+    return reduce_arg_extreme<vec_neon<float>, false>(a, n);
+}
+
+/**
+ * @brief NEON Vector Argmax, the first index of the maximum
+ */
+size_t neon_argmax(const float* a, size_t n){
+    return reduce_arg_extreme<vec_neon<float>, true>(a, n);
+}
@@ -0,0 +1,37 @@
+/**
+ * @file neon_sqrt.cpp
+ * @author Sravan Senthilnathan
+ * @brief NEON_SIMD implementation of parallel floating point square roots
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2023
+ * 
+ */
+#include "simd_playground.h"
+#include "simd_vec.h"
+#include "recip_driver.h"
+
+/**
+ * @brief NEON accelerated Vector Square Root function, see recip_driver.h:
+ * 
+ * @param a operand array
+ * @param b output array (may alias a)
+ * @param n number of elements
+ * @param mode exact, or the reciprocal square root estimate and Newton-Raphson steps
+ */
+void neon_sqrt(const float* a, float* b, size_t n, simd_div_mode mode){
+    recip_unary<vec_neon<float>, recip_fn::sqrt>(a, b, n, mode);
+}
+
+/**
+ * @brief NEON accelerated Vector Reciprocal Square Root function, see recip_driver.h:
+ * 
+ * @param a operand array
+ * @param b output array (may alias a)
+ * @param n number of elements
+ * @param mode exact, or the reciprocal square root estimate and Newton-Raphson steps
+ */
+void neon_rsqrt(const float* a, float* b, size_t n, simd_div_mode mode){
+    recip_unary<vec_neon<float>, recip_fn::rsqrt>(a, b, n, mode);
+}
@@ -0,0 +1,41 @@
+/**
+ * @file neon_stream.cpp
+ * @author Sravan Senthilnathan
+ * @brief NEON_SIMD elementwise kernels with non-temporal stores
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2023
+ * 
+ */
+#include "simd_playground.h"
+#include "simd_vec.h"
+#include "stream_driver.h"
+
+/**
+ * @brief NEON Vector Addition with streaming stores, see stream_driver.h
+ */
+void neon_add_stream(const float* a, const float* b, float* c, size_t n){
+    stream_run<vec_neon<float>, stream_add>(a, b, c, n);
+}
+
+/**
+ * @brief NEON Vector Subtraction with streaming stores, see stream_driver.h
+ */
+void neon_sub_stream(const float* a, const float* b, float* c, size_t n){
+    stream_run<vec_neon<float>, stream_sub>(a, b, c, n);
+}
+
+/**
+ * @brief NEON Vector Multiply with streaming stores, see stream_driver.h
+ */
+void neon_mul_stream(const float* a, const float* b, float* c, size_t n){
+    stream_run<vec_neon<float>, stream_mul>(a, b, c, n);
+}
+
+/**
+ * @brief NEON Vector Division with streaming stores, see stream_driver.h
+ */
+void neon_div_stream(const float* a, const float* b, float* c, size_t n){
+    stream_run<vec_neon<float>, stream_div>(a, b, c, n);
+}
@@ -0,0 +1,3202 @@
+/**
+ * @file bench.cpp
+ * @author Sravan Senthilnathan
+ * @brief benchmarks the kernels of libsimdplayground on every instruction set level
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2023
+ * 
+ * usage: bench [options] [example...], runs every example when none are given.
+ * 
+ * Each example is swept over a range of sizes (L1 resident up to DRAM
+ * resident by default) and timed on every level from scalar up to the
+ * active one, see harness.h for the method. Options:
+ * 
+ *   --sizes=1k,64k,16m   problem sizes instead of the example's defaults
+ *   --trials=N           timed trials per measurement (25)
+ *   --warmup-ms=N        warmup time per measurement (50)
+ *   --min-trial-ms=N     minimum duration of one trial (2)
+ *   --isa=LEVEL          only time this level
+ *   --ghz=F              core clock, for cycles/element where there is no TSC
+ *   --format=table|csv|json
+ *   --out=FILE
+ *   --verify             check every kernel against its scalar reference instead
+ *   --seed=N             random inputs of --verify (1)
+ */
+#include <iostream>
+#include <vector>
+#include <string>
+#include <cstring>
+#include <cmath>
+#include <cfloat>
+#include <cstdint>
+
+#include "simd_playground.h"
+#include "simd_expr.h"
+#include "harness.h"
+#include "verify.h"
+
+// misc lib:
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <memory>
+#include <limits>
+
+using namespace std;
+
+using vector_kernel = void (*)(const float*, const float*, float*, size_t);
+using tensor_kernel = void (*)(const Tensor, const Tensor, Tensor&);
+
+/**
+ * @brief levels to time: every supported one up to the active level
+ * (SIMD_PLAYGROUND_ISA caps it), or just --isa
+ */
+static vector<simd_isa> bench_levels(const bench_options& opt){
+    static const simd_isa active = simd_active_isa();
+
+    vector<simd_isa> levels;
+    for(int i = 0; i <= (int)simd_isa::neon; ++i){
+        const simd_isa isa = (simd_isa)i;
+        if(!opt.isa.empty() && opt.isa != simd_isa_name(isa)){
+            continue;
+        }
+        if(isa != simd_isa::scalar && isa > active){
+            continue;
+        }
+        if(simd_set_isa(isa)){
+            levels.push_back(isa);
+        }
+    }
+    simd_set_isa(active);
+    return levels;
+}
+
+static void bench_vector(harness& h, const char* name, vector_kernel kernel, size_t n){
+    simd_buffer<float> a(n);
+    simd_buffer<float> b(n);
+    simd_buffer<float> c(n);
+
+    iota(a.begin(), a.end(), 0.9f);
+    iota(b.begin(), b.end(), 0.6f);
+
+    for(simd_isa isa : bench_levels(h.options())){
+        simd_set_isa(isa);
+        h.run(name, simd_isa_name(isa), n, n, 3.0 * n * sizeof(float), [&]{
+            kernel(a.data(), b.data(), c.data(), n);
+            do_not_optimize(c.data());
+        });
+    }
+}
+
+/**
+ * @brief times a simd_parallel_* kernel at the active level; the operands are
+ * placed with simd_parallel_first_touch() like a NUMA aware caller would
+ */
+static void bench_parallel(harness& h, const char* name, vector_kernel kernel, size_t n){
+    simd_buffer<float> a(n);
+    simd_buffer<float> b(n);
+    simd_buffer<float> c(n);
+
+    simd_parallel_first_touch(a.data(), n);
+    simd_parallel_first_touch(b.data(), n);
+    simd_parallel_first_touch(c.data(), n);
+    iota(a.begin(), a.end(), 0.9f);
+    iota(b.begin(), b.end(), 0.6f);
+
+    const string label = string(simd_isa_name(simd_active_isa())) + "/" + to_string(simd_threads()) + "t";
+    h.run(name, label, n, n, 3.0 * n * sizeof(float), [&]{
+        kernel(a.data(), b.data(), c.data(), n);
+        do_not_optimize(c.data());
+    });
+}
+
+static void bench_tensor(harness& h, const char* name, tensor_kernel kernel, size_t n){
+    vector<float> a(16 * n);
+    vector<float> b(16 * n);
+    vector<float> c(16 * n);
+
+    iota(a.begin(), a.end(), 1.0f);
+    iota(b.begin(), b.end(), 2.0f);
+
+    for(simd_isa isa : bench_levels(h.options())){
+        simd_set_isa(isa);
+        h.run(name, simd_isa_name(isa), n, 16.0 * n, 3.0 * 16 * n * sizeof(float), [&]{
+            for(size_t i = 0; i < n; ++i){
+                kernel((const float(*)[4])(a.data() + 16 * i),
+                       (const float(*)[4])(b.data() + 16 * i),
+                       *(Tensor*)(c.data() + 16 * i));
+            }
+            do_not_optimize(c.data());
+        });
+    }
+}
+
+using batch_kernel = void (*)(const Tensor*, const Tensor*, Tensor*, size_t);
+
+/**
+ * @brief n independent 4x4 products per call, reported in million matrices/s
+ * 
+ * @param parallel time the multi-threaded path at the active level only
+ */
+static void bench_batch(harness& h, const char* name, batch_kernel kernel, size_t n, bool parallel){
+    unique_ptr<Tensor[]> a(new Tensor[n]);
+    unique_ptr<Tensor[]> b(new Tensor[n]);
+    unique_ptr<Tensor[]> c(new Tensor[n]);
+
+    if(parallel){
+        simd_parallel_first_touch(&a[0][0][0], 16 * n);
+        simd_parallel_first_touch(&b[0][0][0], 16 * n);
+        simd_parallel_first_touch(&c[0][0][0], 16 * n);
+    }
+    iota(&a[0][0][0], &a[0][0][0] + 16 * n, 1.0f);
+    iota(&b[0][0][0], &b[0][0][0] + 16 * n, 2.0f);
+
+    auto call = [&]{
+        kernel(a.get(), b.get(), c.get(), n);
+        do_not_optimize(c.get());
+    };
+
+    if(parallel){
+        const string label = string(simd_isa_name(simd_active_isa())) + "/" + to_string(simd_threads()) + "t";
+        h.run(name, label, n, 16.0 * n, 3.0 * 16 * n * sizeof(float), "Mmatrices/s", n * 1e-6, call);
+        return;
+    }
+    for(simd_isa isa : bench_levels(h.options())){
+        simd_set_isa(isa);
+        h.run(name, simd_isa_name(isa), n, 16.0 * n, 3.0 * 16 * n * sizeof(float), "Mmatrices/s", n * 1e-6, call);
+    }
+}
+
+static void bench_batch_soa(harness& h, size_t n){
+    // planes a multiple of 4 KiB apart would all compete for the same cache sets:
+    const size_t stride = n + 16;
+
+    vector<float> a(16 * stride);
+    vector<float> b(16 * stride);
+    vector<float> c(16 * stride);
+
+    iota(a.begin(), a.end(), 1.0f);
+    iota(b.begin(), b.end(), 2.0f);
+
+    for(simd_isa isa : bench_levels(h.options())){
+        simd_set_isa(isa);
+        h.run("tensor_mul_batch_soa", simd_isa_name(isa), n, 16.0 * n, 3.0 * 16 * n * sizeof(float),
+              "Mmatrices/s", n * 1e-6, [&]{
+            simd_mul_batch_soa(a.data(), b.data(), c.data(), n, stride);
+            do_not_optimize(c.data());
+        });
+    }
+}
+
+static void bench_conv(harness& h, size_t n){
+    const size_t taps = 16;
+
+    vector<float> x(n);
+    vector<float> f(taps);
+    vector<float> y(n + taps - 1, 0.0f);
+
+    iota(x.begin(), x.end(), 1.0f);
+    iota(f.begin(), f.end(), 1.0f);
+
+    for(simd_isa isa : bench_levels(h.options())){
+        simd_set_isa(isa);
+        h.run("convolution", simd_isa_name(isa), n, y.size(),
+              (x.size() + f.size() + 2.0 * y.size()) * sizeof(float), [&]{
+            simd_conv(x.data(), x.size(), f.data(), f.size(), y.data());
+            do_not_optimize(y.data());
+        });
+    }
+}
+
+static const char* conv_method_name(simd_conv_method m){
+    switch(m){
+        case simd_conv_method::automatic:   return "automatic";
+        case simd_conv_method::direct:      return "direct";
+        case simd_conv_method::overlap_add: return "overlap_add";
+        case simd_conv_method::fft:         return "fft";
+    }
+    return "?";
+}
+
+/**
+ * @brief every method of simd_convolve() at the active level for a signal of
+ * n samples and filters of 16, 256 and 4096 taps, the automatic choice
+ * marked with a *; direct convolutions of more than 2^26 products are skipped
+ */
+static void bench_conv_engine(harness& h, size_t n){
+    for(size_t taps : {16, 256, 4096}){
+        vector<float> x(n), f(taps), y(n + taps - 1);
+        for(size_t i = 0; i < n; ++i){
+            x[i] = (float)(i % 31) * 0.0625f - 1.0f;
+        }
+        for(size_t i = 0; i < taps; ++i){
+            f[i] = 1.0f / (float)(i + 1);
+        }
+
+        const string kernel = "conv_engine/" + to_string(taps);
+        const simd_conv_method chosen = simd_conv_choice(n, taps);
+        for(simd_conv_method m : {simd_conv_method::direct, simd_conv_method::overlap_add, simd_conv_method::fft}){
+            if(m == simd_conv_method::direct && (double)n * taps > (double)(1 << 26)){
+                continue;
+            }
+            const string label = string(simd_isa_name(simd_active_isa())) + "/" + conv_method_name(m)
+                               + (m == chosen ? "*" : "");
+            h.run(kernel, label, n, y.size(), (x.size() + f.size() + 2.0 * y.size()) * sizeof(float),
+                  "Msamples/s", n * 1e-6, [&]{
+                simd_convolve(x.data(), n, f.data(), taps, y.data(), m);
+                do_not_optimize(y.data());
+            });
+        }
+    }
+}
+
+/**
+ * @brief one chunk of n samples per call through a simd_fir of 16 and 256
+ * taps, the input walking through a longer signal; p99 is the per chunk
+ * latency bound
+ */
+static void bench_fir_stream(harness& h, size_t n){
+    const size_t chunks = 64;
+    vector<float> x(n * chunks), out(n);
+    for(size_t i = 0; i < x.size(); ++i){
+        x[i] = (float)(i % 29) * 0.0625f - 0.875f;
+    }
+
+    for(size_t taps : {16, 256}){
+        vector<float> f(taps);
+        for(size_t i = 0; i < taps; ++i){
+            f[i] = 1.0f / (float)(i + 1);
+        }
+
+        for(simd_isa isa : bench_levels(h.options())){
+            simd_set_isa(isa);
+            simd_fir fir(f.data(), taps, n);
+            size_t chunk = 0;
+            h.run("fir_stream/" + to_string(taps), simd_isa_name(isa), n, n,
+                  2.0 * n * sizeof(float), "Msamples/s", n * 1e-6, [&]{
+                fir.process(x.data() + chunk * n, out.data(), n);
+                chunk = (chunk + 1) % chunks;
+                do_not_optimize(out.data());
+            });
+        }
+    }
+}
+
+/**
+ * @brief simd_add with regular and with non-temporal stores, forced through
+ * the streaming threshold; * marks what the default threshold picks
+ */
+static void bench_stream(harness& h, size_t n){
+    simd_buffer<float> a(n), b(n), c(n);
+    iota(a.begin(), a.end(), 0.9f);
+    iota(b.begin(), b.end(), 0.6f);
+
+    const size_t threshold = simd_streaming_threshold();
+    for(simd_isa isa : bench_levels(h.options())){
+        simd_set_isa(isa);
+        for(bool stream : {false, true}){
+            simd_set_streaming_threshold(stream ? 0 : SIZE_MAX);
+            const bool automatic = (n >= threshold) == stream;
+            const string label = string(simd_isa_name(isa)) + (stream ? "/stream" : "/cached") + (automatic ? "*" : "");
+            h.run("vec_add_stream", label, n, n, 3.0 * n * sizeof(float), [&]{
+                simd_add(a.data(), b.data(), c.data(), n);
+                do_not_optimize(c.data());
+            });
+        }
+    }
+    simd_set_streaming_threshold(threshold);
+}
+
+/**
+ * @brief the reductions per summation mode; the bytes are the operands
+ * read once (one array for sum and argmax, two for dot)
+ */
+static void bench_reduce(harness& h, size_t n){
+    simd_buffer<float> a(n), b(n);
+    iota(a.begin(), a.end(), 0.9f);
+    iota(b.begin(), b.end(), 0.6f);
+
+    const pair<const char*, simd_sum_mode> modes[] = {
+        {"fast", simd_sum_mode::fast},
+        {"pairwise", simd_sum_mode::pairwise},
+        {"compensated", simd_sum_mode::compensated},
+    };
+    for(simd_isa isa : bench_levels(h.options())){
+        simd_set_isa(isa);
+        for(const auto& m : modes){
+            h.run(string("sum/") + m.first, simd_isa_name(isa), n, n, 1.0 * n * sizeof(float), [&]{
+                float s = simd_sum(a.data(), n, m.second);
+                do_not_optimize(&s);
+            });
+        }
+        for(const auto& m : modes){
+            h.run(string("dot/") + m.first, simd_isa_name(isa), n, n, 2.0 * n * sizeof(float), [&]{
+                float s = simd_dot(a.data(), b.data(), n, m.second);
+                do_not_optimize(&s);
+            });
+        }
+        h.run("argmax", simd_isa_name(isa), n, n, 1.0 * n * sizeof(float), [&]{
+            size_t i = simd_argmax(a.data(), n);
+            do_not_optimize(&i);
+        });
+    }
+}
+
+/**
+ * @brief largest relative difference of got from ref, relative to the
+ * largest magnitude of ref (so cancellation near zero does not dominate)
+ */
+static double relative_error(const float* ref, const float* got, size_t n){
+    double err = 0.0, scale = 0.0;
+    for(size_t i = 0; i < n; ++i){
+        err = max(err, fabs((double)got[i] - ref[i]));
+        scale = max(scale, fabs((double)ref[i]));
+    }
+    return scale > 0.0 ? err / scale : err;
+}
+
+static const pair<const char*, simd_half_format> half_formats[] = {
+    {"fp16", simd_half_format::fp16},
+    {"bf16", simd_half_format::bf16},
+};
+
+/**
+ * @brief vector add and dot product on float, FP16 and BF16 storage; the
+ * half variants report their error relative to the float kernel on the
+ * same (unrounded) inputs
+ */
+static void bench_vec_half(harness& h, size_t n){
+    simd_buffer<float> a(n), b(n), c(n), wide(n);
+    simd_buffer<uint16_t> ah(n), bh(n), ch(n);
+    for(size_t i = 0; i < n; ++i){
+        a[i] = 0.5f + (i % 1000) * 0.0015f;
+        b[i] = 2.0f - (i % 777) * 0.0013f;
+    }
+
+    for(simd_isa isa : bench_levels(h.options())){
+        simd_set_isa(isa);
+        h.run("add/fp32", simd_isa_name(isa), n, n, 3.0 * n * sizeof(float), [&]{
+            simd_add(a.data(), b.data(), c.data(), n);
+            do_not_optimize(c.data());
+        });
+        for(const auto& f : half_formats){
+            simd_to_half(a.data(), ah.data(), n, f.second);
+            simd_to_half(b.data(), bh.data(), n, f.second);
+            simd_add_half(ah.data(), bh.data(), ch.data(), n, f.second);
+            simd_from_half(ch.data(), wide.data(), n, f.second);
+            h.set_error("rel err vs fp32", relative_error(c.data(), wide.data(), n));
+            h.run(string("add/") + f.first, simd_isa_name(isa), n, n, 3.0 * n * sizeof(uint16_t), [&]{
+                simd_add_half(ah.data(), bh.data(), ch.data(), n, f.second);
+                do_not_optimize(ch.data());
+            });
+        }
+
+        h.run("dot/fp32", simd_isa_name(isa), n, n, 2.0 * n * sizeof(float), [&]{
+            float s = simd_dot(a.data(), b.data(), n);
+            do_not_optimize(&s);
+        });
+        const float dot32 = simd_dot(a.data(), b.data(), n);
+        for(const auto& f : half_formats){
+            simd_to_half(a.data(), ah.data(), n, f.second);
+            simd_to_half(b.data(), bh.data(), n, f.second);
+            const float dot16 = simd_dot_half(ah.data(), bh.data(), n, f.second);
+            h.set_error("rel err vs fp32", relative_error(&dot32, &dot16, 1));
+            h.run(string("dot/") + f.first, simd_isa_name(isa), n, n, 2.0 * n * sizeof(uint16_t), [&]{
+                float s = simd_dot_half(ah.data(), bh.data(), n, f.second);
+                do_not_optimize(&s);
+            });
+        }
+    }
+}
+
+/**
+ * @brief 16 tap convolution on float, FP16 and BF16 operands (the output
+ * is float either way), with the error relative to the float convolution
+ */
+static void bench_conv_half(harness& h, size_t n){
+    const size_t taps = 16;
+    vector<float> x(n), f(taps), y(n + taps - 1), wide(n + taps - 1);
+    vector<uint16_t> xh(n), fh(taps);
+    for(size_t i = 0; i < n; ++i){
+        x[i] = sinf(0.01f * i);
+    }
+    for(size_t k = 0; k < taps; ++k){
+        f[k] = 1.0f / (k + 1);
+    }
+
+    for(simd_isa isa : bench_levels(h.options())){
+        simd_set_isa(isa);
+        h.run("conv/fp32", simd_isa_name(isa), n, y.size(),
+              (x.size() + f.size() + 2.0 * y.size()) * sizeof(float), [&]{
+            simd_conv(x.data(), x.size(), f.data(), f.size(), y.data());
+            do_not_optimize(y.data());
+        });
+        fill(y.begin(), y.end(), 0.0f);
+        simd_conv(x.data(), x.size(), f.data(), f.size(), y.data());
+
+        for(const auto& fmt : half_formats){
+            simd_to_half(x.data(), xh.data(), n, fmt.second);
+            simd_to_half(f.data(), fh.data(), taps, fmt.second);
+            fill(wide.begin(), wide.end(), 0.0f);
+            simd_conv_half(xh.data(), n, fh.data(), taps, wide.data(), fmt.second);
+            h.set_error("rel err vs fp32", relative_error(y.data(), wide.data(), y.size()));
+            h.run(string("conv/") + fmt.first, simd_isa_name(isa), n, y.size(),
+                  (x.size() + f.size()) * sizeof(uint16_t) + 2.0 * y.size() * sizeof(float), [&]{
+                simd_conv_half(xh.data(), n, fh.data(), taps, wide.data(), fmt.second);
+                do_not_optimize(wide.data());
+            });
+        }
+    }
+}
+
+/**
+ * @brief integer add/mul (wrapping and saturating) and 8 bit dot products
+ * next to the float kernels the data would otherwise be widened for
+ */
+static void bench_vec_int(harness& h, size_t n){
+    simd_buffer<float> af(n), bf(n), cf(n);
+    simd_buffer<uint8_t> a8(n), b8(n), c8(n);
+    simd_buffer<int8_t> w8(n);
+    simd_buffer<int16_t> a16(n), b16(n), c16(n);
+    simd_buffer<int32_t> a32(n), b32(n), c32(n);
+    for(size_t i = 0; i < n; ++i){
+        af[i] = (float)(i % 1000);
+        bf[i] = (float)(i % 777);
+        a8[i] = (uint8_t)(i * 7);
+        b8[i] = (uint8_t)(i * 13);
+        w8[i] = (int8_t)(i * 5);
+        a16[i] = (int16_t)(i * 97);
+        b16[i] = (int16_t)(i * 31);
+        a32[i] = (int32_t)(i * 40503u);
+        b32[i] = (int32_t)(i * 2654435761u);
+    }
+    const simd_overflow sat = simd_overflow::saturate;
+
+    for(simd_isa isa : bench_levels(h.options())){
+        simd_set_isa(isa);
+        const char* level = simd_isa_name(isa);
+        h.run("add/fp32", level, n, n, 3.0 * n * sizeof(float), [&]{
+            simd_add(af.data(), bf.data(), cf.data(), n);
+            do_not_optimize(cf.data());
+        });
+        h.run("add/i16", level, n, n, 3.0 * n * sizeof(int16_t), [&]{
+            simd_add(a16.data(), b16.data(), c16.data(), n);
+            do_not_optimize(c16.data());
+        });
+        h.run("add_sat/i16", level, n, n, 3.0 * n * sizeof(int16_t), [&]{
+            simd_add(a16.data(), b16.data(), c16.data(), n, sat);
+            do_not_optimize(c16.data());
+        });
+        h.run("mul_sat/i16", level, n, n, 3.0 * n * sizeof(int16_t), [&]{
+            simd_mul(a16.data(), b16.data(), c16.data(), n, sat);
+            do_not_optimize(c16.data());
+        });
+        h.run("add_sat/u8", level, n, n, 3.0 * n, [&]{
+            simd_add(a8.data(), b8.data(), c8.data(), n, sat);
+            do_not_optimize(c8.data());
+        });
+        h.run("mul/u8", level, n, n, 3.0 * n, [&]{
+            simd_mul(a8.data(), b8.data(), c8.data(), n);
+            do_not_optimize(c8.data());
+        });
+        h.run("add_sat/i32", level, n, n, 3.0 * n * sizeof(int32_t), [&]{
+            simd_add(a32.data(), b32.data(), c32.data(), n, sat);
+            do_not_optimize(c32.data());
+        });
+        h.run("mul_sat/i32", level, n, n, 3.0 * n * sizeof(int32_t), [&]{
+            simd_mul(a32.data(), b32.data(), c32.data(), n, sat);
+            do_not_optimize(c32.data());
+        });
+        h.run("dot/fp32", level, n, n, 2.0 * n * sizeof(float), [&]{
+            float s = simd_dot(af.data(), bf.data(), n);
+            do_not_optimize(&s);
+        });
+        h.run("dot/u8*s8", level, n, n, 2.0 * n, [&]{
+            int64_t s = simd_dot(a8.data(), w8.data(), n);
+            do_not_optimize(&s);
+        });
+        h.run("dot/s8*s8", level, n, n, 2.0 * n, [&]{
+            int64_t s = simd_dot(reinterpret_cast<const int8_t*>(a8.data()), w8.data(), n);
+            do_not_optimize(&s);
+        });
+    }
+}
+
+/**
+ * @brief 16 tap convolution on float and on uint8/int8 operands quantized
+ * per tensor, with the error of the dequantized output relative to the
+ * float convolution
+ */
+static void bench_conv_quant(harness& h, size_t n){
+    const size_t taps = 16, l = n + taps - 1;
+    vector<float> x(n), f(taps), y(l), wide(l);
+    vector<uint8_t> xq(n), yq(l);
+    vector<int8_t> fq(taps);
+    for(size_t i = 0; i < n; ++i){
+        x[i] = sinf(0.01f * i);
+    }
+    for(size_t k = 0; k < taps; ++k){
+        f[k] = 1.0f / (k + 1);
+    }
+
+    // x in [-1, 1] around 128, the filter symmetric around 0, y from its float range:
+    const simd_quant x_quant = {1.0f / 127.0f, 128}, f_quant = {1.0f / 127.0f, 0};
+    fill(y.begin(), y.end(), 0.0f);
+    conv(x.data(), n, f.data(), taps, y.data());
+    const float y_max = max(*max_element(y.begin(), y.end()), -*min_element(y.begin(), y.end()));
+    const simd_quant y_quant = {y_max / 127.0f, 128};
+    for(size_t i = 0; i < n; ++i){
+        xq[i] = (uint8_t)(lrintf(x[i] / x_quant.scale) + x_quant.zero_point);
+    }
+    for(size_t k = 0; k < taps; ++k){
+        fq[k] = (int8_t)lrintf(f[k] / f_quant.scale);
+    }
+
+    for(simd_isa isa : bench_levels(h.options())){
+        simd_set_isa(isa);
+        h.run("conv/fp32", simd_isa_name(isa), n, l, (n + taps + 2.0 * l) * sizeof(float), [&]{
+            simd_conv(x.data(), n, f.data(), taps, y.data());
+            do_not_optimize(y.data());
+        });
+        fill(y.begin(), y.end(), 0.0f);
+        simd_conv(x.data(), n, f.data(), taps, y.data());
+
+        simd_conv_quant(xq.data(), n, x_quant, fq.data(), taps, f_quant, yq.data(), y_quant);
+        for(size_t i = 0; i < l; ++i){
+            wide[i] = y_quant.scale * (yq[i] - y_quant.zero_point);
+        }
+        h.set_error("rel err vs fp32", relative_error(y.data(), wide.data(), l));
+        h.run("conv/u8*s8", simd_isa_name(isa), n, l, n + taps + 1.0 * l, [&]{
+            simd_conv_quant(xq.data(), n, x_quant, fq.data(), taps, f_quant, yq.data(), y_quant);
+            do_not_optimize(yq.data());
+        });
+    }
+}
+
+/**
+ * @brief double precision elementwise kernels next to their float versions
+ */
+static void bench_vec_f64(harness& h, size_t n){
+    simd_buffer<float> af(n), bf(n), cf(n);
+    simd_buffer<double> a(n), b(n), c(n), d(n);
+    iota(af.begin(), af.end(), 0.9f);
+    iota(bf.begin(), bf.end(), 0.6f);
+    iota(a.begin(), a.end(), 0.9);
+    iota(b.begin(), b.end(), 0.6);
+    iota(c.begin(), c.end(), 0.3);
+
+    for(simd_isa isa : bench_levels(h.options())){
+        simd_set_isa(isa);
+        const char* level = simd_isa_name(isa);
+        h.run("add/fp32", level, n, n, 3.0 * n * sizeof(float), [&]{
+            simd_add(af.data(), bf.data(), cf.data(), n);
+            do_not_optimize(cf.data());
+        });
+        h.run("add/fp64", level, n, n, 3.0 * n * sizeof(double), [&]{
+            simd_add(a.data(), b.data(), d.data(), n);
+            do_not_optimize(d.data());
+        });
+        h.run("mul/fp64", level, n, n, 3.0 * n * sizeof(double), [&]{
+            simd_mul(a.data(), b.data(), d.data(), n);
+            do_not_optimize(d.data());
+        });
+        h.run("div/fp32", level, n, n, 3.0 * n * sizeof(float), [&]{
+            simd_div(af.data(), bf.data(), cf.data(), n);
+            do_not_optimize(cf.data());
+        });
+        h.run("div/fp64", level, n, n, 3.0 * n * sizeof(double), [&]{
+            simd_div(a.data(), b.data(), d.data(), n);
+            do_not_optimize(d.data());
+        });
+        h.run("mul_add/fp64", level, n, n, 4.0 * n * sizeof(double), [&]{
+            simd_mul_add(a.data(), b.data(), c.data(), d.data(), n);
+            do_not_optimize(d.data());
+        });
+    }
+}
+
+/**
+ * @brief n double precision 4x4 sums and products per call, and the float
+ * product for comparison
+ */
+static void bench_tensor_f64(harness& h, size_t n){
+    vector<float> af(16 * n), bf(16 * n), cf(16 * n);
+    vector<double> a(16 * n), b(16 * n), c(16 * n);
+    iota(af.begin(), af.end(), 1.0f);
+    iota(bf.begin(), bf.end(), 2.0f);
+    iota(a.begin(), a.end(), 1.0);
+    iota(b.begin(), b.end(), 2.0);
+
+    for(simd_isa isa : bench_levels(h.options())){
+        simd_set_isa(isa);
+        const char* level = simd_isa_name(isa);
+        h.run("tensor_mul/fp32", level, n, 16.0 * n, 3.0 * 16 * n * sizeof(float), [&]{
+            for(size_t i = 0; i < n; ++i){
+                simd_mul((const float(*)[4])(af.data() + 16 * i), (const float(*)[4])(bf.data() + 16 * i),
+                         *(Tensor*)(cf.data() + 16 * i));
+            }
+            do_not_optimize(cf.data());
+        });
+        h.run("tensor_add/fp64", level, n, 16.0 * n, 3.0 * 16 * n * sizeof(double), [&]{
+            for(size_t i = 0; i < n; ++i){
+                simd_add((const double(*)[4])(a.data() + 16 * i), (const double(*)[4])(b.data() + 16 * i),
+                         *(Tensor64*)(c.data() + 16 * i));
+            }
+            do_not_optimize(c.data());
+        });
+        h.run("tensor_mul/fp64", level, n, 16.0 * n, 3.0 * 16 * n * sizeof(double), [&]{
+            for(size_t i = 0; i < n; ++i){
+                simd_mul((const double(*)[4])(a.data() + 16 * i), (const double(*)[4])(b.data() + 16 * i),
+                         *(Tensor64*)(c.data() + 16 * i));
+            }
+            do_not_optimize(c.data());
+        });
+    }
+}
+
+/**
+ * @brief 16 tap direct convolution in double and in float precision
+ */
+static void bench_conv_f64(harness& h, size_t n){
+    const size_t taps = 16, l = n + taps - 1;
+    vector<float> xf(n), ff(taps), yf(l, 0.0f);
+    vector<double> x(n), f(taps), y(l, 0.0);
+    iota(xf.begin(), xf.end(), 1.0f);
+    iota(ff.begin(), ff.end(), 1.0f);
+    iota(x.begin(), x.end(), 1.0);
+    iota(f.begin(), f.end(), 1.0);
+
+    for(simd_isa isa : bench_levels(h.options())){
+        simd_set_isa(isa);
+        h.run("conv/fp32", simd_isa_name(isa), n, l, (n + taps + 2.0 * l) * sizeof(float), [&]{
+            simd_conv(xf.data(), n, ff.data(), taps, yf.data());
+            do_not_optimize(yf.data());
+        });
+        h.run("conv/fp64", simd_isa_name(isa), n, l, (n + taps + 2.0 * l) * sizeof(double), [&]{
+            simd_conv(x.data(), n, f.data(), taps, y.data());
+            do_not_optimize(y.data());
+        });
+    }
+}
+
+/**
+ * @brief d = a * b + c - e fused through simd_expr.h against the chain of
+ * whole array kernels through a temporary; the bytes are what each moves
+ * per result: 5 floats fused, 9 chained (3 per kernel)
+ */
+static void bench_expr(harness& h, size_t n){
+    vector<float> a(n), b(n), c(n), e(n), d(n), t(n);
+    iota(a.begin(), a.end(), 0.9f);
+    iota(b.begin(), b.end(), 0.6f);
+    iota(c.begin(), c.end(), 0.3f);
+    iota(e.begin(), e.end(), 0.1f);
+
+    for(simd_isa isa : bench_levels(h.options())){
+        simd_set_isa(isa);
+        h.run("expr/fused", simd_isa_name(isa), n, n, 5.0 * n * sizeof(float),
+              "Mresults/s", n * 1e-6, [&]{
+            simd_dest(d.data(), n) = simd_ref(a.data()) * simd_ref(b.data()) + simd_ref(c.data()) - simd_ref(e.data());
+            do_not_optimize(d.data());
+        });
+        h.run("expr/chain", simd_isa_name(isa), n, n, 9.0 * n * sizeof(float),
+              "Mresults/s", n * 1e-6, [&]{
+            simd_mul(a.data(), b.data(), t.data(), n);
+            simd_add(t.data(), c.data(), t.data(), n);
+            simd_sub(t.data(), e.data(), d.data(), n);
+            do_not_optimize(d.data());
+        });
+    }
+}
+
+/**
+ * @brief a request that needs three temporaries of n floats, d = (a + b) * b
+ * - a, through std::vector, simd_buffer and the scratch arena; the
+ * temporaries are allocated and freed on every call, so the difference is
+ * what the allocations (and std::vector's zeroing) cost
+ */
+static void bench_alloc(harness& h, size_t n){
+    simd_buffer<float> a(n), b(n), d(n);
+    iota(a.begin(), a.end(), 0.9f);
+    iota(b.begin(), b.end(), 0.6f);
+
+    auto request = [&](float* t0, float* t1, float* t2){
+        simd_add(a.data(), b.data(), t0, n);
+        simd_mul(t0, b.data(), t1, n);
+        simd_sub(t1, a.data(), t2, n);
+        simd_add(t2, t0, d.data(), n);
+        do_not_optimize(d.data());
+    };
+
+    const string isa = simd_isa_name(simd_active_isa());
+    h.run("alloc", isa + "/vector", n, n, 12.0 * n * sizeof(float), "Krequests/s", 1e-3, [&]{
+        vector<float> t0(n), t1(n), t2(n);
+        request(t0.data(), t1.data(), t2.data());
+    });
+    h.run("alloc", isa + "/buffer", n, n, 12.0 * n * sizeof(float), "Krequests/s", 1e-3, [&]{
+        simd_buffer<float> t0(n), t1(n), t2(n);
+        request(t0.data(), t1.data(), t2.data());
+    });
+    h.run("alloc", isa + "/arena", n, n, 12.0 * n * sizeof(float), "Krequests/s", 1e-3, [&]{
+        simd_arena& scratch = simd_scratch();
+        simd_arena_scope scope(scratch);
+        request(scratch.alloc<float>(n), scratch.alloc<float>(n), scratch.alloc<float>(n));
+    });
+}
+
+/**
+ * @brief square n x n products, reported in GFLOP/s; scalar and SSE run the
+ * naive reference, which is only timed up to n = 512 (beyond that it takes
+ * seconds per call)
+ */
+static void bench_sgemm(harness& h, size_t n){
+    vector<float> a(n * n);
+    vector<float> b(n * n);
+    vector<float> c(n * n, 0.0f);
+
+    for(size_t i = 0; i < n * n; ++i){
+        a[i] = (float)(i % 17) * 0.125f - 1.0f;
+        b[i] = (float)(i % 13) * 0.25f - 1.5f;
+    }
+
+    for(simd_isa isa : bench_levels(h.options())){
+        if((isa == simd_isa::scalar || isa == simd_isa::generic || isa == simd_isa::sse) && n > 512){
+            continue;
+        }
+        simd_set_isa(isa);
+        h.run("sgemm", simd_isa_name(isa), n, (double)n * n, 4.0 * n * n * sizeof(float),
+              "GFLOP/s", 2.0 * n * n * n * 1e-9, [&]{
+            simd_sgemm(false, false, n, n, n, 1.0f, a.data(), n, b.data(), n, 0.0f, c.data(), n);
+            do_not_optimize(c.data());
+        });
+    }
+}
+
+/**
+ * @brief short vectors with the vector and the scalar tails (see
+ * simd_set_tail()): below 2 W most of the work is the tail
+ */
+static void bench_vec_tail(harness& h, size_t n){
+    simd_buffer<float> a(n), b(n), c(n), d(n);
+    simd_buffer<double> ad(n), bd(n), cd(n), dd(n);
+    iota(a.begin(), a.end(), 0.9f);
+    iota(b.begin(), b.end(), 0.6f);
+    iota(c.begin(), c.end(), 0.3f);
+    iota(ad.begin(), ad.end(), 0.9);
+    iota(bd.begin(), bd.end(), 0.6);
+    iota(cd.begin(), cd.end(), 0.3);
+
+    const simd_tail tail = simd_tail_handling();
+    for(simd_isa isa : bench_levels(h.options())){
+        simd_set_isa(isa);
+        for(simd_tail mode : {simd_tail::scalar, simd_tail::vector}){
+            simd_set_tail(mode);
+            const string label = string(simd_isa_name(isa)) + (mode == simd_tail::vector ? "/vector" : "/scalar");
+            h.run("add/fp32", label, n, n, 3.0 * n * sizeof(float), [&]{
+                simd_add(a.data(), b.data(), d.data(), n);
+                do_not_optimize(d.data());
+            });
+            h.run("mul_add/fp32", label, n, n, 4.0 * n * sizeof(float), [&]{
+                simd_mul_add(a.data(), b.data(), c.data(), d.data(), n);
+                do_not_optimize(d.data());
+            });
+            h.run("add/fp64", label, n, n, 3.0 * n * sizeof(double), [&]{
+                simd_add(ad.data(), bd.data(), dd.data(), n);
+                do_not_optimize(dd.data());
+            });
+            h.run("mul_add/fp64", label, n, n, 4.0 * n * sizeof(double), [&]{
+                simd_mul_add(ad.data(), bd.data(), cd.data(), dd.data(), n);
+                do_not_optimize(dd.data());
+            });
+            h.run("dot/fp32", label, n, n, 2.0 * n * sizeof(float), [&]{
+                float r = simd_dot(a.data(), b.data(), n);
+                do_not_optimize(&r);
+            });
+        }
+    }
+    simd_set_tail(tail);
+}
+
+using math_kernel = void (*)(const float*, float*, size_t, simd_math_mode);
+
+static const pair<const char*, math_kernel> math_kernels[] = {
+    {"exp", simd_exp},
+    {"log", simd_log},
+    {"sin", simd_sin},
+    {"cos", simd_cos},
+    {"tanh", simd_tanh},
+    {"sigmoid", simd_sigmoid},
+    {"erf", simd_erf},
+};
+
+/**
+ * @brief the elementwise math functions in precise and fast mode; the
+ * scalar level is the C library in double precision
+ */
+static void bench_math(harness& h, size_t n){
+    simd_buffer<float> a(n), b(n), c(n);
+    for(size_t i = 0; i < n; ++i){
+        a[i] = 0.01f + 10.0f * (float)((i * 7919) % n) / (float)n;
+        b[i] = -4.0f + 8.0f * (float)((i * 104729) % n) / (float)n;
+    }
+
+    for(simd_isa isa : bench_levels(h.options())){
+        simd_set_isa(isa);
+        for(simd_math_mode mode : {simd_math_mode::precise, simd_math_mode::fast}){
+            if(isa == simd_isa::scalar && mode == simd_math_mode::fast){
+                continue;
+            }
+            const string label = string(simd_isa_name(isa)) + (mode == simd_math_mode::fast ? "/fast" : "/precise");
+            for(const auto& k : math_kernels){
+                h.run(k.first, label, n, n, 2.0 * n * sizeof(float), [&]{
+                    k.second(a.data(), c.data(), n, mode);
+                    do_not_optimize(c.data());
+                });
+            }
+            h.run("pow", label, n, n, 3.0 * n * sizeof(float), [&]{
+                simd_pow(a.data(), b.data(), c.data(), n, mode);
+                do_not_optimize(c.data());
+            });
+        }
+    }
+}
+
+static const pair<const char*, simd_div_mode> div_modes[] = {
+    {"exact", simd_div_mode::exact},
+    {"newton2", simd_div_mode::newton2},
+    {"newton1", simd_div_mode::newton1},
+};
+
+/**
+ * @brief division, square root and reciprocal square root in every
+ * simd_div_mode; the scalar level is exact whatever the mode
+ */
+static void bench_recip(harness& h, size_t n){
+    simd_buffer<float> a(n), b(n), c(n);
+    for(size_t i = 0; i < n; ++i){
+        a[i] = 0.01f + 100.0f * (float)((i * 7919) % n) / (float)n;
+        b[i] = 0.5f + 4.0f * (float)((i * 104729) % n) / (float)n;
+    }
+
+    for(simd_isa isa : bench_levels(h.options())){
+        simd_set_isa(isa);
+        for(const auto& m : div_modes){
+            if(isa == simd_isa::scalar && m.second != simd_div_mode::exact){
+                continue;
+            }
+            const string label = string(simd_isa_name(isa)) + "/" + m.first;
+            h.run("div", label, n, n, 3.0 * n * sizeof(float), [&]{
+                simd_div(a.data(), b.data(), c.data(), n, m.second);
+                do_not_optimize(c.data());
+            });
+            h.run("sqrt", label, n, n, 2.0 * n * sizeof(float), [&]{
+                simd_sqrt(a.data(), c.data(), n, m.second);
+                do_not_optimize(c.data());
+            });
+            h.run("rsqrt", label, n, n, 2.0 * n * sizeof(float), [&]{
+                simd_rsqrt(a.data(), c.data(), n, m.second);
+                do_not_optimize(c.data());
+            });
+        }
+    }
+}
+
+static const pair<const char*, simd_activation> layer_activations[] = {
+    {"relu", simd_activation::relu},
+    {"gelu", simd_activation::gelu},
+    {"gelu_tanh", simd_activation::gelu_tanh},
+};
+
+// rows of the batches the layer kernels are timed on:
+static constexpr size_t layer_rows = 256;
+
+/**
+ * @brief the fused row kernels on layer_rows rows of n floats, next to
+ * softmax and layer norm chained from the elementwise kernels (a pass
+ * per step, the broadcast operands filled per row), and the
+ * multi-threaded versions at the active level
+ */
+static void bench_layers(harness& h, size_t n){
+    const size_t rows = layer_rows, total = rows * n;
+    simd_buffer<float> x(total), y(total), gamma(n), beta(n), bias(n), t(n);
+    for(size_t i = 0; i < total; ++i){
+        x[i] = -8.0f + 16.0f * (float)((i * 7919) % total) / (float)total;
+    }
+    for(size_t i = 0; i < n; ++i){
+        gamma[i] = 0.5f + (float)((i * 104729) % n) / (float)n;
+        beta[i] = -0.25f + 0.5f * (float)((i * 7919) % n) / (float)n;
+        bias[i] = beta[i];
+    }
+    const double bytes = 2.0 * total * sizeof(float);
+
+    auto softmax_chained = [&]{
+        for(size_t r = 0; r < rows; ++r){
+            const float* xr = x.data() + r * n;
+            float* yr = y.data() + r * n;
+            fill_n(t.data(), n, -simd_maximum(xr, n));
+            simd_add(xr, t.data(), yr, n);
+            simd_exp(yr, yr, n);
+            fill_n(t.data(), n, 1.0f / simd_sum(yr, n));
+            simd_mul(yr, t.data(), yr, n);
+        }
+        do_not_optimize(y.data());
+    };
+    auto layer_norm_chained = [&]{
+        for(size_t r = 0; r < rows; ++r){
+            const float* xr = x.data() + r * n;
+            float* yr = y.data() + r * n;
+            fill_n(t.data(), n, -simd_sum(xr, n) / (float)n);
+            simd_add(xr, t.data(), yr, n);
+            fill_n(t.data(), n, 1.0f / sqrt(simd_dot(yr, yr, n) / (float)n + 1e-5f));
+            simd_mul(yr, t.data(), yr, n);
+            simd_mul(yr, gamma.data(), yr, n);
+            simd_add(yr, beta.data(), yr, n);
+        }
+        do_not_optimize(y.data());
+    };
+
+    const string threads = string(simd_isa_name(simd_active_isa())) + "/" + to_string(simd_threads()) + "t";
+    h.run("softmax_mt", threads, n, total, bytes, [&]{
+        simd_parallel_softmax(x.data(), y.data(), rows, n);
+        do_not_optimize(y.data());
+    });
+    h.run("layer_norm_mt", threads, n, total, bytes, [&]{
+        simd_parallel_layer_norm(x.data(), gamma.data(), beta.data(), y.data(), rows, n);
+        do_not_optimize(y.data());
+    });
+    h.run("bias_gelu_mt", threads, n, total, bytes, [&]{
+        simd_parallel_bias_activation(x.data(), bias.data(), y.data(), rows, n, simd_activation::gelu);
+        do_not_optimize(y.data());
+    });
+
+    for(simd_isa isa : bench_levels(h.options())){
+        simd_set_isa(isa);
+        const char* label = simd_isa_name(isa);
+        h.run("softmax", label, n, total, bytes, [&]{
+            simd_softmax(x.data(), y.data(), rows, n);
+            do_not_optimize(y.data());
+        });
+        h.run("softmax_chained", label, n, total, bytes, softmax_chained);
+        h.run("log_softmax", label, n, total, bytes, [&]{
+            simd_log_softmax(x.data(), y.data(), rows, n);
+            do_not_optimize(y.data());
+        });
+        h.run("layer_norm", label, n, total, bytes, [&]{
+            simd_layer_norm(x.data(), gamma.data(), beta.data(), y.data(), rows, n);
+            do_not_optimize(y.data());
+        });
+        h.run("layer_norm_chained", label, n, total, bytes, layer_norm_chained);
+        h.run("rms_norm", label, n, total, bytes, [&]{
+            simd_rms_norm(x.data(), gamma.data(), y.data(), rows, n);
+            do_not_optimize(y.data());
+        });
+        for(const auto& a : layer_activations){
+            h.run(string("bias_") + a.first, label, n, total, bytes, [&]{
+                simd_bias_activation(x.data(), bias.data(), y.data(), rows, n, a.second);
+                do_not_optimize(y.data());
+            });
+        }
+    }
+}
+
+// the image the 2D convolutions are timed on (4K UHD):
+static constexpr size_t conv2d_width = 3840, conv2d_height = 2160;
+
+/**
+ * @brief an n x n filter over a 4K image in megapixels per second, the
+ * general and the separable engine (the same Gaussian-like filter) with
+ * reflected borders, and the multi-threaded versions at the active level;
+ * the general filter skips the slowest levels past 5 x 5
+ */
+static void bench_conv2d(harness& h, size_t n){
+    const size_t w = conv2d_width, ht = conv2d_height, pixels = w * ht;
+    simd_buffer<float> x(pixels), y(pixels), f(n * n), fx(n);
+    for(size_t i = 0; i < pixels; ++i){
+        x[i] = (float)((i * 7919) % 256) / 255.0f;
+    }
+    for(size_t j = 0; j < n; ++j){
+        const float d = (float)j - (float)(n / 2);
+        fx[j] = exp(-d * d / (float)(n * n) * 8.0f);
+    }
+    for(size_t i = 0; i < n; ++i){
+        for(size_t j = 0; j < n; ++j){
+            f[i * n + j] = fx[i] * fx[j];
+        }
+    }
+    const double bytes = 2.0 * pixels * sizeof(float);
+    const double mp = pixels * 1e-6;
+    const simd_border border = simd_border::reflect;
+
+    const string threads = string(simd_isa_name(simd_active_isa())) + "/" + to_string(simd_threads()) + "t";
+    h.run("general_mt", threads, n, pixels, bytes, "MP/s", mp, [&]{
+        simd_parallel_conv2d(x.data(), w, ht, w, f.data(), n, n, y.data(), w, border);
+        do_not_optimize(y.data());
+    });
+    h.run("separable_mt", threads, n, pixels, bytes, "MP/s", mp, [&]{
+        simd_parallel_conv2d_separable(x.data(), w, ht, w, fx.data(), n, fx.data(), n, y.data(), w, border);
+        do_not_optimize(y.data());
+    });
+
+    for(simd_isa isa : bench_levels(h.options())){
+        simd_set_isa(isa);
+        const char* label = simd_isa_name(isa);
+        if(!((isa == simd_isa::scalar || isa == simd_isa::generic || isa == simd_isa::sse) && n > 5)){
+            h.run("general", label, n, pixels, bytes, "MP/s", mp, [&]{
+                simd_conv2d(x.data(), w, ht, w, f.data(), n, n, y.data(), w, border);
+                do_not_optimize(y.data());
+            });
+        }
+        h.run("separable", label, n, pixels, bytes, "MP/s", mp, [&]{
+            simd_conv2d_separable(x.data(), w, ht, w, fx.data(), n, fx.data(), n, y.data(), w, border);
+            do_not_optimize(y.data());
+        });
+    }
+}
+
+/**
+ * @brief a square convolution layer on square images, padded to keep the
+ * size at stride 1
+ */
+struct conv_layer_shape {
+    const char* name;
+    size_t channels;
+    size_t size;
+    size_t filters;
+    size_t kernel;
+    size_t stride;
+    size_t groups;
+};
+
+// ResNet-50 layers at 224 x 224 (v1.5, strided on the 3 x 3) and a grouped ResNeXt one:
+static const conv_layer_shape conv_layer_shapes[] = {
+    {"conv1_7x7/2", 3, 224, 64, 7, 2, 1},
+    {"res2_3x3", 64, 56, 64, 3, 1, 1},
+    {"res2_1x1", 64, 56, 256, 1, 1, 1},
+    {"res3_3x3/2", 128, 56, 128, 3, 2, 1},
+    {"res4_3x3", 256, 14, 256, 3, 1, 1},
+    {"res5_1x1", 2048, 7, 512, 1, 1, 1},
+    {"resnext_3x3_g32", 128, 56, 128, 3, 1, 32},
+};
+
+/**
+ * @brief the convolution layers of conv_layer_shapes on batches of n
+ * images in both layouts, in GFLOP/s of the direct convolution (the
+ * padding counted); like sgemm, the slowest levels are skipped
+ */
+static void bench_conv_layer(harness& h, size_t n){
+    for(const auto& shape : conv_layer_shapes){
+        simd_conv_layer l = {n, shape.channels, shape.size, shape.size, shape.filters, shape.kernel, shape.kernel};
+        l.stride_h = l.stride_w = shape.stride;
+        l.pad_h = l.pad_w = shape.kernel / 2;
+        l.groups = shape.groups;
+        const size_t pixels = simd_conv_layer_height(l) * simd_conv_layer_width(l);
+        const size_t k = shape.channels / shape.groups * shape.kernel * shape.kernel;
+        const size_t in = n * shape.channels * shape.size * shape.size, out = n * shape.filters * pixels;
+
+        simd_buffer<float> x(in), w(shape.filters * k), bias(shape.filters), y(out);
+        for(size_t i = 0; i < in; ++i){
+            x[i] = (float)(i % 17) * 0.125f - 1.0f;
+        }
+        for(size_t i = 0; i < w.size(); ++i){
+            w[i] = (float)(i % 13) * 0.0625f - 0.375f;
+        }
+        fill(bias.begin(), bias.end(), 0.5f);
+        const double bytes = (double)(in + w.size() + out) * sizeof(float);
+        const double gflop = 2.0 * out * k * 1e-9;
+
+        for(simd_layout layout : {simd_layout::nchw, simd_layout::nhwc}){
+            l.layout = layout;
+            simd_buffer<float> workspace(max<size_t>(simd_conv_layer_workspace(l), 1));
+            const string name = string(shape.name) + (layout == simd_layout::nchw ? "/nchw" : "/nhwc");
+            for(simd_isa isa : bench_levels(h.options())){
+                if(isa == simd_isa::scalar || isa == simd_isa::generic || isa == simd_isa::sse){
+                    continue;
+                }
+                simd_set_isa(isa);
+                h.run(name, simd_isa_name(isa), n, out, bytes, "GFLOP/s", gflop, [&]{
+                    simd_conv_layer_forward(l, x.data(), w.data(), bias.data(), y.data(), workspace.data());
+                    do_not_optimize(y.data());
+                });
+            }
+        }
+    }
+}
+
+/**
+ * @brief random operand offsets of 0..3 floats, so kernels see every misalignment
+ */
+static size_t random_offset(verifier& v){
+    return uniform_int_distribution<size_t>(0, 3)(v.rng());
+}
+
+static void verify_vector(verifier& v, const bench_options& opt, const char* name,
+                          vector_kernel kernel, vector_kernel reference){
+    for(simd_isa isa : bench_levels(opt)){
+        simd_set_isa(isa);
+        v.begin(name, simd_isa_name(isa));
+
+        for(int trial = 0; trial < 300; ++trial){
+            const size_t n = v.random_size(1100);
+            const size_t oa = random_offset(v), ob = random_offset(v), oc = random_offset(v);
+
+            vector<float> a(n + 4), b(n + 4), c(n + 4), ref(n);
+            v.fill(a.data() + oa, n, -100.0f, 100.0f, true);
+            v.fill(b.data() + ob, n, -100.0f, 100.0f, true);
+
+            reference(a.data() + oa, b.data() + ob, ref.data(), n);
+
+            kernel(a.data() + oa, b.data() + ob, c.data() + oc, n);
+            for(size_t i = 0; i < n; ++i){
+                v.expect_close("n=" + to_string(n), i, ref[i], c[oc + i], 0);
+            }
+
+            // in place, c = a op c:
+            copy_n(b.data() + ob, n, c.data() + oc);
+            kernel(a.data() + oa, c.data() + oc, c.data() + oc, n);
+            for(size_t i = 0; i < n; ++i){
+                v.expect_close("in-place n=" + to_string(n), i, ref[i], c[oc + i], 0);
+            }
+        }
+        v.end();
+    }
+}
+
+/**
+ * @brief the non-temporal variants, forced on for every size: same checks
+ * as verify_vector(), including outputs not aligned to a cache line
+ */
+static void verify_stream(verifier& v, const bench_options& opt){
+    const size_t threshold = simd_streaming_threshold();
+    simd_set_streaming_threshold(0);
+    verify_vector(v, opt, "vec_add_stream", simd_add, add);
+    verify_vector(v, opt, "vec_sub_stream", simd_sub, sub);
+    verify_vector(v, opt, "vec_mul_stream", simd_mul, mul);
+    verify_vector(v, opt, "vec_div_stream", simd_div, div);
+    simd_set_streaming_threshold(threshold);
+}
+
+/**
+ * @brief the pool splits at cache line boundaries and every chunk runs the
+ * single-threaded kernel, so the result has to match the reference exactly
+ */
+static void verify_parallel(verifier& v, const char* name,
+                            vector_kernel kernel, vector_kernel reference){
+    // exercise the pool on every machine, also below the default threshold:
+    const size_t threads = simd_threads();
+    const size_t threshold = simd_parallel_threshold();
+    simd_set_threads(max<size_t>(threads, 4));
+    simd_set_parallel_threshold(0);
+
+    v.begin(name, string(simd_isa_name(simd_active_isa())) + "/" + to_string(simd_threads()) + "t");
+    for(int trial = 0; trial < 100; ++trial){
+        const size_t n = v.random_size(trial < 90 ? 1100 : 300000);
+        const size_t oa = random_offset(v), ob = random_offset(v), oc = random_offset(v);
+
+        vector<float> a(n + 4), b(n + 4), c(n + 4), ref(n);
+        v.fill(a.data() + oa, n, -100.0f, 100.0f, true);
+        v.fill(b.data() + ob, n, -100.0f, 100.0f, true);
+
+        reference(a.data() + oa, b.data() + ob, ref.data(), n);
+
+        kernel(a.data() + oa, b.data() + ob, c.data() + oc, n);
+        for(size_t i = 0; i < n; ++i){
+            v.expect_close("n=" + to_string(n), i, ref[i], c[oc + i], 0);
+        }
+
+        copy_n(b.data() + ob, n, c.data() + oc);
+        kernel(a.data() + oa, c.data() + oc, c.data() + oc, n);
+        for(size_t i = 0; i < n; ++i){
+            v.expect_close("in-place n=" + to_string(n), i, ref[i], c[oc + i], 0);
+        }
+    }
+    v.end();
+
+    simd_set_parallel_threshold(threshold);
+    simd_set_threads(threads);
+}
+
+static void verify_tensor(verifier& v, const bench_options& opt, const char* name,
+                          tensor_kernel kernel, tensor_kernel reference, bool product){
+    for(simd_isa isa : bench_levels(opt)){
+        simd_set_isa(isa);
+        v.begin(name, simd_isa_name(isa));
+
+        for(int trial = 0; trial < 500; ++trial){
+            const size_t oa = random_offset(v), ob = random_offset(v), oc = random_offset(v);
+
+            float a[20], b[20], c[20], ref[16];
+            // products of specials differ legitimately with FMA, keep those finite:
+            v.fill(a + oa, 16, -10.0f, 10.0f, !product);
+            v.fill(b + ob, 16, -10.0f, 10.0f, !product);
+
+            auto ta = (const float(*)[4])(a + oa);
+            auto tb = (const float(*)[4])(b + ob);
+            reference(ta, tb, *(Tensor*)ref);
+            kernel(ta, tb, *(Tensor*)(c + oc));
+
+            for(int i = 0; i < 16; ++i){
+                float scale = 0.0f;
+                if(product){
+                    for(int k = 0; k < 4; ++k){
+                        scale += fabs(ta[i / 4][k] * tb[k][i % 4]);
+                    }
+                }
+                v.expect_close("tensor", i, ref[i], c[oc + i], product ? 4 : 0, scale);
+            }
+        }
+        v.end();
+    }
+}
+
+/**
+ * @brief sum of the absolute products behind element (i, j) of a * b, the
+ * reference scale of the FMA tolerance
+ */
+static float product_scale(const float* a, size_t as, const float* b, size_t bs, int i, int j){
+    float scale = 0.0f;
+    for(int k = 0; k < 4; ++k){
+        scale += fabs(a[(4 * i + k) * as] * b[(4 * k + j) * bs]);
+    }
+    return scale;
+}
+
+static void verify_batch(verifier& v, const bench_options& opt, const char* name,
+                         batch_kernel kernel, bool parallel){
+    const size_t threads = simd_threads();
+    const size_t threshold = simd_parallel_threshold();
+    vector<simd_isa> levels = bench_levels(opt);
+    if(parallel){
+        simd_set_threads(max<size_t>(threads, 4));
+        simd_set_parallel_threshold(0);
+        levels = {simd_active_isa()};
+    }
+
+    for(simd_isa isa : levels){
+        simd_set_isa(isa);
+        v.begin(name, parallel ? string(simd_isa_name(isa)) + "/" + to_string(simd_threads()) + "t"
+                               : string(simd_isa_name(isa)));
+
+        for(int trial = 0; trial < 100; ++trial){
+            const size_t n = v.random_size(trial < 90 ? 40 : 3000);
+            const size_t oa = random_offset(v), ob = random_offset(v), oc = random_offset(v);
+
+            vector<float> a(16 * n + 4), b(16 * n + 4), c(16 * n + 4), ref(16 * n);
+            v.fill(a.data() + oa, 16 * n, -10.0f, 10.0f, false);
+            v.fill(b.data() + ob, 16 * n, -10.0f, 10.0f, false);
+
+            auto ta = (const Tensor*)(a.data() + oa);
+            auto tb = (const Tensor*)(b.data() + ob);
+            mul_batch(ta, tb, (Tensor*)ref.data(), n);
+            kernel(ta, tb, (Tensor*)(c.data() + oc), n);
+
+            for(size_t e = 0; e < 16 * n; ++e){
+                const size_t m = e / 16;
+                const int i = (e % 16) / 4, j = e % 4;
+                const float scale = product_scale(&ta[m][0][0], 1, &tb[m][0][0], 1, i, j);
+                v.expect_close("n=" + to_string(n), e, ref[e], c[oc + e], 4, scale);
+            }
+        }
+        v.end();
+    }
+
+    if(parallel){
+        simd_set_parallel_threshold(threshold);
+        simd_set_threads(threads);
+    }
+}
+
+static void verify_batch_soa(verifier& v, const bench_options& opt){
+    for(simd_isa isa : bench_levels(opt)){
+        simd_set_isa(isa);
+        v.begin("tensor_mul_batch_soa", simd_isa_name(isa));
+
+        for(int trial = 0; trial < 100; ++trial){
+            const size_t n = v.random_size(200);
+            const size_t stride = n + random_offset(v);
+
+            vector<float> a(16 * stride), b(16 * stride), c(16 * stride), ref(16 * stride);
+            v.fill(a.data(), a.size(), -10.0f, 10.0f, false);
+            v.fill(b.data(), b.size(), -10.0f, 10.0f, false);
+
+            mul_batch_soa(a.data(), b.data(), ref.data(), n, stride);
+            simd_mul_batch_soa(a.data(), b.data(), c.data(), n, stride);
+
+            for(int e = 0; e < 16; ++e){
+                for(size_t m = 0; m < n; ++m){
+                    const float scale = product_scale(a.data() + m, stride, b.data() + m, stride, e / 4, e % 4);
+                    v.expect_close("n=" + to_string(n), e * stride + m, ref[e * stride + m], c[e * stride + m], 4, scale);
+                }
+            }
+        }
+        v.end();
+    }
+}
+
+static void verify_conv(verifier& v, const bench_options& opt){
+    const simd_conv_mode modes[] = {simd_conv_mode::full, simd_conv_mode::same, simd_conv_mode::valid};
+    for(simd_isa isa : bench_levels(opt)){
+        simd_set_isa(isa);
+        v.begin("convolution", simd_isa_name(isa));
+
+        for(int trial = 0; trial < 300; ++trial){
+            // short and long filters, either operand the longer one:
+            size_t l1 = 1 + v.random_size(300);
+            size_t l2 = 1 + v.random_size(trial % 4 == 3 ? 300 : 40);
+            if(trial % 8 == 7){
+                swap(l1, l2);
+            }
+            const size_t l = l1 + l2 - 1;
+            const simd_conv_mode mode = modes[trial % 3];
+            const size_t count = simd_conv_size(l1, l2, mode);
+            const size_t first = mode == simd_conv_mode::full ? 0
+                               : mode == simd_conv_mode::same ? (min(l1, l2) - 1) / 2 : min(l1, l2) - 1;
+            const size_t ox = random_offset(v), oh = random_offset(v), oy = random_offset(v);
+
+            vector<float> x(l1 + 4), h(l2 + 4), y(count + 4, 0.0f), ref(l, 0.0f);
+            v.fill(x.data() + ox, l1, -1.0f, 1.0f, false);
+            v.fill(h.data() + oh, l2, -1.0f, 1.0f, false);
+
+            conv(x.data() + ox, l1, h.data() + oh, l2, ref.data());
+            simd_conv(x.data() + ox, l1, h.data() + oh, l2, y.data() + oy, mode);
+
+            static const char* mode_names[] = {"full", "same", "valid"};
+            const string what = string(mode_names[trial % 3]) + " l1=" + to_string(l1) + " l2=" + to_string(l2);
+            for(size_t i = 0; i < count; ++i){
+                const size_t n = first + i;
+                float scale = 0.0f;
+                for(size_t k = 0; k < l1; ++k){
+                    if(n >= k && n - k < l2){
+                        scale += fabs(x[ox + k] * h[oh + n - k]);
+                    }
+                }
+                v.expect_close(what, i, ref[n], y[oy + i], (uint32_t)min(l1, l2) + 2, scale);
+            }
+            // nothing written past the mode's outputs:
+            for(size_t i = count; i + oy < y.size(); ++i){
+                v.expect_close(what + " past the end", i, 0.0f, y[oy + i], 0, 0.0f);
+            }
+        }
+        v.end();
+    }
+}
+
+/**
+ * @brief random shapes, transpositions, padded leading dimensions and
+ * alpha/beta; the larger cases span several cache blocks in every direction
+ */
+static void verify_sgemm(verifier& v, const bench_options& opt){
+    for(simd_isa isa : bench_levels(opt)){
+        simd_set_isa(isa);
+        v.begin("sgemm", simd_isa_name(isa));
+
+        for(int trial = 0; trial < 60; ++trial){
+            const size_t limit = trial < 50 ? 70 : 300;
+            const size_t m = 1 + v.random_size(limit);
+            const size_t n = 1 + v.random_size(limit);
+            const size_t k = 1 + v.random_size(trial < 50 ? limit : 600);
+            const bool ta = v.rng()() & 1, tb = v.rng()() & 1;
+            const float alpha = trial % 3 == 0 ? 1.0f : uniform_real_distribution<float>(-2.0f, 2.0f)(v.rng());
+            const float beta = trial % 4 == 0 ? 0.0f : uniform_real_distribution<float>(-2.0f, 2.0f)(v.rng());
+
+            const size_t lda = (ta ? m : k) + random_offset(v);
+            const size_t ldb = (tb ? k : n) + random_offset(v);
+            const size_t ldc = n + random_offset(v);
+
+            vector<float> a((ta ? k : m) * lda), b((tb ? n : k) * ldb), c(m * ldc), ref;
+            v.fill(a.data(), a.size(), -1.0f, 1.0f, false);
+            v.fill(b.data(), b.size(), -1.0f, 1.0f, false);
+            v.fill(c.data(), c.size(), -1.0f, 1.0f, false);
+            if(beta == 0.0f){
+                // must be overwritten, not scaled:
+                fill(c.begin(), c.end(), numeric_limits<float>::quiet_NaN());
+            }
+            ref = c;
+
+            sgemm(ta, tb, m, n, k, alpha, a.data(), lda, b.data(), ldb, beta, ref.data(), ldc);
+            simd_sgemm(ta, tb, m, n, k, alpha, a.data(), lda, b.data(), ldb, beta, c.data(), ldc);
+
+            const string what = to_string(m) + "x" + to_string(n) + "x" + to_string(k)
+                              + (ta ? " A^T" : "") + (tb ? " B^T" : "");
+            for(size_t i = 0; i < m; ++i){
+                for(size_t j = 0; j < n; ++j){
+                    float scale = beta == 0.0f ? 0.0f : fabs(beta * c[i * ldc + j]);
+                    for(size_t p = 0; p < k; ++p){
+                        scale += fabs(alpha * (ta ? a[p * lda + i] : a[i * lda + p])
+                                            * (tb ? b[j * ldb + p] : b[p * ldb + j]));
+                    }
+                    v.expect_close(what, i * n + j, ref[i * ldc + j], c[i * ldc + j], (uint32_t)k + 4, scale);
+                }
+            }
+            // the padding between rows stays untouched:
+            for(size_t i = 0; i < m; ++i){
+                for(size_t j = n; j < ldc; ++j){
+                    v.expect_close(what + " padding", i * ldc + j, ref[i * ldc + j], c[i * ldc + j], 0);
+                }
+            }
+        }
+        v.end();
+    }
+}
+
+/**
+ * @brief every method against a double precision convolution; the FFT
+ * error is bounded by eps * log2(N) * |x| * |h| (2-norms), not per sample
+ */
+static void verify_conv_engine(verifier& v, const bench_options& opt){
+    const simd_conv_method methods[] = {simd_conv_method::automatic, simd_conv_method::direct,
+                                        simd_conv_method::overlap_add, simd_conv_method::fft};
+    for(simd_isa isa : bench_levels(opt)){
+        simd_set_isa(isa);
+        for(simd_conv_method method : methods){
+            v.begin(string("conv_engine/") + conv_method_name(method), simd_isa_name(isa));
+
+            for(int trial = 0; trial < 40; ++trial){
+                size_t l1 = 1 + v.random_size(trial < 30 ? 300 : 3000);
+                size_t l2 = 1 + v.random_size(trial < 30 ? 100 : 700);
+                if(trial % 2){
+                    swap(l1, l2);
+                }
+                const size_t l = l1 + l2 - 1;
+
+                vector<float> x(l1), h(l2), y(l, 0.0f);
+                v.fill(x.data(), l1, -1.0f, 1.0f, false);
+                v.fill(h.data(), l2, -1.0f, 1.0f, false);
+
+                vector<double> ref(l, 0.0);
+                double nx = 0.0, nh = 0.0;
+                for(size_t i = 0; i < l1; ++i){
+                    nx += (double)x[i] * x[i];
+                    for(size_t k = 0; k < l2; ++k){
+                        ref[i + k] += (double)x[i] * h[k];
+                    }
+                }
+                for(size_t k = 0; k < l2; ++k){
+                    nh += (double)h[k] * h[k];
+                }
+
+                simd_convolve(x.data(), l1, h.data(), l2, y.data(), method);
+
+                const uint32_t bound = 4 * ((uint32_t)log2((double)l) + 5);
+                const string what = "l1=" + to_string(l1) + " l2=" + to_string(l2);
+                for(size_t n = 0; n < l; ++n){
+                    v.expect_close(what, n, (float)ref[n], y[n], bound, (float)sqrt(nx * nh));
+                }
+            }
+            v.end();
+        }
+    }
+}
+
+/**
+ * @brief random chunkings of a signal through simd_fir, process() and
+ * flush() against one simd_conv() of the whole signal, bit for bit
+ */
+static void verify_fir_stream(verifier& v, const bench_options& opt){
+    const size_t max_chunks[] = {1, 7, 64, 4096};
+    for(simd_isa isa : bench_levels(opt)){
+        simd_set_isa(isa);
+        v.begin("fir_stream", simd_isa_name(isa));
+
+        for(int trial = 0; trial < 60; ++trial){
+            const size_t taps = 1 + v.random_size(300);
+            const size_t l = taps + v.random_size(3000);
+            vector<float> x(l), h(taps), ref(l + taps - 1, 0.0f);
+            v.fill(x.data(), l, -1.0f, 1.0f, false);
+            v.fill(h.data(), taps, -1.0f, 1.0f, false);
+            simd_conv(x.data(), l, h.data(), taps, ref.data());
+
+            simd_fir fir(h.data(), taps, max_chunks[trial % 4]);
+            vector<float> y(l + taps - 1);
+            for(size_t done = 0; done < l; ){
+                const size_t n = min(l - done, v.random_size(600));
+                // in place every other chunk:
+                if(done % 2){
+                    copy(x.begin() + done, x.begin() + done + n, y.begin() + done);
+                    fir.process(y.data() + done, y.data() + done, n);
+                }
+                else{
+                    fir.process(x.data() + done, y.data() + done, n);
+                }
+                done += n;
+            }
+            fir.flush(y.data() + l);
+
+            const string what = "taps=" + to_string(taps) + " l=" + to_string(l);
+            for(size_t i = 0; i < y.size(); ++i){
+                v.expect_close(what, i, ref[i], y[i], 0, 0.0f);
+            }
+        }
+        v.end();
+    }
+}
+
+/**
+ * @brief simd_mul_add() against mul_add(), then expressions through
+ * simd_expr.h against a double precision evaluation: with and without
+ * contraction, broadcast numbers, and the destination aliasing an input
+ */
+static void verify_expr(verifier& v, const bench_options& opt){
+    for(simd_isa isa : bench_levels(opt)){
+        simd_set_isa(isa);
+        v.begin("vec_mul_add", simd_isa_name(isa));
+        for(int trial = 0; trial < 300; ++trial){
+            const size_t n = v.random_size(1100);
+            vector<float> a(n), b(n), c(n), d(n), ref(n);
+            v.fill(a.data(), n, -100.0f, 100.0f, false);
+            v.fill(b.data(), n, -100.0f, 100.0f, false);
+            v.fill(c.data(), n, -100.0f, 100.0f, false);
+            mul_add(a.data(), b.data(), c.data(), ref.data(), n);
+
+            simd_mul_add(a.data(), b.data(), c.data(), d.data(), n);
+            for(size_t i = 0; i < n; ++i){
+                // fused or not, at most one rounding apart:
+                v.expect_close("n=" + to_string(n), i, ref[i], d[i], 1, fabs(a[i] * b[i]) + fabs(c[i]));
+            }
+            simd_mul_add(a.data(), b.data(), c.data(), c.data(), n);
+            for(size_t i = 0; i < n; ++i){
+                v.expect_close("in-place n=" + to_string(n), i, d[i], c[i], 0);
+            }
+        }
+        v.end();
+
+        v.begin("expr", simd_isa_name(isa));
+        for(int trial = 0; trial < 100; ++trial){
+            const size_t n = v.random_size(3000);
+            vector<float> a(n), b(n), c(n), e(n), d(n);
+            v.fill(a.data(), n, -10.0f, 10.0f, false);
+            v.fill(b.data(), n, -10.0f, 10.0f, false);
+            v.fill(c.data(), n, -10.0f, 10.0f, false);
+            v.fill(e.data(), n, 1.0f, 10.0f, false);
+            const auto A = simd_ref(a.data()), B = simd_ref(b.data());
+            const auto C = simd_ref(c.data()), E = simd_ref(e.data());
+            const string size = " n=" + to_string(n);
+
+            simd_dest(d.data(), n) = A * B + C - E;
+            for(size_t i = 0; i < n; ++i){
+                const double ref = (double)a[i] * b[i] + c[i] - e[i];
+                v.expect_close("a*b+c-e" + size, i, (float)ref, d[i], 2, fabs(a[i] * b[i]) + fabs(c[i]) + fabs(e[i]));
+            }
+
+            simd_dest(d.data(), n) = C + A * B;
+            for(size_t i = 0; i < n; ++i){
+                const double ref = (double)c[i] + (double)a[i] * b[i];
+                v.expect_close("c+a*b" + size, i, (float)ref, d[i], 2, fabs(a[i] * b[i]) + fabs(c[i]));
+            }
+
+            simd_dest(d.data(), n) = A * B + C * E;
+            for(size_t i = 0; i < n; ++i){
+                const double ref = (double)a[i] * b[i] + (double)c[i] * e[i];
+                v.expect_close("a*b+c*e" + size, i, (float)ref, d[i], 2, fabs(a[i] * b[i]) + fabs(c[i] * e[i]));
+            }
+
+            simd_dest(d.data(), n) = (A + 2.0f) * (0.5f - B) / E;
+            for(size_t i = 0; i < n; ++i){
+                const float ref = (a[i] + 2.0f) * (0.5f - b[i]) / e[i];
+                v.expect_close("(a+2)*(0.5-b)/e" + size, i, ref, d[i], 0);
+            }
+
+            // d = d * b + a, the destination is an input:
+            copy(c.begin(), c.end(), d.begin());
+            simd_dest(d.data(), n) = simd_ref(d.data()) * B + A;
+            for(size_t i = 0; i < n; ++i){
+                const double ref = (double)c[i] * b[i] + a[i];
+                v.expect_close("in-place" + size, i, (float)ref, d[i], 2, fabs(c[i] * b[i]) + fabs(a[i]));
+            }
+
+            simd_dest(d.data(), n) = A;
+            for(size_t i = 0; i < n; ++i){
+                v.expect_close("copy" + size, i, a[i], d[i], 0);
+            }
+        }
+        v.end();
+    }
+}
+
+/**
+ * @brief the reductions against double precision sums, with the error
+ * bound of each mode: fast and pairwise within a few times n or the
+ * block size ulps of the absolute sum, compensated within a few ulps of
+ * the result even where the terms cancel to almost nothing; the extremes
+ * and their indices, with NaNs and infinities in the data, exactly
+ */
+static void verify_reduce(verifier& v, const bench_options& opt){
+    const simd_sum_mode modes[] = {simd_sum_mode::fast, simd_sum_mode::pairwise, simd_sum_mode::compensated};
+    const char* mode_names[] = {"fast", "pairwise", "compensated"};
+    // bound in ulps of the absolute sum for fast and pairwise (blocks of 1024), of n terms:
+    auto sum_ulps = [](simd_sum_mode mode, size_t n){
+        return (uint32_t)(mode == simd_sum_mode::fast ? n / 4 + 8 : min(n, (size_t)1024) / 4 + 32);
+    };
+
+    for(simd_isa isa : bench_levels(opt)){
+        simd_set_isa(isa);
+
+        v.begin("sum", simd_isa_name(isa));
+        for(int trial = 0; trial < 200; ++trial){
+            const size_t n = v.random_size(5000);
+            const size_t oa = random_offset(v);
+            vector<float> a(n + 4);
+            v.fill(a.data() + oa, n, -100.0f, 100.0f, false);
+            double ref = 0.0, scale = 0.0;
+            for(size_t i = 0; i < n; ++i){
+                ref += a[oa + i];
+                scale += fabs(a[oa + i]);
+            }
+            for(int m = 0; m < 3; ++m){
+                const float got = simd_sum(a.data() + oa, n, modes[m]);
+                const string what = string(mode_names[m]) + " n=" + to_string(n);
+                if(modes[m] == simd_sum_mode::compensated){
+                    // one rounding of the result, and the second order term:
+                    v.expect_close(what, 0, (float)ref, got, 2, (float)(n * FLT_EPSILON * scale));
+                }
+                else{
+                    v.expect_close(what, 0, (float)ref, got, sum_ulps(modes[m], n), (float)scale);
+                }
+            }
+        }
+        // ill-conditioned: big terms cancelling in pairs around a small true sum
+        for(int trial = 0; trial < 100; ++trial){
+            const size_t small = v.random_size(200), big = v.random_size(1000);
+            vector<float> a;
+            double ref = 0.0, scale = 0.0;
+            for(size_t i = 0; i < small; ++i){
+                a.push_back(uniform_real_distribution<float>(-1.0f, 1.0f)(v.rng()));
+                ref += a.back();
+            }
+            for(size_t i = 0; i < big; ++i){
+                const float x = uniform_real_distribution<float>(1e6f, 1e7f)(v.rng());
+                a.push_back(x);
+                a.push_back(-x);
+            }
+            shuffle(a.begin(), a.end(), v.rng());
+            for(float x : a){
+                scale += fabs(x);
+            }
+            const float got = simd_sum(a.data(), a.size(), simd_sum_mode::compensated);
+            v.expect_close("cancelling n=" + to_string(a.size()), 0, (float)ref, got, 2, (float)(FLT_EPSILON * scale));
+        }
+        v.end();
+
+        v.begin("dot", simd_isa_name(isa));
+        for(int trial = 0; trial < 200; ++trial){
+            const size_t n = v.random_size(5000);
+            const size_t oa = random_offset(v), ob = random_offset(v);
+            vector<float> a(n + 4), b(n + 4);
+            v.fill(a.data() + oa, n, -10.0f, 10.0f, false);
+            v.fill(b.data() + ob, n, -10.0f, 10.0f, false);
+            double ref = 0.0, scale = 0.0;
+            for(size_t i = 0; i < n; ++i){
+                ref += (double)a[oa + i] * b[ob + i];
+                scale += fabs((double)a[oa + i] * b[ob + i]);
+            }
+            for(int m = 0; m < 3; ++m){
+                const float got = simd_dot(a.data() + oa, b.data() + ob, n, modes[m]);
+                const string what = string(mode_names[m]) + " n=" + to_string(n);
+                if(modes[m] == simd_sum_mode::compensated){
+                    v.expect_close(what, 0, (float)ref, got, 2, (float)(n * FLT_EPSILON * scale));
+                }
+                else{
+                    // and one rounding per product:
+                    v.expect_close(what, 0, (float)ref, got, sum_ulps(modes[m], n) + 1, (float)scale);
+                }
+            }
+        }
+        // ill-conditioned: products cancelling in pairs, the small ones inexact in float
+        for(int trial = 0; trial < 100; ++trial){
+            const size_t small = v.random_size(200), big = v.random_size(1000);
+            vector<pair<float, float>> terms;
+            double ref = 0.0, scale = 0.0;
+            for(size_t i = 0; i < small; ++i){
+                terms.emplace_back(uniform_real_distribution<float>(-1.0f, 1.0f)(v.rng()),
+                                   uniform_real_distribution<float>(-1.0f, 1.0f)(v.rng()));
+                ref += (double)terms.back().first * terms.back().second;
+            }
+            for(size_t i = 0; i < big; ++i){
+                const float x = uniform_real_distribution<float>(1e3f, 1e4f)(v.rng());
+                const float y = uniform_real_distribution<float>(1e3f, 1e4f)(v.rng());
+                terms.emplace_back(x, y);
+                terms.emplace_back(-x, y);
+            }
+            shuffle(terms.begin(), terms.end(), v.rng());
+            vector<float> a, b;
+            for(const auto& t : terms){
+                a.push_back(t.first);
+                b.push_back(t.second);
+                scale += fabs((double)t.first * t.second);
+            }
+            const float got = simd_dot(a.data(), b.data(), a.size(), simd_sum_mode::compensated);
+            v.expect_close("cancelling n=" + to_string(a.size()), 0, (float)ref, got, 2, (float)(FLT_EPSILON * scale));
+        }
+        v.end();
+
+        v.begin("norm2", simd_isa_name(isa));
+        for(int trial = 0; trial < 200; ++trial){
+            const size_t n = v.random_size(3000);
+            // in range, then squares that overflow and that underflow:
+            const float magnitudes[] = {1.0f, 1e30f, 1e-30f};
+            const char* ranges[] = {"in range", "overflow", "underflow"};
+            const float magnitude = magnitudes[trial % 3];
+            vector<float> a(n);
+            v.fill(a.data(), n, -magnitude, magnitude, false);
+            double squares = 0.0;
+            for(size_t i = 0; i < n; ++i){
+                squares += (double)a[i] * a[i];
+            }
+            const float ref = (float)sqrt(squares);
+            for(int m = 0; m < 3; ++m){
+                const float got = simd_norm2(a.data(), n, modes[m]);
+                // the terms are positive: relative error, halved by the root
+                const uint32_t ulps = modes[m] == simd_sum_mode::compensated ? 2 : sum_ulps(modes[m], n) / 2 + 2;
+                v.expect_close(string(mode_names[m]) + " " + ranges[trial % 3] + " n=" + to_string(n), 0, ref, got, ulps);
+            }
+        }
+        v.end();
+
+        v.begin("min/max", simd_isa_name(isa));
+        for(int trial = 0; trial < 300; ++trial){
+            const size_t n = v.random_size(5000);
+            const size_t oa = random_offset(v);
+            vector<float> a(n + 4);
+            v.fill(a.data() + oa, n, -100.0f, 100.0f, true);
+            if(trial % 10 == 0){
+                // nothing but NaNs and one kind of infinity, or nothing at all:
+                fill_n(a.data() + oa, n, numeric_limits<float>::quiet_NaN());
+                if(trial % 20 == 0 && n > 0){
+                    a[oa + n / 2] = (trial % 40 == 0 ? 1 : -1) * numeric_limits<float>::infinity();
+                }
+            }
+            const float* p = a.data() + oa;
+            const string what = "n=" + to_string(n);
+            v.expect_close("minimum " + what, 0, minimum(p, n), simd_minimum(p, n), 0);
+            v.expect_close("maximum " + what, 0, maximum(p, n), simd_maximum(p, n), 0);
+            v.expect_close("argmin " + what, 0, (float)argmin(p, n), (float)simd_argmin(p, n), 0);
+            v.expect_close("argmax " + what, 0, (float)argmax(p, n), (float)simd_argmax(p, n), 0);
+        }
+        v.end();
+    }
+}
+
+/**
+ * @brief the conversions on every FP16/BF16 bit pattern and on random
+ * floats of every range against the reference conversions (which are
+ * checked to round to nearest even), add/mul exactly against the float
+ * operation rounded once, and the dot product against a double sum
+ */
+static void verify_half(verifier& v, const bench_options& opt){
+    // random floats over the whole range of both formats, with specials:
+    auto random_floats = [&](float* p, size_t n){
+        uniform_real_distribution<float> exponent(-30.0f, 20.0f);
+        for(size_t i = 0; i < n; ++i){
+            p[i] = ldexpf(uniform_real_distribution<float>(-1.0f, 1.0f)(v.rng()), (int)exponent(v.rng()));
+        }
+        if(n > 0 && v.rng()() % 2 == 0){
+            const float specials[] = {0.0f, -0.0f, INFINITY, -INFINITY, NAN, 65504.0f, 65520.0f, 6.1035156e-5f, 2.9802322e-8f};
+            for(float s : specials){
+                p[v.rng()() % n] = s;
+            }
+        }
+    };
+    auto bits = [](float f){
+        uint32_t u;
+        memcpy(&u, &f, sizeof(u));
+        return u;
+    };
+
+    for(const auto& f : half_formats){
+        const simd_half_format format = f.second;
+
+        // the reference: nearest, ties to even, checked through its neighbours
+        v.begin("float_to_half", f.first);
+        for(int trial = 0; trial < 200000; ++trial){
+            float x;
+            random_floats(&x, 1);
+            if(std::isnan(x)){
+                continue;
+            }
+            const uint16_t r = float_to_half(x, format);
+            const double got = half_to_float(r, format);
+            const float biggest = format == simd_half_format::fp16 ? 65504.0f : FLT_MAX;
+            if(std::isinf(got) || std::isinf(x)){
+                // only past the largest finite value plus half its ulp:
+                const double limit = biggest + (format == simd_half_format::fp16 ? 16.0 : ldexp(1.0, 127 - 8));
+                v.expect_close("overflow " + to_string(x), 0, fabs(x) >= limit ? 1.0f : 0.0f, std::isinf(got) ? 1.0f : 0.0f, 0);
+                continue;
+            }
+            const double err = fabs(got - x);
+            for(int step : {-1, 1}){
+                const uint16_t nb = (uint16_t)(r + step);
+                const double other = half_to_float(nb, format);
+                if(std::isnan(other) || std::isinf(other) || ((nb ^ r) & 0x8000)){
+                    continue;
+                }
+                const double other_err = fabs(other - x);
+                const bool ok = err < other_err || (err == other_err && (r & 1) == 0);
+                v.expect_close("nearest even " + to_string(x), 0, 0.0f, ok ? 0.0f : 1.0f, 0);
+            }
+        }
+        v.end();
+    }
+
+    for(simd_isa isa : bench_levels(opt)){
+        simd_set_isa(isa);
+        for(const auto& f : half_formats){
+            const simd_half_format format = f.second;
+            const string level = string(simd_isa_name(isa)) + "/" + f.first;
+
+            v.begin("half conversion", level);
+            vector<uint16_t> all(65536), back(65536);
+            vector<float> wide(65536);
+            iota(all.begin(), all.end(), 0);
+            simd_from_half(all.data(), wide.data(), all.size(), format);
+            simd_to_half(wide.data(), back.data(), all.size(), format);
+            for(size_t i = 0; i < all.size(); ++i){
+                const float ref = half_to_float(all[i], format);
+                v.expect_close("widen", i, ref, wide[i], 0);
+                if(!std::isnan(ref)){
+                    v.expect_close("round trip", i, (float)all[i], (float)back[i], 0);
+                }
+            }
+            for(int trial = 0; trial < 100; ++trial){
+                const size_t n = v.random_size(1100);
+                const size_t oa = random_offset(v), oh = random_offset(v);
+                vector<float> a(n + 4);
+                vector<uint16_t> h(n + 4);
+                random_floats(a.data() + oa, n);
+                simd_to_half(a.data() + oa, h.data() + oh, n, format);
+                for(size_t i = 0; i < n; ++i){
+                    const uint16_t ref = float_to_half(a[oa + i], format);
+                    const uint16_t got = h[oh + i];
+                    // NaNs only have to stay NaNs:
+                    const bool ok = ref == got || (std::isnan(a[oa + i]) && std::isnan(half_to_float(got, format)));
+                    v.expect_close("narrow " + to_string(a[oa + i]) + " bits " + to_string(bits(a[oa + i])), i, 0.0f, ok ? 0.0f : 1.0f, 0);
+                }
+            }
+            v.end();
+
+            v.begin("add/mul half", level);
+            for(int trial = 0; trial < 200; ++trial){
+                const size_t n = v.random_size(1100);
+                vector<float> a(n), b(n);
+                vector<uint16_t> ah(n), bh(n), ch(n);
+                v.fill(a.data(), n, -100.0f, 100.0f, true);
+                v.fill(b.data(), n, -100.0f, 100.0f, true);
+                simd_to_half(a.data(), ah.data(), n, format);
+                simd_to_half(b.data(), bh.data(), n, format);
+                for(bool multiply : {false, true}){
+                    (multiply ? simd_mul_half : simd_add_half)(ah.data(), bh.data(), ch.data(), n, format);
+                    const string what = string(multiply ? "mul" : "add") + " n=" + to_string(n);
+                    for(size_t i = 0; i < n; ++i){
+                        const float x = half_to_float(ah[i], format), y = half_to_float(bh[i], format);
+                        const float ref = half_to_float(float_to_half(multiply ? x * y : x + y, format), format);
+                        v.expect_close(what, i, ref, half_to_float(ch[i], format), 0);
+                    }
+                }
+                // in place:
+                vector<uint16_t> sum(n);
+                simd_add_half(ah.data(), bh.data(), sum.data(), n, format);
+                simd_add_half(ah.data(), bh.data(), bh.data(), n, format);
+                for(size_t i = 0; i < n; ++i){
+                    v.expect_close("in-place n=" + to_string(n), i, half_to_float(sum[i], format), half_to_float(bh[i], format), 0);
+                }
+            }
+            v.end();
+
+            v.begin("dot half", level);
+            for(int trial = 0; trial < 200; ++trial){
+                const size_t n = v.random_size(5000);
+                vector<float> a(n), b(n);
+                vector<uint16_t> ah(n), bh(n);
+                v.fill(a.data(), n, -10.0f, 10.0f, false);
+                v.fill(b.data(), n, -10.0f, 10.0f, false);
+                simd_to_half(a.data(), ah.data(), n, format);
+                simd_to_half(b.data(), bh.data(), n, format);
+                double ref = 0.0, scale = 0.0;
+                for(size_t i = 0; i < n; ++i){
+                    const double t = (double)half_to_float(ah[i], format) * half_to_float(bh[i], format);
+                    ref += t;
+                    scale += fabs(t);
+                }
+                // the bound of simd_dot() in fast mode:
+                v.expect_close("n=" + to_string(n), 0, (float)ref, simd_dot_half(ah.data(), bh.data(), n, format),
+                               (uint32_t)(n / 4 + 9), (float)scale);
+            }
+            v.end();
+        }
+    }
+}
+
+/**
+ * @brief simd_conv_half() bit for bit against simd_conv() on the widened
+ * operands, across its blocks of outputs and with a filter longer than one
+ */
+static void verify_conv_half(verifier& v, const bench_options& opt){
+    for(simd_isa isa : bench_levels(opt)){
+        simd_set_isa(isa);
+        for(const auto& f : half_formats){
+            const simd_half_format format = f.second;
+            const string level = string(simd_isa_name(isa)) + "/" + f.first;
+
+            v.begin("conv half", level);
+            for(int trial = 0; trial < 60; ++trial){
+                // across the 4096 output blocks, a filter longer than a block, either operand the longer one:
+                size_t l1 = 1 + v.random_size(trial % 10 == 9 ? 9000 : 3000);
+                size_t l2 = 1 + v.random_size(trial % 10 == 9 ? 5000 : 100);
+                if(trial % 4 == 3){
+                    swap(l1, l2);
+                }
+                const size_t l = l1 + l2 - 1;
+                vector<float> x(l1), h(l2), y(l, 0.0f), ref(l, 0.0f);
+                vector<uint16_t> xh(l1), hh(l2);
+                v.fill(x.data(), l1, -1.0f, 1.0f, false);
+                v.fill(h.data(), l2, -1.0f, 1.0f, false);
+                simd_to_half(x.data(), xh.data(), l1, format);
+                simd_to_half(h.data(), hh.data(), l2, format);
+                simd_from_half(xh.data(), x.data(), l1, format);
+                simd_from_half(hh.data(), h.data(), l2, format);
+
+                simd_conv(x.data(), l1, h.data(), l2, ref.data());
+                simd_conv_half(xh.data(), l1, hh.data(), l2, y.data(), format);
+                const string what = "l1=" + to_string(l1) + " l2=" + to_string(l2);
+                for(size_t i = 0; i < l; ++i){
+                    v.expect_close(what, i, ref[i], y[i], 0);
+                }
+            }
+            v.end();
+        }
+    }
+}
+
+/**
+ * @brief random integers over the whole range of T (or small ones, which
+ * do not overflow), with the extremes mixed in
+ */
+template<class T>
+static void random_ints(verifier& v, T* p, size_t n, bool small){
+    uniform_int_distribution<int64_t> value(small ? max<int64_t>(numeric_limits<T>::min(), -12) : numeric_limits<T>::min(),
+                                            small ? 12 : numeric_limits<T>::max());
+    const T extremes[] = {numeric_limits<T>::min(), numeric_limits<T>::max(), 0, (T)-1, 1};
+    for(size_t i = 0; i < n; ++i){
+        p[i] = !small && v.rng()() % 8 == 0 ? extremes[v.rng()() % 5] : (T)value(v.rng());
+    }
+}
+
+/**
+ * @brief the integer add/sub/mul of one element type, wrapping and
+ * saturating, against the references, misaligned and in place
+ */
+template<class T>
+static void verify_int_type(verifier& v, const string& level, const char* type){
+    using int_kernel = void (*)(const T*, const T*, T*, size_t, simd_overflow);
+    const int_kernel kernels[] = {simd_add, simd_sub, simd_mul};
+    const int_kernel references[] = {add, sub, mul};
+    const char* names[] = {"add", "sub", "mul"};
+
+    v.begin(string("int add/sub/mul ") + type, level);
+    for(int trial = 0; trial < 100; ++trial){
+        const size_t n = v.random_size(1100);
+        const size_t oa = random_offset(v), ob = random_offset(v), oc = random_offset(v);
+        vector<T> a(n + 4), b(n + 4), c(n + 4), ref(n);
+        random_ints(v, a.data() + oa, n, trial % 4 == 0);
+        random_ints(v, b.data() + ob, n, trial % 4 == 0);
+
+        for(int op = 0; op < 3; ++op){
+            for(simd_overflow overflow : {simd_overflow::wrap, simd_overflow::saturate}){
+                references[op](a.data() + oa, b.data() + ob, ref.data(), n, overflow);
+                kernels[op](a.data() + oa, b.data() + ob, c.data() + oc, n, overflow);
+                const string what = string(names[op]) + (overflow == simd_overflow::saturate ? " saturate" : " wrap")
+                                  + " n=" + to_string(n);
+                for(size_t i = 0; i < n; ++i){
+                    v.expect_equal(what, i, ref[i], c[oc + i]);
+                }
+            }
+        }
+
+        // in place, c = a + c:
+        add(a.data() + oa, b.data() + ob, ref.data(), n, simd_overflow::saturate);
+        copy_n(b.data() + ob, n, c.data() + oc);
+        simd_add(a.data() + oa, c.data() + oc, c.data() + oc, n, simd_overflow::saturate);
+        for(size_t i = 0; i < n; ++i){
+            v.expect_equal("in-place n=" + to_string(n), i, ref[i], c[oc + i]);
+        }
+    }
+    v.end();
+}
+
+/**
+ * @brief integer elementwise kernels of every type, and the 8 bit dot
+ * products, also long enough for the int32 lanes to need flushing
+ */
+static void verify_int(verifier& v, const bench_options& opt){
+    for(simd_isa isa : bench_levels(opt)){
+        simd_set_isa(isa);
+        const string level = simd_isa_name(isa);
+        verify_int_type<int8_t>(v, level, "int8");
+        verify_int_type<uint8_t>(v, level, "uint8");
+        verify_int_type<int16_t>(v, level, "int16");
+        verify_int_type<int32_t>(v, level, "int32");
+
+        v.begin("dot int8", level);
+        for(int trial = 0; trial < 200; ++trial){
+            // every 20th past 2^31 in magnitude, all extremes over 200000 elements:
+            const bool flood = trial % 20 == 19;
+            const size_t n = flood ? 200000 + v.random_size(1000) : v.random_size(5000);
+            const size_t oa = random_offset(v), ob = random_offset(v);
+            vector<uint8_t> a(n + 4);
+            vector<int8_t> s(n + 4), b(n + 4);
+            if(flood){
+                fill(a.begin(), a.end(), 255);
+                fill(s.begin(), s.end(), -128);
+                fill(b.begin(), b.end(), (int8_t)(trial % 40 == 39 ? 127 : -128));
+            }
+            else{
+                random_ints(v, a.data() + oa, n, false);
+                random_ints(v, s.data() + oa, n, false);
+                random_ints(v, b.data() + ob, n, false);
+            }
+            const string what = "n=" + to_string(n);
+            v.expect_equal("u8*s8 " + what, 0, dot(a.data() + oa, b.data() + ob, n), simd_dot(a.data() + oa, b.data() + ob, n));
+            v.expect_equal("s8*s8 " + what, 0, dot(s.data() + oa, b.data() + ob, n), simd_dot(s.data() + oa, b.data() + ob, n));
+        }
+        v.end();
+    }
+}
+
+/**
+ * @brief simd_conv_quant() bit for bit against conv_quant() in every mode,
+ * across its blocks of outputs, with random scales and zero points (some
+ * outputs saturating)
+ */
+static void verify_conv_quant(verifier& v, const bench_options& opt){
+    const simd_conv_mode modes[] = {simd_conv_mode::full, simd_conv_mode::same, simd_conv_mode::valid};
+    static const char* mode_names[] = {"full", "same", "valid"};
+    for(simd_isa isa : bench_levels(opt)){
+        simd_set_isa(isa);
+        v.begin("conv quant", simd_isa_name(isa));
+
+        for(int trial = 0; trial < 150; ++trial){
+            // short and long filters, either operand the longer one, every 30th across the 4096 output blocks:
+            size_t l1 = 1 + v.random_size(trial % 30 == 29 ? 9000 : 300);
+            size_t l2 = 1 + v.random_size(trial % 4 == 3 ? 300 : 40);
+            if(trial % 8 == 7){
+                swap(l1, l2);
+            }
+            const size_t l = l1 + l2 - 1;
+            const simd_conv_mode mode = modes[trial % 3];
+            const size_t count = simd_conv_size(l1, l2, mode);
+            const size_t first = mode == simd_conv_mode::full ? 0
+                               : mode == simd_conv_mode::same ? (min(l1, l2) - 1) / 2 : min(l1, l2) - 1;
+            const size_t ox = random_offset(v), oh = random_offset(v), oy = random_offset(v);
+
+            uniform_real_distribution<float> scale(0.001f, 0.1f), gain(3.0f, 3000.0f);
+            uniform_int_distribution<int32_t> zero_u8(0, 255), zero_s8(-128, 127);
+            const simd_quant xq = {scale(v.rng()), zero_u8(v.rng())};
+            const simd_quant hq = {scale(v.rng()), trial % 2 == 0 ? 0 : zero_s8(v.rng())};
+            const simd_quant yq = {xq.scale * hq.scale * gain(v.rng()), zero_u8(v.rng())};
+
+            vector<uint8_t> x(l1 + 4), y(count + 4, 0xab), ref(l);
+            vector<int8_t> h(l2 + 4);
+            random_ints(v, x.data() + ox, l1, false);
+            random_ints(v, h.data() + oh, l2, false);
+
+            conv_quant(x.data() + ox, l1, xq, h.data() + oh, l2, hq, ref.data(), yq);
+            simd_conv_quant(x.data() + ox, l1, xq, h.data() + oh, l2, hq, y.data() + oy, yq, mode);
+
+            const string what = string(mode_names[trial % 3]) + " l1=" + to_string(l1) + " l2=" + to_string(l2);
+            for(size_t i = 0; i < count; ++i){
+                v.expect_equal(what, i, ref[first + i], y[oy + i]);
+            }
+            // nothing written past the mode's outputs:
+            for(size_t i = count; i + oy < y.size(); ++i){
+                v.expect_equal(what + " past the end", i, 0xab, y[oy + i]);
+            }
+        }
+        v.end();
+    }
+}
+
+/**
+ * @brief the double precision elementwise kernels against the references,
+ * misaligned, in place and with special values; multiply-add within the
+ * FMA tolerance
+ */
+static void verify_vec_f64(verifier& v, const bench_options& opt){
+    using f64_kernel = void (*)(const double*, const double*, double*, size_t);
+    const f64_kernel kernels[] = {simd_add, simd_sub, simd_mul, simd_div};
+    const f64_kernel references[] = {add, sub, mul, div};
+    const char* names[] = {"vec_add fp64", "vec_sub fp64", "vec_mul fp64", "vec_div fp64"};
+
+    for(simd_isa isa : bench_levels(opt)){
+        simd_set_isa(isa);
+        for(int op = 0; op < 4; ++op){
+            v.begin(names[op], simd_isa_name(isa));
+            for(int trial = 0; trial < 150; ++trial){
+                const size_t n = v.random_size(1100);
+                const size_t oa = random_offset(v), ob = random_offset(v), oc = random_offset(v);
+
+                vector<double> a(n + 4), b(n + 4), c(n + 4), ref(n);
+                v.fill(a.data() + oa, n, -100.0, 100.0, true);
+                v.fill(b.data() + ob, n, -100.0, 100.0, true);
+
+                references[op](a.data() + oa, b.data() + ob, ref.data(), n);
+                kernels[op](a.data() + oa, b.data() + ob, c.data() + oc, n);
+                for(size_t i = 0; i < n; ++i){
+                    v.expect_close("n=" + to_string(n), i, ref[i], c[oc + i], 0);
+                }
+
+                // in place, c = a op c:
+                copy_n(b.data() + ob, n, c.data() + oc);
+                kernels[op](a.data() + oa, c.data() + oc, c.data() + oc, n);
+                for(size_t i = 0; i < n; ++i){
+                    v.expect_close("in-place n=" + to_string(n), i, ref[i], c[oc + i], 0);
+                }
+            }
+            v.end();
+        }
+
+        v.begin("vec_mul_add fp64", simd_isa_name(isa));
+        for(int trial = 0; trial < 150; ++trial){
+            const size_t n = v.random_size(1100);
+            const size_t oa = random_offset(v), ob = random_offset(v), oc = random_offset(v);
+
+            // a fused multiply-add differs legitimately once a * b overflows, keep those finite:
+            vector<double> a(n + 4), b(n + 4), c(n + 4), d(n + 4), ref(n);
+            v.fill(a.data() + oa, n, -100.0, 100.0, false);
+            v.fill(b.data() + ob, n, -100.0, 100.0, false);
+            v.fill(c.data() + oc, n, -100.0, 100.0, false);
+
+            mul_add(a.data() + oa, b.data() + ob, c.data() + oc, ref.data(), n);
+            simd_mul_add(a.data() + oa, b.data() + ob, c.data() + oc, d.data() + oc, n);
+            for(size_t i = 0; i < n; ++i){
+                const double scale = fabs(a[oa + i] * b[ob + i]) + fabs(c[oc + i]);
+                v.expect_close("n=" + to_string(n), i, ref[i], d[oc + i], 1, scale);
+            }
+
+            // in place, c = a * b + c:
+            simd_mul_add(a.data() + oa, b.data() + ob, c.data() + oc, c.data() + oc, n);
+            for(size_t i = 0; i < n; ++i){
+                v.expect_close("in-place n=" + to_string(n), i, ref[i], c[oc + i], 1,
+                               fabs(a[oa + i] * b[ob + i]) + fabs(ref[i]));
+            }
+        }
+        v.end();
+    }
+}
+
+/**
+ * @brief the double precision 4x4 Tensor kernels, see verify_tensor()
+ */
+static void verify_tensor_f64(verifier& v, const bench_options& opt){
+    using f64_tensor_kernel = void (*)(const Tensor64, const Tensor64, Tensor64&);
+    const f64_tensor_kernel kernels[] = {simd_add, simd_sub, simd_mul};
+    const f64_tensor_kernel references[] = {add, sub, mul};
+    const char* names[] = {"tensor_add fp64", "tensor_sub fp64", "tensor_mul fp64"};
+
+    for(simd_isa isa : bench_levels(opt)){
+        simd_set_isa(isa);
+        for(int op = 0; op < 3; ++op){
+            const bool product = op == 2;
+            v.begin(names[op], simd_isa_name(isa));
+
+            for(int trial = 0; trial < 500; ++trial){
+                const size_t oa = random_offset(v), ob = random_offset(v), oc = random_offset(v);
+
+                double a[20], b[20], c[20], ref[16];
+                // products of specials differ legitimately with FMA, keep those finite:
+                v.fill(a + oa, 16, -10.0, 10.0, !product);
+                v.fill(b + ob, 16, -10.0, 10.0, !product);
+
+                auto ta = (const double(*)[4])(a + oa);
+                auto tb = (const double(*)[4])(b + ob);
+                references[op](ta, tb, *(Tensor64*)ref);
+                kernels[op](ta, tb, *(Tensor64*)(c + oc));
+
+                for(int i = 0; i < 16; ++i){
+                    double scale = 0.0;
+                    if(product){
+                        for(int k = 0; k < 4; ++k){
+                            scale += fabs(ta[i / 4][k] * tb[k][i % 4]);
+                        }
+                    }
+                    v.expect_close("tensor", i, ref[i], c[oc + i], product ? 4 : 0, scale);
+                }
+            }
+            v.end();
+        }
+    }
+}
+
+/**
+ * @brief the double precision direct convolution in every mode, see verify_conv()
+ */
+static void verify_conv_f64(verifier& v, const bench_options& opt){
+    const simd_conv_mode modes[] = {simd_conv_mode::full, simd_conv_mode::same, simd_conv_mode::valid};
+    static const char* mode_names[] = {"full", "same", "valid"};
+    for(simd_isa isa : bench_levels(opt)){
+        simd_set_isa(isa);
+        v.begin("convolution fp64", simd_isa_name(isa));
+
+        for(int trial = 0; trial < 300; ++trial){
+            // short and long filters, either operand the longer one:
+            size_t l1 = 1 + v.random_size(300);
+            size_t l2 = 1 + v.random_size(trial % 4 == 3 ? 300 : 40);
+            if(trial % 8 == 7){
+                swap(l1, l2);
+            }
+            const size_t l = l1 + l2 - 1;
+            const simd_conv_mode mode = modes[trial % 3];
+            const size_t count = simd_conv_size(l1, l2, mode);
+            const size_t first = mode == simd_conv_mode::full ? 0
+                               : mode == simd_conv_mode::same ? (min(l1, l2) - 1) / 2 : min(l1, l2) - 1;
+            const size_t ox = random_offset(v), oh = random_offset(v), oy = random_offset(v);
+
+            vector<double> x(l1 + 4), h(l2 + 4), y(count + 4, 0.0), ref(l, 0.0);
+            v.fill(x.data() + ox, l1, -1.0, 1.0, false);
+            v.fill(h.data() + oh, l2, -1.0, 1.0, false);
+
+            conv(x.data() + ox, l1, h.data() + oh, l2, ref.data());
+            simd_conv(x.data() + ox, l1, h.data() + oh, l2, y.data() + oy, mode);
+
+            const string what = string(mode_names[trial % 3]) + " l1=" + to_string(l1) + " l2=" + to_string(l2);
+            for(size_t i = 0; i < count; ++i){
+                const size_t n = first + i;
+                double scale = 0.0;
+                for(size_t k = 0; k < l1; ++k){
+                    if(n >= k && n - k < l2){
+                        scale += fabs(x[ox + k] * h[oh + n - k]);
+                    }
+                }
+                v.expect_close(what, i, ref[n], y[oy + i], (uint32_t)min(l1, l2) + 2, scale);
+            }
+            // nothing written past the mode's outputs:
+            for(size_t i = count; i + oy < y.size(); ++i){
+                v.expect_close(what + " past the end", i, 0.0, y[oy + i], 0, 0.0);
+            }
+        }
+        v.end();
+    }
+}
+
+/**
+ * @brief alignment and contents of simd_buffer and simd_arena allocations,
+ * rewinding, and an arena that outgrows its block regrowing to the peak
+ */
+static void verify_alloc(verifier& v, const bench_options&){
+    auto misalignment = [](const void* p){ return (float)(reinterpret_cast<uintptr_t>(p) % simd_alignment); };
+
+    v.begin("alloc", "buffer");
+    for(int trial = 0; trial < 100; ++trial){
+        const size_t n = v.random_size(5000);
+        simd_buffer<float> b(n, trial % 10 == 0);
+        v.expect_close("size n=" + to_string(n), 0, (float)n, (float)b.size(), 0);
+        v.expect_close("alignment n=" + to_string(n), 0, 0.0f, misalignment(b.data()), 0);
+        v.fill(b.data(), n, -1.0f, 1.0f, false);
+        simd_buffer<float> moved(std::move(b));
+        v.expect_close("moved n=" + to_string(n), 0, 0.0f, (float)b.size(), 0);
+        vector<float> copy(moved.begin(), moved.end());
+        for(size_t i = 0; i < n; ++i){
+            v.expect_close("contents n=" + to_string(n), i, copy[i], moved[i], 0);
+        }
+    }
+    v.end();
+
+    v.begin("alloc", "arena");
+    simd_arena arena(4096);
+    for(int trial = 0; trial < 50; ++trial){
+        // a few nested scopes of random sizes, some bigger than the block:
+        vector<pair<float*, size_t>> live;
+        vector<simd_arena::mark> marks;
+        for(int k = 0; k < 8; ++k){
+            if(k % 3 == 0){
+                marks.push_back(arena.position());
+            }
+            const size_t n = v.random_size(k == 5 ? 20000 : 700);
+            float* p = arena.alloc<float>(n);
+            v.expect_close("alignment n=" + to_string(n), k, 0.0f, misalignment(p), 0);
+            for(size_t i = 0; i < n; ++i){
+                p[i] = (float)(k * 100000 + i);
+            }
+            live.emplace_back(p, n);
+        }
+        // nothing overlaps:
+        for(size_t k = 0; k < live.size(); ++k){
+            for(size_t i = 0; i < live[k].second; ++i){
+                v.expect_close("contents", i, (float)(k * 100000 + i), live[k].first[i], 0);
+            }
+        }
+        while(!marks.empty()){
+            arena.rewind(marks.back());
+            marks.pop_back();
+        }
+        v.expect_close("capacity >= peak", trial, 0.0f, arena.capacity() >= arena.peak() ? 0.0f : 1.0f, 0);
+    }
+    v.end();
+}
+
+/**
+ * @brief the elementwise kernels over exactly n elements with either tail:
+ * the reference's results, out of and in place, and nothing written past n
+ */
+template<class T>
+static void verify_tail_elementwise(verifier& v, const string& what, size_t n){
+    const size_t guard = 16;
+    vector<T> a(n), b(n), c(n), ref(n), d(n + guard, T(7)), e(n + guard, T(7));
+    v.fill(a.data(), n, T(-100), T(100), false);
+    v.fill(b.data(), n, T(-100), T(100), false);
+    v.fill(c.data(), n, T(-100), T(100), false);
+
+    add(a.data(), b.data(), ref.data(), n);
+    simd_add(a.data(), b.data(), d.data(), n);
+    copy_n(b.data(), n, e.data());
+    simd_add(a.data(), e.data(), e.data(), n);
+    for(size_t i = 0; i < n; ++i){
+        v.expect_close("add " + what, i, ref[i], d[i], 0);
+        v.expect_close("add in-place " + what, i, ref[i], e[i], 0);
+    }
+
+    div(a.data(), b.data(), ref.data(), n);
+    simd_div(a.data(), b.data(), d.data(), n);
+    for(size_t i = 0; i < n; ++i){
+        v.expect_close("div " + what, i, ref[i], d[i], 0);
+    }
+
+    mul_add(a.data(), b.data(), c.data(), ref.data(), n);
+    simd_mul_add(a.data(), b.data(), c.data(), d.data(), n);
+    copy_n(c.data(), n, e.data());
+    simd_mul_add(a.data(), b.data(), e.data(), e.data(), n);
+    for(size_t i = 0; i < n; ++i){
+        const T scale = fabs(a[i] * b[i]) + fabs(c[i]);
+        v.expect_close("mul_add " + what, i, ref[i], d[i], 1, scale);
+        v.expect_close("mul_add in-place " + what, i, d[i], e[i], 0);
+    }
+
+    for(size_t i = n; i < n + guard; ++i){
+        v.expect_close("past the end " + what, i, T(7), d[i], 0);
+        v.expect_close("in-place past the end " + what, i, T(7), e[i], 0);
+    }
+}
+
+/**
+ * @brief simd_conv() of n outputs with the given tail, the guard elements
+ * after them have to stay 0
+ */
+template<class T>
+static vector<T> tail_conv(const vector<T>& x, const vector<T>& h, simd_tail mode){
+    const size_t count = simd_conv_size(x.size(), h.size(), simd_conv_mode::full);
+    vector<T> y(count + 16, T(0));
+    simd_set_tail(mode);
+    simd_conv(x.data(), x.size(), h.data(), h.size(), y.data(), simd_conv_mode::full);
+    return y;
+}
+
+/**
+ * @brief n = 1 .. 64 on every level with the vector and the scalar tails
+ * (see simd_set_tail()): the elementwise kernels match the reference, the
+ * convolutions the same bits either way, and the fast mode sum and dot
+ * product their scalar tail results within the error bound of the fast mode
+ */
+static void verify_vec_tail(verifier& v, const bench_options& opt){
+    const simd_tail tail = simd_tail_handling();
+    for(simd_isa isa : bench_levels(opt)){
+        simd_set_isa(isa);
+        v.begin("vec_tail", simd_isa_name(isa));
+        for(size_t n = 1; n <= 64; ++n){
+            for(simd_tail mode : {simd_tail::vector, simd_tail::scalar}){
+                simd_set_tail(mode);
+                const string what = string(mode == simd_tail::vector ? "vector" : "scalar") + " n=" + to_string(n);
+                verify_tail_elementwise<float>(v, what + " fp32", n);
+                verify_tail_elementwise<double>(v, what + " fp64", n);
+            }
+
+            const string what = "n=" + to_string(n);
+            vector<float> x(n), h(1 + n % 9);
+            vector<double> xd(n), hd(1 + n % 9);
+            v.fill(x.data(), x.size(), -1.0f, 1.0f, false);
+            v.fill(h.data(), h.size(), -1.0f, 1.0f, false);
+            v.fill(xd.data(), xd.size(), -1.0, 1.0, false);
+            v.fill(hd.data(), hd.size(), -1.0, 1.0, false);
+            const vector<float> y = tail_conv(x, h, simd_tail::vector), ys = tail_conv(x, h, simd_tail::scalar);
+            for(size_t i = 0; i < y.size(); ++i){
+                v.expect_close("conv fp32 " + what, i, ys[i], y[i], 0);
+            }
+            const vector<double> yd = tail_conv(xd, hd, simd_tail::vector), yds = tail_conv(xd, hd, simd_tail::scalar);
+            for(size_t i = 0; i < yd.size(); ++i){
+                v.expect_close("conv fp64 " + what, i, yds[i], yd[i], 0);
+            }
+
+            float scale = 0.0f, dot_scale = 0.0f;
+            for(size_t i = 0; i < n; ++i){
+                scale += fabs(x[i]);
+                dot_scale += fabs(x[i] * x[i]);
+            }
+            simd_set_tail(simd_tail::scalar);
+            const float sum = simd_sum(x.data(), n), dot = simd_dot(x.data(), x.data(), n);
+            simd_set_tail(simd_tail::vector);
+            v.expect_close("sum " + what, 0, sum, simd_sum(x.data(), n), (uint32_t)n, scale);
+            v.expect_close("dot " + what, 0, dot, simd_dot(x.data(), x.data(), n), (uint32_t)n, dot_scale);
+        }
+        v.end();
+    }
+    simd_set_tail(tail);
+}
+
+/**
+ * @brief one elementwise math function: its double precision reference,
+ * the inputs of either mode and the error allowed for them; fast mode
+ * errors are relative to the result, or absolute (scale 1) for the
+ * functions that cancel around zero
+ */
+struct math_check {
+    const char* name;
+    math_kernel kernel;
+    double (*reference)(double);
+    float lo, hi;
+    uint32_t max_ulp;
+    float fast_lo, fast_hi;
+    uint32_t fast_ulp;
+    bool fast_absolute;
+};
+
+static const math_check math_checks[] = {
+    {"exp", simd_exp, [](double x){ return exp(x); }, -110.0f, 100.0f, 1, -87.0f, 88.0f, 96, false},
+    {"log", simd_log, [](double x){ return log(x); }, 0.0f, 100.0f, 1, 1e-30f, 1e30f, 256, false},
+    {"sin", simd_sin, [](double x){ return sin(x); }, -10000.0f, 10000.0f, 2, -8192.0f, 8192.0f, 16, true},
+    {"cos", simd_cos, [](double x){ return cos(x); }, -10000.0f, 10000.0f, 2, -8192.0f, 8192.0f, 16, true},
+    {"tanh", simd_tanh, [](double x){ return tanh(x); }, -12.0f, 12.0f, 1, -12.0f, 12.0f, 32, true},
+    {"sigmoid", simd_sigmoid, [](double x){ return 1.0 / (1.0 + exp(-x)); }, -110.0f, 100.0f, 3, -80.0f, 80.0f, 96, false},
+    {"erf", simd_erf, [](double x){ return erf(x); }, -6.0f, 6.0f, 2, -6.0f, 6.0f, 32, true},
+};
+
+/**
+ * @brief a float of any sign and magnitude, NaNs, infinities and
+ * subnormals included
+ */
+static float random_bits(verifier& v){
+    const uint32_t u = v.rng()();
+    float x;
+    memcpy(&x, &u, sizeof(x));
+    return x;
+}
+
+/**
+ * @brief precise mode on uniform values, special values and random bit
+ * patterns (every magnitude), fast mode on the range it is meant for;
+ * the log inputs of fast mode are spread over its decades
+ */
+static void math_inputs(verifier& v, const math_check& m, simd_math_mode mode, float* a, size_t n){
+    if(mode == simd_math_mode::fast && m.kernel == simd_log){
+        uniform_real_distribution<float> decade(log(m.fast_lo), log(m.fast_hi));
+        for(size_t i = 0; i < n; ++i){
+            a[i] = exp(decade(v.rng()));
+        }
+        return;
+    }
+    if(mode == simd_math_mode::fast){
+        v.fill(a, n, m.fast_lo, m.fast_hi, false);
+        return;
+    }
+    v.fill(a, n, m.lo, m.hi, true);
+    for(size_t i = 0; i < n; ++i){
+        if(v.rng()() % 4 == 0){
+            a[i] = random_bits(v);
+        }
+    }
+}
+
+static void verify_math_pow(verifier& v, simd_math_mode mode){
+    for(int trial = 0; trial < 300; ++trial){
+        const size_t n = v.random_size(1100);
+        const size_t oa = random_offset(v), ob = random_offset(v), oc = random_offset(v);
+
+        vector<float> a(n + 4), b(n + 4), c(n + 4), ref(n);
+        float* x = a.data() + oa;
+        float* y = b.data() + ob;
+        if(mode == simd_math_mode::fast){
+            v.fill(x, n, 0.01f, 100.0f, false);
+            v.fill(y, n, -8.0f, 8.0f, false);
+        }
+        else{
+            v.fill(x, n, -4.0f, 4.0f, true);
+            v.fill(y, n, -30.0f, 30.0f, true);
+            for(size_t i = 0; i < n; ++i){
+                switch(v.rng()() % 4){
+                    case 0:  y[i] = round(y[i]); break;
+                    case 1:  x[i] = random_bits(v); y[i] = y[i] / 16.0f; break;
+                    default: break;
+                }
+            }
+        }
+        for(size_t i = 0; i < n; ++i){
+            ref[i] = (float)pow((double)x[i], (double)y[i]);
+        }
+
+        simd_pow(x, y, c.data() + oc, n, mode);
+        for(size_t i = 0; i < n; ++i){
+            if(mode == simd_math_mode::fast){
+                // the error of log x is multiplied by y:
+                const float scale = fabs(ref[i]) * max(1.0f, fabs(y[i] * log(x[i])));
+                v.expect_close("fast n=" + to_string(n), i, ref[i], c[oc + i], 256, scale);
+            }
+            else{
+                v.expect_close("n=" + to_string(n), i, ref[i], c[oc + i], 1);
+            }
+        }
+
+        // in place, c = a^c:
+        const vector<float> got(c.begin() + oc, c.begin() + oc + n);
+        copy_n(y, n, c.data() + oc);
+        simd_pow(x, c.data() + oc, c.data() + oc, n, mode);
+        for(size_t i = 0; i < n; ++i){
+            v.expect_close("in-place n=" + to_string(n), i, got[i], c[oc + i], 0);
+        }
+    }
+}
+
+/**
+ * @brief the elementwise math functions against the C library in double
+ * precision, rounded once: precise mode within the documented ulp over
+ * all inputs, fast mode within its error on its range; in place gives
+ * the same bits
+ */
+static void verify_math(verifier& v, const bench_options& opt){
+    for(simd_isa isa : bench_levels(opt)){
+        simd_set_isa(isa);
+        for(simd_math_mode mode : {simd_math_mode::precise, simd_math_mode::fast}){
+            const string suffix = mode == simd_math_mode::fast ? " fast" : "";
+            for(const math_check& m : math_checks){
+                v.begin(string("math ") + m.name + suffix, simd_isa_name(isa));
+                for(int trial = 0; trial < 300; ++trial){
+                    const size_t n = v.random_size(1100);
+                    const size_t oa = random_offset(v), ob = random_offset(v);
+
+                    vector<float> a(n + 4), b(n + 4);
+                    math_inputs(v, m, mode, a.data() + oa, n);
+                    m.kernel(a.data() + oa, b.data() + ob, n, mode);
+                    for(size_t i = 0; i < n; ++i){
+                        const float ref = (float)m.reference(a[oa + i]);
+                        if(mode == simd_math_mode::fast){
+                            v.expect_close("n=" + to_string(n), i, ref, b[ob + i], m.fast_ulp,
+                                           m.fast_absolute ? 1.0f : fabs(ref));
+                        }
+                        else{
+                            v.expect_close("n=" + to_string(n), i, ref, b[ob + i], m.max_ulp);
+                        }
+                    }
+
+                    m.kernel(a.data() + oa, a.data() + oa, n, mode);
+                    for(size_t i = 0; i < n; ++i){
+                        v.expect_close("in-place n=" + to_string(n), i, b[ob + i], a[oa + i], 0);
+                    }
+                }
+                v.end();
+            }
+            v.begin(string("math pow") + suffix, simd_isa_name(isa));
+            verify_math_pow(v, mode);
+            v.end();
+        }
+    }
+}
+
+/**
+ * @brief the error bound of simd_div_mode in ulp; the one step newton
+ * mode on the 8 bit estimates of NEON (and generic) is relative instead
+ */
+static uint32_t recip_ulp(simd_isa isa, simd_div_mode mode, bool rsqrt){
+    switch(mode){
+        case simd_div_mode::exact:   return rsqrt ? 1 : 0;
+        case simd_div_mode::newton2: return 3;
+        default:                     return isa == simd_isa::generic || isa == simd_isa::neon ? 256 : 3;
+    }
+}
+
+/**
+ * @brief division, square root and reciprocal square root in every mode
+ * against double precision rounded once, on uniform values, special
+ * values and random bit patterns (every magnitude, so the lanes the
+ * estimates do not cover are exercised too); in place gives the same bits
+ */
+static void verify_recip(verifier& v, const bench_options& opt){
+    for(simd_isa isa : bench_levels(opt)){
+        simd_set_isa(isa);
+        for(const auto& m : div_modes){
+            const string suffix = m.second == simd_div_mode::exact ? "" : string(" ") + m.first;
+            for(int f = 0; f < 3; ++f){
+                const char* name = f == 0 ? "div" : f == 1 ? "sqrt" : "rsqrt";
+                const uint32_t max_ulp = recip_ulp(isa, m.second, f == 2);
+                v.begin(string("recip ") + name + suffix, simd_isa_name(isa));
+                for(int trial = 0; trial < 300; ++trial){
+                    const size_t n = v.random_size(1100);
+                    const size_t oa = random_offset(v), ob = random_offset(v), oc = random_offset(v);
+
+                    vector<float> a(n + 4), b(n + 4), c(n + 4), ref(n);
+                    float* x = a.data() + oa;
+                    float* y = b.data() + ob;
+                    v.fill(x, n, f == 0 ? -100.0f : 0.0f, 100.0f, true);
+                    v.fill(y, n, -100.0f, 100.0f, true);
+                    for(size_t i = 0; i < n; ++i){
+                        if(v.rng()() % 4 == 0){
+                            x[i] = random_bits(v);
+                        }
+                        if(v.rng()() % 4 == 0){
+                            y[i] = random_bits(v);
+                        }
+                        switch(f){
+                            case 0:  ref[i] = (float)((double)x[i] / (double)y[i]); break;
+                            case 1:  ref[i] = (float)sqrt((double)x[i]); break;
+                            default: ref[i] = (float)(1.0 / sqrt((double)x[i])); break;
+                        }
+                    }
+
+                    float* z = c.data() + oc;
+                    switch(f){
+                        case 0:  simd_div(x, y, z, n, m.second); break;
+                        case 1:  simd_sqrt(x, z, n, m.second); break;
+                        default: simd_rsqrt(x, z, n, m.second); break;
+                    }
+                    for(size_t i = 0; i < n; ++i){
+                        v.expect_close("n=" + to_string(n), i, ref[i], z[i], max_ulp, fabs(ref[i]));
+                    }
+
+                    // in place, c = a op c (c = op a for the square roots):
+                    const vector<float> got(z, z + n);
+                    copy_n(f == 0 ? y : x, n, z);
+                    switch(f){
+                        case 0:  simd_div(x, z, z, n, m.second); break;
+                        case 1:  simd_sqrt(z, z, n, m.second); break;
+                        default: simd_rsqrt(z, z, n, m.second); break;
+                    }
+                    for(size_t i = 0; i < n; ++i){
+                        v.expect_close("in-place n=" + to_string(n), i, got[i], z[i], 0);
+                    }
+                }
+                v.end();
+            }
+        }
+    }
+}
+
+enum class layer_fn { softmax, log_softmax, layer_norm, rms_norm, relu, gelu, gelu_tanh };
+
+static const pair<const char*, layer_fn> layer_fns[] = {
+    {"softmax", layer_fn::softmax},
+    {"log_softmax", layer_fn::log_softmax},
+    {"layer_norm", layer_fn::layer_norm},
+    {"rms_norm", layer_fn::rms_norm},
+    {"bias_relu", layer_fn::relu},
+    {"bias_gelu", layer_fn::gelu},
+    {"bias_gelu_tanh", layer_fn::gelu_tanh},
+};
+
+/**
+ * @brief one of the layer kernels on rows x cols; p is gamma (the norms)
+ * or the bias, q beta
+ */
+static void layer_call(layer_fn f, bool parallel, const float* x, const float* p, const float* q, float* y,
+                       size_t rows, size_t cols){
+    const simd_activation act = f == layer_fn::relu ? simd_activation::relu
+                              : f == layer_fn::gelu ? simd_activation::gelu : simd_activation::gelu_tanh;
+    switch(f){
+        case layer_fn::softmax:
+            (parallel ? simd_parallel_softmax : simd_softmax)(x, y, rows, cols);
+            break;
+        case layer_fn::log_softmax:
+            (parallel ? simd_parallel_log_softmax : simd_log_softmax)(x, y, rows, cols);
+            break;
+        case layer_fn::layer_norm:
+            (parallel ? simd_parallel_layer_norm : simd_layer_norm)(x, p, q, y, rows, cols, 1e-5f);
+            break;
+        case layer_fn::rms_norm:
+            (parallel ? simd_parallel_rms_norm : simd_rms_norm)(x, p, y, rows, cols, 1e-6f);
+            break;
+        default:
+            (parallel ? simd_parallel_bias_activation : simd_bias_activation)(x, p, y, rows, cols, act);
+    }
+}
+
+/**
+ * @brief a row of a layer kernel in double precision: ref the outputs
+ * rounded once, scale the magnitude the float computation errs relative to
+ */
+static void layer_reference(layer_fn f, const float* x, const float* p, const float* q, size_t n,
+                            float* ref, float* scale){
+    double m = -INFINITY, s = 0.0, mean = 0.0, var = 0.0;
+    for(size_t i = 0; i < n; ++i){
+        m = x[i] > m ? x[i] : m;
+        mean += x[i];
+    }
+    mean /= (double)n;
+    for(size_t i = 0; i < n; ++i){
+        s += exp(x[i] - m);
+        var += (x[i] - mean) * (x[i] - mean);
+    }
+    const double rstd = 1.0 / sqrt(var / (double)n + 1e-5);
+    double q2 = 0.0;
+    for(size_t i = 0; i < n; ++i){
+        q2 += (double)x[i] * x[i];
+    }
+    const double rms = 1.0 / sqrt(q2 / (double)n + 1e-6);
+
+    for(size_t i = 0; i < n; ++i){
+        const double d = x[i] - m;
+        const double a = (double)(x[i] + p[i]);
+        switch(f){
+            case layer_fn::softmax:
+                // x - max is rounded to float first:
+                ref[i] = (float)(exp(d) / s);
+                scale[i] = fabs(ref[i]) * (1.0f + (float)fabs(d));
+                break;
+            case layer_fn::log_softmax:
+                // the float sum errs relative to s, so log s absolutely:
+                ref[i] = (float)(d - log(s));
+                scale[i] = (float)(fabs(d) + fabs(log(s)) + 1.0);
+                break;
+            case layer_fn::layer_norm:
+                ref[i] = (float)((x[i] - mean) * rstd * p[i] + q[i]);
+                // the float sums err relative to the spread and the mean of the row:
+                scale[i] = (float)((fabs(x[i] - mean) + sqrt(var / (double)n) + fabs(mean)) * rstd * fabs(p[i])
+                                   + fabs(q[i]));
+                break;
+            case layer_fn::rms_norm:
+                ref[i] = (float)(x[i] * rms * p[i]);
+                scale[i] = fabs(ref[i]);
+                break;
+            case layer_fn::relu:
+                ref[i] = (float)(a < 0.0 ? 0.0 : a);
+                scale[i] = 0.0f;
+                break;
+            case layer_fn::gelu:
+                ref[i] = (float)(0.5 * a * (1.0 + erf(a * 0.7071067811865476)));
+                scale[i] = (float)fabs(a);
+                break;
+            default:
+                ref[i] = (float)(0.5 * a * (1.0 + tanh(0.7978845608028654 * (a + 0.044715 * a * a * a))));
+                scale[i] = (float)fabs(a);
+        }
+    }
+}
+
+/**
+ * @brief the layer kernels against double precision rounded once, within
+ * 64 ulp of the magnitudes the float computation errs relative to (the
+ * float sums of up to a thousand terms, x - max rounded in softmax); rows
+ * of every length and offset, -inf logits in softmax, special values
+ * through relu. In place and the multi-threaded versions (on at least 4
+ * threads, every batch through the pool) give the same bits.
+ */
+static void verify_layers(verifier& v, const bench_options& opt){
+    const size_t threads = simd_threads();
+    const size_t threshold = simd_parallel_threshold();
+    simd_set_threads(max<size_t>(threads, 4));
+    simd_set_parallel_threshold(0);
+
+    for(simd_isa isa : bench_levels(opt)){
+        simd_set_isa(isa);
+        for(const auto& f : layer_fns){
+            v.begin(string("layers ") + f.first, simd_isa_name(isa));
+            for(int trial = 0; trial < 100; ++trial){
+                const size_t rows = 1 + v.rng()() % 7;
+                const size_t cols = max<size_t>(1, v.random_size(1100));
+                const size_t total = rows * cols;
+                const size_t ox = random_offset(v), oy = random_offset(v), op = random_offset(v);
+
+                vector<float> a(total + 4), b(total + 4), c(total + 4), g(cols + 4), e(cols + 4);
+                vector<float> ref(cols), scale(cols);
+                float* x = a.data() + ox;
+                float* y = b.data() + oy;
+                float* p = g.data() + op;
+                float* q = e.data() + op;
+
+                // a mean far from zero now and then, for the variance:
+                const float shift = trial % 4 == 0 ? 1000.0f : 0.0f;
+                v.fill(x, total, shift - 20.0f, shift + 20.0f, f.second == layer_fn::relu);
+                v.fill(p, cols, -2.0f, 2.0f, false);
+                v.fill(q, cols, -2.0f, 2.0f, false);
+                if(f.second == layer_fn::softmax || f.second == layer_fn::log_softmax){
+                    for(size_t i = 0; i < total; ++i){
+                        if(v.rng()() % 8 == 0){
+                            x[i] = -INFINITY;
+                        }
+                    }
+                }
+
+                layer_call(f.second, false, x, p, q, y, rows, cols);
+                for(size_t r = 0; r < rows; ++r){
+                    layer_reference(f.second, x + r * cols, p, q, cols, ref.data(), scale.data());
+                    for(size_t i = 0; i < cols; ++i){
+                        v.expect_close("rows=" + to_string(rows) + " cols=" + to_string(cols), r * cols + i,
+                                       ref[i], y[r * cols + i], 64, scale[i]);
+                    }
+                }
+
+                layer_call(f.second, true, x, p, q, c.data(), rows, cols);
+                for(size_t i = 0; i < total; ++i){
+                    v.expect_close("mt cols=" + to_string(cols), i, y[i], c[i], 0);
+                }
+
+                layer_call(f.second, false, x, p, q, x, rows, cols);
+                for(size_t i = 0; i < total; ++i){
+                    v.expect_close("in-place cols=" + to_string(cols), i, y[i], x[i], 0);
+                }
+            }
+            v.end();
+        }
+    }
+
+    simd_set_parallel_threshold(threshold);
+    simd_set_threads(threads);
+}
+
+/**
+ * @brief the pixel a row or column index i of a line of n reads under a
+ * border mode, -1 for a zero
+ */
+static ptrdiff_t conv2d_source(ptrdiff_t i, size_t n, simd_border border){
+    const ptrdiff_t last = (ptrdiff_t)n - 1;
+    if(border == simd_border::clamp){
+        return min(max<ptrdiff_t>(i, 0), last);
+    }
+    if(border == simd_border::reflect){
+        // bounce between the edges until inside:
+        while(i < 0 || i > last){
+            i = i < 0 ? -i : 2 * last - i;
+            if(last == 0){
+                i = 0;
+            }
+        }
+        return i;
+    }
+    return i < 0 || i > last ? -1 : i;
+}
+
+/**
+ * @brief the general and the separable 2D convolution against double
+ * precision, within kw kh + 2 ulp of the sum of the absolute terms; random
+ * image sizes and row strides, odd and even filters up to 9 x 9 (some
+ * larger than the image) and every border mode. The multi-threaded
+ * versions (on at least 4 threads, every image through the pool) give the
+ * same bits.
+ */
+static void verify_conv2d(verifier& v, const bench_options& opt){
+    const size_t threads = simd_threads();
+    const size_t threshold = simd_parallel_threshold();
+    simd_set_threads(max<size_t>(threads, 4));
+    simd_set_parallel_threshold(0);
+
+    static const pair<const char*, simd_border> borders[] = {
+        {"zero", simd_border::zero}, {"clamp", simd_border::clamp}, {"reflect", simd_border::reflect},
+    };
+    for(simd_isa isa : bench_levels(opt)){
+        simd_set_isa(isa);
+        for(bool separable : {false, true}){
+            v.begin(separable ? "conv2d separable" : "conv2d", simd_isa_name(isa));
+            for(int trial = 0; trial < 150; ++trial){
+                const size_t w = 1 + v.random_size(trial % 4 == 0 ? 8 : 150);
+                const size_t ht = 1 + v.rng()() % (trial % 4 == 0 ? 8 : 40);
+                const size_t kw = 1 + v.rng()() % 9, kh = 1 + v.rng()() % 9;
+                const size_t xs = w + random_offset(v), ys = w + random_offset(v);
+                const auto& border = borders[trial % 3];
+
+                vector<float> x(ht * xs), y(ht * ys, 0.0f), c(ht * ys, 0.0f), hx(kw), hy(kh), f(kw * kh);
+                v.fill(x.data(), x.size(), -1.0f, 1.0f, false);
+                v.fill(hx.data(), kw, -1.0f, 1.0f, false);
+                v.fill(hy.data(), kh, -1.0f, 1.0f, false);
+                if(separable){
+                    for(size_t i = 0; i < kh; ++i){
+                        for(size_t j = 0; j < kw; ++j){
+                            f[i * kw + j] = hy[i] * hx[j];
+                        }
+                    }
+                    simd_conv2d_separable(x.data(), w, ht, xs, hx.data(), kw, hy.data(), kh, y.data(), ys, border.second);
+                    simd_parallel_conv2d_separable(x.data(), w, ht, xs, hx.data(), kw, hy.data(), kh, c.data(), ys,
+                                                   border.second);
+                }
+                else{
+                    v.fill(f.data(), f.size(), -1.0f, 1.0f, false);
+                    simd_conv2d(x.data(), w, ht, xs, f.data(), kw, kh, y.data(), ys, border.second);
+                    simd_parallel_conv2d(x.data(), w, ht, xs, f.data(), kw, kh, c.data(), ys, border.second);
+                }
+
+                const string what = string(border.first) + " " + to_string(w) + "x" + to_string(ht)
+                                  + " filter " + to_string(kw) + "x" + to_string(kh);
+                for(size_t r = 0; r < ht; ++r){
+                    for(size_t col = 0; col < w; ++col){
+                        double ref = 0.0, scale = 0.0;
+                        for(size_t i = 0; i < kh; ++i){
+                            const ptrdiff_t sr = conv2d_source((ptrdiff_t)(r + kh / 2) - (ptrdiff_t)i, ht, border.second);
+                            for(size_t j = 0; j < kw; ++j){
+                                const ptrdiff_t sc = conv2d_source((ptrdiff_t)(col + kw / 2) - (ptrdiff_t)j, w,
+                                                                   border.second);
+                                if(sr >= 0 && sc >= 0){
+                                    // the separable filter's taps are products of float taps:
+                                    const double t = separable ? (double)hy[i] * hx[j] : f[i * kw + j];
+                                    ref += t * x[sr * xs + sc];
+                                    scale += fabs(t * x[sr * xs + sc]);
+                                }
+                            }
+                        }
+                        v.expect_close(what, r * ys + col, (float)ref, y[r * ys + col], (uint32_t)(kw * kh + 2),
+                                       (float)scale);
+                    }
+                }
+                for(size_t i = 0; i < y.size(); ++i){
+                    v.expect_close("mt " + what, i, y[i], c[i], 0);
+                }
+            }
+            v.end();
+        }
+    }
+
+    simd_set_parallel_threshold(threshold);
+    simd_set_threads(threads);
+}
+
+/**
+ * @brief random layers in both layouts against double precision, within
+ * K + 4 ulp of the sum of the absolute terms (K the filter size, as for
+ * sgemm): batches, groups up to depthwise, kernels, strides, padding and
+ * dilation, some outputs large enough to take several tiles and the 1 x 1
+ * layers that skip the gather; with and without bias. The output with a
+ * caller workspace of exactly simd_conv_layer_workspace() floats has the
+ * same bits as with the scratch arena.
+ */
+static void verify_conv_layer(verifier& v, const bench_options& opt){
+    for(simd_isa isa : bench_levels(opt)){
+        simd_set_isa(isa);
+        v.begin("conv_layer", simd_isa_name(isa));
+        for(int trial = 0; trial < 200; ++trial){
+            auto pick = [&](size_t lo, size_t hi){ return uniform_int_distribution<size_t>(lo, hi)(v.rng()); };
+            simd_conv_layer l = {pick(1, 2), 0, pick(1, trial % 4 == 0 ? 40 : 16), pick(1, 16), 0,
+                                 pick(1, 5), pick(1, 5)};
+            const size_t cg = pick(1, trial % 8 == 0 ? 40 : 6), fg = pick(1, 5);
+            l.groups = trial % 6 == 5 ? pick(2, 4) : 1;
+            if(trial % 10 == 9){
+                // depthwise:
+                l.groups = pick(2, 8);
+            }
+            l.channels = l.groups * (trial % 10 == 9 ? 1 : cg);
+            l.filters = l.groups * fg;
+            l.stride_h = pick(1, 3);
+            l.stride_w = pick(1, 3);
+            l.pad_h = pick(0, 3);
+            l.pad_w = pick(0, 3);
+            l.dilation_h = pick(1, 2);
+            l.dilation_w = pick(1, 2);
+            if(trial % 5 == 0){
+                l.kernel_h = l.kernel_w = l.stride_h = l.stride_w = 1;
+                l.pad_h = l.pad_w = 0;
+            }
+            l.layout = trial % 2 ? simd_layout::nhwc : simd_layout::nchw;
+            const bool nchw = l.layout == simd_layout::nchw;
+
+            const size_t oh = simd_conv_layer_height(l), ow = simd_conv_layer_width(l);
+            const size_t k = l.channels / l.groups * l.kernel_h * l.kernel_w;
+            const size_t in = l.batch * l.channels * l.height * l.width, out = l.batch * l.filters * oh * ow;
+            vector<float> x(in), w(l.filters * k), bias(l.filters), y(out, 0.0f), y2(out, 0.0f);
+            vector<float> workspace(simd_conv_layer_workspace(l));
+            v.fill(x.data(), in, -1.0f, 1.0f, false);
+            v.fill(w.data(), w.size(), -1.0f, 1.0f, false);
+            v.fill(bias.data(), l.filters, -1.0f, 1.0f, false);
+            const float* b = trial % 3 == 2 ? nullptr : bias.data();
+
+            simd_conv_layer_forward(l, x.data(), w.data(), b, y.data());
+            simd_conv_layer_forward(l, x.data(), w.data(), b, y2.data(), workspace.data());
+
+            const size_t cg_in = l.channels / l.groups, fg_out = l.filters / l.groups;
+            const string what = string(nchw ? "nchw " : "nhwc ") + to_string(l.channels) + "x"
+                              + to_string(l.height) + "x" + to_string(l.width) + " -> " + to_string(l.filters)
+                              + " k=" + to_string(l.kernel_h) + "x" + to_string(l.kernel_w) + " s="
+                              + to_string(l.stride_h) + "," + to_string(l.stride_w) + " p=" + to_string(l.pad_h)
+                              + "," + to_string(l.pad_w) + " d=" + to_string(l.dilation_h) + ","
+                              + to_string(l.dilation_w) + " g=" + to_string(l.groups);
+            for(size_t n = 0; n < l.batch; ++n){
+                for(size_t f = 0; f < l.filters; ++f){
+                    const size_t g = f / fg_out;
+                    for(size_t r = 0; r < oh; ++r){
+                        for(size_t col = 0; col < ow; ++col){
+                            double ref = b ? b[f] : 0.0, scale = fabs(ref);
+                            for(size_t c = 0; c < cg_in; ++c){
+                                const size_t ch = g * cg_in + c;
+                                for(size_t i = 0; i < l.kernel_h; ++i){
+                                    const ptrdiff_t iy = (ptrdiff_t)(r * l.stride_h + i * l.dilation_h)
+                                                       - (ptrdiff_t)l.pad_h;
+                                    for(size_t j = 0; j < l.kernel_w; ++j){
+                                        const ptrdiff_t ix = (ptrdiff_t)(col * l.stride_w + j * l.dilation_w)
+                                                           - (ptrdiff_t)l.pad_w;
+                                        if(iy < 0 || iy >= (ptrdiff_t)l.height || ix < 0 || ix >= (ptrdiff_t)l.width){
+                                            continue;
+                                        }
+                                        const double xv = nchw ? x[((n * l.channels + ch) * l.height + iy) * l.width + ix]
+                                                               : x[((n * l.height + iy) * l.width + ix) * l.channels + ch];
+                                        const double wv = nchw ? w[((f * cg_in + c) * l.kernel_h + i) * l.kernel_w + j]
+                                                               : w[((f * l.kernel_h + i) * l.kernel_w + j) * cg_in + c];
+                                        ref += wv * xv;
+                                        scale += fabs(wv * xv);
+                                    }
+                                }
+                            }
+                            const size_t o = nchw ? ((n * l.filters + f) * oh + r) * ow + col
+                                                  : ((n * oh + r) * ow + col) * l.filters + f;
+                            v.expect_close(what, o, (float)ref, y[o], (uint32_t)k + 4, (float)scale);
+                        }
+                    }
+                }
+            }
+            for(size_t i = 0; i < out; ++i){
+                v.expect_close("workspace " + what, i, y[i], y2[i], 0);
+            }
+        }
+        v.end();
+    }
+}
+
+struct example {
+    const char* name;
+    vector<size_t> sizes;
+    void (*run)(harness& h, size_t n);
+    void (*verify)(verifier& v, const bench_options& opt);
+};
+
+// vectors: L1 .. DRAM resident, tensors: number of 4x4 products, convolution: signal length (16 taps),
+// batches: number of independent 4x4 products, conv_engine: signal length (16, 256 and 4096 taps),
+// fir_stream: samples per chunk (16 and 256 taps), expr: vector length,
+// alloc: floats per temporary, vec_add_stream: vector length around the LLC size, reduce: vector length,
+// vec_half: vector length, conv_half: signal length (16 taps), vec_int: vector length,
+// conv_quant: signal length (16 taps), vec_f64: vector length, tensor_f64: number of 4x4 operations,
+// conv_f64: signal length (16 taps), sgemm: n of n x n x n, vec_tail: vector length, math: vector length,
+// recip: vector length, layers: row length (256 rows), conv2d: n of the n x n filter on a 3840 x 2160 image,
+// conv_layer: images per batch
+static const vector<size_t> vector_sizes = {1 << 10, 1 << 14, 1 << 17, 1 << 20, 1 << 24};
+static const vector<size_t> tensor_sizes = {1, 64, 4096, 1 << 18};
+static const vector<size_t> conv_sizes   = {64, 256, 1024, 4096};
+static const vector<size_t> batch_sizes  = {64, 4096, 1 << 16, 1 << 20};
+static const vector<size_t> engine_sizes = {4096, 1 << 16, 1 << 20};
+static const vector<size_t> chunk_sizes  = {256, 1024, 4096};
+static const vector<size_t> alloc_sizes  = {256, 4096, 1 << 16, 1 << 20};
+static const vector<size_t> stream_sizes = {1 << 18, 1 << 20, 1 << 22, 1 << 24};
+static const vector<size_t> sgemm_sizes  = {64, 256, 1024, 2048};
+static const vector<size_t> tail_sizes   = {1, 3, 4, 7, 8, 13, 15, 16, 17, 31, 32, 33, 47, 63, 64};
+static const vector<size_t> layer_sizes  = {512, 1024, 4096};
+static const vector<size_t> conv2d_sizes = {5, 9, 15};
+static const vector<size_t> cnn_sizes    = {1, 4};
+
+static const example examples[] = {
+    {"vec_add", vector_sizes,
+     [](harness& h, size_t n){ bench_vector(h, "vec_add", simd_add, n); },
+     [](verifier& v, const bench_options& o){ verify_vector(v, o, "vec_add", simd_add, add); }},
+    {"vec_sub", vector_sizes,
+     [](harness& h, size_t n){ bench_vector(h, "vec_sub", simd_sub, n); },
+     [](verifier& v, const bench_options& o){ verify_vector(v, o, "vec_sub", simd_sub, sub); }},
+    {"vec_mul", vector_sizes,
+     [](harness& h, size_t n){ bench_vector(h, "vec_mul", simd_mul, n); },
+     [](verifier& v, const bench_options& o){ verify_vector(v, o, "vec_mul", simd_mul, mul); }},
+    {"vec_div", vector_sizes,
+     [](harness& h, size_t n){ bench_vector(h, "vec_div", simd_div, n); },
+     [](verifier& v, const bench_options& o){ verify_vector(v, o, "vec_div", simd_div, div); }},
+    {"vec_add_mt", vector_sizes,
+     [](harness& h, size_t n){ bench_parallel(h, "vec_add_mt", simd_parallel_add, n); },
+     [](verifier& v, const bench_options&){ verify_parallel(v, "vec_add_mt", simd_parallel_add, add); }},
+    {"vec_sub_mt", vector_sizes,
+     [](harness& h, size_t n){ bench_parallel(h, "vec_sub_mt", simd_parallel_sub, n); },
+     [](verifier& v, const bench_options&){ verify_parallel(v, "vec_sub_mt", simd_parallel_sub, sub); }},
+    {"vec_mul_mt", vector_sizes,
+     [](harness& h, size_t n){ bench_parallel(h, "vec_mul_mt", simd_parallel_mul, n); },
+     [](verifier& v, const bench_options&){ verify_parallel(v, "vec_mul_mt", simd_parallel_mul, mul); }},
+    {"vec_div_mt", vector_sizes,
+     [](harness& h, size_t n){ bench_parallel(h, "vec_div_mt", simd_parallel_div, n); },
+     [](verifier& v, const bench_options&){ verify_parallel(v, "vec_div_mt", simd_parallel_div, div); }},
+    {"tensor_add", tensor_sizes,
+     [](harness& h, size_t n){ bench_tensor(h, "tensor_add", simd_add, n); },
+     [](verifier& v, const bench_options& o){ verify_tensor(v, o, "tensor_add", simd_add, add, false); }},
+    {"tensor_sub", tensor_sizes,
+     [](harness& h, size_t n){ bench_tensor(h, "tensor_sub", simd_sub, n); },
+     [](verifier& v, const bench_options& o){ verify_tensor(v, o, "tensor_sub", simd_sub, sub, false); }},
+    {"tensor_mul", tensor_sizes,
+     [](harness& h, size_t n){ bench_tensor(h, "tensor_mul", simd_mul, n); },
+     [](verifier& v, const bench_options& o){ verify_tensor(v, o, "tensor_mul", simd_mul, mul, true); }},
+    {"tensor_mul_batch", batch_sizes,
+     [](harness& h, size_t n){ bench_batch(h, "tensor_mul_batch", simd_mul_batch, n, false); },
+     [](verifier& v, const bench_options& o){ verify_batch(v, o, "tensor_mul_batch", simd_mul_batch, false); }},
+    {"tensor_mul_batch_soa", batch_sizes, bench_batch_soa, verify_batch_soa},
+    {"tensor_mul_batch_mt", batch_sizes,
+     [](harness& h, size_t n){ bench_batch(h, "tensor_mul_batch_mt", simd_parallel_mul_batch, n, true); },
+     [](verifier& v, const bench_options& o){ verify_batch(v, o, "tensor_mul_batch_mt", simd_parallel_mul_batch, true); }},
+    {"convolution", conv_sizes, bench_conv, verify_conv},
+    {"conv_engine", engine_sizes, bench_conv_engine, verify_conv_engine},
+    {"fir_stream", chunk_sizes, bench_fir_stream, verify_fir_stream},
+    {"expr", vector_sizes, bench_expr, verify_expr},
+    {"alloc", alloc_sizes, bench_alloc, verify_alloc},
+    {"vec_add_stream", stream_sizes, bench_stream, verify_stream},
+    {"reduce", vector_sizes, bench_reduce, verify_reduce},
+    {"vec_half", vector_sizes, bench_vec_half, verify_half},
+    {"conv_half", conv_sizes, bench_conv_half, verify_conv_half},
+    {"vec_int", vector_sizes, bench_vec_int, verify_int},
+    {"conv_quant", conv_sizes, bench_conv_quant, verify_conv_quant},
+    {"vec_f64", vector_sizes, bench_vec_f64, verify_vec_f64},
+    {"tensor_f64", tensor_sizes, bench_tensor_f64, verify_tensor_f64},
+    {"conv_f64", conv_sizes, bench_conv_f64, verify_conv_f64},
+    {"sgemm", sgemm_sizes, bench_sgemm, verify_sgemm},
+    {"vec_tail", tail_sizes, bench_vec_tail, verify_vec_tail},
+    {"math", vector_sizes, bench_math, verify_math},
+    {"recip", vector_sizes, bench_recip, verify_recip},
+    {"layers", layer_sizes, bench_layers, verify_layers},
+    {"conv2d", conv2d_sizes, bench_conv2d, verify_conv2d},
+    {"conv_layer", cnn_sizes, bench_conv_layer, verify_conv_layer},
+};
+
+static void usage(){
+    cerr << "usage: bench [--sizes=N,...] [--trials=N] [--warmup-ms=N] [--min-trial-ms=N]" << endl
+         << "             [--isa=LEVEL] [--ghz=F] [--format=table|csv|json] [--out=FILE] [example...]" << endl
+         << "       bench --verify [--seed=N] [--isa=LEVEL] [example...]" << endl;
+    cerr << "examples:";
+    for(const auto& e : examples){
+        cerr << " " << e.name;
+    }
+    cerr << endl;
+}
+
+int main(int argc, char** argv){
+    bench_options opt;
+    if(!parse_bench_options(argc, argv, opt)){
+        usage();
+        return(1);
+    }
+
+    vector<const example*> selected;
+    for(int i = 1; i < argc; ++i){
+        const auto it = find_if(begin(examples), end(examples),
+                                [&](const example& e){ return strcmp(argv[i], e.name) == 0; });
+        if(it == end(examples)){
+            cerr << "unknown example: " << argv[i] << endl;
+            usage();
+            return(1);
+        }
+        selected.push_back(&*it);
+    }
+    if(selected.empty()){
+        for(const auto& e : examples){
+            selected.push_back(&e);
+        }
+    }
+
+    if(opt.verify){
+        verifier v(opt.seed);
+        for(const example* e : selected){
+            e->verify(v, opt);
+        }
+        if(v.failures() != 0){
+            cout << v.failures() << " kernel/level combination(s) FAILED (seed " << opt.seed << ")" << endl;
+            return(1);
+        }
+        cout << "all kernels match their references" << endl;
+        return(0);
+    }
+
+    harness h(opt);
+    for(const example* e : selected){
+        for(size_t n : opt.sizes.empty() ? e->sizes : opt.sizes){
+            e->run(h, n);
+        }
+    }
+    h.finish();
+
+    return(0);
+}
@@ -0,0 +1,216 @@
+/**
+ * @file harness.cpp
+ * @author Sravan Senthilnathan
+ * @brief statistics and report output of the benchmark harness
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2023
+ * 
+ */
+#include "harness.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <numeric>
+#include <sstream>
+
+using namespace std;
+
+static const char* table_header =
+    "kernel                 isa        n          min(ns)      median(ns)   p99(ns)      cyc/elem  GB/s      extra\n";
+
+static void write_row(ostream& os, const bench_result& r){
+    char line[256];
+    snprintf(line, sizeof(line), "%-22s %-10s %-10zu %-12.1f %-12.1f %-12.1f %-9.3f %-9.2f",
+             r.kernel.c_str(), r.isa.c_str(), r.n, r.min_ns, r.median_ns, r.p99_ns,
+             r.cycles_per_element, r.gb_per_s);
+    os << line;
+    if(!r.extra_name.empty()){
+        os << " " << r.extra << " " << r.extra_name;
+    }
+    if(!r.error_name.empty()){
+        os << " " << r.error << " " << r.error_name;
+    }
+    os << "\n";
+}
+
+harness::harness(const bench_options& opt) : opt_(opt){
+    if(opt_.trials < 1){
+        opt_.trials = 1;
+    }
+    if(opt_.format == bench_format::table && opt_.out.empty()){
+        cout << table_header;
+    }
+}
+
+bench_result& harness::record(const string& kernel, const string& isa, size_t n,
+                              double elements, double bytes, const string& extra_name,
+                              double extra_per_call, vector<double>& samples,
+                              double cycles_per_call){
+    sort(samples.begin(), samples.end());
+
+    // nearest rank percentile:
+    auto percentile = [&](double p){
+        size_t rank = (size_t)ceil(p / 100.0 * samples.size());
+        return samples[rank == 0 ? 0 : rank - 1];
+    };
+
+    bench_result r;
+    r.kernel = kernel;
+    r.isa = isa;
+    r.n = n;
+    r.elements = elements;
+    r.bytes = bytes;
+    r.min_ns = samples.front();
+    r.median_ns = percentile(50);
+    r.p99_ns = percentile(99);
+    r.mean_ns = accumulate(samples.begin(), samples.end(), 0.0) / samples.size();
+
+    if(cycles_per_call <= 0 && opt_.ghz > 0){
+        cycles_per_call = r.median_ns * opt_.ghz;
+    }
+    r.cycles_per_element = elements > 0 ? cycles_per_call / elements : 0;
+    r.gb_per_s = r.median_ns > 0 ? bytes / r.median_ns : 0;
+    r.extra_name = extra_name;
+    r.extra = r.median_ns > 0 ? extra_per_call / (r.median_ns * 1e-9) : 0;
+    r.error_name = error_name_;
+    r.error = error_;
+    error_name_.clear();
+    error_ = 0.0;
+
+    results_.push_back(r);
+
+    if(opt_.format == bench_format::table && opt_.out.empty()){
+        write_row(cout, r);
+        cout.flush();
+    }
+    return results_.back();
+}
+
+void harness::write(ostream& os) const{
+    switch(opt_.format){
+        case bench_format::table:
+            os << table_header;
+            for(const auto& r : results_){
+                write_row(os, r);
+            }
+            break;
+
+        case bench_format::csv:
+            os << "kernel,isa,n,elements,bytes,min_ns,median_ns,p99_ns,mean_ns,cycles_per_element,gb_per_s,extra_name,extra,error_name,error\n";
+            for(const auto& r : results_){
+                os << r.kernel << "," << r.isa << "," << r.n << "," << r.elements << "," << r.bytes << ","
+                   << r.min_ns << "," << r.median_ns << "," << r.p99_ns << "," << r.mean_ns << ","
+                   << r.cycles_per_element << "," << r.gb_per_s << ","
+                   << r.extra_name << "," << r.extra << "," << r.error_name << "," << r.error << "\n";
+            }
+            break;
+
+        case bench_format::json:
+            os << "[\n";
+            for(size_t i = 0; i < results_.size(); ++i){
+                const auto& r = results_[i];
+                os << "  {\"kernel\": \"" << r.kernel << "\", \"isa\": \"" << r.isa << "\", \"n\": " << r.n
+                   << ", \"elements\": " << r.elements << ", \"bytes\": " << r.bytes
+                   << ", \"min_ns\": " << r.min_ns << ", \"median_ns\": " << r.median_ns
+                   << ", \"p99_ns\": " << r.p99_ns << ", \"mean_ns\": " << r.mean_ns
+                   << ", \"cycles_per_element\": " << r.cycles_per_element
+                   << ", \"gb_per_s\": " << r.gb_per_s;
+                if(!r.extra_name.empty()){
+                    os << ", \"" << r.extra_name << "\": " << r.extra;
+                }
+                if(!r.error_name.empty()){
+                    os << ", \"" << r.error_name << "\": " << r.error;
+                }
+                os << "}" << (i + 1 < results_.size() ? "," : "") << "\n";
+            }
+            os << "]\n";
+            break;
+    }
+}
+
+void harness::finish() const{
+    if(!opt_.out.empty()){
+        ofstream f(opt_.out);
+        write(f);
+    }
+    else if(opt_.format != bench_format::table){
+        write(cout);
+    }
+}
+
+static bool parse_sizes(const char* s, vector<size_t>& sizes){
+    sizes.clear();
+    stringstream ss(s);
+    string item;
+    while(getline(ss, item, ',')){
+        char* end = nullptr;
+        unsigned long long v = strtoull(item.c_str(), &end, 10);
+        if(end == item.c_str()){
+            return false;
+        }
+        // allow k/m suffixes, e.g. 16k or 4m elements:
+        if(*end == 'k' || *end == 'K') v <<= 10;
+        if(*end == 'm' || *end == 'M') v <<= 20;
+        sizes.push_back((size_t)v);
+    }
+    return !sizes.empty();
+}
+
+bool parse_bench_options(int& argc, char** argv, bench_options& opt){
+    int out = 1;
+    for(int i = 1; i < argc; ++i){
+        const char* a = argv[i];
+        auto value = [&](const char* name) -> const char* {
+            const size_t l = strlen(name);
+            return strncmp(a, name, l) == 0 && a[l] == '=' ? a + l + 1 : nullptr;
+        };
+
+        if(const char* v = value("--sizes")){
+            if(!parse_sizes(v, opt.sizes)) return false;
+        }
+        else if(const char* v = value("--trials")){
+            opt.trials = atoi(v);
+        }
+        else if(const char* v = value("--warmup-ms")){
+            opt.warmup_ms = atof(v);
+        }
+        else if(const char* v = value("--min-trial-ms")){
+            opt.min_trial_ms = atof(v);
+        }
+        else if(const char* v = value("--ghz")){
+            opt.ghz = atof(v);
+        }
+        else if(const char* v = value("--isa")){
+            opt.isa = v;
+        }
+        else if(const char* v = value("--seed")){
+            opt.seed = (unsigned)strtoul(v, nullptr, 10);
+        }
+        else if(strcmp(a, "--verify") == 0){
+            opt.verify = true;
+        }
+        else if(const char* v = value("--out")){
+            opt.out = v;
+        }
+        else if(const char* v = value("--format")){
+            if(strcmp(v, "table") == 0)     opt.format = bench_format::table;
+            else if(strcmp(v, "csv") == 0)  opt.format = bench_format::csv;
+            else if(strcmp(v, "json") == 0) opt.format = bench_format::json;
+            else return false;
+        }
+        else if(strncmp(a, "--", 2) == 0){
+            return false;
+        }
+        else{
+            argv[out++] = argv[i];
+        }
+    }
+    argc = out;
+    return true;
+}
@@ -0,0 +1,191 @@
+/**
+ * @file harness.h
+ * @author Sravan Senthilnathan
+ * @brief repeated-trial benchmark harness used by the bench program
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2023
+ * 
+ * Every measurement first touches its buffers (done by the caller), then runs
+ * the kernel for a warmup period so caches, TLBs and the clock frequency
+ * settle, then times a number of trials. Each trial repeats the kernel often
+ * enough to last at least min_trial_ms, so the clock resolution does not
+ * matter. The per call time of every trial is kept and summarised as
+ * min/median/p99.
+ */
+#ifndef HARNESS_H
+#define HARNESS_H
+
+#include <chrono>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+/**
+ * @brief keeps the compiler from dropping a kernel call whose output is unused
+ */
+inline void do_not_optimize(const void* p){
+    __asm__ volatile("" : : "r"(p) : "memory");
+}
+
+/**
+ * @brief cycle counter: the TSC on x86, zero where there is none
+ * (cycles are then derived from --ghz)
+ */
+inline uint64_t cycle_count(){
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    return 0;
+#endif
+}
+
+enum class bench_format { table, csv, json };
+
+struct bench_options {
+    std::vector<size_t> sizes;      // overrides each example's default sweep
+    int trials = 25;
+    double warmup_ms = 50.0;
+    double min_trial_ms = 2.0;
+    double ghz = 0.0;               // core clock for cycles/element where no TSC exists
+    bench_format format = bench_format::table;
+    std::string out;                // write the report here instead of stdout
+    std::string isa;                // only time this level
+    bool verify = false;            // check results instead of timing
+    unsigned seed = 1;              // random inputs of --verify
+};
+
+struct bench_result {
+    std::string kernel;
+    std::string isa;
+    size_t n;                       // problem size of one call
+    double elements;                // elements produced per call
+    double bytes;                   // bytes read + written per call
+    double min_ns;
+    double median_ns;
+    double p99_ns;
+    double mean_ns;
+    double cycles_per_element;
+    double gb_per_s;                // from the median
+    std::string extra_name;         // optional kernel specific rate, e.g. "matrices/s"
+    double extra = 0.0;
+    std::string error_name;         // optional accuracy figure, e.g. "rel err vs fp32"
+    double error = 0.0;
+};
+
+class harness {
+public:
+    explicit harness(const bench_options& opt);
+
+    /**
+     * @brief times fn, which performs one call of the kernel under test
+     * 
+     * @param kernel kernel name, e.g. "vec_add"
+     * @param isa implementation name, e.g. "avx2" or "reference"
+     * @param n problem size
+     * @param elements elements produced by one call
+     * @param bytes bytes read and written by one call
+     * @param fn the call
+     * @return the stored result
+     */
+    template<class F>
+    bench_result& run(const std::string& kernel, const std::string& isa, size_t n,
+                      double elements, double bytes, F&& fn){
+        return run(kernel, isa, n, elements, bytes, std::string(), 0.0, std::forward<F>(fn));
+    }
+
+    /**
+     * @brief same, additionally reporting a kernel specific rate
+     * 
+     * @param extra_name unit of the rate, e.g. "GFLOP/s"
+     * @param extra_per_call units of work done by one call, e.g. 2mnk * 1e-9
+     */
+    template<class F>
+    bench_result& run(const std::string& kernel, const std::string& isa, size_t n,
+                      double elements, double bytes, const std::string& extra_name,
+                      double extra_per_call, F&& fn){
+        using clock = std::chrono::steady_clock;
+
+        // warmup:
+        const auto warm_end = clock::now() + std::chrono::duration<double, std::milli>(opt_.warmup_ms);
+        size_t calls = 0;
+        double single_ns = 0;
+        do {
+            const auto st = clock::now();
+            fn();
+            const auto sp = clock::now();
+            single_ns = std::chrono::duration<double, std::nano>(sp - st).count();
+            ++calls;
+        } while(clock::now() < warm_end);
+
+        // enough repetitions for one trial to outlast the timer resolution:
+        size_t reps = 1;
+        if(single_ns > 0){
+            reps = (size_t)(opt_.min_trial_ms * 1e6 / single_ns) + 1;
+        }
+
+        std::vector<double> samples(opt_.trials);
+        uint64_t cycles = 0;
+        for(auto& s : samples){
+            const uint64_t c0 = cycle_count();
+            const auto st = clock::now();
+            for(size_t r = 0; r < reps; ++r){
+                fn();
+            }
+            const auto sp = clock::now();
+            cycles += cycle_count() - c0;
+            s = std::chrono::duration<double, std::nano>(sp - st).count() / reps;
+        }
+
+        return record(kernel, isa, n, elements, bytes, extra_name, extra_per_call, samples,
+                      (double)cycles / ((double)reps * opt_.trials));
+    }
+
+    /**
+     * @brief attaches an accuracy figure to the next result, e.g. the error
+     * of a reduced precision kernel against its float version
+     */
+    void set_error(const std::string& name, double error){
+        error_name_ = name;
+        error_ = error;
+    }
+
+    /**
+     * @brief writes every result in the selected format
+     */
+    void write(std::ostream& os) const;
+
+    /**
+     * @brief writes the report to stdout or --out
+     */
+    void finish() const;
+
+    const bench_options& options() const { return opt_; }
+
+private:
+    bench_result& record(const std::string& kernel, const std::string& isa, size_t n,
+                         double elements, double bytes, const std::string& extra_name,
+                         double extra_per_call, std::vector<double>& samples,
+                         double cycles_per_call);
+
+    bench_options opt_;
+    std::vector<bench_result> results_;
+    std::string error_name_;
+    double error_ = 0.0;
+};
+
+/**
+ * @brief parses the harness options out of argv, leaving the rest (example names) in place
+ * 
+ * @return false on a malformed option
+ */
+bool parse_bench_options(int& argc, char** argv, bench_options& opt);
+
+#endif
@@ -0,0 +1,171 @@
+/**
+ * @file verify.cpp
+ * @author Sravan Senthilnathan
+ * @brief comparison helpers of the kernel verification
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2023
+ * 
+ */
+#include "verify.h"
+
+#include <cfloat>
+#include <cmath>
+#include <cstring>
+#include <iostream>
+#include <limits>
+
+using namespace std;
+
+uint32_t ulp_distance(float a, float b){
+    if(isnan(a) || isnan(b)){
+        return isnan(a) && isnan(b) ? 0 : UINT32_MAX;
+    }
+
+    // map the sign-magnitude bit patterns onto a monotonic integer line:
+    auto ordered = [](float f){
+        int32_t i;
+        memcpy(&i, &f, sizeof(i));
+        return i < 0 ? (int64_t)INT32_MIN - i : (int64_t)i;
+    };
+    const int64_t d = ordered(a) - ordered(b);
+    return (uint32_t)min<int64_t>(d < 0 ? -d : d, UINT32_MAX);
+}
+
+uint32_t ulp_distance(double a, double b){
+    if(isnan(a) || isnan(b)){
+        return isnan(a) && isnan(b) ? 0 : UINT32_MAX;
+    }
+
+    auto ordered = [](double f){
+        int64_t i;
+        memcpy(&i, &f, sizeof(i));
+        return i < 0 ? INT64_MIN - i : i;
+    };
+    // the distance can exceed INT64_MAX, take it unsigned:
+    const int64_t oa = ordered(a), ob = ordered(b);
+    const uint64_t d = oa >= ob ? (uint64_t)oa - (uint64_t)ob : (uint64_t)ob - (uint64_t)oa;
+    return (uint32_t)min<uint64_t>(d, UINT32_MAX);
+}
+
+verifier::verifier(unsigned seed) : rng_(seed){}
+
+size_t verifier::random_size(size_t max){
+    uniform_int_distribution<int> pick(0, 3);
+    switch(pick(rng_)){
+        case 0:  return uniform_int_distribution<size_t>(0, min<size_t>(max, 20))(rng_);
+        case 1:  return uniform_int_distribution<size_t>(0, min<size_t>(max, 130))(rng_);
+        default: return uniform_int_distribution<size_t>(0, max)(rng_);
+    }
+}
+
+void verifier::fill(float* p, size_t n, float lo, float hi, bool specials){
+    static const float special_values[] = {
+        numeric_limits<float>::quiet_NaN(),
+        numeric_limits<float>::infinity(),
+        -numeric_limits<float>::infinity(),
+        0.0f, -0.0f,
+        numeric_limits<float>::denorm_min(),
+        -FLT_MIN / 3.0f,
+        FLT_MAX, -FLT_MAX, FLT_MIN,
+    };
+    uniform_real_distribution<float> value(lo, hi);
+    uniform_int_distribution<int> special(0, 19);
+    uniform_int_distribution<size_t> which(0, size(special_values) - 1);
+
+    for(size_t i = 0; i < n; ++i){
+        p[i] = specials && special(rng_) == 0 ? special_values[which(rng_)] : value(rng_);
+    }
+}
+
+void verifier::fill(double* p, size_t n, double lo, double hi, bool specials){
+    static const double special_values[] = {
+        numeric_limits<double>::quiet_NaN(),
+        numeric_limits<double>::infinity(),
+        -numeric_limits<double>::infinity(),
+        0.0, -0.0,
+        numeric_limits<double>::denorm_min(),
+        -DBL_MIN / 3.0,
+        DBL_MAX, -DBL_MAX, DBL_MIN,
+    };
+    uniform_real_distribution<double> value(lo, hi);
+    uniform_int_distribution<int> special(0, 19);
+    uniform_int_distribution<size_t> which(0, size(special_values) - 1);
+
+    for(size_t i = 0; i < n; ++i){
+        p[i] = specials && special(rng_) == 0 ? special_values[which(rng_)] : value(rng_);
+    }
+}
+
+void verifier::begin(const string& kernel, const string& isa){
+    current_ = kernel + " [" + isa + "]";
+    mismatches_ = 0;
+    checked_ = 0;
+    worst_ulp_ = 0;
+}
+
+bool verifier::expect_close(const string& what, size_t i, float ref, float got, uint32_t max_ulp, float scale){
+    ++checked_;
+
+    const uint32_t ulp = ulp_distance(ref, got);
+    bool ok = ulp <= max_ulp;
+    if(!ok && scale > 0 && isfinite(ref) && isfinite(got)){
+        ok = fabs(ref - got) <= max_ulp * FLT_EPSILON * scale;
+    }
+    if(ok){
+        worst_ulp_ = max(worst_ulp_, ulp);
+        return true;
+    }
+
+    // only the first few mismatches of a kernel are worth reading:
+    if(mismatches_++ < 5){
+        cout << "  MISMATCH " << current_ << " " << what << " i=" << i
+             << ": expected " << ref << " got " << got << " (" << ulp << " ulp)" << endl;
+    }
+    return false;
+}
+
+bool verifier::expect_close(const string& what, size_t i, double ref, double got, uint32_t max_ulp, double scale){
+    ++checked_;
+
+    const uint32_t ulp = ulp_distance(ref, got);
+    bool ok = ulp <= max_ulp;
+    if(!ok && scale > 0 && isfinite(ref) && isfinite(got)){
+        ok = fabs(ref - got) <= max_ulp * DBL_EPSILON * scale;
+    }
+    if(ok){
+        worst_ulp_ = max(worst_ulp_, ulp);
+        return true;
+    }
+
+    if(mismatches_++ < 5){
+        cout.precision(17);
+        cout << "  MISMATCH " << current_ << " " << what << " i=" << i
+             << ": expected " << ref << " got " << got << " (" << ulp << " ulp)" << endl;
+        cout.precision(6);
+    }
+    return false;
+}
+
+bool verifier::expect_equal(const string& what, size_t i, int64_t ref, int64_t got){
+    ++checked_;
+    if(ref == got){
+        return true;
+    }
+    if(mismatches_++ < 5){
+        cout << "  MISMATCH " << current_ << " " << what << " i=" << i
+             << ": expected " << ref << " got " << got << endl;
+    }
+    return false;
+}
+
+void verifier::end(){
+    if(mismatches_ == 0){
+        cout << "ok       " << current_ << ": " << checked_ << " values, worst " << worst_ulp_ << " ulp" << endl;
+    }
+    else{
+        cout << "FAILED   " << current_ << ": " << mismatches_ << " of " << checked_ << " values" << endl;
+        ++failures_;
+    }
+}
@@ -0,0 +1,92 @@
+/**
+ * @file verify.h
+ * @author Sravan Senthilnathan
+ * @brief checks the SIMD kernels against the scalar reference kernels
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2023
+ * 
+ * Used by `bench --verify`: every kernel is run on every instruction set
+ * level over randomized sizes (including vector tails), misaligned pointers,
+ * in-place operation and special values (NaN, inf, signed zero, denormals),
+ * and compared against its scalar reference within a ULP bound.
+ */
+#ifndef VERIFY_H
+#define VERIFY_H
+
+#include <cstdint>
+#include <random>
+#include <string>
+
+/**
+ * @brief distance between two floats in units in the last place,
+ * two NaNs count as equal and +0/-0 are 0 apart
+ */
+uint32_t ulp_distance(float a, float b);
+uint32_t ulp_distance(double a, double b);
+
+class verifier {
+public:
+    explicit verifier(unsigned seed);
+
+    std::mt19937& rng() { return rng_; }
+
+    /**
+     * @brief random element count, biased towards small sizes and vector tails
+     */
+    size_t random_size(size_t max);
+
+    /**
+     * @brief fills p with uniform values in [lo, hi), replacing about one in
+     * twenty with a special value when specials is set
+     */
+    void fill(float* p, size_t n, float lo, float hi, bool specials);
+    void fill(double* p, size_t n, double lo, double hi, bool specials);
+
+    /**
+     * @brief starts checking one kernel on one level
+     */
+    void begin(const std::string& kernel, const std::string& isa);
+
+    /**
+     * @brief compares one output element
+     * 
+     * passes if got is within max_ulp of ref, or, for sums of products where
+     * the ULP distance says little about cancellation, within
+     * max_ulp * FLT_EPSILON * scale (scale = sum of the absolute terms, 0 for
+     * elementwise kernels).
+     * 
+     * @param what description of the case, printed on failure
+     * @param i index of the element
+     * @return whether the element matched
+     */
+    bool expect_close(const std::string& what, size_t i, float ref, float got, uint32_t max_ulp, float scale = 0.0f);
+
+    /**
+     * @brief the same for doubles, ULPs of double and DBL_EPSILON
+     */
+    bool expect_close(const std::string& what, size_t i, double ref, double got, uint32_t max_ulp, double scale = 0.0);
+
+    /**
+     * @brief compares one integer output element, which has to match exactly
+     */
+    bool expect_equal(const std::string& what, size_t i, int64_t ref, int64_t got);
+
+    /**
+     * @brief ends the current kernel/level and prints its verdict
+     */
+    void end();
+
+    int failures() const { return failures_; }
+
+private:
+    std::mt19937 rng_;
+    std::string current_;
+    int mismatches_ = 0;
+    int checked_ = 0;
+    uint32_t worst_ulp_ = 0;
+    int failures_ = 0;
+};
+
+#endif
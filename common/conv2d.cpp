@@ -0,0 +1,156 @@
+/**
+ * @file conv2d.cpp
+ * @author Sravan Senthilnathan
+ * @brief 2D convolution of single channel images: borders, the ring of input rows and the separable passes
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2023
+ * 
+ * A band of output rows is computed top to bottom from a ring of kh rows
+ * in the thread's scratch arena. Moving to the next output row brings in
+ * one input row: padded with kw - 1 border columns for a general filter,
+ * or padded and filtered by the row pass for a separable one, so the
+ * column pass only ever reads kh rows of width floats (a strip of the
+ * intermediate image, not all of it). Rows above and below the image are
+ * the border row the mode maps them to, or a shared row of zeros. The
+ * multiply-adds are the dispatched conv2d_rows kernel, see
+ * conv2d_driver.h.
+ */
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+
+#include "simd_playground.h"
+#include "dispatch.h"
+#include "simd_vec.h"
+#include "conv2d_driver.h"
+
+namespace {
+
+/**
+ * @brief the index a position i of a line of n pixels reads, -1 for zero
+ */
+ptrdiff_t border_index(ptrdiff_t i, size_t n, simd_border border){
+    const ptrdiff_t last = (ptrdiff_t)n - 1;
+    if(i >= 0 && i <= last){
+        return i;
+    }
+    switch(border){
+        case simd_border::zero:  return -1;
+        case simd_border::clamp: return i < 0 ? 0 : last;
+        default: {
+            if(last == 0){
+                return 0;
+            }
+            // mirrored about both edges, periodic in 2 (n - 1) for filters wider than the image:
+            const ptrdiff_t period = 2 * last;
+            ptrdiff_t k = i % period;
+            if(k < 0){
+                k += period;
+            }
+            return k <= last ? k : period - k;
+        }
+    }
+}
+
+/**
+ * @brief pad[t] = src[t - left] for t < left + width + right, the columns
+ * outside the row taken from the border
+ */
+void pad_row(const float* src, size_t width, size_t left, size_t right, simd_border border, float* pad){
+    for(size_t t = 0; t < left; ++t){
+        const ptrdiff_t k = border_index((ptrdiff_t)t - (ptrdiff_t)left, width, border);
+        pad[t] = k < 0 ? 0.0f : src[k];
+    }
+    std::memcpy(pad + left, src, width * sizeof(float));
+    for(size_t t = 0; t < right; ++t){
+        const ptrdiff_t k = border_index((ptrdiff_t)(width + t), width, border);
+        pad[left + width + t] = k < 0 ? 0.0f : src[k];
+    }
+}
+
+}
+
+void scalar_conv2d_rows(const float* const* rows, const float* h, size_t kw, size_t kh, float* y, size_t count){
+    conv2d_run<vec_scalar<float>>(rows, h, kw, kh, y, count);
+}
+
+void conv2d_band(const conv2d_job& job, size_t begin, size_t end){
+    if(begin >= end || job.width == 0 || job.kw == 0 || job.kh == 0){
+        return;
+    }
+    const auto kernel = active_kernels().conv2d_rows;
+    const bool separable = job.h == nullptr;
+    const size_t kw = job.kw, kh = job.kh, width = job.width;
+
+    // the filter's centre (rounded down for even sizes) lands on the output pixel:
+    const ptrdiff_t ay = (ptrdiff_t)(kh / 2);
+    const size_t left = kw - 1 - kw / 2, right = kw / 2;
+    const size_t padded = width + kw - 1;
+    const size_t row_size = separable ? width : padded;
+
+    simd_arena& scratch = simd_scratch();
+    simd_arena_scope scope(scratch);
+    float* ring = scratch.alloc<float>(kh * row_size);
+    float* zero = scratch.alloc<float>(row_size);
+    float* pad = separable ? scratch.alloc<float>(padded) : nullptr;
+    const float** slots = scratch.alloc<const float*>(kh);
+    const float** rows = scratch.alloc<const float*>(kh);
+    std::fill(zero, zero + row_size, 0.0f);
+
+    // input row v (may lie outside the image) goes to slot (v - base) % kh:
+    const ptrdiff_t base = (ptrdiff_t)begin + ay - (ptrdiff_t)kh + 1;
+    auto bring_in = [&](ptrdiff_t v){
+        const size_t k = (size_t)(v - base) % kh;
+        const ptrdiff_t s = border_index(v, job.height, job.border);
+        if(s < 0){
+            slots[k] = zero;
+            return;
+        }
+        const float* src = job.x + (size_t)s * job.x_stride;
+        float* dst = ring + k * row_size;
+        if(separable){
+            pad_row(src, width, left, right, job.border, pad);
+            const float* p = pad + kw - 1;
+            kernel(&p, job.hx, kw, 1, dst, width);
+        }
+        else{
+            pad_row(src, width, left, right, job.border, dst);
+        }
+        slots[k] = dst;
+    };
+
+    for(ptrdiff_t v = base; v < base + (ptrdiff_t)kh - 1; ++v){
+        bring_in(v);
+    }
+    for(size_t r = begin; r < end; ++r){
+        const ptrdiff_t top = (ptrdiff_t)r + ay;
+        bring_in(top);
+        for(size_t i = 0; i < kh; ++i){
+            const float* row = slots[(size_t)(top - (ptrdiff_t)i - base) % kh];
+            rows[i] = separable ? row : row + kw - 1;
+        }
+        float* y = job.y + r * job.y_stride;
+        if(separable){
+            kernel(rows, job.hy, 1, kh, y, width);
+        }
+        else{
+            kernel(rows, job.h, kw, kh, y, width);
+        }
+    }
+}
+
+void simd_conv2d(const float* x, size_t width, size_t height, size_t x_stride,
+                 const float* h, size_t kw, size_t kh,
+                 float* y, size_t y_stride, simd_border border){
+    const conv2d_job job = {x, width, height, x_stride, h, nullptr, nullptr, kw, kh, y, y_stride, border};
+    conv2d_band(job, 0, height);
+}
+
+void simd_conv2d_separable(const float* x, size_t width, size_t height, size_t x_stride,
+                           const float* hx, size_t kw, const float* hy, size_t kh,
+                           float* y, size_t y_stride, simd_border border){
+    const conv2d_job job = {x, width, height, x_stride, nullptr, hx, hy, kw, kh, y, y_stride, border};
+    conv2d_band(job, 0, height);
+}
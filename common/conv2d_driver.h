@@ -0,0 +1,116 @@
+/**
+ * @file conv2d_driver.h
+ * @author Sravan Senthilnathan
+ * @brief row kernel of the 2D convolution shared by the per instruction set kernels
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2023
+ * 
+ * simd_conv2d() computes an output row as
+ * 
+ *   y[c] = sum_i sum_j h[i kw + j] rows[i][c - j]
+ * 
+ * with rows[i] the input row kernel row i lands on, padded with the border
+ * so that every rows[i][c - j] is readable (see conv2d.cpp). The separable
+ * filters use the same kernel twice: a row pass (kh = 1) into a ring of
+ * filtered rows and a column pass (kw = 1) over that ring.
+ * 
+ * conv2d_run() keeps 4 * W outputs in registers for the whole filter,
+ * every tap broadcast once and multiplied into 4 vectors loaded from the
+ * input rows, then single vectors, then the count % W last outputs with
+ * scalars through the backend's mul_add, which rounds like a lane of the
+ * vector one, so every output comes out the same whichever loop computes
+ * it.
+ */
+#ifndef CONV2D_DRIVER_H
+#define CONV2D_DRIVER_H
+
+#include <cstddef>
+
+#include "simd_playground.h"
+
+/**
+ * @brief y[c] = sum h[i kw + j] rows[i][c - j] for c < count, see the file comment
+ */
+template<class V>
+void conv2d_run(const float* const* rows, const float* h, size_t kw, size_t kh, float* y, size_t count){
+    using reg = typename V::reg;
+
+    size_t c = 0;
+    for(; c + 4 * V::W <= count; c += 4 * V::W){
+        reg c0 = V::zero(), c1 = V::zero(), c2 = V::zero(), c3 = V::zero();
+        for(size_t i = 0; i < kh; ++i){
+            const float* src = rows[i] + c;
+            const float* hi = h + i * kw;
+            for(size_t j = 0; j < kw; ++j){
+                const reg t = V::set1(hi[j]);
+                const float* s = src - j;
+                c0 = V::mul_add(t, V::load(s), c0);
+                c1 = V::mul_add(t, V::load(s + V::W), c1);
+                c2 = V::mul_add(t, V::load(s + 2 * V::W), c2);
+                c3 = V::mul_add(t, V::load(s + 3 * V::W), c3);
+            }
+        }
+        V::store(y + c, c0);
+        V::store(y + c + V::W, c1);
+        V::store(y + c + 2 * V::W, c2);
+        V::store(y + c + 3 * V::W, c3);
+    }
+    for(; c + V::W <= count; c += V::W){
+        reg c0 = V::zero();
+        for(size_t i = 0; i < kh; ++i){
+            const float* src = rows[i] + c;
+            const float* hi = h + i * kw;
+            for(size_t j = 0; j < kw; ++j){
+                c0 = V::mul_add(V::set1(hi[j]), V::load(src - j), c0);
+            }
+        }
+        V::store(y + c, c0);
+    }
+    // the same operations per output as the vector lanes:
+    for(; c < count; ++c){
+        float acc = 0.0f;
+        for(size_t i = 0; i < kh; ++i){
+            for(size_t j = 0; j < kw; ++j){
+                acc = V::mul_add(h[i * kw + j], rows[i][c - j], acc);
+            }
+        }
+        y[c] = acc;
+    }
+}
+
+/**
+ * @brief one simd_conv2d() or simd_conv2d_separable() call
+ */
+struct conv2d_job {
+    const float* x;
+    size_t width;
+    size_t height;
+    size_t x_stride;
+    const float* h;     // kh x kw, nullptr for a separable filter
+    const float* hx;    // kw taps of the separable filter
+    const float* hy;    // kh taps of the separable filter
+    size_t kw;
+    size_t kh;
+    float* y;
+    size_t y_stride;
+    simd_border border;
+};
+
+/**
+ * @brief output rows [begin, end) of a job, on the calling thread
+ */
+void conv2d_band(const conv2d_job& job, size_t begin, size_t end);
+
+// scalar fallback:
+void scalar_conv2d_rows(const float* const* rows, const float* h, size_t kw, size_t kh, float* y, size_t count);
+
+// the generic level, see simd_vec.h:
+void generic_conv2d_rows(const float* const* rows, const float* h, size_t kw, size_t kh, float* y, size_t count);
+
+#if defined(__aarch64__)
+void neon_conv2d_rows(const float* const* rows, const float* h, size_t kw, size_t kh, float* y, size_t count);
+#endif
+
+#endif
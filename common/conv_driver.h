@@ -0,0 +1,176 @@
+/**
+ * @file conv_driver.h
+ * @author Sravan Senthilnathan
+ * @brief direct convolution shared by the per instruction set kernels
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2023
+ * 
+ * y[n] = sum_k h[k] x[n - k] over a range [first, first + count) of the
+ * full output, with x the longer operand (the kernels swap them otherwise,
+ * convolution commutes). With M the filter and L the signal length the
+ * outputs split into three regions:
+ * 
+ *   head: n < M - 1      the filter hangs off the start of x
+ *   body: M - 1 <= n < L every tap has a sample, no bounds checks
+ *   tail: n >= L         the filter hangs off the end of x
+ * 
+ * All three run the same loop: 4 * W consecutive outputs at a time,
+ * every tap h[k] broadcast once and multiplied into 4 vectors loaded from
+ * x + n - k, so the accumulators stay in registers for the whole filter.
+ * The head and tail read a copy of the M - 1 samples at their end of x
+ * padded with M - 1 zeros instead of checking bounds, taken from the
+ * thread's scratch arena. The count % W outputs after the last whole
+ * vector are finished like the elementwise kernels (see vector_driver.h):
+ * the last W outputs once more as an overlapping vector, computed from
+ * the y they started with before the loops, a masked vector below W
+ * outputs on masked backends, or a scalar loop.
+ * 
+ * The driver is a template on a backend V of simd_vec.h for the element
+ * type (float or double, taken from the operands); it uses W, load, store,
+ * set1, mul_add and the partial loads and stores. mul_add's scalar form
+ * rounds like a lane of the vector one (fused or not), so an output comes
+ * out the same whichever loop computes it.
+ */
+#ifndef CONV_DRIVER_H
+#define CONV_DRIVER_H
+
+#include <algorithm>
+#include <cstddef>
+
+#include "simd_playground.h"
+#include "dispatch.h"
+
+/**
+ * @brief y[i] += sum_k h[k] x[i - k] for i < count, every x[i - k] must be readable
+ */
+template<class V, class T>
+void conv_run(const T* x, const T* h, size_t m, T* y, size_t count){
+    using reg = typename V::reg;
+
+    const bool vector_tail = count % V::W != 0 && use_vector_tails();
+    const bool overlap = vector_tail && count > V::W;
+    reg last = V::zero();
+    if(overlap){
+        const size_t j = count - V::W;
+        last = V::load(y + j);
+        for(size_t k = 0; k < m; ++k){
+            last = V::mul_add(V::set1(h[k]), V::load(x + j - k), last);
+        }
+    }
+
+    size_t i = 0;
+    for(; i + 4 * V::W <= count; i += 4 * V::W){
+        const T* src = x + i;
+        reg c0 = V::load(y + i);
+        reg c1 = V::load(y + i + V::W);
+        reg c2 = V::load(y + i + 2 * V::W);
+        reg c3 = V::load(y + i + 3 * V::W);
+        for(size_t k = 0; k < m; ++k){
+            const reg t = V::set1(h[k]);
+            const T* s = src - k;
+            c0 = V::mul_add(t, V::load(s), c0);
+            c1 = V::mul_add(t, V::load(s + V::W), c1);
+            c2 = V::mul_add(t, V::load(s + 2 * V::W), c2);
+            c3 = V::mul_add(t, V::load(s + 3 * V::W), c3);
+        }
+        V::store(y + i, c0);
+        V::store(y + i + V::W, c1);
+        V::store(y + i + 2 * V::W, c2);
+        V::store(y + i + 3 * V::W, c3);
+    }
+    for(; i + V::W <= count; i += V::W){
+        reg c0 = V::load(y + i);
+        for(size_t k = 0; k < m; ++k){
+            c0 = V::mul_add(V::set1(h[k]), V::load(x + i - k), c0);
+        }
+        V::store(y + i, c0);
+    }
+    if(overlap){
+        V::store(y + count - V::W, last);
+        return;
+    }
+    if(vector_tail && V::masked){
+        reg c0 = V::load_partial(y, count);
+        for(size_t k = 0; k < m; ++k){
+            c0 = V::mul_add(V::set1(h[k]), V::load_partial(x - k, count), c0);
+        }
+        V::store_partial(y, c0, count);
+        return;
+    }
+    // the same operations per output as the vector lanes:
+    for(; i < count; ++i){
+        T acc = y[i];
+        for(size_t k = 0; k < m; ++k){
+            acc = V::mul_add(h[k], x[i - k], acc);
+        }
+        y[i] = acc;
+    }
+}
+
+/**
+ * @brief y[i] += (x * h)[first + i] for i < count, see the file comment
+ */
+template<class V, class T>
+void conv_direct(const T* x, size_t l1, const T* h, size_t l2, T* y,
+                 size_t first, size_t count){
+    if(l1 < l2){
+        std::swap(x, h);
+        std::swap(l1, l2);
+    }
+    const size_t l = l1, m = l2;
+    const size_t end = first + count;
+    if(m == 0 || count == 0){
+        return;
+    }
+
+    simd_arena& scratch = simd_scratch();
+    simd_arena_scope scope(scratch);
+
+    // head: the first M - 1 samples behind M - 1 zeros
+    const size_t head_end = std::min(end, m - 1);
+    if(first < head_end){
+        T* pad = scratch.alloc<T>(2 * (m - 1));
+        std::fill(pad, pad + (m - 1), T(0));
+        std::copy(x, x + m - 1, pad + (m - 1));
+        conv_run<V>(pad + (m - 1) + first, h, m, y, head_end - first);
+    }
+
+    const size_t body_begin = std::max(first, m - 1);
+    const size_t body_end = std::min(end, l);
+    if(body_begin < body_end){
+        conv_run<V>(x + body_begin, h, m, y + (body_begin - first), body_end - body_begin);
+    }
+
+    // tail: the last M - 1 samples followed by M - 1 zeros
+    const size_t tail_begin = std::max(first, l);
+    if(tail_begin < end){
+        const size_t origin = l - (m - 1);
+        T* pad = scratch.alloc<T>(2 * (m - 1));
+        std::copy(x + origin, x + l, pad);
+        std::fill(pad + (m - 1), pad + 2 * (m - 1), T(0));
+        conv_run<V>(pad + (tail_begin - origin), h, m, y + (tail_begin - first), end - tail_begin);
+    }
+}
+
+// scalar instantiations, the dispatcher's fallback:
+void scalar_conv(const float* x, size_t l1, const float* h, size_t l2, float* y,
+                 size_t first, size_t count);
+void scalar_conv(const double* x, size_t l1, const double* h, size_t l2, double* y,
+                 size_t first, size_t count);
+
+// the generic level, see simd_vec.h:
+void generic_conv(const float* x, size_t l1, const float* h, size_t l2, float* y,
+                  size_t first, size_t count);
+void generic_conv(const double* x, size_t l1, const double* h, size_t l2, double* y,
+                  size_t first, size_t count);
+
+#if defined(__aarch64__)
+void neon_conv(const float* x, size_t l1, const float* h, size_t l2, float* y,
+               size_t first, size_t count);
+void neon_conv(const double* x, size_t l1, const double* h, size_t l2, double* y,
+               size_t first, size_t count);
+#endif
+
+#endif
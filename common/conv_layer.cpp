@@ -0,0 +1,216 @@
+/**
+ * @file conv_layer.cpp
+ * @author Sravan Senthilnathan
+ * @brief multi-channel convolution layer (NCHW/NHWC, stride, padding, dilation, groups) on the blocked GEMM
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2023
+ * 
+ * A convolution layer is a matrix product per image and group: the
+ * filters, filters / groups x K with K = channels / groups x kernel_h x
+ * kernel_w, times the im2col matrix, K x output pixels, whose column for a
+ * pixel holds the input values its filter window covers (zeros in the
+ * padding). In NHWC both sides are transposed: pixels x K times the
+ * filters transposed, the outputs interleaved with a row stride of
+ * filters.
+ * 
+ * The im2col matrix has K times as many elements as the output (9 times
+ * for a 3 x 3 layer), so it is never built whole: the output pixels are
+ * cut into tiles, the columns of a tile gathered into the workspace
+ * (sized to stay in L2) and multiplied right away by the dispatched
+ * simd_sgemm(), which packs them once more for its micro-kernel. The
+ * tiles are wide enough for the packing of the filters, repeated per
+ * tile, to cost little next to the product. 1 x 1 layers with stride 1
+ * and no padding are already a matrix product on x and skip the gather.
+ */
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+
+#include "simd_playground.h"
+
+namespace {
+
+// floats of im2col columns gathered per product, 1 MB (the L2 of current cores):
+constexpr size_t tile_floats = 1 << 18;
+
+// output pixels per tile are a multiple of every micro-kernel width (12, 16 and 32), at least 2 of them:
+constexpr size_t tile_step = 96;
+constexpr size_t min_tile = 2 * tile_step;
+
+size_t output_size(size_t n, size_t k, size_t stride, size_t pad, size_t dilation){
+    const size_t span = dilation * (k - 1) + 1;
+    if(k == 0 || n + 2 * pad < span){
+        return 0;
+    }
+    return (n + 2 * pad - span) / stride + 1;
+}
+
+/**
+ * @brief the layers simd_sgemm() runs on x as it is
+ */
+bool direct(const simd_conv_layer& l){
+    return l.kernel_h == 1 && l.kernel_w == 1 && l.stride_h == 1 && l.stride_w == 1 && l.pad_h == 0 && l.pad_w == 0;
+}
+
+/**
+ * @brief output pixels per tile for im2col columns of k floats
+ */
+size_t tile_pixels(size_t k, size_t pixels){
+    const size_t t = std::max(tile_floats / std::max<size_t>(k, 1), min_tile) / tile_step * tile_step;
+    return std::min(t, pixels);
+}
+
+/**
+ * @brief out[q] = src[x0 + q step] for q < count, 0 outside the width floats of src
+ */
+void gather_row(const float* src, size_t width, ptrdiff_t x0, size_t step, size_t count, float* out){
+    if(step == 1){
+        // zeros left of the row, the row, zeros right of it:
+        const size_t lead = x0 < 0 ? std::min(count, (size_t)-x0) : 0;
+        const size_t first = (size_t)(x0 + (ptrdiff_t)lead);
+        const size_t inside = first < width ? std::min(count - lead, width - first) : 0;
+        std::fill(out, out + lead, 0.0f);
+        std::memcpy(out + lead, src + first, inside * sizeof(float));
+        std::fill(out + lead + inside, out + count, 0.0f);
+        return;
+    }
+    for(size_t q = 0; q < count; ++q){
+        const ptrdiff_t ix = x0 + (ptrdiff_t)(q * step);
+        out[q] = ix >= 0 && ix < (ptrdiff_t)width ? src[ix] : 0.0f;
+    }
+}
+
+/**
+ * @brief the im2col columns of output pixels [p0, p0 + count) of one
+ * image and group in the nchw layout: K rows of count floats
+ */
+void gather_nchw(const simd_conv_layer& l, const float* x, size_t ow, size_t p0, size_t count, float* col){
+    const size_t cg = l.channels / l.groups;
+    for(size_t c = 0; c < cg; ++c){
+        const float* plane = x + c * l.height * l.width;
+        for(size_t i = 0; i < l.kernel_h; ++i){
+            for(size_t j = 0; j < l.kernel_w; ++j){
+                const ptrdiff_t dy = (ptrdiff_t)(i * l.dilation_h) - (ptrdiff_t)l.pad_h;
+                const ptrdiff_t dx = (ptrdiff_t)(j * l.dilation_w) - (ptrdiff_t)l.pad_w;
+                // a segment of the tile per output row:
+                for(size_t p = p0; p < p0 + count;){
+                    const size_t r = p / ow, c0 = p % ow;
+                    const size_t n = std::min(ow - c0, p0 + count - p);
+                    const ptrdiff_t iy = (ptrdiff_t)(r * l.stride_h) + dy;
+                    float* out = col + p - p0;
+                    if(iy < 0 || iy >= (ptrdiff_t)l.height){
+                        std::fill(out, out + n, 0.0f);
+                    }
+                    else{
+                        gather_row(plane + (size_t)iy * l.width, l.width, (ptrdiff_t)(c0 * l.stride_w) + dx,
+                                   l.stride_w, n, out);
+                    }
+                    p += n;
+                }
+                col += count;
+            }
+        }
+    }
+}
+
+/**
+ * @brief the im2col rows of output pixels [p0, p0 + count) of one image
+ * and group in the nhwc layout: count rows of K floats, channels / groups
+ * contiguous ones per filter tap
+ */
+void gather_nhwc(const simd_conv_layer& l, const float* x, size_t ow, size_t p0, size_t count, float* col){
+    const size_t cg = l.channels / l.groups;
+    for(size_t p = p0; p < p0 + count; ++p){
+        const size_t r = p / ow, c = p % ow;
+        for(size_t i = 0; i < l.kernel_h; ++i){
+            const ptrdiff_t iy = (ptrdiff_t)(r * l.stride_h + i * l.dilation_h) - (ptrdiff_t)l.pad_h;
+            for(size_t j = 0; j < l.kernel_w; ++j){
+                const ptrdiff_t ix = (ptrdiff_t)(c * l.stride_w + j * l.dilation_w) - (ptrdiff_t)l.pad_w;
+                if(iy < 0 || iy >= (ptrdiff_t)l.height || ix < 0 || ix >= (ptrdiff_t)l.width){
+                    std::fill(col, col + cg, 0.0f);
+                }
+                else{
+                    std::memcpy(col, x + ((size_t)iy * l.width + (size_t)ix) * l.channels, cg * sizeof(float));
+                }
+                col += cg;
+            }
+        }
+    }
+}
+
+}
+
+size_t simd_conv_layer_height(const simd_conv_layer& l){
+    return output_size(l.height, l.kernel_h, l.stride_h, l.pad_h, l.dilation_h);
+}
+
+size_t simd_conv_layer_width(const simd_conv_layer& l){
+    return output_size(l.width, l.kernel_w, l.stride_w, l.pad_w, l.dilation_w);
+}
+
+size_t simd_conv_layer_workspace(const simd_conv_layer& l){
+    const size_t pixels = simd_conv_layer_height(l) * simd_conv_layer_width(l);
+    if(direct(l) || pixels == 0){
+        return 0;
+    }
+    const size_t k = l.channels / l.groups * l.kernel_h * l.kernel_w;
+    return k * tile_pixels(k, pixels);
+}
+
+void simd_conv_layer_forward(const simd_conv_layer& l, const float* x, const float* w, const float* bias,
+                             float* y, float* workspace){
+    const size_t ow = simd_conv_layer_width(l);
+    const size_t pixels = simd_conv_layer_height(l) * ow;
+    if(pixels == 0 || l.filters == 0){
+        return;
+    }
+    const size_t cg = l.channels / l.groups, fg = l.filters / l.groups;
+    const size_t k = cg * l.kernel_h * l.kernel_w;
+    const size_t hw = l.height * l.width;
+    const bool in_place = direct(l);
+    const size_t tile = in_place ? pixels : tile_pixels(k, pixels);
+    // the product accumulates into the bias:
+    const float beta = bias ? 1.0f : 0.0f;
+
+    simd_arena& scratch = simd_scratch();
+    simd_arena_scope scope(scratch);
+    float* col = in_place || workspace ? workspace : scratch.alloc<float>(simd_conv_layer_workspace(l));
+
+    for(size_t n = 0; n < l.batch; ++n){
+        for(size_t g = 0; g < l.groups; ++g){
+            const float* wg = w + g * fg * k;
+            const float* bg = bias ? bias + g * fg : nullptr;
+            for(size_t p0 = 0; p0 < pixels; p0 += tile){
+                const size_t t = std::min(tile, pixels - p0);
+                if(l.layout == simd_layout::nchw){
+                    // y (fg x t, row stride pixels) = w (fg x k) * im2col (k x t):
+                    const float* xg = x + (n * l.channels + g * cg) * hw;
+                    float* yg = y + (n * l.filters + g * fg) * pixels + p0;
+                    if(!in_place){
+                        gather_nchw(l, xg, ow, p0, t, col);
+                    }
+                    for(size_t f = 0; bg && f < fg; ++f){
+                        std::fill(yg + f * pixels, yg + f * pixels + t, bg[f]);
+                    }
+                    simd_sgemm(false, false, fg, t, k, 1.0f, wg, k, in_place ? xg + p0 : col, in_place ? hw : t,
+                               beta, yg, pixels);
+                }
+                else{
+                    // y (t x fg, row stride filters) = im2col (t x k) * w^T (k x fg):
+                    const float* xg = x + n * hw * l.channels + g * cg;
+                    float* yg = y + (n * pixels + p0) * l.filters + g * fg;
+                    if(!in_place){
+                        gather_nhwc(l, xg, ow, p0, t, col);
+                    }
+                    for(size_t p = 0; bg && p < t; ++p){
+                        std::copy(bg, bg + fg, yg + p * l.filters);
+                    }
+                    simd_sgemm(false, true, t, fg, k, 1.0f, in_place ? xg + p0 * l.channels : col,
+                               in_place ? l.channels : k, wg, k, beta, yg, l.filters);
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,248 @@
+/**
+ * @file convolve.cpp
+ * @author Sravan Senthilnathan
+ * @brief convolution engine: direct, overlap-add or single FFT depending on the sizes
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2023
+ * 
+ * The FFT paths treat the longer operand as the signal and the shorter one
+ * as the filter. The filter spectrum is computed once per call, the signal
+ * is cut into blocks of N - M + 1 samples (N the transform size, M the
+ * filter length), and every block costs one forward and one inverse real
+ * transform of N points whose results are added into y. With one block
+ * this is the plain FFT convolution.
+ * 
+ * Real transforms of N points run as complex ones of N / 2 points on the
+ * even/odd samples plus an O(N) split step; the complex transforms and the
+ * spectrum products go through the dispatcher, the plans through the
+ * shared plan cache, the buffers come from the thread's scratch arena.
+ */
+#include <algorithm>
+#include <cmath>
+
+#include "simd_playground.h"
+#include "dispatch.h"
+#include "simd_vec.h"
+#include "conv_driver.h"
+#include "fft.h"
+
+namespace {
+
+// shortest transform the FFT paths use:
+constexpr size_t min_fft_size = 16;
+
+size_t next_pow2(size_t n){
+    size_t p = 1;
+    while(p < n){
+        p *= 2;
+    }
+    return p;
+}
+
+/**
+ * @brief cost estimates in nanoseconds, measured with bench conv_engine on
+ * an AVX-512 class core; only their ratios matter. The direct kernels do
+ * (l + m) * m multiply-adds, one per output and filter tap.
+ */
+double direct_cost(size_t l, size_t m){
+    return 50.0 + 0.05 * (double)(l + m) * (double)m;
+}
+
+/**
+ * @brief one real transform of n points: the complex one of n / 2 points
+ * and the split
+ */
+double fft_cost(size_t n){
+    return 0.16 * (double)n * std::log2((double)n) + 0.3 * (double)n;
+}
+
+/**
+ * @brief cost of overlap-add with transform size n: setup and the filter
+ * transform, then per block a forward and an inverse transform plus the
+ * spectrum product and the copies
+ */
+double overlap_add_cost(size_t l, size_t m, size_t n){
+    const size_t block = n - m + 1;
+    const size_t blocks = (l + block - 1) / block;
+    return 500.0 + fft_cost(n) + (double)blocks * (2.0 * fft_cost(n) + 0.5 * (double)n);
+}
+
+/**
+ * @brief cheapest transform size for a signal of l and a filter of m samples
+ */
+size_t best_fft_size(size_t l, size_t m){
+    const size_t full = std::max(min_fft_size, next_pow2(l + m - 1));
+    size_t best = full;
+    for(size_t n = std::max(min_fft_size, next_pow2(2 * m)); n < full; n *= 2){
+        if(overlap_add_cost(l, m, n) < overlap_add_cost(l, m, best)){
+            best = n;
+        }
+    }
+    return best;
+}
+
+/**
+ * @brief X = DFT(x) of N = 2 * p.n real samples, split into p.n + 1 bins
+ * 
+ * z[k] = x[2k] + i x[2k + 1] is transformed as complex data, then
+ * X[k] = (Z[k] + conj(Z[n - k])) / 2 - i W^k (Z[k] - conj(Z[n - k])) / 2
+ * with W = exp(-2 pi i / N).
+ */
+void real_forward(const kernel_table& kt, const fft_plan& p, const float* x,
+                  float* zr, float* zi, float* xr, float* xi){
+    const size_t n = p.n;
+    kt.fft(p, x, x + 1, 2, zr, zi);
+
+    // bins 0 and n only see Z[0]:
+    xr[0] = zr[0] + zi[0];
+    xi[0] = 0.0f;
+    xr[n] = zr[0] - zi[0];
+    xi[n] = 0.0f;
+
+    const float* wr = p.tw_re.data() + n - 1;
+    const float* wi = p.tw_im.data() + n - 1;
+    for(size_t k = 1; k < n; ++k){
+        const size_t b = n - k;
+        const float er = zr[k] + zr[b], ei = zi[k] - zi[b];
+        // (Z[k] - conj(Z[n - k])) / i:
+        const float or_ = zi[k] + zi[b], oi = zr[b] - zr[k];
+        xr[k] = 0.5f * (er + or_ * wr[k] - oi * wi[k]);
+        xi[k] = 0.5f * (ei + or_ * wi[k] + oi * wr[k]);
+    }
+}
+
+/**
+ * @brief Z[k] = E + i O from the bins a = X[k], b = X[n - k] and w = W^k,
+ * E = a + conj(b), O = (a - conj(b)) conj(w)
+ */
+inline void inverse_bin(float ar, float ai, float br, float bi, float wr, float wi,
+                        float& zr, float& zi){
+    const float dr = ar - br, di = ai + bi;
+    zr = ar + br - (di * wr - dr * wi);
+    zi = ai - bi + (dr * wr + di * wi);
+}
+
+/**
+ * @brief inverse of real_forward() scaled by N, in place on the bins;
+ * sample 2k ends up in zi[k], sample 2k + 1 in zr[k]
+ */
+void real_inverse(const kernel_table& kt, const fft_plan& p, float* xr, float* xi,
+                  float* zr, float* zi){
+    const size_t n = p.n;
+    const float* wr = p.tw_re.data() + n - 1;
+    const float* wi = p.tw_im.data() + n - 1;
+
+    // k and n - k are done together so the bins can be overwritten:
+    inverse_bin(xr[0], xi[0], xr[n], xi[n], 1.0f, 0.0f, xr[0], xi[0]);
+    for(size_t k = 1; k < n / 2; ++k){
+        const size_t j = n - k;
+        const float ar = xr[k], ai = xi[k], br = xr[j], bi = xi[j];
+        inverse_bin(ar, ai, br, bi, wr[k], wi[k], xr[k], xi[k]);
+        inverse_bin(br, bi, ar, ai, wr[j], wi[j], xr[j], xi[j]);
+    }
+    inverse_bin(xr[n / 2], xi[n / 2], xr[n / 2], xi[n / 2], wr[n / 2], wi[n / 2], xr[n / 2], xi[n / 2]);
+
+    // inverse = forward with re and im swapped on both sides:
+    kt.fft(p, xi, xr, 1, zr, zi);
+}
+
+/**
+ * @brief y += x * h by overlap-add with n point transforms, l >= m
+ */
+void overlap_add(const kernel_table& kt, const float* x, size_t l, const float* h, size_t m,
+                 float* y, size_t n){
+    const size_t half = n / 2;
+    const auto plan = fft_plan_for(half);
+    const size_t block = n - m + 1;
+    const size_t total = l + m - 1;
+
+    simd_arena& scratch = simd_scratch();
+    simd_arena_scope scope(scratch);
+    float* buf = scratch.alloc<float>(n);
+    float* zr = scratch.alloc<float>(half);
+    float* zi = scratch.alloc<float>(half);
+    float* hr = scratch.alloc<float>(half + 1);
+    float* hi = scratch.alloc<float>(half + 1);
+    float* xr = scratch.alloc<float>(half + 1);
+    float* xi = scratch.alloc<float>(half + 1);
+
+    // filter spectrum, with the 1 / N of the inverse folded in:
+    std::copy(h, h + m, buf);
+    std::fill(buf + m, buf + n, 0.0f);
+    real_forward(kt, *plan, buf, zr, zi, hr, hi);
+    const float scale = 1.0f / (float)n;
+    for(size_t k = 0; k <= half; ++k){
+        hr[k] *= scale;
+        hi[k] *= scale;
+    }
+
+    for(size_t s = 0; s < l; s += block){
+        const size_t len = std::min(block, l - s);
+        std::copy(x + s, x + s + len, buf);
+        std::fill(buf + len, buf + n, 0.0f);
+
+        real_forward(kt, *plan, buf, zr, zi, xr, xi);
+        kt.spectrum_mul(xr, xi, hr, hi, xr, xi, half + 1);
+        real_inverse(kt, *plan, xr, xi, zr, zi);
+
+        float* out = y + s;
+        const size_t count = std::min(len + m - 1, total - s);
+        for(size_t t = 0; t < count; ++t){
+            out[t] += (t & 1) ? zr[t / 2] : zi[t / 2];
+        }
+    }
+}
+
+}
+
+void scalar_conv(const float* x, size_t l1, const float* h, size_t l2, float* y,
+                 size_t first, size_t count){
+    conv_direct<vec_scalar<float>>(x, l1, h, l2, y, first, count);
+}
+
+void scalar_conv(const double* x, size_t l1, const double* h, size_t l2, double* y,
+                 size_t first, size_t count){
+    conv_direct<vec_scalar<double>>(x, l1, h, l2, y, first, count);
+}
+
+simd_conv_method simd_conv_choice(size_t l1, size_t l2){
+    const size_t l = std::max(l1, l2), m = std::min(l1, l2);
+    if(m == 0){
+        return simd_conv_method::direct;
+    }
+
+    const size_t n = best_fft_size(l, m);
+    if(direct_cost(l, m) <= overlap_add_cost(l, m, n)){
+        return simd_conv_method::direct;
+    }
+    return n >= l + m - 1 ? simd_conv_method::fft : simd_conv_method::overlap_add;
+}
+
+void simd_convolve(const float* x, size_t l1, const float* h, size_t l2, float* y,
+                   simd_conv_method method){
+    if(l1 == 0 || l2 == 0){
+        return;
+    }
+    if(method == simd_conv_method::automatic){
+        method = simd_conv_choice(l1, l2);
+    }
+
+    // convolution commutes: the longer operand is the signal and the shorter
+    // one the filter (the direct kernels loop over its taps, the FFT paths
+    // cut the signal into blocks):
+    const kernel_table& kt = active_kernels();
+    const float* sig = l1 >= l2 ? x : h;
+    const float* fil = l1 >= l2 ? h : x;
+    const size_t l = std::max(l1, l2), m = std::min(l1, l2);
+
+    if(method == simd_conv_method::direct){
+        kt.conv(sig, l, fil, m, y, 0, l + m - 1);
+        return;
+    }
+
+    const size_t n = method == simd_conv_method::fft ? std::max(min_fft_size, next_pow2(l + m - 1))
+                                                     : best_fft_size(l, m);
+    overlap_add(kt, sig, l, fil, m, y, n);
+}
@@ -0,0 +1,858 @@
+/**
+ * @file dispatch.cpp
+ * @author Sravan Senthilnathan
+ * @brief runtime CPU feature detection and kernel dispatch
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2023
+ * 
+ * The CPU is probed once, on first use, and a kernel table is built for every
+ * level up to the detected one. simd_set_isa()/SIMD_PLAYGROUND_ISA only swap
+ * which of those tables the simd_* entry points read.
+ */
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <string>
+
+#include "dispatch.h"
+#include "conv_driver.h"
+#include "conv2d_driver.h"
+#include "fft.h"
+#include "half_driver.h"
+#include "int_driver.h"
+#include "layer_driver.h"
+#include "math_driver.h"
+#include "recip_driver.h"
+#include "reduce_driver.h"
+#include "stream_driver.h"
+#include "vector_driver.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <cpuid.h>
+#include "x86_kernels.h"
+#endif
+
+#if defined(__linux__)
+#include <unistd.h>
+#endif
+
+namespace {
+
+constexpr int isa_count = (int)simd_isa::neon + 1;
+
+#if defined(__x86_64__) || defined(__i386__)
+
+/**
+ * @brief reads an extended control register, XCR0 tells which register
+ * states the OS saves on a context switch
+ */
+unsigned long long xgetbv(unsigned int index){
+    unsigned int eax, edx;
+    __asm__ volatile("xgetbv" : "=a"(eax), "=d"(edx) : "c"(index));
+    return ((unsigned long long)edx << 32) | eax;
+}
+
+simd_isa detect(){
+    unsigned int eax, ebx, ecx, edx;
+    if(!__get_cpuid(1, &eax, &ebx, &ecx, &edx)){
+        return simd_isa::scalar;
+    }
+
+    const bool sse3   = ecx & bit_SSE3;
+    const bool ssse3  = ecx & bit_SSSE3;
+    const bool sse41  = ecx & bit_SSE4_1;
+    const bool fma    = ecx & bit_FMA;
+    const bool f16c   = ecx & bit_F16C;
+    const bool osxsave = ecx & bit_OSXSAVE;
+    const bool avx    = ecx & bit_AVX;
+
+    if(!(sse3 && ssse3 && sse41)){
+        return simd_isa::scalar;
+    }
+
+    // the OS has to save the ymm (and zmm) state for AVX (AVX-512) to be usable:
+    const unsigned long long xcr0 = osxsave ? xgetbv(0) : 0;
+    const bool ymm_state = (xcr0 & 0x06) == 0x06;
+    const bool zmm_state = (xcr0 & 0xe6) == 0xe6;
+
+    if(!(avx && ymm_state)){
+        return simd_isa::sse;
+    }
+
+    unsigned int max_leaf = __get_cpuid_max(0, nullptr);
+    if(max_leaf < 7){
+        return simd_isa::avx;
+    }
+    __cpuid_count(7, 0, eax, ebx, ecx, edx);
+
+    const bool avx2     = ebx & bit_AVX2;
+    const bool avx512f  = ebx & bit_AVX512F;
+    const bool avx512dq = ebx & bit_AVX512DQ;
+    const bool avx512bw = ebx & bit_AVX512BW;
+    const bool avx512vl = ebx & bit_AVX512VL;
+
+    if(!(avx2 && fma && f16c)){
+        return simd_isa::avx;
+    }
+    if(!(avx512f && avx512dq && avx512bw && avx512vl && zmm_state)){
+        return simd_isa::avx2;
+    }
+    return simd_isa::avx512;
+}
+
+/**
+ * @brief AVX512_VNNI (vpdpbusd), an extension on top of the avx512 level
+ * that only the 8 bit dot products use
+ */
+bool has_avx512_vnni(){
+    unsigned int eax, ebx, ecx, edx;
+    if(__get_cpuid_max(0, nullptr) < 7){
+        return false;
+    }
+    __cpuid_count(7, 0, eax, ebx, ecx, edx);
+    return ecx & bit_AVX512VNNI;
+}
+
+#elif defined(__aarch64__)
+
+simd_isa detect(){
+    // Advanced SIMD is mandatory on ARMv8-A
+    return simd_isa::neon;
+}
+
+#else
+
+simd_isa detect(){
+    return simd_isa::scalar;
+}
+
+#endif
+
+bool supported(simd_isa isa, simd_isa detected){
+    if(isa == simd_isa::scalar || isa == simd_isa::generic){
+        return true;
+    }
+#if defined(__aarch64__)
+    return isa == simd_isa::neon;
+#else
+    return isa != simd_isa::neon && isa <= detected;
+#endif
+}
+
+/**
+ * @brief bytes of the largest data cache of CPU 0 (usually the LLC it
+ * shares with its neighbours), 0 if the OS does not say
+ */
+size_t detect_llc(){
+#if defined(__linux__)
+    // sysfs lists every cache of the CPU, sizes like "2048K":
+    size_t best_level = 0, best = 0;
+    for(int i = 0; i < 16; ++i){
+        const std::string dir = "/sys/devices/system/cpu/cpu0/cache/index" + std::to_string(i) + "/";
+        std::ifstream level_file(dir + "level"), size_file(dir + "size"), type_file(dir + "type");
+        size_t level = 0;
+        std::string size, type;
+        if(!(level_file >> level) || !(size_file >> size)){
+            break;
+        }
+        type_file >> type;
+        if(type == "Instruction"){
+            continue;
+        }
+
+        char* unit = nullptr;
+        size_t bytes = std::strtoull(size.c_str(), &unit, 10);
+        switch(*unit){
+            case 'K': bytes <<= 10; break;
+            case 'M': bytes <<= 20; break;
+            case 'G': bytes <<= 30; break;
+        }
+        if(level >= best_level){
+            best_level = level;
+            best = bytes;
+        }
+    }
+    if(best > 0){
+        return best;
+    }
+#if defined(_SC_LEVEL3_CACHE_SIZE)
+    const long l3 = sysconf(_SC_LEVEL3_CACHE_SIZE);
+    if(l3 > 0){
+        return (size_t)l3;
+    }
+#endif
+#endif
+    return 0;
+}
+
+/**
+ * @brief kernel table for one level: scalar references first, then every
+ * level up to the requested one overrides the slots it implements (the
+ * generic level only its own, on top of scalar)
+ */
+kernel_table build_table(simd_isa level){
+    kernel_table t;
+
+    t.add = add;
+    t.sub = sub;
+    t.mul = mul;
+    t.div = div;
+    t.mul_add = mul_add;
+    t.add_stream = add;
+    t.sub_stream = sub;
+    t.mul_stream = mul;
+    t.div_stream = div;
+    t.sum = scalar_sum;
+    t.dot = scalar_dot;
+    t.minimum = scalar_minimum;
+    t.maximum = scalar_maximum;
+    t.argmin = scalar_argmin;
+    t.argmax = scalar_argmax;
+    t.exp = scalar_exp;
+    t.log = scalar_log;
+    t.sin = scalar_sin;
+    t.cos = scalar_cos;
+    t.tanh = scalar_tanh;
+    t.sigmoid = scalar_sigmoid;
+    t.erf = scalar_erf;
+    t.pow = scalar_pow;
+    t.div_mode = scalar_div;
+    t.sqrt = scalar_sqrt;
+    t.rsqrt = scalar_rsqrt;
+    t.softmax = scalar_softmax;
+    t.log_softmax = scalar_log_softmax;
+    t.layer_norm = scalar_layer_norm;
+    t.rms_norm = scalar_rms_norm;
+    t.bias_activation = scalar_bias_activation;
+    t.to_half = scalar_to_half;
+    t.from_half = scalar_from_half;
+    t.add_half = scalar_add_half;
+    t.mul_half = scalar_mul_half;
+    t.dot_half = scalar_dot_half;
+    t.add_i8 = scalar_add;
+    t.add_u8 = scalar_add;
+    t.add_i16 = scalar_add;
+    t.add_i32 = scalar_add;
+    t.sub_i8 = scalar_sub;
+    t.sub_u8 = scalar_sub;
+    t.sub_i16 = scalar_sub;
+    t.sub_i32 = scalar_sub;
+    t.mul_i8 = scalar_mul;
+    t.mul_u8 = scalar_mul;
+    t.mul_i16 = scalar_mul;
+    t.mul_i32 = scalar_mul;
+    t.dot_u8 = scalar_dot;
+    t.dot_i8 = scalar_dot;
+    t.conv_quant = scalar_conv_quant;
+    t.tensor_add = add;
+    t.tensor_sub = sub;
+    t.tensor_mul = mul;
+    t.mul_batch = mul_batch;
+    t.mul_batch_soa = mul_batch_soa;
+    t.conv = scalar_conv;
+    t.conv2d_rows = scalar_conv2d_rows;
+    t.add_f64 = add;
+    t.sub_f64 = sub;
+    t.mul_f64 = mul;
+    t.div_f64 = div;
+    t.mul_add_f64 = mul_add;
+    t.tensor_add_f64 = add;
+    t.tensor_sub_f64 = sub;
+    t.tensor_mul_f64 = mul;
+    t.conv_f64 = scalar_conv;
+    t.fft = scalar_fft;
+    t.spectrum_mul = scalar_spectrum_mul;
+    t.sgemm = sgemm;
+
+    if(level == simd_isa::generic){
+        t.add = generic_add;
+        t.sub = generic_sub;
+        t.mul = generic_mul;
+        t.div = generic_div;
+        t.mul_add = generic_mul_add;
+        t.add_stream = generic_add_stream;
+        t.sub_stream = generic_sub_stream;
+        t.mul_stream = generic_mul_stream;
+        t.div_stream = generic_div_stream;
+        t.sum = generic_sum;
+        t.dot = generic_dot;
+        t.minimum = generic_minimum;
+        t.maximum = generic_maximum;
+        t.argmin = generic_argmin;
+        t.argmax = generic_argmax;
+        t.exp = generic_exp;
+        t.log = generic_log;
+        t.sin = generic_sin;
+        t.cos = generic_cos;
+        t.tanh = generic_tanh;
+        t.sigmoid = generic_sigmoid;
+        t.erf = generic_erf;
+        t.pow = generic_pow;
+        t.div_mode = generic_div;
+        t.sqrt = generic_sqrt;
+        t.rsqrt = generic_rsqrt;
+        t.softmax = generic_softmax;
+        t.log_softmax = generic_log_softmax;
+        t.layer_norm = generic_layer_norm;
+        t.rms_norm = generic_rms_norm;
+        t.bias_activation = generic_bias_activation;
+        t.conv = generic_conv;
+        t.conv2d_rows = generic_conv2d_rows;
+        t.add_f64 = generic_add;
+        t.sub_f64 = generic_sub;
+        t.mul_f64 = generic_mul;
+        t.div_f64 = generic_div;
+        t.mul_add_f64 = generic_mul_add;
+        t.conv_f64 = generic_conv;
+    }
+
+#if defined(__x86_64__) || defined(__i386__)
+    if(level >= simd_isa::sse){
+        t.add = sse_add;
+        t.sub = sse_sub;
+        t.mul = sse_mul;
+        t.div = sse_div;
+        t.mul_add = sse_mul_add;
+        t.add_stream = sse_add_stream;
+        t.sub_stream = sse_sub_stream;
+        t.mul_stream = sse_mul_stream;
+        t.div_stream = sse_div_stream;
+        t.sum = sse_sum;
+        t.dot = sse_dot;
+        t.minimum = sse_minimum;
+        t.maximum = sse_maximum;
+        t.argmin = sse_argmin;
+        t.argmax = sse_argmax;
+        t.exp = sse_exp;
+        t.log = sse_log;
+        t.sin = sse_sin;
+        t.cos = sse_cos;
+        t.tanh = sse_tanh;
+        t.sigmoid = sse_sigmoid;
+        t.erf = sse_erf;
+        t.pow = sse_pow;
+        t.div_mode = sse_div;
+        t.sqrt = sse_sqrt;
+        t.rsqrt = sse_rsqrt;
+        t.softmax = sse_softmax;
+        t.log_softmax = sse_log_softmax;
+        t.layer_norm = sse_layer_norm;
+        t.rms_norm = sse_rms_norm;
+        t.bias_activation = sse_bias_activation;
+        t.to_half = sse_to_half;
+        t.from_half = sse_from_half;
+        t.add_half = sse_add_half;
+        t.mul_half = sse_mul_half;
+        t.dot_half = sse_dot_half;
+        t.add_i8 = sse_add;
+        t.add_u8 = sse_add;
+        t.add_i16 = sse_add;
+        t.add_i32 = sse_add;
+        t.sub_i8 = sse_sub;
+        t.sub_u8 = sse_sub;
+        t.sub_i16 = sse_sub;
+        t.sub_i32 = sse_sub;
+        t.mul_i8 = sse_mul;
+        t.mul_u8 = sse_mul;
+        t.mul_i16 = sse_mul;
+        t.mul_i32 = sse_mul;
+        t.dot_u8 = sse_dot;
+        t.dot_i8 = sse_dot;
+        t.conv_quant = sse_conv_quant;
+        t.tensor_add = sse_add;
+        t.tensor_sub = sse_sub;
+        t.tensor_mul = sse_mul;
+        t.mul_batch = sse_mul_batch;
+        t.mul_batch_soa = sse_mul_batch_soa;
+        t.conv = sse_conv;
+        t.conv2d_rows = sse_conv2d_rows;
+        t.add_f64 = sse_add;
+        t.sub_f64 = sse_sub;
+        t.mul_f64 = sse_mul;
+        t.div_f64 = sse_div;
+        t.mul_add_f64 = sse_mul_add;
+        t.tensor_add_f64 = sse_add;
+        t.tensor_sub_f64 = sse_sub;
+        t.tensor_mul_f64 = sse_mul;
+        t.conv_f64 = sse_conv;
+        t.fft = sse_fft;
+        t.spectrum_mul = sse_spectrum_mul;
+    }
+    if(level >= simd_isa::avx){
+        t.add = avx_add;
+        t.sub = avx_sub;
+        t.mul = avx_mul;
+        t.div = avx_div;
+        t.mul_add = avx_mul_add;
+        t.add_stream = avx_add_stream;
+        t.sub_stream = avx_sub_stream;
+        t.mul_stream = avx_mul_stream;
+        t.div_stream = avx_div_stream;
+        t.sum = avx_sum;
+        t.dot = avx_dot;
+        t.minimum = avx_minimum;
+        t.maximum = avx_maximum;
+        t.argmin = avx_argmin;
+        t.argmax = avx_argmax;
+        t.div_mode = avx_div;
+        t.sqrt = avx_sqrt;
+        t.rsqrt = avx_rsqrt;
+        t.tensor_add = avx_add;
+        t.tensor_sub = avx_sub;
+        t.tensor_mul = avx_mul;
+        t.conv = avx_conv;
+        t.conv2d_rows = avx_conv2d_rows;
+        t.add_f64 = avx_add;
+        t.sub_f64 = avx_sub;
+        t.mul_f64 = avx_mul;
+        t.div_f64 = avx_div;
+        t.mul_add_f64 = avx_mul_add;
+        t.tensor_add_f64 = avx_add;
+        t.tensor_sub_f64 = avx_sub;
+        t.tensor_mul_f64 = avx_mul;
+        t.conv_f64 = avx_conv;
+        t.sgemm = avx_sgemm;
+    }
+    if(level >= simd_isa::avx2){
+        t.mul_add = avx2_mul_add;
+        t.sum = avx2_sum;
+        t.dot = avx2_dot;
+        t.minimum = avx2_minimum;
+        t.maximum = avx2_maximum;
+        t.argmin = avx2_argmin;
+        t.argmax = avx2_argmax;
+        t.exp = avx2_exp;
+        t.log = avx2_log;
+        t.sin = avx2_sin;
+        t.cos = avx2_cos;
+        t.tanh = avx2_tanh;
+        t.sigmoid = avx2_sigmoid;
+        t.erf = avx2_erf;
+        t.pow = avx2_pow;
+        t.div_mode = avx2_div;
+        t.sqrt = avx2_sqrt;
+        t.rsqrt = avx2_rsqrt;
+        t.softmax = avx2_softmax;
+        t.log_softmax = avx2_log_softmax;
+        t.layer_norm = avx2_layer_norm;
+        t.rms_norm = avx2_rms_norm;
+        t.bias_activation = avx2_bias_activation;
+        t.to_half = avx2_to_half;
+        t.from_half = avx2_from_half;
+        t.add_half = avx2_add_half;
+        t.mul_half = avx2_mul_half;
+        t.dot_half = avx2_dot_half;
+        t.add_i8 = avx2_add;
+        t.add_u8 = avx2_add;
+        t.add_i16 = avx2_add;
+        t.add_i32 = avx2_add;
+        t.sub_i8 = avx2_sub;
+        t.sub_u8 = avx2_sub;
+        t.sub_i16 = avx2_sub;
+        t.sub_i32 = avx2_sub;
+        t.mul_i8 = avx2_mul;
+        t.mul_u8 = avx2_mul;
+        t.mul_i16 = avx2_mul;
+        t.mul_i32 = avx2_mul;
+        t.dot_u8 = avx2_dot;
+        t.dot_i8 = avx2_dot;
+        t.conv_quant = avx2_conv_quant;
+        t.tensor_mul = avx2_mul;
+        t.mul_batch = avx2_mul_batch;
+        t.mul_batch_soa = avx2_mul_batch_soa;
+        t.conv = avx2_conv;
+        t.conv2d_rows = avx2_conv2d_rows;
+        t.mul_add_f64 = avx2_mul_add;
+        t.tensor_mul_f64 = avx2_mul;
+        t.conv_f64 = avx2_conv;
+        t.fft = avx2_fft;
+        t.spectrum_mul = avx2_spectrum_mul;
+        t.sgemm = avx2_sgemm;
+    }
+    if(level >= simd_isa::avx512){
+        t.add = avx512_add;
+        t.sub = avx512_sub;
+        t.mul = avx512_mul;
+        t.div = avx512_div;
+        t.mul_add = avx512_mul_add;
+        t.add_stream = avx512_add_stream;
+        t.sub_stream = avx512_sub_stream;
+        t.mul_stream = avx512_mul_stream;
+        t.div_stream = avx512_div_stream;
+        t.sum = avx512_sum;
+        t.dot = avx512_dot;
+        t.minimum = avx512_minimum;
+        t.maximum = avx512_maximum;
+        t.argmin = avx512_argmin;
+        t.argmax = avx512_argmax;
+        t.exp = avx512_exp;
+        t.log = avx512_log;
+        t.sin = avx512_sin;
+        t.cos = avx512_cos;
+        t.tanh = avx512_tanh;
+        t.sigmoid = avx512_sigmoid;
+        t.erf = avx512_erf;
+        t.pow = avx512_pow;
+        t.div_mode = avx512_div;
+        t.sqrt = avx512_sqrt;
+        t.rsqrt = avx512_rsqrt;
+        t.softmax = avx512_softmax;
+        t.log_softmax = avx512_log_softmax;
+        t.layer_norm = avx512_layer_norm;
+        t.rms_norm = avx512_rms_norm;
+        t.bias_activation = avx512_bias_activation;
+        t.to_half = avx512_to_half;
+        t.from_half = avx512_from_half;
+        t.add_half = avx512_add_half;
+        t.mul_half = avx512_mul_half;
+        t.dot_half = avx512_dot_half;
+        t.add_i8 = avx512_add;
+        t.add_u8 = avx512_add;
+        t.add_i16 = avx512_add;
+        t.add_i32 = avx512_add;
+        t.sub_i8 = avx512_sub;
+        t.sub_u8 = avx512_sub;
+        t.sub_i16 = avx512_sub;
+        t.sub_i32 = avx512_sub;
+        t.mul_i8 = avx512_mul;
+        t.mul_u8 = avx512_mul;
+        t.mul_i16 = avx512_mul;
+        t.mul_i32 = avx512_mul;
+        t.dot_u8 = avx512_dot;
+        t.dot_i8 = avx512_dot;
+        if(has_avx512_vnni()){
+            t.dot_u8 = avx512_vnni_dot;
+            t.dot_i8 = avx512_vnni_dot;
+        }
+        t.conv_quant = avx512_conv_quant;
+        t.tensor_add = avx512_add;
+        t.tensor_sub = avx512_sub;
+        t.tensor_mul = avx512_mul;
+        t.mul_batch = avx512_mul_batch;
+        t.mul_batch_soa = avx512_mul_batch_soa;
+        t.conv = avx512_conv;
+        t.conv2d_rows = avx512_conv2d_rows;
+        t.add_f64 = avx512_add;
+        t.sub_f64 = avx512_sub;
+        t.mul_f64 = avx512_mul;
+        t.div_f64 = avx512_div;
+        t.mul_add_f64 = avx512_mul_add;
+        t.tensor_add_f64 = avx512_add;
+        t.tensor_sub_f64 = avx512_sub;
+        t.tensor_mul_f64 = avx512_mul;
+        t.conv_f64 = avx512_conv;
+        t.sgemm = avx512_sgemm;
+    }
+#elif defined(__aarch64__)
+    if(level == simd_isa::neon){
+        t.add = neon_add;
+        t.sub = neon_sub;
+        t.mul = neon_mul;
+        t.div = neon_div;
+        t.mul_add = neon_mul_add;
+        t.add_stream = neon_add_stream;
+        t.sub_stream = neon_sub_stream;
+        t.mul_stream = neon_mul_stream;
+        t.div_stream = neon_div_stream;
+        t.sum = neon_sum;
+        t.dot = neon_dot;
+        t.minimum = neon_minimum;
+        t.maximum = neon_maximum;
+        t.argmin = neon_argmin;
+        t.argmax = neon_argmax;
+        t.exp = neon_exp;
+        t.log = neon_log;
+        t.sin = neon_sin;
+        t.cos = neon_cos;
+        t.tanh = neon_tanh;
+        t.sigmoid = neon_sigmoid;
+        t.erf = neon_erf;
+        t.pow = neon_pow;
+        t.div_mode = neon_div;
+        t.sqrt = neon_sqrt;
+        t.rsqrt = neon_rsqrt;
+        t.softmax = neon_softmax;
+        t.log_softmax = neon_log_softmax;
+        t.layer_norm = neon_layer_norm;
+        t.rms_norm = neon_rms_norm;
+        t.bias_activation = neon_bias_activation;
+        t.to_half = neon_to_half;
+        t.from_half = neon_from_half;
+        t.add_half = neon_add_half;
+        t.mul_half = neon_mul_half;
+        t.dot_half = neon_dot_half;
+        t.add_i8 = neon_add;
+        t.add_u8 = neon_add;
+        t.add_i16 = neon_add;
+        t.add_i32 = neon_add;
+        t.sub_i8 = neon_sub;
+        t.sub_u8 = neon_sub;
+        t.sub_i16 = neon_sub;
+        t.sub_i32 = neon_sub;
+        t.mul_i8 = neon_mul;
+        t.mul_u8 = neon_mul;
+        t.mul_i16 = neon_mul;
+        t.mul_i32 = neon_mul;
+        t.dot_u8 = neon_dot;
+        t.dot_i8 = neon_dot;
+        t.conv_quant = neon_conv_quant;
+        t.tensor_add = neon_add;
+        t.tensor_sub = neon_sub;
+        t.tensor_mul = neon_mul;
+        t.mul_batch = neon_mul_batch;
+        t.mul_batch_soa = neon_mul_batch_soa;
+        t.fft = neon_fft;
+        t.spectrum_mul = neon_spectrum_mul;
+        t.conv = neon_conv;
+        t.conv2d_rows = neon_conv2d_rows;
+        t.add_f64 = neon_add;
+        t.sub_f64 = neon_sub;
+        t.mul_f64 = neon_mul;
+        t.div_f64 = neon_div;
+        t.mul_add_f64 = neon_mul_add;
+        t.tensor_add_f64 = neon_add;
+        t.tensor_sub_f64 = neon_sub;
+        t.tensor_mul_f64 = neon_mul;
+        t.conv_f64 = neon_conv;
+        t.sgemm = neon_sgemm;
+    }
+#endif
+
+    return t;
+}
+
+struct dispatch_state {
+    simd_isa detected;
+    kernel_table tables[isa_count];
+    std::atomic<int> active;
+
+    dispatch_state() : detected(detect()){
+        for(int i = 0; i < isa_count; ++i){
+            tables[i] = build_table((simd_isa)i);
+        }
+        int level = (int)detected;
+
+        if(const char* env = std::getenv("SIMD_PLAYGROUND_ISA")){
+            int forced = -1;
+            for(int i = 0; i < isa_count; ++i){
+                if(std::strcmp(env, simd_isa_name((simd_isa)i)) == 0){
+                    forced = i;
+                }
+            }
+            if(forced < 0){
+                std::cerr << "SIMD_PLAYGROUND_ISA: unknown level '" << env << "', using "
+                          << simd_isa_name(detected) << std::endl;
+            }
+            else if(!supported((simd_isa)forced, detected)){
+                std::cerr << "SIMD_PLAYGROUND_ISA: " << env << " is not supported by this CPU, using "
+                          << simd_isa_name(detected) << std::endl;
+            }
+            else{
+                level = forced;
+            }
+        }
+        active.store(level);
+    }
+};
+
+dispatch_state& state(){
+    static dispatch_state s;
+    return s;
+}
+
+// from here on a, b and c of c = a op b together take more than half the
+// LLC, which is shared with the other cores and whatever else is cached:
+std::atomic<size_t>& stream_threshold(){
+    static std::atomic<size_t> threshold{simd_llc_size() / (2 * 3 * sizeof(float))};
+    return threshold;
+}
+
+std::atomic<int>& tail_mode(){
+    static std::atomic<int> mode{(int)simd_tail::vector};
+    return mode;
+}
+
+}
+
+const kernel_table& active_kernels(){
+    dispatch_state& s = state();
+    return s.tables[s.active.load(std::memory_order_relaxed)];
+}
+
+simd_isa simd_detected_isa(){
+    return state().detected;
+}
+
+simd_isa simd_active_isa(){
+    return (simd_isa)state().active.load(std::memory_order_relaxed);
+}
+
+bool simd_set_isa(simd_isa isa){
+    dispatch_state& s = state();
+    if(!supported(isa, s.detected)){
+        return false;
+    }
+    s.active.store((int)isa, std::memory_order_relaxed);
+    return true;
+}
+
+size_t simd_llc_size(){
+    static const size_t llc = detect_llc();
+    return llc > 0 ? llc : 8 << 20;
+}
+
+void simd_set_streaming_threshold(size_t n){
+    stream_threshold().store(n, std::memory_order_relaxed);
+}
+
+size_t simd_streaming_threshold(){
+    return stream_threshold().load(std::memory_order_relaxed);
+}
+
+bool use_streaming(size_t n){
+    return n >= stream_threshold().load(std::memory_order_relaxed);
+}
+
+void simd_set_tail(simd_tail tail){
+    tail_mode().store((int)tail, std::memory_order_relaxed);
+}
+
+simd_tail simd_tail_handling(){
+    return (simd_tail)tail_mode().load(std::memory_order_relaxed);
+}
+
+bool use_vector_tails(){
+    return tail_mode().load(std::memory_order_relaxed) == (int)simd_tail::vector;
+}
+
+const char* simd_isa_name(simd_isa isa){
+    switch(isa){
+        case simd_isa::scalar:  return "scalar";
+        case simd_isa::generic: return "generic";
+        case simd_isa::sse:     return "sse";
+        case simd_isa::avx:     return "avx";
+        case simd_isa::avx2:    return "avx2";
+        case simd_isa::avx512:  return "avx512";
+        case simd_isa::neon:    return "neon";
+    }
+    return "unknown";
+}
+
+void simd_add(const float* a, const float* b, float* c, size_t n){
+    const kernel_table& kt = active_kernels();
+    (use_streaming(n) ? kt.add_stream : kt.add)(a, b, c, n);
+}
+
+void simd_sub(const float* a, const float* b, float* c, size_t n){
+    const kernel_table& kt = active_kernels();
+    (use_streaming(n) ? kt.sub_stream : kt.sub)(a, b, c, n);
+}
+
+void simd_mul(const float* a, const float* b, float* c, size_t n){
+    const kernel_table& kt = active_kernels();
+    (use_streaming(n) ? kt.mul_stream : kt.mul)(a, b, c, n);
+}
+
+void simd_div(const float* a, const float* b, float* c, size_t n){
+    const kernel_table& kt = active_kernels();
+    (use_streaming(n) ? kt.div_stream : kt.div)(a, b, c, n);
+}
+
+void simd_mul_add(const float* a, const float* b, const float* c, float* d, size_t n){
+    active_kernels().mul_add(a, b, c, d, n);
+}
+
+void simd_add(const Tensor a, const Tensor b, Tensor &c){
+    active_kernels().tensor_add(a, b, c);
+}
+
+void simd_sub(const Tensor a, const Tensor b, Tensor &c){
+    active_kernels().tensor_sub(a, b, c);
+}
+
+void simd_mul(const Tensor a, const Tensor b, Tensor &c){
+    active_kernels().tensor_mul(a, b, c);
+}
+
+size_t simd_conv_size(size_t l1, size_t l2, simd_conv_mode mode){
+    if(l1 == 0 || l2 == 0){
+        return 0;
+    }
+    switch(mode){
+        case simd_conv_mode::same:  return std::max(l1, l2);
+        case simd_conv_mode::valid: return std::max(l1, l2) - std::min(l1, l2) + 1;
+        default:                    return l1 + l2 - 1;
+    }
+}
+
+size_t conv_first(size_t l1, size_t l2, simd_conv_mode mode){
+    // the outputs of same and valid are centred in the full convolution:
+    const size_t m = std::min(l1, l2);
+    if(m == 0){
+        return 0;
+    }
+    switch(mode){
+        case simd_conv_mode::same:  return (m - 1) / 2;
+        case simd_conv_mode::valid: return m - 1;
+        default:                    return 0;
+    }
+}
+
+void simd_conv(const float* x, size_t l1, const float* h, size_t l2, float* y, simd_conv_mode mode){
+    active_kernels().conv(x, l1, h, l2, y, conv_first(l1, l2, mode), simd_conv_size(l1, l2, mode));
+}
+
+void simd_add(const double* a, const double* b, double* c, size_t n){
+    active_kernels().add_f64(a, b, c, n);
+}
+
+void simd_sub(const double* a, const double* b, double* c, size_t n){
+    active_kernels().sub_f64(a, b, c, n);
+}
+
+void simd_mul(const double* a, const double* b, double* c, size_t n){
+    active_kernels().mul_f64(a, b, c, n);
+}
+
+void simd_div(const double* a, const double* b, double* c, size_t n){
+    active_kernels().div_f64(a, b, c, n);
+}
+
+void simd_mul_add(const double* a, const double* b, const double* c, double* d, size_t n){
+    active_kernels().mul_add_f64(a, b, c, d, n);
+}
+
+void simd_add(const Tensor64 a, const Tensor64 b, Tensor64 &c){
+    active_kernels().tensor_add_f64(a, b, c);
+}
+
+void simd_sub(const Tensor64 a, const Tensor64 b, Tensor64 &c){
+    active_kernels().tensor_sub_f64(a, b, c);
+}
+
+void simd_mul(const Tensor64 a, const Tensor64 b, Tensor64 &c){
+    active_kernels().tensor_mul_f64(a, b, c);
+}
+
+void simd_conv(const double* x, size_t l1, const double* h, size_t l2, double* y, simd_conv_mode mode){
+    active_kernels().conv_f64(x, l1, h, l2, y, conv_first(l1, l2, mode), simd_conv_size(l1, l2, mode));
+}
+
+void simd_mul_batch(const Tensor* a, const Tensor* b, Tensor* c, size_t count){
+    active_kernels().mul_batch(a, b, c, count);
+}
+
+void simd_mul_batch_soa(const float* a, const float* b, float* c, size_t count, size_t stride){
+    active_kernels().mul_batch_soa(a, b, c, count, stride);
+}
+
+void simd_sgemm(bool trans_a, bool trans_b, size_t m, size_t n, size_t k,
+                float alpha, const float* a, size_t lda, const float* b, size_t ldb,
+                float beta, float* c, size_t ldc){
+    active_kernels().sgemm(trans_a, trans_b, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+}
@@ -0,0 +1,153 @@
+/**
+ * @file dispatch.h
+ * @author Sravan Senthilnathan
+ * @brief internal kernel table behind the simd_* entry points
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2023
+ * 
+ */
+#ifndef DISPATCH_H
+#define DISPATCH_H
+
+#include "simd_playground.h"
+
+struct fft_plan;
+
+/**
+ * @brief one function pointer per dispatched kernel
+ * 
+ * a table is built per instruction set level, starting from the scalar
+ * reference kernels and overriding every slot a faster variant exists for.
+ */
+struct kernel_table {
+    void (*add)(const float* a, const float* b, float* c, size_t n);
+    void (*sub)(const float* a, const float* b, float* c, size_t n);
+    void (*mul)(const float* a, const float* b, float* c, size_t n);
+    void (*div)(const float* a, const float* b, float* c, size_t n);
+    void (*mul_add)(const float* a, const float* b, const float* c, float* d, size_t n);
+
+    // the same with non-temporal stores, from simd_streaming_threshold() elements on:
+    void (*add_stream)(const float* a, const float* b, float* c, size_t n);
+    void (*sub_stream)(const float* a, const float* b, float* c, size_t n);
+    void (*mul_stream)(const float* a, const float* b, float* c, size_t n);
+    void (*div_stream)(const float* a, const float* b, float* c, size_t n);
+
+    // reductions, see reduce_driver.h:
+    float (*sum)(const float* a, size_t n, simd_sum_mode mode);
+    float (*dot)(const float* a, const float* b, size_t n, simd_sum_mode mode);
+    float (*minimum)(const float* a, size_t n);
+    float (*maximum)(const float* a, size_t n);
+    size_t (*argmin)(const float* a, size_t n);
+    size_t (*argmax)(const float* a, size_t n);
+
+    // elementwise math, see math_driver.h:
+    void (*exp)(const float* a, float* b, size_t n, simd_math_mode mode);
+    void (*log)(const float* a, float* b, size_t n, simd_math_mode mode);
+    void (*sin)(const float* a, float* b, size_t n, simd_math_mode mode);
+    void (*cos)(const float* a, float* b, size_t n, simd_math_mode mode);
+    void (*tanh)(const float* a, float* b, size_t n, simd_math_mode mode);
+    void (*sigmoid)(const float* a, float* b, size_t n, simd_math_mode mode);
+    void (*erf)(const float* a, float* b, size_t n, simd_math_mode mode);
+    void (*pow)(const float* a, const float* b, float* c, size_t n, simd_math_mode mode);
+
+    // division and square roots with a simd_div_mode, see recip_driver.h:
+    void (*div_mode)(const float* a, const float* b, float* c, size_t n, simd_div_mode mode);
+    void (*sqrt)(const float* a, float* b, size_t n, simd_div_mode mode);
+    void (*rsqrt)(const float* a, float* b, size_t n, simd_div_mode mode);
+
+    // fused row kernels over rows x cols batches, see layer_driver.h:
+    void (*softmax)(const float* x, float* y, size_t rows, size_t cols);
+    void (*log_softmax)(const float* x, float* y, size_t rows, size_t cols);
+    void (*layer_norm)(const float* x, const float* gamma, const float* beta, float* y,
+                       size_t rows, size_t cols, float eps);
+    void (*rms_norm)(const float* x, const float* gamma, float* y, size_t rows, size_t cols, float eps);
+    void (*bias_activation)(const float* x, const float* bias, float* y, size_t rows, size_t cols,
+                            simd_activation act);
+
+    // FP16/BF16 storage, see half_driver.h:
+    void (*to_half)(const float* a, uint16_t* h, size_t n, simd_half_format format);
+    void (*from_half)(const uint16_t* h, float* a, size_t n, simd_half_format format);
+    void (*add_half)(const uint16_t* a, const uint16_t* b, uint16_t* c, size_t n, simd_half_format format);
+    void (*mul_half)(const uint16_t* a, const uint16_t* b, uint16_t* c, size_t n, simd_half_format format);
+    float (*dot_half)(const uint16_t* a, const uint16_t* b, size_t n, simd_half_format format);
+
+    // integer and quantized kernels, see int_driver.h:
+    void (*add_i8)(const int8_t* a, const int8_t* b, int8_t* c, size_t n, simd_overflow overflow);
+    void (*add_u8)(const uint8_t* a, const uint8_t* b, uint8_t* c, size_t n, simd_overflow overflow);
+    void (*add_i16)(const int16_t* a, const int16_t* b, int16_t* c, size_t n, simd_overflow overflow);
+    void (*add_i32)(const int32_t* a, const int32_t* b, int32_t* c, size_t n, simd_overflow overflow);
+    void (*sub_i8)(const int8_t* a, const int8_t* b, int8_t* c, size_t n, simd_overflow overflow);
+    void (*sub_u8)(const uint8_t* a, const uint8_t* b, uint8_t* c, size_t n, simd_overflow overflow);
+    void (*sub_i16)(const int16_t* a, const int16_t* b, int16_t* c, size_t n, simd_overflow overflow);
+    void (*sub_i32)(const int32_t* a, const int32_t* b, int32_t* c, size_t n, simd_overflow overflow);
+    void (*mul_i8)(const int8_t* a, const int8_t* b, int8_t* c, size_t n, simd_overflow overflow);
+    void (*mul_u8)(const uint8_t* a, const uint8_t* b, uint8_t* c, size_t n, simd_overflow overflow);
+    void (*mul_i16)(const int16_t* a, const int16_t* b, int16_t* c, size_t n, simd_overflow overflow);
+    void (*mul_i32)(const int32_t* a, const int32_t* b, int32_t* c, size_t n, simd_overflow overflow);
+    int64_t (*dot_u8)(const uint8_t* a, const int8_t* b, size_t n);
+    int64_t (*dot_i8)(const int8_t* a, const int8_t* b, size_t n);
+    void (*conv_quant)(const int16_t* x, const int16_t* h, size_t m, uint8_t* y, size_t count,
+                       float multiplier, int32_t zero_point);
+
+    void (*tensor_add)(const Tensor a, const Tensor b, Tensor &c);
+    void (*tensor_sub)(const Tensor a, const Tensor b, Tensor &c);
+    void (*tensor_mul)(const Tensor a, const Tensor b, Tensor &c);
+
+    void (*mul_batch)(const Tensor* a, const Tensor* b, Tensor* c, size_t count);
+    void (*mul_batch_soa)(const float* a, const float* b, float* c, size_t count, size_t stride);
+
+    // y[i] += (x * h)[first + i], see conv_driver.h:
+    void (*conv)(const float* x, size_t l1, const float* h, size_t l2, float* y,
+                 size_t first, size_t count);
+
+    // y[c] = sum h[i kw + j] rows[i][c - j], a row of a 2D convolution, see conv2d_driver.h:
+    void (*conv2d_rows)(const float* const* rows, const float* h, size_t kw, size_t kh, float* y, size_t count);
+
+    // double precision, see vector_driver.h:
+    void (*add_f64)(const double* a, const double* b, double* c, size_t n);
+    void (*sub_f64)(const double* a, const double* b, double* c, size_t n);
+    void (*mul_f64)(const double* a, const double* b, double* c, size_t n);
+    void (*div_f64)(const double* a, const double* b, double* c, size_t n);
+    void (*mul_add_f64)(const double* a, const double* b, const double* c, double* d, size_t n);
+    void (*tensor_add_f64)(const Tensor64 a, const Tensor64 b, Tensor64 &c);
+    void (*tensor_sub_f64)(const Tensor64 a, const Tensor64 b, Tensor64 &c);
+    void (*tensor_mul_f64)(const Tensor64 a, const Tensor64 b, Tensor64 &c);
+    void (*conv_f64)(const double* x, size_t l1, const double* h, size_t l2, double* y,
+                     size_t first, size_t count);
+
+    // FFT passes of the convolution engine, see fft.h:
+    void (*fft)(const fft_plan& p, const float* in_re, const float* in_im, size_t stride,
+                float* re, float* im);
+    void (*spectrum_mul)(const float* ar, const float* ai, const float* br, const float* bi,
+                         float* cr, float* ci, size_t n);
+
+    void (*sgemm)(bool trans_a, bool trans_b, size_t m, size_t n, size_t k,
+                  float alpha, const float* a, size_t lda, const float* b, size_t ldb,
+                  float beta, float* c, size_t ldc);
+};
+
+/**
+ * @brief kernel table of the active instruction set level
+ */
+const kernel_table& active_kernels();
+
+/**
+ * @brief whether an elementwise kernel over n elements should take the
+ * non-temporal (_stream) variant
+ */
+bool use_streaming(size_t n);
+
+/**
+ * @brief whether the kernels finish with a vector tail, see simd_set_tail()
+ */
+bool use_vector_tails();
+
+/**
+ * @brief index in the full convolution of the first output of the given
+ * mode, see simd_conv()
+ */
+size_t conv_first(size_t l1, size_t l2, simd_conv_mode mode);
+
+#endif
@@ -0,0 +1,84 @@
+/**
+ * @file fft.cpp
+ * @author Sravan Senthilnathan
+ * @brief FFT plan cache and the scalar transform
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2023
+ * 
+ */
+#include <cmath>
+#include <map>
+#include <mutex>
+
+#include "fft.h"
+
+namespace {
+
+fft_plan* build_plan(size_t n){
+    fft_plan* p = new fft_plan;
+    p->n = n;
+
+    size_t bits = 0;
+    while(((size_t)1 << bits) < n){
+        ++bits;
+    }
+    p->rev.resize(n);
+    for(size_t i = 0; i < n; ++i){
+        size_t r = 0;
+        for(size_t b = 0; b < bits; ++b){
+            r |= ((i >> b) & 1) << (bits - 1 - b);
+        }
+        p->rev[i] = (uint32_t)r;
+    }
+
+    // twiddles in double, so the tables do not add rounding error of their own:
+    p->tw_re.resize(2 * n - 1);
+    p->tw_im.resize(2 * n - 1);
+    for(size_t L = 1; L <= n; L *= 2){
+        for(size_t k = 0; k < L; ++k){
+            const double angle = -M_PI * (double)k / (double)L;
+            p->tw_re[L - 1 + k] = (float)std::cos(angle);
+            p->tw_im[L - 1 + k] = (float)std::sin(angle);
+        }
+    }
+    return p;
+}
+
+struct scalar_vec {
+    static constexpr size_t W = 1;
+    using reg = float;
+
+    static reg load(const float* p) { return *p; }
+    static void store(float* p, reg a) { *p = a; }
+    static reg add(reg a, reg b) { return a + b; }
+    static reg sub(reg a, reg b) { return a - b; }
+    static reg mul(reg a, reg b) { return a * b; }
+    static reg mul_add(reg a, reg b, reg c) { return a * b + c; }
+    static reg mul_sub(reg a, reg b, reg c) { return a * b - c; }
+};
+
+}
+
+std::shared_ptr<const fft_plan> fft_plan_for(size_t n){
+    static std::mutex lock;
+    static std::map<size_t, std::shared_ptr<const fft_plan>> plans;
+
+    std::lock_guard<std::mutex> guard(lock);
+    auto& p = plans[n];
+    if(!p){
+        p.reset(build_plan(n));
+    }
+    return p;
+}
+
+void scalar_fft(const fft_plan& p, const float* in_re, const float* in_im, size_t stride,
+                float* re, float* im){
+    fft_forward<scalar_vec>(p, in_re, in_im, stride, re, im);
+}
+
+void scalar_spectrum_mul(const float* ar, const float* ai, const float* br, const float* bi,
+                         float* cr, float* ci, size_t n){
+    fft_spectrum_mul<scalar_vec>(ar, ai, br, bi, cr, ci, n);
+}
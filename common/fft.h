@@ -0,0 +1,237 @@
+/**
+ * @file fft.h
+ * @author Sravan Senthilnathan
+ * @brief FFT plans and the radix-2/4 transform shared by the per instruction set kernels
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2023
+ * 
+ * Complex transforms of power of two size on split arrays (re[], im[]), so
+ * every butterfly works on W independent points with plain vector
+ * arithmetic. The transform is decimation in time: the input is gathered
+ * in bit reversed order, the first three radix-2 stages run as a scalar
+ * leaf on blocks of 8, then every later pair of stages is fused into one
+ * radix-4 (radix-2^2) pass over memory, with a last radix-2 pass when the
+ * number of stages is odd. The twiddles of every stage are stored
+ * contiguously in the plan, so the vector passes only do unit stride loads.
+ * 
+ * The passes are templates on a vector policy V, the same way as the GEMM
+ * driver, so each instruction set gets its own copy built with its own
+ * flags. V provides W (lanes, at most 8), reg, load, store, add, sub, mul,
+ * mul_add(a, b, c) = a * b + c and mul_sub(a, b, c) = a * b - c.
+ */
+#ifndef FFT_H
+#define FFT_H
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+/**
+ * @brief everything a transform of one size needs, immutable once built
+ * and shared by all callers (see fft_plan_for())
+ */
+struct fft_plan {
+    size_t n;                       // complex points, a power of two
+    std::vector<uint32_t> rev;      // bit reversal permutation
+    // exp(-i pi k / L) for k < L, for every L = 1, 2, 4, .., n; table L starts at L - 1:
+    std::vector<float> tw_re;
+    std::vector<float> tw_im;
+};
+
+/**
+ * @brief cached plan for n complex points (a power of two), built on first use
+ */
+std::shared_ptr<const fft_plan> fft_plan_for(size_t n);
+
+/**
+ * @brief unnormalised forward transform, out of place
+ * 
+ * input point j is (in_re[j * stride], in_im[j * stride]), so an
+ * interleaved complex array is read with in_im = in_re + 1 and stride 2.
+ * The inverse transform is the forward one with re and im swapped on both
+ * sides.
+ */
+template<class V>
+void fft_forward(const fft_plan& p, const float* in_re, const float* in_im, size_t stride,
+                 float* re, float* im){
+    static_assert(V::W <= 8, "the vector passes start at 8 point blocks");
+    using reg = typename V::reg;
+
+    const size_t n = p.n;
+    const float* twr = p.tw_re.data();
+    const float* twi = p.tw_im.data();
+
+    // bit reversal fused with the first three stages, scalar:
+    if(n < 8){
+        for(size_t t = 0; t < n; ++t){
+            re[t] = in_re[p.rev[t] * stride];
+            im[t] = in_im[p.rev[t] * stride];
+        }
+        for(size_t L = 1; L < n; L *= 2){
+            for(size_t i = 0; i < n; i += 2 * L){
+                for(size_t k = 0; k < L; ++k){
+                    const float wr = twr[L - 1 + k], wi = twi[L - 1 + k];
+                    const float ur = re[i + k + L] * wr - im[i + k + L] * wi;
+                    const float ui = re[i + k + L] * wi + im[i + k + L] * wr;
+                    re[i + k + L] = re[i + k] - ur;
+                    im[i + k + L] = im[i + k] - ui;
+                    re[i + k] += ur;
+                    im[i + k] += ui;
+                }
+            }
+        }
+        return;
+    }
+    // block q reads points q + t n / 8, eight sequential streams, and
+    // writes its 8 outputs, in bit reversed order of t, starting at rev(q):
+    const size_t d = n / 8 * stride;
+    const float c = 0.70710678118654752f;
+    for(size_t q = 0; q < n / 8; ++q){
+        const float* xr = in_re + q * stride;
+        const float* xi = in_im + q * stride;
+        float* r = re + p.rev[q];
+        float* m = im + p.rev[q];
+
+        // L = 1, twiddle 1:
+        const float a0r = xr[0] + xr[4 * d],     a0i = xi[0] + xi[4 * d];
+        const float a1r = xr[0] - xr[4 * d],     a1i = xi[0] - xi[4 * d];
+        const float a2r = xr[2 * d] + xr[6 * d], a2i = xi[2 * d] + xi[6 * d];
+        const float a3r = xr[2 * d] - xr[6 * d], a3i = xi[2 * d] - xi[6 * d];
+        const float a4r = xr[d] + xr[5 * d],     a4i = xi[d] + xi[5 * d];
+        const float a5r = xr[d] - xr[5 * d],     a5i = xi[d] - xi[5 * d];
+        const float a6r = xr[3 * d] + xr[7 * d], a6i = xi[3 * d] + xi[7 * d];
+        const float a7r = xr[3 * d] - xr[7 * d], a7i = xi[3 * d] - xi[7 * d];
+
+        // L = 2, twiddles 1 and -i:
+        const float b0r = a0r + a2r, b0i = a0i + a2i;
+        const float b2r = a0r - a2r, b2i = a0i - a2i;
+        const float b1r = a1r + a3i, b1i = a1i - a3r;
+        const float b3r = a1r - a3i, b3i = a1i + a3r;
+        const float b4r = a4r + a6r, b4i = a4i + a6i;
+        const float b6r = a4r - a6r, b6i = a4i - a6i;
+        const float b5r = a5r + a7i, b5i = a5i - a7r;
+        const float b7r = a5r - a7i, b7i = a5i + a7r;
+
+        // L = 4, twiddles 1, c (1 - i), -i and -c (1 + i):
+        const float u5r = c * (b5r + b5i), u5i = c * (b5i - b5r);
+        const float u7r = c * (b7i - b7r), u7i = -c * (b7r + b7i);
+        r[0] = b0r + b4r;  m[0] = b0i + b4i;
+        r[4] = b0r - b4r;  m[4] = b0i - b4i;
+        r[1] = b1r + u5r;  m[1] = b1i + u5i;
+        r[5] = b1r - u5r;  m[5] = b1i - u5i;
+        r[2] = b2r + b6i;  m[2] = b2i - b6r;
+        r[6] = b2r - b6i;  m[6] = b2i + b6r;
+        r[3] = b3r + u7r;  m[3] = b3i + u7i;
+        r[7] = b3r - u7r;  m[7] = b3i - u7i;
+    }
+
+    size_t L = 8;
+    while(L < n){
+        if(4 * L <= n){
+            // two radix-2 stages (L -> 2L -> 4L) per pass:
+            const float* w1r = twr + L - 1;
+            const float* w1i = twi + L - 1;
+            const float* w2r = twr + 2 * L - 1;
+            const float* w2i = twi + 2 * L - 1;
+            for(size_t i = 0; i < n; i += 4 * L){
+                float* r = re + i;
+                float* m = im + i;
+                for(size_t k = 0; k < L; k += V::W){
+                    const reg a0r = V::load(r + k),         a0i = V::load(m + k);
+                    const reg a1r = V::load(r + k + L),     a1i = V::load(m + k + L);
+                    const reg a2r = V::load(r + k + 2 * L), a2i = V::load(m + k + 2 * L);
+                    const reg a3r = V::load(r + k + 3 * L), a3i = V::load(m + k + 3 * L);
+
+                    // first stage, the same twiddle for both pairs:
+                    const reg tr = V::load(w1r + k), ti = V::load(w1i + k);
+                    const reg t1r = V::mul_sub(a1r, tr, V::mul(a1i, ti));
+                    const reg t1i = V::mul_add(a1r, ti, V::mul(a1i, tr));
+                    const reg t3r = V::mul_sub(a3r, tr, V::mul(a3i, ti));
+                    const reg t3i = V::mul_add(a3r, ti, V::mul(a3i, tr));
+                    const reg b0r = V::add(a0r, t1r), b0i = V::add(a0i, t1i);
+                    const reg b1r = V::sub(a0r, t1r), b1i = V::sub(a0i, t1i);
+                    const reg b2r = V::add(a2r, t3r), b2i = V::add(a2i, t3i);
+                    const reg b3r = V::sub(a2r, t3r), b3i = V::sub(a2i, t3i);
+
+                    // second stage, twiddles k and k + L of the 2L table:
+                    const reg ur = V::load(w2r + k),     ui = V::load(w2i + k);
+                    const reg vr = V::load(w2r + k + L), vi = V::load(w2i + k + L);
+                    const reg u2r = V::mul_sub(b2r, ur, V::mul(b2i, ui));
+                    const reg u2i = V::mul_add(b2r, ui, V::mul(b2i, ur));
+                    const reg u3r = V::mul_sub(b3r, vr, V::mul(b3i, vi));
+                    const reg u3i = V::mul_add(b3r, vi, V::mul(b3i, vr));
+
+                    V::store(r + k,         V::add(b0r, u2r));
+                    V::store(m + k,         V::add(b0i, u2i));
+                    V::store(r + k + 2 * L, V::sub(b0r, u2r));
+                    V::store(m + k + 2 * L, V::sub(b0i, u2i));
+                    V::store(r + k + L,     V::add(b1r, u3r));
+                    V::store(m + k + L,     V::add(b1i, u3i));
+                    V::store(r + k + 3 * L, V::sub(b1r, u3r));
+                    V::store(m + k + 3 * L, V::sub(b1i, u3i));
+                }
+            }
+            L *= 4;
+        }
+        else{
+            const float* w1r = twr + L - 1;
+            const float* w1i = twi + L - 1;
+            for(size_t i = 0; i < n; i += 2 * L){
+                float* r = re + i;
+                float* m = im + i;
+                for(size_t k = 0; k < L; k += V::W){
+                    const reg ar = V::load(r + k),     ai = V::load(m + k);
+                    const reg br = V::load(r + k + L), bi = V::load(m + k + L);
+                    const reg tr = V::load(w1r + k),   ti = V::load(w1i + k);
+                    const reg ur = V::mul_sub(br, tr, V::mul(bi, ti));
+                    const reg ui = V::mul_add(br, ti, V::mul(bi, tr));
+                    V::store(r + k,     V::add(ar, ur));
+                    V::store(m + k,     V::add(ai, ui));
+                    V::store(r + k + L, V::sub(ar, ur));
+                    V::store(m + k + L, V::sub(ai, ui));
+                }
+            }
+            L *= 2;
+        }
+    }
+}
+
+/**
+ * @brief pointwise complex product c = a * b of two split spectra, c may be a or b
+ */
+template<class V>
+void fft_spectrum_mul(const float* ar, const float* ai, const float* br, const float* bi,
+                      float* cr, float* ci, size_t n){
+    using reg = typename V::reg;
+
+    size_t k = 0;
+    for(; k + V::W <= n; k += V::W){
+        const reg xr = V::load(ar + k), xi = V::load(ai + k);
+        const reg yr = V::load(br + k), yi = V::load(bi + k);
+        V::store(cr + k, V::mul_sub(xr, yr, V::mul(xi, yi)));
+        V::store(ci + k, V::mul_add(xr, yi, V::mul(xi, yr)));
+    }
+    for(; k < n; ++k){
+        const float xr = ar[k], xi = ai[k], yr = br[k], yi = bi[k];
+        cr[k] = xr * yr - xi * yi;
+        ci[k] = xr * yi + xi * yr;
+    }
+}
+
+// scalar instantiations, the dispatcher's fallback:
+void scalar_fft(const fft_plan& p, const float* in_re, const float* in_im, size_t stride,
+                float* re, float* im);
+void scalar_spectrum_mul(const float* ar, const float* ai, const float* br, const float* bi,
+                         float* cr, float* ci, size_t n);
+
+#if defined(__aarch64__)
+void neon_fft(const fft_plan& p, const float* in_re, const float* in_im, size_t stride,
+              float* re, float* im);
+void neon_spectrum_mul(const float* ar, const float* ai, const float* br, const float* bi,
+                       float* cr, float* ci, size_t n);
+#endif
+
+#endif
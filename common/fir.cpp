@@ -0,0 +1,71 @@
+/**
+ * @file fir.cpp
+ * @author Sravan Senthilnathan
+ * @brief streaming FIR filter on top of the direct convolution kernels
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2023
+ * 
+ * The buffer holds the last taps - 1 samples followed by the current
+ * chunk, so every output of the chunk is a body output of the convolution
+ * of the buffer with h (see conv_driver.h): the kernel sums the same taps
+ * in the same order as over the whole signal, which is what makes the
+ * result bit identical to the one-shot convolution.
+ */
+#include <algorithm>
+#include <cstring>
+
+#include "simd_playground.h"
+#include "dispatch.h"
+
+using namespace std;
+
+simd_fir::simd_fir(const float* h, size_t taps, size_t max_chunk)
+    : h_(h, h + taps), max_chunk_(max(max_chunk, (size_t)1)){
+    // an empty filter outputs zeros, like a single zero tap:
+    if(h_.empty()){
+        h_.push_back(0.0f);
+    }
+    buf_.assign(h_.size() - 1 + max_chunk_, 0.0f);
+}
+
+void simd_fir::process(const float* in, float* out, size_t n){
+    const size_t hist = h_.size() - 1;
+    while(n > 0){
+        const size_t len = min(n, max_chunk_);
+        // in and out may be the same array, the chunk is copied first:
+        memcpy(buf_.data() + hist, in, len * sizeof(float));
+        run(out, len);
+        in += len;
+        out += len;
+        n -= len;
+    }
+}
+
+void simd_fir::flush(float* out){
+    const size_t hist = h_.size() - 1;
+    for(size_t done = 0; done < hist; ){
+        const size_t len = min(hist - done, max_chunk_);
+        fill(buf_.begin() + hist, buf_.begin() + hist + len, 0.0f);
+        run(out + done, len);
+        done += len;
+    }
+    reset();
+}
+
+void simd_fir::reset(){
+    fill(buf_.begin(), buf_.end(), 0.0f);
+}
+
+/**
+ * @brief outputs for the len samples after the history, then keeps the
+ * last taps - 1 samples as the new history
+ */
+void simd_fir::run(float* out, size_t len){
+    const size_t hist = h_.size() - 1;
+    fill(out, out + len, 0.0f);
+    // outputs hist .. hist + len - 1 of buf * h are all body outputs:
+    active_kernels().conv(buf_.data(), hist + len, h_.data(), h_.size(), out, hist, len);
+    memmove(buf_.data(), buf_.data() + len, hist * sizeof(float));
+}
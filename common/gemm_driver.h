@@ -0,0 +1,180 @@
+/**
+ * @file gemm_driver.h
+ * @author Sravan Senthilnathan
+ * @brief cache blocked SGEMM driver shared by the per instruction set kernels
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2023
+ * 
+ * C = alpha * op(A) * op(B) + beta * C on row-major matrices, blocked the
+ * usual way (Goto/BLIS):
+ * 
+ *   jc: NC columns of B    -> packed B panel, KC x NC, stays in L3
+ *   pc: KC deep slice      -> one pass of rank-KC updates
+ *   ic: MC rows of A       -> packed A block, MC x KC, stays in L2
+ *   jr: NR wide B sliver   -> KC x NR, stays in L1
+ *   ir: MR high A sliver   -> micro-kernel, MR x NR accumulators in registers
+ * 
+ * The packed slivers are stored in the order the micro-kernel reads them, so
+ * its inner loop only sees unit stride loads whatever the transposition and
+ * leading dimensions of the operands. Edges are zero padded while packing.
+ * 
+ * A micro-kernel is a struct K with the block sizes MR, NR, MC, KC, NC and
+ * 
+ *   static void kernel(size_t kc, const float* a, const float* b,
+ *                      float* c, size_t ldc, float alpha, float beta);
+ * 
+ * computing c = alpha * a * b + beta * c on one full MR x NR tile, with c
+ * not read when beta is 0. The driver is a template on K so every
+ * instruction set gets its own copy compiled with its own flags.
+ */
+#ifndef GEMM_DRIVER_H
+#define GEMM_DRIVER_H
+
+#include <algorithm>
+#include <cstddef>
+#include <new>
+
+/**
+ * @brief one 64 byte aligned packing buffer per thread and kernel, grown on demand
+ */
+template<class K, int Slot>
+float* gemm_buffer(size_t floats){
+    struct buffer {
+        float* p = nullptr;
+        size_t size = 0;
+        ~buffer(){ ::operator delete(p, std::align_val_t(64)); }
+    };
+    thread_local buffer buf;
+
+    if(buf.size < floats){
+        ::operator delete(buf.p, std::align_val_t(64));
+        buf.p = static_cast<float*>(::operator new(floats * sizeof(float), std::align_val_t(64)));
+        buf.size = floats;
+    }
+    return buf.p;
+}
+
+/**
+ * @brief packs rows [i0, i0 + mc) x columns [p0, p0 + kc) of op(A) into MR high slivers
+ */
+template<class K>
+void gemm_pack_a(bool trans, const float* a, size_t lda, size_t i0, size_t p0,
+                 size_t mc, size_t kc, float* out){
+    for(size_t ir = 0; ir < mc; ir += K::MR){
+        const size_t mr = std::min(K::MR, mc - ir);
+        for(size_t p = 0; p < kc; ++p){
+            for(size_t i = 0; i < mr; ++i){
+                const size_t row = i0 + ir + i, col = p0 + p;
+                out[i] = trans ? a[col * lda + row] : a[row * lda + col];
+            }
+            for(size_t i = mr; i < K::MR; ++i){
+                out[i] = 0.0f;
+            }
+            out += K::MR;
+        }
+    }
+}
+
+/**
+ * @brief packs rows [p0, p0 + kc) x columns [j0, j0 + nc) of op(B) into NR wide slivers
+ */
+template<class K>
+void gemm_pack_b(bool trans, const float* b, size_t ldb, size_t p0, size_t j0,
+                 size_t kc, size_t nc, float* out){
+    for(size_t jr = 0; jr < nc; jr += K::NR){
+        const size_t nr = std::min(K::NR, nc - jr);
+        for(size_t p = 0; p < kc; ++p){
+            const size_t row = p0 + p;
+            if(trans){
+                for(size_t j = 0; j < nr; ++j){
+                    out[j] = b[(j0 + jr + j) * ldb + row];
+                }
+            }
+            else{
+                const float* src = b + row * ldb + j0 + jr;
+                for(size_t j = 0; j < nr; ++j){
+                    out[j] = src[j];
+                }
+            }
+            for(size_t j = nr; j < K::NR; ++j){
+                out[j] = 0.0f;
+            }
+            out += K::NR;
+        }
+    }
+}
+
+/**
+ * @brief blocked SGEMM on top of the micro-kernel K, same arguments as sgemm()
+ */
+template<class K>
+void gemm_blocked(bool trans_a, bool trans_b, size_t m, size_t n, size_t k,
+                  float alpha, const float* a, size_t lda, const float* b, size_t ldb,
+                  float beta, float* c, size_t ldc){
+    if(m == 0 || n == 0){
+        return;
+    }
+
+    // nothing to accumulate, only scale C (beta = 0 overwrites, even NaNs):
+    if(k == 0 || alpha == 0.0f){
+        for(size_t i = 0; i < m; ++i){
+            for(size_t j = 0; j < n; ++j){
+                c[i * ldc + j] = beta == 0.0f ? 0.0f : beta * c[i * ldc + j];
+            }
+        }
+        return;
+    }
+
+    const size_t kc_max = std::min(K::KC, k);
+    const size_t mc_max = std::min(K::MC, (m + K::MR - 1) / K::MR * K::MR);
+    const size_t nc_max = std::min(K::NC, (n + K::NR - 1) / K::NR * K::NR);
+    float* pa = gemm_buffer<K, 0>(mc_max * kc_max);
+    float* pb = gemm_buffer<K, 1>(nc_max * kc_max);
+
+    alignas(64) float tile[K::MR * K::NR];
+
+    for(size_t jc = 0; jc < n; jc += K::NC){
+        const size_t nc = std::min(K::NC, n - jc);
+
+        for(size_t pc = 0; pc < k; pc += K::KC){
+            const size_t kc = std::min(K::KC, k - pc);
+            // beta only applies on the first pass, later ones accumulate:
+            const float bt = pc == 0 ? beta : 1.0f;
+
+            gemm_pack_b<K>(trans_b, b, ldb, pc, jc, kc, nc, pb);
+
+            for(size_t ic = 0; ic < m; ic += K::MC){
+                const size_t mc = std::min(K::MC, m - ic);
+
+                gemm_pack_a<K>(trans_a, a, lda, ic, pc, mc, kc, pa);
+
+                for(size_t jr = 0; jr < nc; jr += K::NR){
+                    const size_t nr = std::min(K::NR, nc - jr);
+
+                    for(size_t ir = 0; ir < mc; ir += K::MR){
+                        const size_t mr = std::min(K::MR, mc - ir);
+                        float* cp = c + (ic + ir) * ldc + jc + jr;
+
+                        if(mr == K::MR && nr == K::NR){
+                            K::kernel(kc, pa + ir * kc, pb + jr * kc, cp, ldc, alpha, bt);
+                        }
+                        else{
+                            // partial tile: compute the full one aside, merge the valid part
+                            K::kernel(kc, pa + ir * kc, pb + jr * kc, tile, K::NR, alpha, 0.0f);
+                            for(size_t i = 0; i < mr; ++i){
+                                for(size_t j = 0; j < nr; ++j){
+                                    float& y = cp[i * ldc + j];
+                                    y = bt == 0.0f ? tile[i * K::NR + j] : bt * y + tile[i * K::NR + j];
+                                }
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+
+#endif
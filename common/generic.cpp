@@ -0,0 +1,186 @@
+/**
+ * @file generic.cpp
+ * @author Sravan Senthilnathan
+ * @brief the generic level: the shared kernels on the portable NEON shaped backend
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2023
+ * 
+ * The same driver instantiations as arm64/neon, on vec_generic instead of
+ * vec_neon: 4 float (2 double) lanes, fused multiply-adds, NaN skipping
+ * min/max and no non-temporal stores. Built without any instruction set
+ * flags, it runs wherever the library does, which is how x86 machines
+ * build and verify the code paths the NEON level takes. It is not meant
+ * to be fast.
+ */
+#include "simd_playground.h"
+#include "simd_vec.h"
+#include "conv_driver.h"
+#include "conv2d_driver.h"
+#include "layer_driver.h"
+#include "math_driver.h"
+#include "recip_driver.h"
+#include "reduce_driver.h"
+#include "stream_driver.h"
+#include "vector_driver.h"
+
+void generic_add(const float* a, const float* b, float* c, size_t n){
+    vec_binary<vec_generic<float>, vec_op::add>(a, b, c, n);
+}
+
+void generic_sub(const float* a, const float* b, float* c, size_t n){
+    vec_binary<vec_generic<float>, vec_op::sub>(a, b, c, n);
+}
+
+void generic_mul(const float* a, const float* b, float* c, size_t n){
+    vec_binary<vec_generic<float>, vec_op::mul>(a, b, c, n);
+}
+
+void generic_div(const float* a, const float* b, float* c, size_t n){
+    vec_binary<vec_generic<float>, vec_op::div>(a, b, c, n);
+}
+
+void generic_mul_add(const float* a, const float* b, const float* c, float* d, size_t n){
+    vec_mul_add<vec_generic<float>>(a, b, c, d, n);
+}
+
+void generic_add(const double* a, const double* b, double* c, size_t n){
+    vec_binary<vec_generic<double>, vec_op::add>(a, b, c, n);
+}
+
+void generic_sub(const double* a, const double* b, double* c, size_t n){
+    vec_binary<vec_generic<double>, vec_op::sub>(a, b, c, n);
+}
+
+void generic_mul(const double* a, const double* b, double* c, size_t n){
+    vec_binary<vec_generic<double>, vec_op::mul>(a, b, c, n);
+}
+
+void generic_div(const double* a, const double* b, double* c, size_t n){
+    vec_binary<vec_generic<double>, vec_op::div>(a, b, c, n);
+}
+
+void generic_mul_add(const double* a, const double* b, const double* c, double* d, size_t n){
+    vec_mul_add<vec_generic<double>>(a, b, c, d, n);
+}
+
+void generic_add_stream(const float* a, const float* b, float* c, size_t n){
+    stream_run<vec_generic<float>, stream_add>(a, b, c, n);
+}
+
+void generic_sub_stream(const float* a, const float* b, float* c, size_t n){
+    stream_run<vec_generic<float>, stream_sub>(a, b, c, n);
+}
+
+void generic_mul_stream(const float* a, const float* b, float* c, size_t n){
+    stream_run<vec_generic<float>, stream_mul>(a, b, c, n);
+}
+
+void generic_div_stream(const float* a, const float* b, float* c, size_t n){
+    stream_run<vec_generic<float>, stream_div>(a, b, c, n);
+}
+
+float generic_sum(const float* a, size_t n, simd_sum_mode mode){
+    return reduce_sum<vec_generic<float>>(a, n, mode);
+}
+
+float generic_dot(const float* a, const float* b, size_t n, simd_sum_mode mode){
+    return reduce_dot<vec_generic<float>>(a, b, n, mode);
+}
+
+float generic_minimum(const float* a, size_t n){
+    return reduce_extreme<vec_generic<float>, false>(a, 0, n);
+}
+
+float generic_maximum(const float* a, size_t n){
+    return reduce_extreme<vec_generic<float>, true>(a, 0, n);
+}
+
+size_t generic_argmin(const float* a, size_t n){
+    return reduce_arg_extreme<vec_generic<float>, false>(a, n);
+}
+
+size_t generic_argmax(const float* a, size_t n){
+    return reduce_arg_extreme<vec_generic<float>, true>(a, n);
+}
+
+void generic_exp(const float* a, float* b, size_t n, simd_math_mode mode){
+    math_unary<vec_generic<float>, math_fn::exp>(a, b, n, mode);
+}
+
+void generic_log(const float* a, float* b, size_t n, simd_math_mode mode){
+    math_unary<vec_generic<float>, math_fn::log>(a, b, n, mode);
+}
+
+void generic_sin(const float* a, float* b, size_t n, simd_math_mode mode){
+    math_unary<vec_generic<float>, math_fn::sin>(a, b, n, mode);
+}
+
+void generic_cos(const float* a, float* b, size_t n, simd_math_mode mode){
+    math_unary<vec_generic<float>, math_fn::cos>(a, b, n, mode);
+}
+
+void generic_tanh(const float* a, float* b, size_t n, simd_math_mode mode){
+    math_unary<vec_generic<float>, math_fn::tanh>(a, b, n, mode);
+}
+
+void generic_sigmoid(const float* a, float* b, size_t n, simd_math_mode mode){
+    math_unary<vec_generic<float>, math_fn::sigmoid>(a, b, n, mode);
+}
+
+void generic_erf(const float* a, float* b, size_t n, simd_math_mode mode){
+    math_unary<vec_generic<float>, math_fn::erf>(a, b, n, mode);
+}
+
+void generic_pow(const float* a, const float* b, float* c, size_t n, simd_math_mode mode){
+    math_pow<vec_generic<float>, vec_generic<double>>(a, b, c, n, mode);
+}
+
+void generic_div(const float* a, const float* b, float* c, size_t n, simd_div_mode mode){
+    recip_div<vec_generic<float>>(a, b, c, n, mode);
+}
+
+void generic_sqrt(const float* a, float* b, size_t n, simd_div_mode mode){
+    recip_unary<vec_generic<float>, recip_fn::sqrt>(a, b, n, mode);
+}
+
+void generic_rsqrt(const float* a, float* b, size_t n, simd_div_mode mode){
+    recip_unary<vec_generic<float>, recip_fn::rsqrt>(a, b, n, mode);
+}
+
+void generic_softmax(const float* x, float* y, size_t rows, size_t cols){
+    layer_softmax<vec_generic<float>>(x, y, rows, cols);
+}
+
+void generic_log_softmax(const float* x, float* y, size_t rows, size_t cols){
+    layer_log_softmax<vec_generic<float>>(x, y, rows, cols);
+}
+
+void generic_layer_norm(const float* x, const float* gamma, const float* beta, float* y,
+                        size_t rows, size_t cols, float eps){
+    layer_layer_norm<vec_generic<float>>(x, gamma, beta, y, rows, cols, eps);
+}
+
+void generic_rms_norm(const float* x, const float* gamma, float* y, size_t rows, size_t cols, float eps){
+    layer_rms_norm<vec_generic<float>>(x, gamma, y, rows, cols, eps);
+}
+
+void generic_bias_activation(const float* x, const float* bias, float* y, size_t rows, size_t cols,
+                             simd_activation act){
+    layer_bias_activation<vec_generic<float>>(x, bias, y, rows, cols, act);
+}
+
+void generic_conv(const float* x, size_t l1, const float* h, size_t l2, float* y,
+                  size_t first, size_t count){
+    conv_direct<vec_generic<float>>(x, l1, h, l2, y, first, count);
+}
+
+void generic_conv(const double* x, size_t l1, const double* h, size_t l2, double* y,
+                  size_t first, size_t count){
+    conv_direct<vec_generic<double>>(x, l1, h, l2, y, first, count);
+}
+
+void generic_conv2d_rows(const float* const* rows, const float* h, size_t kw, size_t kh, float* y, size_t count){
+    conv2d_run<vec_generic<float>>(rows, h, kw, kh, y, count);
+}
@@ -0,0 +1,114 @@
+/**
+ * @file half.cpp
+ * @author Sravan Senthilnathan
+ * @brief dispatched FP16/BF16 storage kernels and their scalar fallback
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2023
+ * 
+ */
+#include <algorithm>
+
+#include "simd_playground.h"
+#include "dispatch.h"
+#include "half_driver.h"
+
+namespace {
+
+/**
+ * @brief one lane, converting with the reference conversions
+ */
+struct scalar_half_vec {
+    static constexpr size_t W = 1;
+    using reg = float;
+
+    static reg load(const float* p) { return *p; }
+    static void store(float* p, reg a) { *p = a; }
+    static reg zero() { return 0.0f; }
+    static reg add(reg a, reg b) { return a + b; }
+    static reg mul(reg a, reg b) { return a * b; }
+    static reg mul_add(reg a, reg b, reg c) { return a * b + c; }
+    static reg load_fp16(const uint16_t* p) { return half_to_float(*p, simd_half_format::fp16); }
+    static void store_fp16(uint16_t* p, reg a) { *p = float_to_half(a, simd_half_format::fp16); }
+    static reg load_bf16(const uint16_t* p) { return half_to_float(*p, simd_half_format::bf16); }
+    static void store_bf16(uint16_t* p, reg a) { *p = float_to_half(a, simd_half_format::bf16); }
+};
+
+// outputs per block of simd_conv_half(), the converted samples stay in L2:
+constexpr size_t half_conv_block = 4096;
+
+}
+
+void scalar_to_half(const float* a, uint16_t* h, size_t n, simd_half_format format){
+    half_to<scalar_half_vec>(a, h, n, format);
+}
+
+void scalar_from_half(const uint16_t* h, float* a, size_t n, simd_half_format format){
+    half_from<scalar_half_vec>(h, a, n, format);
+}
+
+void scalar_add_half(const uint16_t* a, const uint16_t* b, uint16_t* c, size_t n, simd_half_format format){
+    half_binary<scalar_half_vec, false>(a, b, c, n, format);
+}
+
+void scalar_mul_half(const uint16_t* a, const uint16_t* b, uint16_t* c, size_t n, simd_half_format format){
+    half_binary<scalar_half_vec, true>(a, b, c, n, format);
+}
+
+float scalar_dot_half(const uint16_t* a, const uint16_t* b, size_t n, simd_half_format format){
+    return half_dot<scalar_half_vec>(a, b, n, format);
+}
+
+void simd_to_half(const float* a, uint16_t* h, size_t n, simd_half_format format){
+    active_kernels().to_half(a, h, n, format);
+}
+
+void simd_from_half(const uint16_t* h, float* a, size_t n, simd_half_format format){
+    active_kernels().from_half(h, a, n, format);
+}
+
+void simd_add_half(const uint16_t* a, const uint16_t* b, uint16_t* c, size_t n, simd_half_format format){
+    active_kernels().add_half(a, b, c, n, format);
+}
+
+void simd_mul_half(const uint16_t* a, const uint16_t* b, uint16_t* c, size_t n, simd_half_format format){
+    active_kernels().mul_half(a, b, c, n, format);
+}
+
+float simd_dot_half(const uint16_t* a, const uint16_t* b, size_t n, simd_half_format format){
+    return active_kernels().dot_half(a, b, n, format);
+}
+
+void simd_conv_half(const uint16_t* x, size_t l1, const uint16_t* h, size_t l2, float* y,
+                    simd_half_format format){
+    if(l1 == 0 || l2 == 0){
+        return;
+    }
+    if(l1 < l2){
+        std::swap(x, h);
+        std::swap(l1, l2);
+    }
+    const kernel_table& kt = active_kernels();
+
+    simd_arena& scratch = simd_scratch();
+    simd_arena_scope scope(scratch);
+
+    // the filter once, the signal a block of outputs at a time: the samples
+    // under it (and the m - 1 before), converted into scratch
+    const size_t m = l2, total = l1 + l2 - 1;
+    const size_t block = std::max(half_conv_block, m);
+    float* hf = scratch.alloc<float>(m);
+    float* xf = scratch.alloc<float>(block + m - 1);
+    kt.from_half(h, hf, m, format);
+
+    for(size_t first = 0; first < total; first += block){
+        const size_t count = std::min(block, total - first);
+        // at least m samples, so the kernel keeps x as the longer operand and
+        // every output falls in the same head/body/tail region as in one call:
+        const size_t begin = std::min(first - std::min(first, m - 1), l1 - m);
+        const size_t end = std::min(l1, first + count);
+        kt.from_half(x + begin, xf, end - begin, format);
+        kt.conv(xf, end - begin, hf, m, y + first, first - begin, count);
+    }
+}
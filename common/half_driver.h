@@ -0,0 +1,170 @@
+/**
+ * @file half_driver.h
+ * @author Sravan Senthilnathan
+ * @brief FP16/BF16 storage kernels shared by the per instruction set kernels
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2023
+ * 
+ * The *_half kernels keep their operands in 16 bits and widen them to
+ * float as they are loaded: arithmetic and accumulation are float, only
+ * memory traffic is halved, which is what bounds these kernels beyond L1.
+ * Results stored as half are rounded once, so c = a + b on half storage
+ * equals the float result rounded to the format. FP16 converts with F16C
+ * (vcvtph2ps/vcvtps2ph) on x86 and fcvtl/fcvtn on NEON; BF16 is the upper
+ * half of a float, so widening is a shift and narrowing rounds to nearest
+ * even with integer adds (no native instructions before AVX512_BF16).
+ * The scalar tails convert with half_to_float() and float_to_half(), which
+ * round the same way.
+ * 
+ * The driver is a template on a vector policy V: W (lanes), reg, load,
+ * store, zero, add, mul, mul_add (for reg and float), and load_fp16,
+ * store_fp16, load_bf16, store_bf16 moving W halves to and from a reg.
+ */
+#ifndef HALF_DRIVER_H
+#define HALF_DRIVER_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+
+#include "simd_playground.h"
+#include "reduce_driver.h"
+
+template<class V, simd_half_format F>
+typename V::reg half_load(const uint16_t* p){
+    return F == simd_half_format::fp16 ? V::load_fp16(p) : V::load_bf16(p);
+}
+
+template<class V, simd_half_format F>
+void half_store(uint16_t* p, typename V::reg a){
+    if(F == simd_half_format::fp16){
+        V::store_fp16(p, a);
+    }
+    else{
+        V::store_bf16(p, a);
+    }
+}
+
+template<class V, simd_half_format F>
+void half_to_run(const float* a, uint16_t* h, size_t n){
+    size_t i = 0;
+    for(; i + V::W <= n; i += V::W){
+        half_store<V, F>(h + i, V::load(a + i));
+    }
+    for(; i < n; ++i){
+        h[i] = float_to_half(a[i], F);
+    }
+}
+
+template<class V, simd_half_format F>
+void half_from_run(const uint16_t* h, float* a, size_t n){
+    size_t i = 0;
+    for(; i + V::W <= n; i += V::W){
+        V::store(a + i, half_load<V, F>(h + i));
+    }
+    for(; i < n; ++i){
+        a[i] = half_to_float(h[i], F);
+    }
+}
+
+/**
+ * @brief c[i] = a[i] op b[i] (Mul: times, else plus), in float, rounded once
+ */
+template<class V, simd_half_format F, bool Mul>
+void half_binary_run(const uint16_t* a, const uint16_t* b, uint16_t* c, size_t n){
+    using reg = typename V::reg;
+
+    size_t i = 0;
+    for(; i + 2 * V::W <= n; i += 2 * V::W){
+        const reg x0 = half_load<V, F>(a + i), y0 = half_load<V, F>(b + i);
+        const reg x1 = half_load<V, F>(a + i + V::W), y1 = half_load<V, F>(b + i + V::W);
+        half_store<V, F>(c + i, Mul ? V::mul(x0, y0) : V::add(x0, y0));
+        half_store<V, F>(c + i + V::W, Mul ? V::mul(x1, y1) : V::add(x1, y1));
+    }
+    for(; i + V::W <= n; i += V::W){
+        const reg x = half_load<V, F>(a + i), y = half_load<V, F>(b + i);
+        half_store<V, F>(c + i, Mul ? V::mul(x, y) : V::add(x, y));
+    }
+    for(; i < n; ++i){
+        const float x = half_to_float(a[i], F), y = half_to_float(b[i], F);
+        c[i] = float_to_half(Mul ? x * y : x + y, F);
+    }
+}
+
+/**
+ * @brief terms of a half dot product for reduce_fast()
+ */
+template<class V, simd_half_format F>
+struct half_dot_terms {
+    using reg = typename V::reg;
+    // no masked half loads, reduce_fast keeps its scalar tail:
+    static constexpr bool masked = false;
+    const uint16_t* a;
+    const uint16_t* b;
+
+    reg accumulate(reg s, size_t i) const { return V::mul_add(half_load<V, F>(a + i), half_load<V, F>(b + i), s); }
+    reg accumulate_partial(reg s, size_t i, size_t n) const {
+        uint16_t x[V::W] = {}, y[V::W] = {};
+        std::copy(a + i, a + i + n, x);
+        std::copy(b + i, b + i + n, y);
+        return V::mul_add(half_load<V, F>(x), half_load<V, F>(y), s);
+    }
+    float accumulate_at(float s, size_t i) const { return V::mul_add(half_to_float(a[i], F), half_to_float(b[i], F), s); }
+};
+
+template<class V>
+void half_to(const float* a, uint16_t* h, size_t n, simd_half_format format){
+    if(format == simd_half_format::fp16){
+        half_to_run<V, simd_half_format::fp16>(a, h, n);
+    }
+    else{
+        half_to_run<V, simd_half_format::bf16>(a, h, n);
+    }
+}
+
+template<class V>
+void half_from(const uint16_t* h, float* a, size_t n, simd_half_format format){
+    if(format == simd_half_format::fp16){
+        half_from_run<V, simd_half_format::fp16>(h, a, n);
+    }
+    else{
+        half_from_run<V, simd_half_format::bf16>(h, a, n);
+    }
+}
+
+template<class V, bool Mul>
+void half_binary(const uint16_t* a, const uint16_t* b, uint16_t* c, size_t n, simd_half_format format){
+    if(format == simd_half_format::fp16){
+        half_binary_run<V, simd_half_format::fp16, Mul>(a, b, c, n);
+    }
+    else{
+        half_binary_run<V, simd_half_format::bf16, Mul>(a, b, c, n);
+    }
+}
+
+template<class V>
+float half_dot(const uint16_t* a, const uint16_t* b, size_t n, simd_half_format format){
+    if(format == simd_half_format::fp16){
+        return reduce_fast<V>(half_dot_terms<V, simd_half_format::fp16>{a, b}, 0, n);
+    }
+    return reduce_fast<V>(half_dot_terms<V, simd_half_format::bf16>{a, b}, 0, n);
+}
+
+// scalar instantiations, the dispatcher's fallback:
+void scalar_to_half(const float* a, uint16_t* h, size_t n, simd_half_format format);
+void scalar_from_half(const uint16_t* h, float* a, size_t n, simd_half_format format);
+void scalar_add_half(const uint16_t* a, const uint16_t* b, uint16_t* c, size_t n, simd_half_format format);
+void scalar_mul_half(const uint16_t* a, const uint16_t* b, uint16_t* c, size_t n, simd_half_format format);
+float scalar_dot_half(const uint16_t* a, const uint16_t* b, size_t n, simd_half_format format);
+
+#if defined(__aarch64__)
+void neon_to_half(const float* a, uint16_t* h, size_t n, simd_half_format format);
+void neon_from_half(const uint16_t* h, float* a, size_t n, simd_half_format format);
+void neon_add_half(const uint16_t* a, const uint16_t* b, uint16_t* c, size_t n, simd_half_format format);
+void neon_mul_half(const uint16_t* a, const uint16_t* b, uint16_t* c, size_t n, simd_half_format format);
+float neon_dot_half(const uint16_t* a, const uint16_t* b, size_t n, simd_half_format format);
+#endif
+
+#endif
@@ -0,0 +1,209 @@
+/**
+ * @file int_driver.h
+ * @author Sravan Senthilnathan
+ * @brief integer, 8 bit dot product and quantized convolution kernels shared by the per instruction set kernels
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2023
+ * 
+ * Elementwise add/sub/mul come in a wrapping and a saturating flavour for
+ * int8, uint8, int16 and int32. The scalar tails compute in int64 and
+ * narrow like the references, so every lane of every level gives the
+ * same bits.
+ * 
+ * The 8 bit dot products accumulate in int32 lanes, which cannot overflow
+ * within int_dot_block elements (65536 * 255 * 128 < 2^31), and are
+ * folded into an int64 after every block.
+ * 
+ * The quantized convolution works on operands already widened to int16
+ * with their zero points subtracted (|value| <= 255) and a filter padded
+ * to an even number of taps: pairs of taps go through one pmaddwd style
+ * multiply-add, x[i - k] * h[k] + x[i - k - 1] * h[k + 1], into int32.
+ * 
+ * The drivers are templates on policies like the other drivers:
+ * 
+ *   elementwise, one per element type T: W (lanes), reg, load, store, and
+ *   add, adds, sub, subs, mul, muls (the s ones saturating)
+ *   dot: W (bytes), reg, zero, dot(acc, a, b) for uint8 and int8 a,
+ *   hsum(acc) to int64
+ *   quantized convolution: W (outputs), reg, zero, load (W int16),
+ *   taps(h0, h1), madd(lo, hi, x0, x1, taps) adding
+ *   x0[j] * h0 + x1[j] * h1 for the W outputs into lo and hi (in an order
+ *   of the policy's choosing), and requantize(y, lo, hi, multiplier,
+ *   zero_point) storing the W outputs in order.
+ */
+#ifndef INT_DRIVER_H
+#define INT_DRIVER_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+#include "simd_playground.h"
+
+enum class int_op { add, sub, mul };
+
+// elements per int32 accumulation of the 8 bit dot products:
+constexpr size_t int_dot_block = 65536;
+
+/**
+ * @brief one element of an elementwise integer kernel, as the references compute it
+ */
+template<class T, int_op Op, bool Sat>
+T int_scalar(T a, T b){
+    int64_t r = Op == int_op::add ? (int64_t)a + b : Op == int_op::sub ? (int64_t)a - b : (int64_t)a * b;
+    if(Sat){
+        r = std::min<int64_t>(std::max<int64_t>(r, std::numeric_limits<T>::min()), std::numeric_limits<T>::max());
+    }
+    return (T)(uint64_t)r;
+}
+
+template<class V, int_op Op, bool Sat>
+typename V::reg int_apply(typename V::reg a, typename V::reg b){
+    if(Op == int_op::add){
+        return Sat ? V::adds(a, b) : V::add(a, b);
+    }
+    if(Op == int_op::sub){
+        return Sat ? V::subs(a, b) : V::sub(a, b);
+    }
+    return Sat ? V::muls(a, b) : V::mul(a, b);
+}
+
+template<class V, int_op Op, bool Sat, class T>
+void int_binary_run(const T* a, const T* b, T* c, size_t n){
+    using reg = typename V::reg;
+
+    size_t i = 0;
+    for(; i + 2 * V::W <= n; i += 2 * V::W){
+        const reg r0 = int_apply<V, Op, Sat>(V::load(a + i), V::load(b + i));
+        const reg r1 = int_apply<V, Op, Sat>(V::load(a + i + V::W), V::load(b + i + V::W));
+        V::store(c + i, r0);
+        V::store(c + i + V::W, r1);
+    }
+    for(; i + V::W <= n; i += V::W){
+        V::store(c + i, int_apply<V, Op, Sat>(V::load(a + i), V::load(b + i)));
+    }
+    for(; i < n; ++i){
+        c[i] = int_scalar<T, Op, Sat>(a[i], b[i]);
+    }
+}
+
+/**
+ * @brief c[i] = a[i] op b[i], wrapping or saturating
+ */
+template<class V, int_op Op, class T>
+void int_binary(const T* a, const T* b, T* c, size_t n, simd_overflow overflow){
+    if(overflow == simd_overflow::saturate){
+        int_binary_run<V, Op, true>(a, b, c, n);
+    }
+    else{
+        int_binary_run<V, Op, false>(a, b, c, n);
+    }
+}
+
+/**
+ * @brief a[0] * b[0] + ... + a[n - 1] * b[n - 1], exact
+ */
+template<class V, class A>
+int64_t int_dot(const A* a, const int8_t* b, size_t n){
+    using reg = typename V::reg;
+
+    int64_t s = 0;
+    size_t i = 0;
+    while(i + V::W <= n){
+        const size_t end = i + std::min(int_dot_block, (n - i) / V::W * V::W);
+        reg acc0 = V::zero(), acc1 = V::zero();
+        for(; i + 2 * V::W <= end; i += 2 * V::W){
+            acc0 = V::dot(acc0, a + i, b + i);
+            acc1 = V::dot(acc1, a + i + V::W, b + i + V::W);
+        }
+        if(i < end){
+            acc0 = V::dot(acc0, a + i, b + i);
+            i += V::W;
+        }
+        s += V::hsum(acc0) + V::hsum(acc1);
+    }
+    for(; i < n; ++i){
+        s += (int64_t)a[i] * b[i];
+    }
+    return s;
+}
+
+/**
+ * @brief y[i] = requantize(sum over k < m of h[k] * x[i - k]) for i < count,
+ * m even, x readable from x[1 - m] on
+ */
+template<class V>
+void quant_conv_run(const int16_t* x, const int16_t* h, size_t m, uint8_t* y, size_t count,
+                    float multiplier, int32_t zero_point){
+    using reg = typename V::reg;
+
+    size_t i = 0;
+    for(; i + 2 * V::W <= count; i += 2 * V::W){
+        reg lo0 = V::zero(), hi0 = V::zero(), lo1 = V::zero(), hi1 = V::zero();
+        const int16_t* p = x + i;
+        for(size_t k = 0; k < m; k += 2){
+            const reg t = V::taps(h[k], h[k + 1]);
+            V::madd(lo0, hi0, V::load(p - k), V::load(p - k - 1), t);
+            V::madd(lo1, hi1, V::load(p + V::W - k), V::load(p + V::W - k - 1), t);
+        }
+        V::requantize(y + i, lo0, hi0, multiplier, zero_point);
+        V::requantize(y + i + V::W, lo1, hi1, multiplier, zero_point);
+    }
+    for(; i + V::W <= count; i += V::W){
+        reg lo = V::zero(), hi = V::zero();
+        for(size_t k = 0; k < m; k += 2){
+            V::madd(lo, hi, V::load(x + i - k), V::load(x + i - k - 1), V::taps(h[k], h[k + 1]));
+        }
+        V::requantize(y + i, lo, hi, multiplier, zero_point);
+    }
+    for(; i < count; ++i){
+        const int16_t* p = x + i;
+        int32_t acc = 0;
+        for(size_t k = 0; k < m; ++k){
+            acc += h[k] * *(p - k);
+        }
+        y[i] = requantize(acc, multiplier, zero_point);
+    }
+}
+
+// scalar instantiations, the dispatcher's fallback:
+void scalar_add(const int8_t* a, const int8_t* b, int8_t* c, size_t n, simd_overflow overflow);
+void scalar_add(const uint8_t* a, const uint8_t* b, uint8_t* c, size_t n, simd_overflow overflow);
+void scalar_add(const int16_t* a, const int16_t* b, int16_t* c, size_t n, simd_overflow overflow);
+void scalar_add(const int32_t* a, const int32_t* b, int32_t* c, size_t n, simd_overflow overflow);
+void scalar_sub(const int8_t* a, const int8_t* b, int8_t* c, size_t n, simd_overflow overflow);
+void scalar_sub(const uint8_t* a, const uint8_t* b, uint8_t* c, size_t n, simd_overflow overflow);
+void scalar_sub(const int16_t* a, const int16_t* b, int16_t* c, size_t n, simd_overflow overflow);
+void scalar_sub(const int32_t* a, const int32_t* b, int32_t* c, size_t n, simd_overflow overflow);
+void scalar_mul(const int8_t* a, const int8_t* b, int8_t* c, size_t n, simd_overflow overflow);
+void scalar_mul(const uint8_t* a, const uint8_t* b, uint8_t* c, size_t n, simd_overflow overflow);
+void scalar_mul(const int16_t* a, const int16_t* b, int16_t* c, size_t n, simd_overflow overflow);
+void scalar_mul(const int32_t* a, const int32_t* b, int32_t* c, size_t n, simd_overflow overflow);
+int64_t scalar_dot(const uint8_t* a, const int8_t* b, size_t n);
+int64_t scalar_dot(const int8_t* a, const int8_t* b, size_t n);
+void scalar_conv_quant(const int16_t* x, const int16_t* h, size_t m, uint8_t* y, size_t count,
+                       float multiplier, int32_t zero_point);
+
+#if defined(__aarch64__)
+void neon_add(const int8_t* a, const int8_t* b, int8_t* c, size_t n, simd_overflow overflow);
+void neon_add(const uint8_t* a, const uint8_t* b, uint8_t* c, size_t n, simd_overflow overflow);
+void neon_add(const int16_t* a, const int16_t* b, int16_t* c, size_t n, simd_overflow overflow);
+void neon_add(const int32_t* a, const int32_t* b, int32_t* c, size_t n, simd_overflow overflow);
+void neon_sub(const int8_t* a, const int8_t* b, int8_t* c, size_t n, simd_overflow overflow);
+void neon_sub(const uint8_t* a, const uint8_t* b, uint8_t* c, size_t n, simd_overflow overflow);
+void neon_sub(const int16_t* a, const int16_t* b, int16_t* c, size_t n, simd_overflow overflow);
+void neon_sub(const int32_t* a, const int32_t* b, int32_t* c, size_t n, simd_overflow overflow);
+void neon_mul(const int8_t* a, const int8_t* b, int8_t* c, size_t n, simd_overflow overflow);
+void neon_mul(const uint8_t* a, const uint8_t* b, uint8_t* c, size_t n, simd_overflow overflow);
+void neon_mul(const int16_t* a, const int16_t* b, int16_t* c, size_t n, simd_overflow overflow);
+void neon_mul(const int32_t* a, const int32_t* b, int32_t* c, size_t n, simd_overflow overflow);
+int64_t neon_dot(const uint8_t* a, const int8_t* b, size_t n);
+int64_t neon_dot(const int8_t* a, const int8_t* b, size_t n);
+void neon_conv_quant(const int16_t* x, const int16_t* h, size_t m, uint8_t* y, size_t count,
+                     float multiplier, int32_t zero_point);
+#endif
+
+#endif
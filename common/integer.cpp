@@ -0,0 +1,227 @@
+/**
+ * @file integer.cpp
+ * @author Sravan Senthilnathan
+ * @brief dispatched integer and quantized kernels and their scalar fallback
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2023
+ * 
+ */
+#include <algorithm>
+
+#include "simd_playground.h"
+#include "dispatch.h"
+#include "int_driver.h"
+
+namespace {
+
+/**
+ * @brief one lane of T, computed like the references
+ */
+template<class T>
+struct scalar_int_vec {
+    static constexpr size_t W = 1;
+    using reg = T;
+
+    static reg load(const T* p) { return *p; }
+    static void store(T* p, reg a) { *p = a; }
+    static reg add(reg a, reg b) { return int_scalar<T, int_op::add, false>(a, b); }
+    static reg adds(reg a, reg b) { return int_scalar<T, int_op::add, true>(a, b); }
+    static reg sub(reg a, reg b) { return int_scalar<T, int_op::sub, false>(a, b); }
+    static reg subs(reg a, reg b) { return int_scalar<T, int_op::sub, true>(a, b); }
+    static reg mul(reg a, reg b) { return int_scalar<T, int_op::mul, false>(a, b); }
+    static reg muls(reg a, reg b) { return int_scalar<T, int_op::mul, true>(a, b); }
+};
+
+/**
+ * @brief one byte per step into one int32
+ */
+struct scalar_dot_vec {
+    static constexpr size_t W = 1;
+    using reg = int32_t;
+
+    static reg zero() { return 0; }
+    template<class A>
+    static reg dot(reg acc, const A* a, const int8_t* b) { return acc + *a * *b; }
+    static int64_t hsum(reg a) { return a; }
+};
+
+/**
+ * @brief one output per step, the tap pair packed like a pmaddwd operand
+ */
+struct scalar_quant_vec {
+    static constexpr size_t W = 1;
+    using reg = int32_t;
+
+    static reg zero() { return 0; }
+    static reg load(const int16_t* p) { return *p; }
+    static reg taps(int16_t h0, int16_t h1) { return (int32_t)(((uint32_t)(uint16_t)h1 << 16) | (uint16_t)h0); }
+    static void madd(reg& lo, reg&, reg x0, reg x1, reg t) { lo += x0 * (int16_t)(t & 0xffff) + x1 * (int16_t)(t >> 16); }
+    static void requantize(uint8_t* y, reg lo, reg, float multiplier, int32_t zero_point) {
+        *y = ::requantize(lo, multiplier, zero_point);
+    }
+};
+
+// outputs per block of simd_conv_quant(), the widened samples stay in L1/L2:
+constexpr size_t quant_conv_block = 4096;
+
+}
+
+void scalar_add(const int8_t* a, const int8_t* b, int8_t* c, size_t n, simd_overflow overflow){
+    int_binary<scalar_int_vec<int8_t>, int_op::add>(a, b, c, n, overflow);
+}
+
+void scalar_add(const uint8_t* a, const uint8_t* b, uint8_t* c, size_t n, simd_overflow overflow){
+    int_binary<scalar_int_vec<uint8_t>, int_op::add>(a, b, c, n, overflow);
+}
+
+void scalar_add(const int16_t* a, const int16_t* b, int16_t* c, size_t n, simd_overflow overflow){
+    int_binary<scalar_int_vec<int16_t>, int_op::add>(a, b, c, n, overflow);
+}
+
+void scalar_add(const int32_t* a, const int32_t* b, int32_t* c, size_t n, simd_overflow overflow){
+    int_binary<scalar_int_vec<int32_t>, int_op::add>(a, b, c, n, overflow);
+}
+
+void scalar_sub(const int8_t* a, const int8_t* b, int8_t* c, size_t n, simd_overflow overflow){
+    int_binary<scalar_int_vec<int8_t>, int_op::sub>(a, b, c, n, overflow);
+}
+
+void scalar_sub(const uint8_t* a, const uint8_t* b, uint8_t* c, size_t n, simd_overflow overflow){
+    int_binary<scalar_int_vec<uint8_t>, int_op::sub>(a, b, c, n, overflow);
+}
+
+void scalar_sub(const int16_t* a, const int16_t* b, int16_t* c, size_t n, simd_overflow overflow){
+    int_binary<scalar_int_vec<int16_t>, int_op::sub>(a, b, c, n, overflow);
+}
+
+void scalar_sub(const int32_t* a, const int32_t* b, int32_t* c, size_t n, simd_overflow overflow){
+    int_binary<scalar_int_vec<int32_t>, int_op::sub>(a, b, c, n, overflow);
+}
+
+void scalar_mul(const int8_t* a, const int8_t* b, int8_t* c, size_t n, simd_overflow overflow){
+    int_binary<scalar_int_vec<int8_t>, int_op::mul>(a, b, c, n, overflow);
+}
+
+void scalar_mul(const uint8_t* a, const uint8_t* b, uint8_t* c, size_t n, simd_overflow overflow){
+    int_binary<scalar_int_vec<uint8_t>, int_op::mul>(a, b, c, n, overflow);
+}
+
+void scalar_mul(const int16_t* a, const int16_t* b, int16_t* c, size_t n, simd_overflow overflow){
+    int_binary<scalar_int_vec<int16_t>, int_op::mul>(a, b, c, n, overflow);
+}
+
+void scalar_mul(const int32_t* a, const int32_t* b, int32_t* c, size_t n, simd_overflow overflow){
+    int_binary<scalar_int_vec<int32_t>, int_op::mul>(a, b, c, n, overflow);
+}
+
+int64_t scalar_dot(const uint8_t* a, const int8_t* b, size_t n){
+    return int_dot<scalar_dot_vec>(a, b, n);
+}
+
+int64_t scalar_dot(const int8_t* a, const int8_t* b, size_t n){
+    return int_dot<scalar_dot_vec>(a, b, n);
+}
+
+void scalar_conv_quant(const int16_t* x, const int16_t* h, size_t m, uint8_t* y, size_t count,
+                       float multiplier, int32_t zero_point){
+    quant_conv_run<scalar_quant_vec>(x, h, m, y, count, multiplier, zero_point);
+}
+
+void simd_add(const int8_t* a, const int8_t* b, int8_t* c, size_t n, simd_overflow overflow){
+    active_kernels().add_i8(a, b, c, n, overflow);
+}
+
+void simd_add(const uint8_t* a, const uint8_t* b, uint8_t* c, size_t n, simd_overflow overflow){
+    active_kernels().add_u8(a, b, c, n, overflow);
+}
+
+void simd_add(const int16_t* a, const int16_t* b, int16_t* c, size_t n, simd_overflow overflow){
+    active_kernels().add_i16(a, b, c, n, overflow);
+}
+
+void simd_add(const int32_t* a, const int32_t* b, int32_t* c, size_t n, simd_overflow overflow){
+    active_kernels().add_i32(a, b, c, n, overflow);
+}
+
+void simd_sub(const int8_t* a, const int8_t* b, int8_t* c, size_t n, simd_overflow overflow){
+    active_kernels().sub_i8(a, b, c, n, overflow);
+}
+
+void simd_sub(const uint8_t* a, const uint8_t* b, uint8_t* c, size_t n, simd_overflow overflow){
+    active_kernels().sub_u8(a, b, c, n, overflow);
+}
+
+void simd_sub(const int16_t* a, const int16_t* b, int16_t* c, size_t n, simd_overflow overflow){
+    active_kernels().sub_i16(a, b, c, n, overflow);
+}
+
+void simd_sub(const int32_t* a, const int32_t* b, int32_t* c, size_t n, simd_overflow overflow){
+    active_kernels().sub_i32(a, b, c, n, overflow);
+}
+
+void simd_mul(const int8_t* a, const int8_t* b, int8_t* c, size_t n, simd_overflow overflow){
+    active_kernels().mul_i8(a, b, c, n, overflow);
+}
+
+void simd_mul(const uint8_t* a, const uint8_t* b, uint8_t* c, size_t n, simd_overflow overflow){
+    active_kernels().mul_u8(a, b, c, n, overflow);
+}
+
+void simd_mul(const int16_t* a, const int16_t* b, int16_t* c, size_t n, simd_overflow overflow){
+    active_kernels().mul_i16(a, b, c, n, overflow);
+}
+
+void simd_mul(const int32_t* a, const int32_t* b, int32_t* c, size_t n, simd_overflow overflow){
+    active_kernels().mul_i32(a, b, c, n, overflow);
+}
+
+int64_t simd_dot(const uint8_t* a, const int8_t* b, size_t n){
+    return active_kernels().dot_u8(a, b, n);
+}
+
+int64_t simd_dot(const int8_t* a, const int8_t* b, size_t n){
+    return active_kernels().dot_i8(a, b, n);
+}
+
+void simd_conv_quant(const uint8_t* x, size_t l1, simd_quant xq, const int8_t* h, size_t l2, simd_quant hq,
+                     uint8_t* y, simd_quant yq, simd_conv_mode mode){
+    const size_t total = simd_conv_size(l1, l2, mode);
+    if(total == 0){
+        return;
+    }
+    const kernel_table& kt = active_kernels();
+    const float multiplier = xq.scale * hq.scale / yq.scale;
+
+    simd_arena& scratch = simd_scratch();
+    simd_arena_scope scope(scratch);
+
+    // the filter once, padded to pairs of taps, the signal a block of outputs
+    // at a time: the m - 1 samples before the block and the block, widened
+    // with the zero point taken off (zero past either end) into scratch
+    const size_t m = l2 + (l2 & 1);
+    const size_t block = std::min(quant_conv_block, total);
+    int16_t* hw = scratch.alloc<int16_t>(m);
+    int16_t* xw = scratch.alloc<int16_t>(block + m - 1);
+    for(size_t k = 0; k < m; ++k){
+        hw[k] = (int16_t)(k < l2 ? h[k] - hq.zero_point : 0);
+    }
+
+    const size_t start = conv_first(l1, l2, mode);
+    for(size_t done = 0; done < total; done += block){
+        const size_t count = std::min(block, total - done);
+        // xw[j] is x[first + j - (m - 1)]:
+        const size_t first = start + done;
+        const size_t width = count + m - 1;
+        const size_t head = std::min(width, (m - 1) - std::min(first, m - 1));
+        const size_t body = std::min(width - head, l1 - std::min(l1, first + head - (m - 1)));
+        const uint8_t* src = x + first + head - (m - 1);
+        std::fill(xw, xw + head, (int16_t)0);
+        for(size_t j = 0; j < body; ++j){
+            xw[head + j] = (int16_t)(src[j] - xq.zero_point);
+        }
+        std::fill(xw + head + body, xw + width, (int16_t)0);
+        kt.conv_quant(xw + m - 1, hw, m, y + done, count, multiplier, yq.zero_point);
+    }
+}
@@ -0,0 +1,132 @@
+/**
+ * @file layer.cpp
+ * @author Sravan Senthilnathan
+ * @brief dispatched fused softmax, normalization and activation kernels, and their scalar fallback
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2023
+ * 
+ * The scalar level computes every row in double precision and rounds each
+ * output once, which makes it the reference the vector levels are
+ * verified against.
+ */
+#include <cmath>
+
+#include "simd_playground.h"
+#include "dispatch.h"
+#include "layer_driver.h"
+
+void scalar_softmax(const float* x, float* y, size_t rows, size_t cols){
+    for(size_t r = 0; r < rows; ++r){
+        const float* xr = x + r * cols;
+        float* yr = y + r * cols;
+        double m = -INFINITY;
+        for(size_t i = 0; i < cols; ++i){
+            m = xr[i] > m ? xr[i] : m;
+        }
+        double s = 0.0;
+        for(size_t i = 0; i < cols; ++i){
+            s += std::exp(xr[i] - m);
+        }
+        for(size_t i = 0; i < cols; ++i){
+            yr[i] = (float)(std::exp(xr[i] - m) / s);
+        }
+    }
+}
+
+void scalar_log_softmax(const float* x, float* y, size_t rows, size_t cols){
+    for(size_t r = 0; r < rows; ++r){
+        const float* xr = x + r * cols;
+        float* yr = y + r * cols;
+        double m = -INFINITY;
+        for(size_t i = 0; i < cols; ++i){
+            m = xr[i] > m ? xr[i] : m;
+        }
+        double s = 0.0;
+        for(size_t i = 0; i < cols; ++i){
+            s += std::exp(xr[i] - m);
+        }
+        const double l = std::log(s);
+        for(size_t i = 0; i < cols; ++i){
+            yr[i] = (float)((xr[i] - m) - l);
+        }
+    }
+}
+
+void scalar_layer_norm(const float* x, const float* gamma, const float* beta, float* y,
+                       size_t rows, size_t cols, float eps){
+    for(size_t r = 0; r < rows; ++r){
+        const float* xr = x + r * cols;
+        float* yr = y + r * cols;
+        double mean = 0.0;
+        for(size_t i = 0; i < cols; ++i){
+            mean += xr[i];
+        }
+        mean /= (double)cols;
+        double var = 0.0;
+        for(size_t i = 0; i < cols; ++i){
+            var += (xr[i] - mean) * (xr[i] - mean);
+        }
+        const double rstd = 1.0 / std::sqrt(var / (double)cols + (double)eps);
+        for(size_t i = 0; i < cols; ++i){
+            yr[i] = (float)((xr[i] - mean) * rstd * gamma[i] + beta[i]);
+        }
+    }
+}
+
+void scalar_rms_norm(const float* x, const float* gamma, float* y, size_t rows, size_t cols, float eps){
+    for(size_t r = 0; r < rows; ++r){
+        const float* xr = x + r * cols;
+        float* yr = y + r * cols;
+        double q = 0.0;
+        for(size_t i = 0; i < cols; ++i){
+            q += (double)xr[i] * xr[i];
+        }
+        const double rms = 1.0 / std::sqrt(q / (double)cols + (double)eps);
+        for(size_t i = 0; i < cols; ++i){
+            yr[i] = (float)(xr[i] * rms * gamma[i]);
+        }
+    }
+}
+
+void scalar_bias_activation(const float* x, const float* bias, float* y, size_t rows, size_t cols,
+                            simd_activation act){
+    for(size_t r = 0; r < rows; ++r){
+        const float* xr = x + r * cols;
+        float* yr = y + r * cols;
+        for(size_t i = 0; i < cols; ++i){
+            const double a = (double)(xr[i] + bias[i]);
+            switch(act){
+                case simd_activation::relu: yr[i] = (float)(a < 0.0 ? 0.0 : a); break;
+                case simd_activation::gelu: yr[i] = (float)(0.5 * a * (1.0 + std::erf(a * 0.7071067811865476))); break;
+                default: {
+                    const double u = 0.7978845608028654 * (a + 0.044715 * a * a * a);
+                    yr[i] = (float)(0.5 * a * (1.0 + std::tanh(u)));
+                }
+            }
+        }
+    }
+}
+
+void simd_softmax(const float* x, float* y, size_t rows, size_t cols){
+    active_kernels().softmax(x, y, rows, cols);
+}
+
+void simd_log_softmax(const float* x, float* y, size_t rows, size_t cols){
+    active_kernels().log_softmax(x, y, rows, cols);
+}
+
+void simd_layer_norm(const float* x, const float* gamma, const float* beta, float* y,
+                     size_t rows, size_t cols, float eps){
+    active_kernels().layer_norm(x, gamma, beta, y, rows, cols, eps);
+}
+
+void simd_rms_norm(const float* x, const float* gamma, float* y, size_t rows, size_t cols, float eps){
+    active_kernels().rms_norm(x, gamma, y, rows, cols, eps);
+}
+
+void simd_bias_activation(const float* x, const float* bias, float* y, size_t rows, size_t cols,
+                          simd_activation act){
+    active_kernels().bias_activation(x, bias, y, rows, cols, act);
+}
@@ -0,0 +1,357 @@
+/**
+ * @file layer_driver.h
+ * @author Sravan Senthilnathan
+ * @brief fused row kernels of neural network layers, shared by the per instruction set kernels
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2023
+ * 
+ * Every kernel works on a row-major batch, rows x cols floats, one row at a
+ * time, in as few passes over the row as the function allows:
+ * 
+ *   softmax:         max; y = e^(x - max) stored while summed; y *= 1 / sum
+ *   log_softmax:     max; sum of e^(x - max); y = (x - max) - log sum
+ *   layer_norm:      sum and sum of squares of x - x[0]; y = (x - mean) *
+ *                    (gamma / sqrt(var + eps)) + beta
+ *   rms_norm:        sum of squares; y = x * (gamma / sqrt(mean + eps))
+ *   bias_activation: y = act(x + bias), a single pass
+ * 
+ * so a row of up to a few thousand floats is read from memory once and
+ * from L1 after that. The sums accumulate in float vectors, two (layer
+ * norm) or four (the others) per row; shifting by the first element keeps
+ * the variance from cancelling when the mean is large next to the
+ * deviations. The exponentials, logarithm, erf and tanh are the precise
+ * ones of math_driver.h.
+ * 
+ * The driver is a template on a float backend V of simd_vec.h with the
+ * math_driver.h members. The row tails are one partial vector, except for
+ * the sums of the norms, which finish with scalars. y may alias x: every
+ * pass that writes y reads x at the same index first.
+ */
+#ifndef LAYER_DRIVER_H
+#define LAYER_DRIVER_H
+
+#include <cmath>
+#include <cstddef>
+
+#include "simd_playground.h"
+#include "simd_vec.h"
+#include "math_driver.h"
+#include "reduce_driver.h"
+
+/**
+ * @brief sum of the first n lanes of a
+ */
+template<class V>
+float layer_lanes_sum(typename V::reg a, size_t n){
+    alignas(64) float lanes[V::W];
+    V::store(lanes, a);
+    float s = 0.0f;
+    for(size_t l = 0; l < n; ++l){
+        s += lanes[l];
+    }
+    return s;
+}
+
+/**
+ * @brief sum of e^(x[i] - m), stored to y[i] if Store
+ */
+template<class V, bool Store>
+float layer_exp_sum(const float* x, float* y, size_t n, float m){
+    using reg = typename V::reg;
+    const reg vm = V::set1(m);
+
+    reg s0 = V::zero(), s1 = V::zero(), s2 = V::zero(), s3 = V::zero();
+    size_t i = 0;
+    for(; i + 4 * V::W <= n; i += 4 * V::W){
+        const reg e0 = math_exp<V, false>(V::sub(V::load(x + i), vm));
+        const reg e1 = math_exp<V, false>(V::sub(V::load(x + i + V::W), vm));
+        const reg e2 = math_exp<V, false>(V::sub(V::load(x + i + 2 * V::W), vm));
+        const reg e3 = math_exp<V, false>(V::sub(V::load(x + i + 3 * V::W), vm));
+        if(Store){
+            V::store(y + i, e0);
+            V::store(y + i + V::W, e1);
+            V::store(y + i + 2 * V::W, e2);
+            V::store(y + i + 3 * V::W, e3);
+        }
+        s0 = V::add(s0, e0);
+        s1 = V::add(s1, e1);
+        s2 = V::add(s2, e2);
+        s3 = V::add(s3, e3);
+    }
+    for(; i + V::W <= n; i += V::W){
+        const reg e = math_exp<V, false>(V::sub(V::load(x + i), vm));
+        if(Store){
+            V::store(y + i, e);
+        }
+        s0 = V::add(s0, e);
+    }
+    float s = vec_reduce_add<V, float>(V::add(V::add(s0, s1), V::add(s2, s3)));
+    if(i < n){
+        const reg e = math_exp<V, false>(V::sub(V::load_partial(x + i, n - i), vm));
+        if(Store){
+            V::store_partial(y + i, e, n - i);
+        }
+        s += layer_lanes_sum<V>(e, n - i);
+    }
+    return s;
+}
+
+/**
+ * @brief y[i] = x[i] * s
+ */
+template<class V>
+void layer_scale(const float* x, float* y, size_t n, float s){
+    const typename V::reg vs = V::set1(s);
+    size_t i = 0;
+    for(; i + V::W <= n; i += V::W){
+        V::store(y + i, V::mul(V::load(x + i), vs));
+    }
+    if(i < n){
+        V::store_partial(y + i, V::mul(V::load_partial(x + i, n - i), vs), n - i);
+    }
+}
+
+/**
+ * @brief softmax of every row, y may alias x
+ */
+template<class V>
+void layer_softmax(const float* x, float* y, size_t rows, size_t cols){
+    for(size_t r = 0; r < rows; ++r){
+        const float* xr = x + r * cols;
+        float* yr = y + r * cols;
+        const float m = reduce_extreme<V, true>(xr, 0, cols);
+        const float s = layer_exp_sum<V, true>(xr, yr, cols, m);
+        layer_scale<V>(yr, yr, cols, 1.0f / s);
+    }
+}
+
+/**
+ * @brief log-softmax of every row, y may alias x
+ */
+template<class V>
+void layer_log_softmax(const float* x, float* y, size_t rows, size_t cols){
+    using reg = typename V::reg;
+    for(size_t r = 0; r < rows; ++r){
+        const float* xr = x + r * cols;
+        float* yr = y + r * cols;
+        const float m = reduce_extreme<V, true>(xr, 0, cols);
+        const float s = layer_exp_sum<V, false>(xr, nullptr, cols, m);
+        const reg vm = V::set1(m);
+        const reg vl = V::set1(std::log(s));
+        size_t i = 0;
+        for(; i + V::W <= cols; i += V::W){
+            V::store(yr + i, V::sub(V::sub(V::load(xr + i), vm), vl));
+        }
+        if(i < cols){
+            V::store_partial(yr + i, V::sub(V::sub(V::load_partial(xr + i, cols - i), vm), vl), cols - i);
+        }
+    }
+}
+
+/**
+ * @brief y[i] = (x[i] - mean) * (gamma[i] * rstd) + beta[i]
+ */
+template<class V>
+void layer_normalize(const float* x, const float* gamma, const float* beta, float* y, size_t n,
+                     float mean, float rstd){
+    using reg = typename V::reg;
+    const reg vm = V::set1(mean);
+    const reg vr = V::set1(rstd);
+    size_t i = 0;
+    for(; i + V::W <= n; i += V::W){
+        const reg g = V::mul(V::load(gamma + i), vr);
+        V::store(y + i, V::mul_add(V::sub(V::load(x + i), vm), g, V::load(beta + i)));
+    }
+    if(i < n){
+        const size_t k = n - i;
+        const reg g = V::mul(V::load_partial(gamma + i, k), vr);
+        V::store_partial(y + i, V::mul_add(V::sub(V::load_partial(x + i, k), vm), g, V::load_partial(beta + i, k)), k);
+    }
+}
+
+/**
+ * @brief layer normalization of every row over its cols elements, y may
+ * alias x
+ */
+template<class V>
+void layer_layer_norm(const float* x, const float* gamma, const float* beta, float* y,
+                      size_t rows, size_t cols, float eps){
+    using reg = typename V::reg;
+    for(size_t r = 0; r < rows; ++r){
+        const float* xr = x + r * cols;
+        float* yr = y + r * cols;
+        if(cols == 0){
+            continue;
+        }
+
+        // sums of d = x - x0:
+        const float x0 = xr[0];
+        const reg v0 = V::set1(x0);
+        reg s0 = V::zero(), s1 = V::zero(), q0 = V::zero(), q1 = V::zero();
+        size_t i = 0;
+        for(; i + 2 * V::W <= cols; i += 2 * V::W){
+            const reg d0 = V::sub(V::load(xr + i), v0);
+            const reg d1 = V::sub(V::load(xr + i + V::W), v0);
+            s0 = V::add(s0, d0);
+            s1 = V::add(s1, d1);
+            q0 = V::mul_add(d0, d0, q0);
+            q1 = V::mul_add(d1, d1, q1);
+        }
+        for(; i + V::W <= cols; i += V::W){
+            const reg d = V::sub(V::load(xr + i), v0);
+            s0 = V::add(s0, d);
+            q0 = V::mul_add(d, d, q0);
+        }
+        float s = vec_reduce_add<V, float>(V::add(s0, s1));
+        float q = vec_reduce_add<V, float>(V::add(q0, q1));
+        for(; i < cols; ++i){
+            const float d = xr[i] - x0;
+            s += d;
+            q = V::mul_add(d, d, q);
+        }
+
+        const double mean = (double)s / (double)cols;
+        const double var = std::fmax(0.0, ((double)q - (double)s * mean) / (double)cols);
+        const float rstd = (float)(1.0 / std::sqrt(var + (double)eps));
+        layer_normalize<V>(xr, gamma, beta, yr, cols, (float)((double)x0 + mean), rstd);
+    }
+}
+
+/**
+ * @brief RMS normalization of every row over its cols elements, y may
+ * alias x
+ */
+template<class V>
+void layer_rms_norm(const float* x, const float* gamma, float* y, size_t rows, size_t cols, float eps){
+    using reg = typename V::reg;
+    for(size_t r = 0; r < rows; ++r){
+        const float* xr = x + r * cols;
+        float* yr = y + r * cols;
+
+        reg q0 = V::zero(), q1 = V::zero(), q2 = V::zero(), q3 = V::zero();
+        size_t i = 0;
+        for(; i + 4 * V::W <= cols; i += 4 * V::W){
+            const reg a0 = V::load(xr + i);
+            const reg a1 = V::load(xr + i + V::W);
+            const reg a2 = V::load(xr + i + 2 * V::W);
+            const reg a3 = V::load(xr + i + 3 * V::W);
+            q0 = V::mul_add(a0, a0, q0);
+            q1 = V::mul_add(a1, a1, q1);
+            q2 = V::mul_add(a2, a2, q2);
+            q3 = V::mul_add(a3, a3, q3);
+        }
+        for(; i + V::W <= cols; i += V::W){
+            const reg a = V::load(xr + i);
+            q0 = V::mul_add(a, a, q0);
+        }
+        float q = vec_reduce_add<V, float>(V::add(V::add(q0, q1), V::add(q2, q3)));
+        for(; i < cols; ++i){
+            q = V::mul_add(xr[i], xr[i], q);
+        }
+
+        const float rms = (float)(1.0 / std::sqrt((double)q / (double)cols + (double)eps));
+        const reg vr = V::set1(rms);
+        for(i = 0; i + V::W <= cols; i += V::W){
+            V::store(yr + i, V::mul(V::load(xr + i), V::mul(V::load(gamma + i), vr)));
+        }
+        if(i < cols){
+            const size_t k = cols - i;
+            V::store_partial(yr + i, V::mul(V::load_partial(xr + i, k), V::mul(V::load_partial(gamma + i, k), vr)), k);
+        }
+    }
+}
+
+/**
+ * @brief act(a)
+ */
+template<class V, simd_activation Act>
+typename V::reg layer_activate(typename V::reg a){
+    using reg = typename V::reg;
+    const reg half = V::set1(0.5f);
+    const reg one = V::set1(1.0f);
+    switch(Act){
+        case simd_activation::relu:
+            // NaNs stay NaN:
+            return V::select(V::lt(a, V::zero()), V::zero(), a);
+        case simd_activation::gelu: {
+            const reg e = math_erf<V, false>(V::mul(a, V::set1(0.707106781f)));
+            return V::mul(V::mul(half, a), V::add(one, e));
+        }
+        default: {
+            // sqrt(2 / pi) (a + 0.044715 a^3):
+            const reg a2 = V::mul(a, a);
+            const reg u = V::mul(V::mul(a, V::set1(0.797884561f)), V::mul_add(a2, V::set1(0.044715f), one));
+            return V::mul(V::mul(half, a), V::add(one, math_tanh<V, false>(u)));
+        }
+    }
+}
+
+template<class V, simd_activation Act>
+void layer_bias_run(const float* x, const float* bias, float* y, size_t rows, size_t cols){
+    using reg = typename V::reg;
+    for(size_t r = 0; r < rows; ++r){
+        const float* xr = x + r * cols;
+        float* yr = y + r * cols;
+        size_t i = 0;
+        for(; i + 2 * V::W <= cols; i += 2 * V::W){
+            const reg a0 = layer_activate<V, Act>(V::add(V::load(xr + i), V::load(bias + i)));
+            const reg a1 = layer_activate<V, Act>(V::add(V::load(xr + i + V::W), V::load(bias + i + V::W)));
+            V::store(yr + i, a0);
+            V::store(yr + i + V::W, a1);
+        }
+        for(; i + V::W <= cols; i += V::W){
+            V::store(yr + i, layer_activate<V, Act>(V::add(V::load(xr + i), V::load(bias + i))));
+        }
+        if(i < cols){
+            const size_t k = cols - i;
+            const reg a = V::add(V::load_partial(xr + i, k), V::load_partial(bias + i, k));
+            V::store_partial(yr + i, layer_activate<V, Act>(a), k);
+        }
+    }
+}
+
+/**
+ * @brief y = act(x + bias) with the bias broadcast down the rows, y may
+ * alias x
+ */
+template<class V>
+void layer_bias_activation(const float* x, const float* bias, float* y, size_t rows, size_t cols,
+                           simd_activation act){
+    switch(act){
+        case simd_activation::relu: layer_bias_run<V, simd_activation::relu>(x, bias, y, rows, cols); break;
+        case simd_activation::gelu: layer_bias_run<V, simd_activation::gelu>(x, bias, y, rows, cols); break;
+        default:                    layer_bias_run<V, simd_activation::gelu_tanh>(x, bias, y, rows, cols);
+    }
+}
+
+// scalar fallback, in double precision rounded once per element:
+void scalar_softmax(const float* x, float* y, size_t rows, size_t cols);
+void scalar_log_softmax(const float* x, float* y, size_t rows, size_t cols);
+void scalar_layer_norm(const float* x, const float* gamma, const float* beta, float* y,
+                       size_t rows, size_t cols, float eps);
+void scalar_rms_norm(const float* x, const float* gamma, float* y, size_t rows, size_t cols, float eps);
+void scalar_bias_activation(const float* x, const float* bias, float* y, size_t rows, size_t cols,
+                            simd_activation act);
+
+// the generic level, see simd_vec.h:
+void generic_softmax(const float* x, float* y, size_t rows, size_t cols);
+void generic_log_softmax(const float* x, float* y, size_t rows, size_t cols);
+void generic_layer_norm(const float* x, const float* gamma, const float* beta, float* y,
+                        size_t rows, size_t cols, float eps);
+void generic_rms_norm(const float* x, const float* gamma, float* y, size_t rows, size_t cols, float eps);
+void generic_bias_activation(const float* x, const float* bias, float* y, size_t rows, size_t cols,
+                             simd_activation act);
+
+#if defined(__aarch64__)
+void neon_softmax(const float* x, float* y, size_t rows, size_t cols);
+void neon_log_softmax(const float* x, float* y, size_t rows, size_t cols);
+void neon_layer_norm(const float* x, const float* gamma, const float* beta, float* y,
+                     size_t rows, size_t cols, float eps);
+void neon_rms_norm(const float* x, const float* gamma, float* y, size_t rows, size_t cols, float eps);
+void neon_bias_activation(const float* x, const float* bias, float* y, size_t rows, size_t cols,
+                          simd_activation act);
+#endif
+
+#endif
@@ -0,0 +1,95 @@
+/**
+ * @file math.cpp
+ * @author Sravan Senthilnathan
+ * @brief dispatched elementwise math functions and their scalar fallback
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2023
+ * 
+ * The scalar level has no polynomials of its own: every element goes
+ * through the C library in double precision and is rounded once, which is
+ * also the reference the vector levels are verified against.
+ */
+#include <cmath>
+
+#include "simd_playground.h"
+#include "dispatch.h"
+#include "math_driver.h"
+
+namespace {
+
+template<class F>
+void scalar_math(const float* a, float* b, size_t n, F f){
+    for(size_t i = 0; i < n; ++i){
+        b[i] = (float)f((double)a[i]);
+    }
+}
+
+}
+
+void scalar_exp(const float* a, float* b, size_t n, simd_math_mode){
+    scalar_math(a, b, n, [](double x) { return std::exp(x); });
+}
+
+void scalar_log(const float* a, float* b, size_t n, simd_math_mode){
+    scalar_math(a, b, n, [](double x) { return std::log(x); });
+}
+
+void scalar_sin(const float* a, float* b, size_t n, simd_math_mode){
+    scalar_math(a, b, n, [](double x) { return std::sin(x); });
+}
+
+void scalar_cos(const float* a, float* b, size_t n, simd_math_mode){
+    scalar_math(a, b, n, [](double x) { return std::cos(x); });
+}
+
+void scalar_tanh(const float* a, float* b, size_t n, simd_math_mode){
+    scalar_math(a, b, n, [](double x) { return std::tanh(x); });
+}
+
+void scalar_sigmoid(const float* a, float* b, size_t n, simd_math_mode){
+    scalar_math(a, b, n, [](double x) { return 1.0 / (1.0 + std::exp(-x)); });
+}
+
+void scalar_erf(const float* a, float* b, size_t n, simd_math_mode){
+    scalar_math(a, b, n, [](double x) { return std::erf(x); });
+}
+
+void scalar_pow(const float* a, const float* b, float* c, size_t n, simd_math_mode){
+    for(size_t i = 0; i < n; ++i){
+        c[i] = (float)std::pow((double)a[i], (double)b[i]);
+    }
+}
+
+void simd_exp(const float* a, float* b, size_t n, simd_math_mode mode){
+    active_kernels().exp(a, b, n, mode);
+}
+
+void simd_log(const float* a, float* b, size_t n, simd_math_mode mode){
+    active_kernels().log(a, b, n, mode);
+}
+
+void simd_sin(const float* a, float* b, size_t n, simd_math_mode mode){
+    active_kernels().sin(a, b, n, mode);
+}
+
+void simd_cos(const float* a, float* b, size_t n, simd_math_mode mode){
+    active_kernels().cos(a, b, n, mode);
+}
+
+void simd_tanh(const float* a, float* b, size_t n, simd_math_mode mode){
+    active_kernels().tanh(a, b, n, mode);
+}
+
+void simd_sigmoid(const float* a, float* b, size_t n, simd_math_mode mode){
+    active_kernels().sigmoid(a, b, n, mode);
+}
+
+void simd_erf(const float* a, float* b, size_t n, simd_math_mode mode){
+    active_kernels().erf(a, b, n, mode);
+}
+
+void simd_pow(const float* a, const float* b, float* c, size_t n, simd_math_mode mode){
+    active_kernels().pow(a, b, c, n, mode);
+}
@@ -0,0 +1,495 @@
+/**
+ * @file math_driver.h
+ * @author Sravan Senthilnathan
+ * @brief elementwise exp, log, sin, cos, tanh, sigmoid, erf and pow shared by the per instruction set kernels
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2023
+ * 
+ * Every function reduces its argument to a short interval, evaluates a
+ * polynomial there and undoes the reduction:
+ * 
+ *   exp:     x = k ln2 + r, |r| <= ln2 / 2 (ln2 in two parts, Cody-Waite),
+ *            e^r = 1 + r + r^2 Q(r), scaled by 2^k in two steps so the
+ *            results down to the subnormals round once
+ *   log:     x = 2^e m, m in [sqrt(1/2), sqrt(2)), log(1 + f) = f - f^2/2
+ *            + f^3 P(f); subnormals are scaled by 2^23 first
+ *   sin/cos: |x| = k pi/2 + r, |r| <= pi/4 (pi/2 in five parts), the sine
+ *            or cosine polynomial of r picked and negated by k mod 4; from
+ *            |x| > 8192 the reduction runs out of bits and the precise
+ *            mode hands those lanes to the C library
+ *   tanh:    x + x^3 T(x^2) below 0.625, 1 - 2 / (e^2x + 1) above
+ *   sigmoid: 1 / (1 + e^-x), as e^x / (1 + e^x) for negative x so it does
+ *            not cancel
+ *   erf:     x P(x^2) below 0.875, 1 - e^-x^2 G(x) above (x^2 split into
+ *            two floats), 1 from 4 on
+ *   pow:     e^(y log |x|) in double precision (the error of log |x| is
+ *            multiplied by y), then the C99 special cases and signs
+ * 
+ * The polynomials are weighted minimax fits on those intervals; measured
+ * on every 13th float the precise mode is within 1 ulp (exp, log, tanh),
+ * 2 ulp (sin, cos, erf) and 3 ulp (sigmoid) of the correctly rounded
+ * result, pow within 1 ulp on random inputs. The fast mode uses shorter
+ * polynomials (exp degree 4, log 6, sin 5 and cos 6 instead of 6, 10, 7
+ * and 8), reduces sin/cos with pi/2 in three parts, scales exp by 2^k in
+ * one step, skips the C library lanes of sin/cos, evaluates tanh as
+ * 1 - 2 / (e^2x + 1) throughout, erf with Abramowitz and Stegun 7.1.26
+ * and pow on the fast exp and log in float, see simd_math_mode for its
+ * error.
+ * 
+ * The driver is a template on a float backend V of simd_vec.h with the
+ * math members (pow also on the double backend D of the same instruction
+ * set). Every array is processed a vector at a time, the tail as one
+ * partial vector.
+ */
+#ifndef MATH_DRIVER_H
+#define MATH_DRIVER_H
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+
+#include "simd_playground.h"
+#include "reduce_driver.h"
+#include "simd_vec.h"
+
+enum class math_fn { exp, log, sin, cos, tanh, sigmoid, erf };
+
+// from here on the pi/2 reduction of sin/cos is no longer exact:
+constexpr float math_trig_limit = 8192.0f;
+
+// e^r = 1 + r + r^2 Q(r) on [-ln2/2, ln2/2]:
+constexpr float math_exp_q[] = {4.999999404e-01f, 1.666652113e-01f, 4.166838899e-02f,
+                                8.368710056e-03f, 1.381461276e-03f};
+constexpr float math_exp_q_fast[] = {5.000511408e-01f, 1.675351411e-01f, 4.127774760e-02f};
+// log(1 + f) = f - f^2/2 + f^3 P(f) on [sqrt(1/2) - 1, sqrt(2) - 1]:
+constexpr float math_log_p[] = {3.333333135e-01f, -2.500081956e-01f, 2.000122666e-01f,
+                                -1.662335694e-01f, 1.420175880e-01f, -1.316018254e-01f,
+                                1.276157498e-01f, -7.634492964e-02f};
+constexpr float math_log_p_fast[] = {3.328547180e-01f, -2.524499893e-01f, 2.177650928e-01f,
+                                     -1.459251046e-01f};
+// sin r = r + r^3 S(r^2), cos r = 1 - r^2/2 + r^4 C(r^2) on [-pi/4, pi/4]:
+constexpr float math_sin_s[] = {-1.666665524e-01f, 8.332160302e-03f, -1.951528247e-04f};
+constexpr float math_sin_s_fast[] = {-1.666339040e-01f, 8.163281716e-03f};
+constexpr float math_cos_c[] = {4.166664556e-02f, -1.388731645e-03f, 2.443315680e-05f};
+constexpr float math_cos_c_fast[] = {4.166107252e-02f, -1.364871394e-03f};
+// tanh x = x + x^3 T(x^2) on [0, 0.625]:
+constexpr float math_tanh_t[] = {-3.333328068e-01f, 1.333144158e-01f, -5.373971537e-02f,
+                                 2.063908614e-02f, -5.704986397e-03f};
+// erf x = x P(x^2) on [0, 0.875], erfc x = e^-x^2 G(x) on [0.875, 4]:
+constexpr float math_erf_p[] = {1.128379107e+00f, -3.761255741e-01f, 1.128252447e-01f,
+                                -2.679395489e-02f, 5.035872106e-03f, -6.222422817e-04f};
+constexpr float math_erfc_g[] = {9.971064925e-01f, -1.107297778e+00f, 9.306091666e-01f,
+                                 -6.150187254e-01f, 3.164984882e-01f, -1.229730025e-01f,
+                                 3.448380157e-02f, -6.528974045e-03f, 7.421664777e-04f,
+                                 -3.806821042e-05f};
+// Abramowitz and Stegun 7.1.26, |error| <= 1.5e-7:
+constexpr float math_erf_as[] = {2.54829592e-01f, -2.84496736e-01f, 1.421413741e+00f,
+                                 -1.453152027e+00f, 1.061405429e+00f};
+// the double precision exp and log of pow, Taylor and atanh series:
+constexpr double math_exp64_c[] = {1.0, 1.0, 1.0 / 2, 1.0 / 6, 1.0 / 24, 1.0 / 120, 1.0 / 720,
+                                   1.0 / 5040, 1.0 / 40320, 1.0 / 362880, 1.0 / 3628800,
+                                   1.0 / 39916800};
+constexpr double math_log64_c[] = {2.0, 2.0 / 3, 2.0 / 5, 2.0 / 7, 2.0 / 9, 2.0 / 11, 2.0 / 13,
+                                   2.0 / 15, 2.0 / 17};
+
+/**
+ * @brief c[0] + c[1] x + ... + c[N - 1] x^(N - 1) by Horner's rule
+ */
+template<class V, class T, size_t N>
+typename V::reg math_horner(typename V::reg x, const T (&c)[N]){
+    typename V::reg p = V::set1(c[N - 1]);
+    for(size_t j = N - 1; j-- > 0;){
+        p = V::mul_add(p, x, V::set1(c[j]));
+    }
+    return p;
+}
+
+/**
+ * @brief e^x
+ */
+template<class V, bool Fast>
+typename V::reg math_exp(typename V::reg x){
+    using reg = typename V::reg;
+    const reg one = V::set1(1.0f);
+    // e^x overflows above hi and rounds to 0 below lo (fast: is flushed below FLT_MIN):
+    const reg hi = V::set1(88.7228394f);
+    const reg lo = V::set1(Fast ? -87.3365448f : -103.972084f);
+
+    const reg xc = V::max(V::min(x, hi), lo);
+    const reg k = V::round(V::mul(xc, V::set1(1.44269504f)));
+    reg r = V::mul_add(k, V::set1(-0.693359375f), xc);
+    r = V::mul_add(k, V::set1(2.12194440e-4f), r);
+
+    const reg q = Fast ? math_horner<V>(r, math_exp_q_fast) : math_horner<V>(r, math_exp_q);
+    const reg p = V::add(V::mul_add(V::mul(r, r), q, r), one);
+
+    reg y;
+    if(Fast){
+        // 2^128 is not a float: fast mode overflows from 2^127.5 on
+        y = V::mul(p, V::pow2i(V::min(k, V::set1(127.0f))));
+    }
+    else{
+        // k in [-150, 128] split in two halves that are normal powers of two:
+        const reg k1 = V::floor(V::mul(k, V::set1(0.5f)));
+        y = V::mul(V::mul(p, V::pow2i(k1)), V::pow2i(V::sub(k, k1)));
+    }
+    y = V::select(V::lt(hi, x), V::set1(std::numeric_limits<float>::infinity()), y);
+    y = V::select(V::lt(x, lo), V::zero(), y);
+    return V::select(V::unord(x, x), x, y);
+}
+
+/**
+ * @brief natural logarithm
+ */
+template<class V, bool Fast>
+typename V::reg math_log(typename V::reg x){
+    using reg = typename V::reg;
+    const reg one = V::set1(1.0f);
+
+    // subnormals scaled to normal numbers by 2^23:
+    const typename V::mask tiny = V::lt(x, V::set1(std::numeric_limits<float>::min()));
+    const reg xs = V::select(tiny, V::mul(x, V::set1(8388608.0f)), x);
+    reg e = V::getexp(xs);
+    e = V::select(tiny, V::sub(e, V::set1(23.0f)), e);
+    reg m = V::getmant(xs);
+    const typename V::mask big = V::lt(V::set1(1.41421356f), m);
+    m = V::select(big, V::mul(m, V::set1(0.5f)), m);
+    e = V::select(big, V::add(e, one), e);
+
+    const reg f = V::sub(m, one);
+    const reg z = V::mul(f, f);
+    const reg p = Fast ? math_horner<V>(f, math_log_p_fast) : math_horner<V>(f, math_log_p);
+    reg y = V::mul(V::mul(z, f), p);
+    y = V::mul_add(e, V::set1(-2.12194440e-4f), y);
+    y = V::mul_add(z, V::set1(-0.5f), y);
+    y = V::add(f, y);
+    y = V::mul_add(e, V::set1(0.693359375f), y);
+
+    const reg inf = V::set1(std::numeric_limits<float>::infinity());
+    y = V::select(V::eq(x, inf), x, y);
+    y = V::select(V::lt(x, V::zero()), V::set1(std::numeric_limits<float>::quiet_NaN()), y);
+    y = V::select(V::eq(x, V::zero()), V::sub(V::zero(), inf), y);
+    return V::select(V::unord(x, x), x, y);
+}
+
+/**
+ * @brief sin x, or cos x
+ */
+template<class V, bool Fast, bool Cos>
+typename V::reg math_sin_cos(typename V::reg x){
+    using reg = typename V::reg;
+    const reg one = V::set1(1.0f);
+
+    const reg ax = V::abs(x);
+    const reg k = V::round(V::mul(ax, V::set1(0.636619772f)));
+    reg r;
+    if(Fast){
+        r = V::mul_add(k, V::set1(-1.5703125f), ax);
+        r = V::mul_add(k, V::set1(-4.837512969970703e-4f), r);
+        r = V::mul_add(k, V::set1(-7.549789954891882e-8f), r);
+    }
+    else{
+        // the parts of pi/2 but the last have at most 11 bits, so k (up to
+        // 13 bits) times them is exact with or without FMA:
+        r = V::mul_add(k, V::set1(-1.5703125f), ax);
+        r = V::mul_add(k, V::set1(-4.837512969970703e-4f), r);
+        r = V::mul_add(k, V::set1(-7.549533620476723e-8f), r);
+        r = V::mul_add(k, V::set1(-2.5632829192545614e-12f), r);
+        r = V::mul_add(k, V::set1(-6.123234262925839e-17f), r);
+    }
+
+    const reg z = V::mul(r, r);
+    const reg s = V::mul_add(V::mul(z, r), Fast ? math_horner<V>(z, math_sin_s_fast) : math_horner<V>(z, math_sin_s), r);
+    const reg c = V::mul_add(V::mul(z, z), Fast ? math_horner<V>(z, math_cos_c_fast) : math_horner<V>(z, math_cos_c),
+                             V::mul_add(z, V::set1(-0.5f), one));
+
+    // quadrant q = k mod 4 (one more for the cosine): sin r, cos r, -sin r, -cos r
+    const reg q = Cos ? V::add(k, one) : k;
+    const reg quadrant = V::sub(q, V::mul(V::floor(V::mul(q, V::set1(0.25f))), V::set1(4.0f)));
+    const reg half = V::mul(quadrant, V::set1(0.5f));
+    const typename V::mask odd = V::lt(V::floor(half), half);
+    reg y = V::select(odd, c, s);
+
+    reg sign = Cos ? one : V::copysign(one, x);
+    sign = V::select(V::lt(V::set1(1.5f), quadrant), V::sub(V::zero(), sign), sign);
+    return V::mul(y, sign);
+}
+
+/**
+ * @brief hyperbolic tangent
+ */
+template<class V, bool Fast>
+typename V::reg math_tanh(typename V::reg x){
+    using reg = typename V::reg;
+    const reg one = V::set1(1.0f);
+
+    const reg ax = V::abs(x);
+    const reg e = math_exp<V, Fast>(V::add(ax, ax));
+    reg y = V::sub(one, V::div(V::set1(2.0f), V::add(e, one)));
+    if(!Fast){
+        const reg z = V::mul(ax, ax);
+        const reg small = V::mul_add(V::mul(z, ax), math_horner<V>(z, math_tanh_t), ax);
+        y = V::select(V::lt(ax, V::set1(0.625f)), small, y);
+    }
+    return V::copysign(y, x);
+}
+
+/**
+ * @brief logistic function 1 / (1 + e^-x)
+ */
+template<class V, bool Fast>
+typename V::reg math_sigmoid(typename V::reg x){
+    using reg = typename V::reg;
+    const reg e = math_exp<V, Fast>(V::sub(V::zero(), V::abs(x)));
+    const reg s = V::div(V::set1(1.0f), V::add(V::set1(1.0f), e));
+    return V::select(V::lt(x, V::zero()), V::mul(e, s), s);
+}
+
+/**
+ * @brief error function
+ */
+template<class V, bool Fast>
+typename V::reg math_erf(typename V::reg x){
+    using reg = typename V::reg;
+    const reg one = V::set1(1.0f);
+    const reg ax = V::abs(x);
+
+    // erf 4 rounds to 1, and e^-x^2 stays clear of the (slow) subnormals:
+    const reg xc = V::min(ax, V::set1(4.0f));
+    reg y;
+    if(Fast){
+        const reg t = V::div(one, V::mul_add(xc, V::set1(0.3275911f), one));
+        const reg e = math_exp<V, true>(V::sub(V::zero(), V::mul(xc, xc)));
+        y = V::sub(one, V::mul(V::mul(t, math_horner<V>(t, math_erf_as)), e));
+    }
+    else{
+        const reg small = V::mul(ax, math_horner<V>(V::mul(ax, ax), math_erf_p));
+        // e^-x^2 from x^2 = hi + lo: e^-hi (1 - lo)
+        const reg hi = V::mul(xc, xc);
+        const reg lo = reduce_product_error<V>(xc, xc, hi);
+        const reg e = V::mul(math_exp<V, false>(V::sub(V::zero(), hi)), V::sub(one, lo));
+        const reg big = V::sub(one, V::mul(e, math_horner<V>(xc, math_erfc_g)));
+        y = V::select(V::lt(ax, V::set1(0.875f)), small, big);
+    }
+    y = V::copysign(y, x);
+    return V::select(V::unord(x, x), x, y);
+}
+
+template<class V, math_fn Fn, bool Fast>
+typename V::reg math_eval(typename V::reg x){
+    switch(Fn){
+        case math_fn::exp:     return math_exp<V, Fast>(x);
+        case math_fn::log:     return math_log<V, Fast>(x);
+        case math_fn::sin:     return math_sin_cos<V, Fast, false>(x);
+        case math_fn::cos:     return math_sin_cos<V, Fast, true>(x);
+        case math_fn::tanh:    return math_tanh<V, Fast>(x);
+        case math_fn::sigmoid: return math_sigmoid<V, Fast>(x);
+        default:               return math_erf<V, Fast>(x);
+    }
+}
+
+/**
+ * @brief y with the lanes whose |x| is beyond math_trig_limit (where the
+ * reduction is no longer exact) computed by the C library
+ */
+template<class V, math_fn Fn>
+typename V::reg math_trig_libm(typename V::reg x, typename V::reg y){
+    float xs[V::W], ys[V::W];
+    V::store(xs, x);
+    V::store(ys, y);
+    for(size_t l = 0; l < V::W; ++l){
+        if(std::fabs(xs[l]) > math_trig_limit){
+            ys[l] = Fn == math_fn::sin ? std::sin(xs[l]) : std::cos(xs[l]);
+        }
+    }
+    return V::load(ys);
+}
+
+template<class V, math_fn Fn, bool Fast>
+typename V::reg math_vector(typename V::reg x){
+    typename V::reg y = math_eval<V, Fn, Fast>(x);
+    if(!Fast && (Fn == math_fn::sin || Fn == math_fn::cos)
+       && V::any(V::lt(V::set1(math_trig_limit), V::abs(x)))){
+        y = math_trig_libm<V, Fn>(x, y);
+    }
+    return y;
+}
+
+template<class V, math_fn Fn, bool Fast>
+void math_run(const float* a, float* b, size_t n){
+    size_t i = 0;
+    for(; i + 2 * V::W <= n; i += 2 * V::W){
+        const typename V::reg y0 = math_vector<V, Fn, Fast>(V::load(a + i));
+        const typename V::reg y1 = math_vector<V, Fn, Fast>(V::load(a + i + V::W));
+        V::store(b + i, y0);
+        V::store(b + i + V::W, y1);
+    }
+    for(; i + V::W <= n; i += V::W){
+        V::store(b + i, math_vector<V, Fn, Fast>(V::load(a + i)));
+    }
+    if(i < n){
+        V::store_partial(b + i, math_vector<V, Fn, Fast>(V::load_partial(a + i, n - i)), n - i);
+    }
+}
+
+/**
+ * @brief b[i] = Fn(a[i]), b may alias a
+ */
+template<class V, math_fn Fn>
+void math_unary(const float* a, float* b, size_t n, simd_math_mode mode){
+    if(mode == simd_math_mode::fast){
+        math_run<V, Fn, true>(a, b, n);
+    }
+    else{
+        math_run<V, Fn, false>(a, b, n);
+    }
+}
+
+/**
+ * @brief log x for positive normal doubles: 2^e m, m in [sqrt(1/2), sqrt(2)),
+ * log m = 2 atanh((m - 1) / (m + 1))
+ */
+template<class D>
+typename D::reg math_log64(typename D::reg x){
+    using reg = typename D::reg;
+    const reg one = D::set1(1.0);
+    reg e = D::getexp(x);
+    reg m = D::getmant(x);
+    const typename D::mask big = D::lt(D::set1(1.4142135623730951), m);
+    m = D::select(big, D::mul(m, D::set1(0.5)), m);
+    e = D::select(big, D::add(e, one), e);
+
+    const reg s = D::div(D::sub(m, one), D::add(m, one));
+    const reg p = D::mul(s, math_horner<D>(D::mul(s, s), math_log64_c));
+    return D::mul_add(e, D::set1(0.69314718055994531), p);
+}
+
+/**
+ * @brief e^x for doubles in a range where the float result is not yet 0 or inf
+ */
+template<class D>
+typename D::reg math_exp64(typename D::reg x){
+    using reg = typename D::reg;
+    const reg xc = D::max(D::min(x, D::set1(200.0)), D::set1(-200.0));
+    const reg k = D::round(D::mul(xc, D::set1(1.4426950408889634)));
+    reg r = D::mul_add(k, D::set1(-6.93147180369123816490e-01), xc);
+    r = D::mul_add(k, D::set1(-1.90821492927058770002e-10), r);
+    return D::mul(math_horner<D>(r, math_exp64_c), D::pow2i(k));
+}
+
+/**
+ * @brief pow of the lanes that need no special case: finite nonzero x,
+ * finite y, the sign still to be applied
+ */
+template<class V, class D, bool Fast>
+typename V::reg math_pow_core(const float* a, const float* b){
+    if(Fast){
+        const typename V::reg y = V::load(b);
+        return math_exp<V, true>(V::mul(y, math_log<V, true>(V::abs(V::load(a)))));
+    }
+    float r[V::W];
+    for(size_t j = 0; j < V::W; j += D::W){
+        const typename D::reg x = D::abs(D::load_float(a + j));
+        D::store_float(r + j, math_exp64<D>(D::mul(D::load_float(b + j), math_log64<D>(x))));
+    }
+    return V::load(r);
+}
+
+/**
+ * @brief x^y from |x|^y for the finite nonzero x and finite y lanes: the
+ * other |x|^y, the sign, and the C99 cases that are 1 or NaN
+ */
+template<class V, bool Fast>
+typename V::reg math_pow_fix(typename V::reg x, typename V::reg y, typename V::reg r){
+    using reg = typename V::reg;
+    using mask = typename V::mask;
+    const reg one = V::set1(1.0f), zero = V::zero();
+    const reg inf = V::set1(std::numeric_limits<float>::infinity());
+    const reg ax = V::abs(x);
+
+    if(!Fast){
+        // zeros, infinities and NaNs through the float exp and log, which get them right:
+        const mask special = V::mask_or(V::mask_or(V::unord(x, y), V::eq(V::abs(y), inf)),
+                                        V::mask_or(V::eq(ax, inf), V::eq(ax, zero)));
+        if(V::any(special)){
+            r = V::select(special, math_exp<V, false>(V::mul(y, math_log<V, false>(ax))), r);
+        }
+    }
+
+    const reg yi = V::floor(y);
+    const reg half = V::mul(y, V::set1(0.5f));
+    const mask odd = V::mask_and(V::eq(yi, y), V::lt(V::floor(half), half));
+    const mask negative = V::lt(V::copysign(one, x), zero);
+    r = V::select(V::mask_and(odd, negative), V::mul(r, V::set1(-1.0f)), r);
+    // a finite negative x to a non-integer power:
+    const mask finite_negative = V::mask_and(V::lt(x, zero), V::lt(V::sub(zero, inf), x));
+    r = V::select(V::mask_and(finite_negative, V::lt(yi, y)), V::set1(std::numeric_limits<float>::quiet_NaN()), r);
+    // x^0 = 1^y = (-1)^inf = 1, NaNs included:
+    r = V::select(V::mask_or(V::eq(y, zero), V::eq(x, one)), one, r);
+    return V::select(V::mask_and(V::eq(x, V::set1(-1.0f)), V::eq(V::abs(y), inf)), one, r);
+}
+
+template<class V, class D, bool Fast>
+void math_pow_run(const float* a, const float* b, float* c, size_t n){
+    size_t i = 0;
+    for(; i + V::W <= n; i += V::W){
+        const typename V::reg r = math_pow_core<V, D, Fast>(a + i, b + i);
+        V::store(c + i, math_pow_fix<V, Fast>(V::load(a + i), V::load(b + i), r));
+    }
+    if(i < n){
+        float x[V::W] = {}, y[V::W] = {};
+        std::copy(a + i, a + n, x);
+        std::copy(b + i, b + n, y);
+        const typename V::reg r = math_pow_core<V, D, Fast>(x, y);
+        V::store_partial(c + i, math_pow_fix<V, Fast>(V::load(x), V::load(y), r), n - i);
+    }
+}
+
+/**
+ * @brief c[i] = a[i]^b[i], c may alias a or b
+ */
+template<class V, class D>
+void math_pow(const float* a, const float* b, float* c, size_t n, simd_math_mode mode){
+    if(mode == simd_math_mode::fast){
+        math_pow_run<V, D, true>(a, b, c, n);
+    }
+    else{
+        math_pow_run<V, D, false>(a, b, c, n);
+    }
+}
+
+// scalar fallback, every element in double precision by the C library:
+void scalar_exp(const float* a, float* b, size_t n, simd_math_mode mode);
+void scalar_log(const float* a, float* b, size_t n, simd_math_mode mode);
+void scalar_sin(const float* a, float* b, size_t n, simd_math_mode mode);
+void scalar_cos(const float* a, float* b, size_t n, simd_math_mode mode);
+void scalar_tanh(const float* a, float* b, size_t n, simd_math_mode mode);
+void scalar_sigmoid(const float* a, float* b, size_t n, simd_math_mode mode);
+void scalar_erf(const float* a, float* b, size_t n, simd_math_mode mode);
+void scalar_pow(const float* a, const float* b, float* c, size_t n, simd_math_mode mode);
+
+// the generic level, see simd_vec.h:
+void generic_exp(const float* a, float* b, size_t n, simd_math_mode mode);
+void generic_log(const float* a, float* b, size_t n, simd_math_mode mode);
+void generic_sin(const float* a, float* b, size_t n, simd_math_mode mode);
+void generic_cos(const float* a, float* b, size_t n, simd_math_mode mode);
+void generic_tanh(const float* a, float* b, size_t n, simd_math_mode mode);
+void generic_sigmoid(const float* a, float* b, size_t n, simd_math_mode mode);
+void generic_erf(const float* a, float* b, size_t n, simd_math_mode mode);
+void generic_pow(const float* a, const float* b, float* c, size_t n, simd_math_mode mode);
+
+#if defined(__aarch64__)
+void neon_exp(const float* a, float* b, size_t n, simd_math_mode mode);
+void neon_log(const float* a, float* b, size_t n, simd_math_mode mode);
+void neon_sin(const float* a, float* b, size_t n, simd_math_mode mode);
+void neon_cos(const float* a, float* b, size_t n, simd_math_mode mode);
+void neon_tanh(const float* a, float* b, size_t n, simd_math_mode mode);
+void neon_sigmoid(const float* a, float* b, size_t n, simd_math_mode mode);
+void neon_erf(const float* a, float* b, size_t n, simd_math_mode mode);
+void neon_pow(const float* a, const float* b, float* c, size_t n, simd_math_mode mode);
+#endif
+
+#endif
@@ -0,0 +1,117 @@
+/**
+ * @file memory.cpp
+ * @author Sravan Senthilnathan
+ * @brief aligned allocations and the scratch arenas
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2023
+ * 
+ */
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+
+#include "simd_playground.h"
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#endif
+
+using namespace std;
+
+namespace {
+
+// transparent huge page size on x86-64 and arm64 with 4 KB pages:
+constexpr size_t huge_page = 2 << 20;
+
+size_t round_up(size_t n, size_t to){
+    return (n + to - 1) / to * to;
+}
+
+}
+
+void* simd_alloc(size_t bytes, bool huge_pages){
+    // plain malloc, which is much faster than aligned_alloc for small
+    // sizes, with room to align and to keep the malloc pointer just before:
+    const size_t align = huge_pages ? huge_page : simd_alignment;
+    if(huge_pages){
+        // whole huge pages, so that every page advised below is ours:
+        bytes = round_up(max(bytes, (size_t)1), huge_page);
+    }
+    char* raw = static_cast<char*>(malloc(bytes + align + sizeof(void*)));
+    if(!raw){
+        return nullptr;
+    }
+    const uintptr_t start = reinterpret_cast<uintptr_t>(raw) + sizeof(void*);
+    char* p = raw + (round_up(start, align) - reinterpret_cast<uintptr_t>(raw));
+    reinterpret_cast<void**>(p)[-1] = raw;
+
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+    if(huge_pages){
+        // only a hint, the kernel may still use small pages:
+        madvise(p, bytes, MADV_HUGEPAGE);
+    }
+#endif
+    return p;
+}
+
+void simd_free(void* p){
+    if(p){
+        free(static_cast<void**>(p)[-1]);
+    }
+}
+
+simd_arena::simd_arena(size_t bytes){
+    if(bytes > 0){
+        block_ = static_cast<char*>(simd_alloc(bytes));
+        size_ = block_ ? round_up(bytes, simd_alignment) : 0;
+    }
+}
+
+simd_arena::~simd_arena(){
+    rewind({0, 0});
+    simd_free(block_);
+}
+
+void* simd_arena::alloc(size_t bytes){
+    bytes = round_up(max(bytes, (size_t)1), simd_alignment);
+
+    void* p = nullptr;
+    if(bytes <= size_ - used_){
+        p = block_ + used_;
+        used_ += bytes;
+    }
+    else{
+        // does not fit, on its own until the next time the arena is empty:
+        p = simd_alloc(bytes);
+        if(!p){
+            return nullptr;
+        }
+        spills_.emplace_back(p, bytes);
+        spilled_ += bytes;
+    }
+    peak_ = max(peak_, used_ + spilled_);
+    return p;
+}
+
+void simd_arena::rewind(mark m){
+    while(spills_.size() > m.spills){
+        simd_free(spills_.back().first);
+        spilled_ -= spills_.back().second;
+        spills_.pop_back();
+    }
+    used_ = min(used_, m.used);
+
+    // empty again: regrow the block so the peak fits without spilling
+    if(used_ == 0 && spills_.empty() && peak_ > size_){
+        simd_free(block_);
+        block_ = static_cast<char*>(simd_alloc(peak_));
+        size_ = block_ ? peak_ : 0;
+    }
+}
+
+simd_arena& simd_scratch(){
+    thread_local simd_arena arena;
+    return arena;
+}
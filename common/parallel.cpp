@@ -0,0 +1,215 @@
+/**
+ * @file parallel.cpp
+ * @author Sravan Senthilnathan
+ * @brief multi-threaded vector kernels on top of the shared worker pool
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2023
+ * 
+ * Each worker runs the dispatched single-threaded kernel on its own cache
+ * line aligned chunk. simd_parallel_first_touch() uses the same chunking, so
+ * the pages a worker computes on were faulted in by that worker and live on
+ * its NUMA node.
+ */
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+
+#include "simd_playground.h"
+#include "dispatch.h"
+#include "conv2d_driver.h"
+#include "thread_pool.h"
+
+namespace {
+
+// below this many elements fork/join costs more than the extra bandwidth brings
+std::atomic<size_t> threshold{1 << 16};
+
+using vector_fn = void (*)(const float*, const float*, float*, size_t);
+
+void parallel_vector(vector_fn kernel, const float* a, const float* b, float* c, size_t n){
+    if(n < threshold.load(std::memory_order_relaxed)){
+        kernel(a, b, c, n);
+        return;
+    }
+
+    thread_pool& pool = shared_pool();
+    const size_t parts = pool.size();
+    pool.run([&](size_t worker){
+        size_t begin, end;
+        chunk_range(c, n, parts, worker, begin, end);
+        if(begin < end){
+            kernel(a + begin, b + begin, c + begin, end - begin);
+        }
+    });
+}
+
+/**
+ * @brief rows_fn(begin, end) on a range of whole rows per worker
+ */
+template<class F>
+void parallel_rows(size_t rows, size_t cols, F rows_fn){
+    if(rows * cols < threshold.load(std::memory_order_relaxed) || rows < 2){
+        rows_fn(0, rows);
+        return;
+    }
+
+    thread_pool& pool = shared_pool();
+    const size_t parts = pool.size();
+    pool.run([&](size_t worker){
+        const size_t begin = rows * worker / parts;
+        const size_t end = rows * (worker + 1) / parts;
+        if(begin < end){
+            rows_fn(begin, end);
+        }
+    });
+}
+
+}
+
+void simd_parallel_add(const float* a, const float* b, float* c, size_t n){
+    const kernel_table& kt = active_kernels();
+    parallel_vector(use_streaming(n) ? kt.add_stream : kt.add, a, b, c, n);
+}
+
+void simd_parallel_sub(const float* a, const float* b, float* c, size_t n){
+    const kernel_table& kt = active_kernels();
+    parallel_vector(use_streaming(n) ? kt.sub_stream : kt.sub, a, b, c, n);
+}
+
+void simd_parallel_mul(const float* a, const float* b, float* c, size_t n){
+    const kernel_table& kt = active_kernels();
+    parallel_vector(use_streaming(n) ? kt.mul_stream : kt.mul, a, b, c, n);
+}
+
+void simd_parallel_div(const float* a, const float* b, float* c, size_t n){
+    const kernel_table& kt = active_kernels();
+    parallel_vector(use_streaming(n) ? kt.div_stream : kt.div, a, b, c, n);
+}
+
+void simd_parallel_mul_batch(const Tensor* a, const Tensor* b, Tensor* c, size_t count){
+    const auto kernel = active_kernels().mul_batch;
+    if(16 * count < threshold.load(std::memory_order_relaxed)){
+        kernel(a, b, c, count);
+        return;
+    }
+
+    // a tensor is 64 bytes, splitting between tensors keeps the chunks line sized:
+    thread_pool& pool = shared_pool();
+    const size_t parts = pool.size();
+    pool.run([&](size_t worker){
+        const size_t begin = count * worker / parts;
+        const size_t end = count * (worker + 1) / parts;
+        if(begin < end){
+            kernel(a + begin, b + begin, c + begin, end - begin);
+        }
+    });
+}
+
+void simd_parallel_mul_batch_soa(const float* a, const float* b, float* c, size_t count, size_t stride){
+    const auto kernel = active_kernels().mul_batch_soa;
+    if(16 * count < threshold.load(std::memory_order_relaxed)){
+        kernel(a, b, c, count, stride);
+        return;
+    }
+
+    // every worker takes the same tensor range of all 16 planes:
+    thread_pool& pool = shared_pool();
+    const size_t parts = pool.size();
+    pool.run([&](size_t worker){
+        size_t begin, end;
+        chunk_range(c, count, parts, worker, begin, end);
+        if(begin < end){
+            kernel(a + begin, b + begin, c + begin, end - begin, stride);
+        }
+    });
+}
+
+void simd_parallel_softmax(const float* x, float* y, size_t rows, size_t cols){
+    const auto kernel = active_kernels().softmax;
+    parallel_rows(rows, cols, [&](size_t begin, size_t end){
+        kernel(x + begin * cols, y + begin * cols, end - begin, cols);
+    });
+}
+
+void simd_parallel_log_softmax(const float* x, float* y, size_t rows, size_t cols){
+    const auto kernel = active_kernels().log_softmax;
+    parallel_rows(rows, cols, [&](size_t begin, size_t end){
+        kernel(x + begin * cols, y + begin * cols, end - begin, cols);
+    });
+}
+
+void simd_parallel_layer_norm(const float* x, const float* gamma, const float* beta, float* y,
+                              size_t rows, size_t cols, float eps){
+    const auto kernel = active_kernels().layer_norm;
+    parallel_rows(rows, cols, [&](size_t begin, size_t end){
+        kernel(x + begin * cols, gamma, beta, y + begin * cols, end - begin, cols, eps);
+    });
+}
+
+void simd_parallel_rms_norm(const float* x, const float* gamma, float* y, size_t rows, size_t cols, float eps){
+    const auto kernel = active_kernels().rms_norm;
+    parallel_rows(rows, cols, [&](size_t begin, size_t end){
+        kernel(x + begin * cols, gamma, y + begin * cols, end - begin, cols, eps);
+    });
+}
+
+void simd_parallel_bias_activation(const float* x, const float* bias, float* y, size_t rows, size_t cols,
+                                   simd_activation act){
+    const auto kernel = active_kernels().bias_activation;
+    parallel_rows(rows, cols, [&](size_t begin, size_t end){
+        kernel(x + begin * cols, bias, y + begin * cols, end - begin, cols, act);
+    });
+}
+
+void simd_parallel_conv2d(const float* x, size_t width, size_t height, size_t x_stride,
+                          const float* h, size_t kw, size_t kh,
+                          float* y, size_t y_stride, simd_border border){
+    const conv2d_job job = {x, width, height, x_stride, h, nullptr, nullptr, kw, kh, y, y_stride, border};
+    parallel_rows(height, width, [&](size_t begin, size_t end){
+        conv2d_band(job, begin, end);
+    });
+}
+
+void simd_parallel_conv2d_separable(const float* x, size_t width, size_t height, size_t x_stride,
+                                    const float* hx, size_t kw, const float* hy, size_t kh,
+                                    float* y, size_t y_stride, simd_border border){
+    const conv2d_job job = {x, width, height, x_stride, nullptr, hx, hy, kw, kh, y, y_stride, border};
+    parallel_rows(height, width, [&](size_t begin, size_t end){
+        conv2d_band(job, begin, end);
+    });
+}
+
+void simd_parallel_first_touch(float* p, size_t n){
+    if(n < threshold.load(std::memory_order_relaxed)){
+        std::memset(p, 0, n * sizeof(float));
+        return;
+    }
+
+    thread_pool& pool = shared_pool();
+    const size_t parts = pool.size();
+    pool.run([&](size_t worker){
+        size_t begin, end;
+        chunk_range(p, n, parts, worker, begin, end);
+        if(begin < end){
+            std::memset(p + begin, 0, (end - begin) * sizeof(float));
+        }
+    });
+}
+
+void simd_set_threads(size_t threads){
+    resize_shared_pool(threads);
+}
+
+size_t simd_threads(){
+    return shared_pool().size();
+}
+
+void simd_set_parallel_threshold(size_t n){
+    threshold.store(n, std::memory_order_relaxed);
+}
+
+size_t simd_parallel_threshold(){
+    return threshold.load(std::memory_order_relaxed);
+}
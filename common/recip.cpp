@@ -0,0 +1,50 @@
+/**
+ * @file recip.cpp
+ * @author Sravan Senthilnathan
+ * @brief dispatched division modes, square root and reciprocal square root, and their scalar fallback
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2023
+ * 
+ * Scalar code has no estimate instructions, so the scalar level divides
+ * and takes square roots exactly in every mode, in float like the exact
+ * mode of the vector levels.
+ */
+#include <cmath>
+
+#include "simd_playground.h"
+#include "dispatch.h"
+#include "recip_driver.h"
+
+void scalar_div(const float* a, const float* b, float* c, size_t n, simd_div_mode){
+    div(a, b, c, n);
+}
+
+void scalar_sqrt(const float* a, float* b, size_t n, simd_div_mode){
+    for(size_t i = 0; i < n; ++i){
+        b[i] = std::sqrt(a[i]);
+    }
+}
+
+void scalar_rsqrt(const float* a, float* b, size_t n, simd_div_mode){
+    for(size_t i = 0; i < n; ++i){
+        b[i] = 1.0f / std::sqrt(a[i]);
+    }
+}
+
+void simd_div(const float* a, const float* b, float* c, size_t n, simd_div_mode mode){
+    if(mode == simd_div_mode::exact){
+        simd_div(a, b, c, n);
+        return;
+    }
+    active_kernels().div_mode(a, b, c, n, mode);
+}
+
+void simd_sqrt(const float* a, float* b, size_t n, simd_div_mode mode){
+    active_kernels().sqrt(a, b, n, mode);
+}
+
+void simd_rsqrt(const float* a, float* b, size_t n, simd_div_mode mode){
+    active_kernels().rsqrt(a, b, n, mode);
+}
@@ -0,0 +1,171 @@
+/**
+ * @file recip_driver.h
+ * @author Sravan Senthilnathan
+ * @brief division, square root and reciprocal square root from the hardware estimates, shared by the per instruction set kernels
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2023
+ * 
+ * The exact mode (simd_div_mode) is the divide and square root
+ * instructions, whose throughput is a fraction of a multiply's. The newton
+ * modes start from the estimates rcp(b) ~ 1/b and rsqrt(a) ~ 1/sqrt(a) of
+ * simd_vec.h and refine them with one or two Newton-Raphson steps, each
+ * roughly doubling the correct bits:
+ * 
+ *   1/b:        e = 1 - b x,      x' = x + x e
+ *   1/sqrt(a):  e = 1 - a y^2,    y' = y + y/2 e
+ * 
+ * two multiply-adds a step (fused from AVX2 and on NEON), then a / b = a x
+ * and sqrt(a) = a y. The estimates only cover the normal range: lanes with
+ * |b| below FLT_MIN or above 2^125 (1/b close to the subnormals, which the
+ * estimates flush to zero), a below FLT_MIN (zeros, subnormals and
+ * negative numbers) or infinite a are recomputed with the exact
+ * instruction, in the vectors that have one, so those come out as in the
+ * exact mode. NaNs go through the estimates and stay NaN.
+ * 
+ * The driver is a template on a float backend V of simd_vec.h with the
+ * recip_driver.h members. Every array is processed a vector at a time,
+ * the tail as one partial vector (there is no scalar estimate to finish
+ * with), the exact division the way vec_binary() does.
+ */
+#ifndef RECIP_DRIVER_H
+#define RECIP_DRIVER_H
+
+#include <cstddef>
+#include <limits>
+
+#include "simd_playground.h"
+#include "simd_vec.h"
+#include "vector_driver.h"
+
+enum class recip_fn { div, sqrt, rsqrt };
+
+// from here on 1/b is too close to the subnormals for the estimates:
+constexpr float recip_div_limit = 0x1p125f;
+
+/**
+ * @brief Steps Newton-Raphson steps on the estimate x of 1/b
+ */
+template<class V, int Steps>
+typename V::reg recip_refine(typename V::reg b, typename V::reg x){
+    using reg = typename V::reg;
+    const reg one = V::set1(1.0f);
+    const reg nb = V::sub(V::zero(), b);
+    for(int s = 0; s < Steps; ++s){
+        const reg e = V::mul_add(nb, x, one);
+        x = V::mul_add(x, e, x);
+    }
+    return x;
+}
+
+/**
+ * @brief Steps Newton-Raphson steps on the estimate y of 1/sqrt(a)
+ */
+template<class V, int Steps>
+typename V::reg recip_refine_rsqrt(typename V::reg a, typename V::reg y){
+    using reg = typename V::reg;
+    const reg one = V::set1(1.0f);
+    const reg half = V::set1(0.5f);
+    const reg na = V::sub(V::zero(), a);
+    for(int s = 0; s < Steps; ++s){
+        const reg e = V::mul_add(V::mul(na, y), y, one);
+        y = V::mul_add(V::mul(y, half), e, y);
+    }
+    return y;
+}
+
+/**
+ * @brief Fn of one vector, Steps = 0 the exact instructions; the unary
+ * functions ignore b. Inline, so the constants are hoisted out of the
+ * loops of recip_run().
+ */
+template<class V, recip_fn Fn, int Steps>
+inline typename V::reg recip_vector(typename V::reg a, typename V::reg b){
+    using reg = typename V::reg;
+    using mask = typename V::mask;
+    const reg one = V::set1(1.0f);
+    const reg tiny = V::set1(std::numeric_limits<float>::min());
+
+    if(Fn == recip_fn::div){
+        if(Steps == 0){
+            return V::div(a, b);
+        }
+        const reg q = V::mul(a, recip_refine<V, Steps>(b, V::rcp(b)));
+        const reg m = V::abs(b);
+        const mask outside = V::mask_or(V::lt(m, tiny), V::lt(V::set1(recip_div_limit), m));
+        return V::any(outside) ? V::select(outside, V::div(a, b), q) : q;
+    }
+
+    if(Steps == 0){
+        const reg s = V::sqrt(a);
+        return Fn == recip_fn::sqrt ? s : V::div(one, s);
+    }
+    const reg y = recip_refine_rsqrt<V, Steps>(a, V::rsqrt(a));
+    const reg r = Fn == recip_fn::sqrt ? V::mul(a, y) : y;
+    const mask outside = V::mask_or(V::lt(a, tiny), V::lt(V::set1(std::numeric_limits<float>::max()), a));
+    if(!V::any(outside)){
+        return r;
+    }
+    const reg s = V::sqrt(a);
+    return V::select(outside, Fn == recip_fn::sqrt ? s : V::div(one, s), r);
+}
+
+/**
+ * @brief c[i] = Fn(a[i], b[i]), b = a for the unary functions; c may alias
+ * a or b
+ */
+template<class V, recip_fn Fn, int Steps>
+void recip_run(const float* a, const float* b, float* c, size_t n){
+    size_t i = 0;
+    for(; i + 2 * V::W <= n; i += 2 * V::W){
+        const typename V::reg r0 = recip_vector<V, Fn, Steps>(V::load(a + i), V::load(b + i));
+        const typename V::reg r1 = recip_vector<V, Fn, Steps>(V::load(a + i + V::W), V::load(b + i + V::W));
+        V::store(c + i, r0);
+        V::store(c + i + V::W, r1);
+    }
+    for(; i + V::W <= n; i += V::W){
+        V::store(c + i, recip_vector<V, Fn, Steps>(V::load(a + i), V::load(b + i)));
+    }
+    if(i < n){
+        const typename V::reg r = recip_vector<V, Fn, Steps>(V::load_partial(a + i, n - i),
+                                                             V::load_partial(b + i, n - i));
+        V::store_partial(c + i, r, n - i);
+    }
+}
+
+/**
+ * @brief c[i] = a[i] / b[i] in the given mode, c may alias a or b
+ */
+template<class V>
+void recip_div(const float* a, const float* b, float* c, size_t n, simd_div_mode mode){
+    switch(mode){
+        case simd_div_mode::newton2: recip_run<V, recip_fn::div, 2>(a, b, c, n); break;
+        case simd_div_mode::newton1: recip_run<V, recip_fn::div, 1>(a, b, c, n); break;
+        default:                     vec_binary<V, vec_op::div>(a, b, c, n);
+    }
+}
+
+/**
+ * @brief b[i] = Fn(a[i]) (sqrt or rsqrt) in the given mode, b may alias a
+ */
+template<class V, recip_fn Fn>
+void recip_unary(const float* a, float* b, size_t n, simd_div_mode mode){
+    switch(mode){
+        case simd_div_mode::newton2: recip_run<V, Fn, 2>(a, a, b, n); break;
+        case simd_div_mode::newton1: recip_run<V, Fn, 1>(a, a, b, n); break;
+        default:                     recip_run<V, Fn, 0>(a, a, b, n);
+    }
+}
+
+// scalar fallback, exact whatever the mode:
+void scalar_div(const float* a, const float* b, float* c, size_t n, simd_div_mode mode);
+void scalar_sqrt(const float* a, float* b, size_t n, simd_div_mode mode);
+void scalar_rsqrt(const float* a, float* b, size_t n, simd_div_mode mode);
+
+// the generic level, see simd_vec.h:
+void generic_div(const float* a, const float* b, float* c, size_t n, simd_div_mode mode);
+void generic_sqrt(const float* a, float* b, size_t n, simd_div_mode mode);
+void generic_rsqrt(const float* a, float* b, size_t n, simd_div_mode mode);
+
+#endif
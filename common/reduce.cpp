@@ -0,0 +1,93 @@
+/**
+ * @file reduce.cpp
+ * @author Sravan Senthilnathan
+ * @brief dispatched reductions and their scalar fallback
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2023
+ * 
+ */
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "simd_playground.h"
+#include "dispatch.h"
+#include "simd_vec.h"
+#include "reduce_driver.h"
+
+float scalar_sum(const float* a, size_t n, simd_sum_mode mode){
+    return reduce_sum<vec_scalar<float>>(a, n, mode);
+}
+
+float scalar_dot(const float* a, const float* b, size_t n, simd_sum_mode mode){
+    return reduce_dot<vec_scalar<float>>(a, b, n, mode);
+}
+
+float scalar_minimum(const float* a, size_t n){
+    return reduce_extreme<vec_scalar<float>, false>(a, 0, n);
+}
+
+float scalar_maximum(const float* a, size_t n){
+    return reduce_extreme<vec_scalar<float>, true>(a, 0, n);
+}
+
+size_t scalar_argmin(const float* a, size_t n){
+    return reduce_arg_extreme<vec_scalar<float>, false>(a, n);
+}
+
+size_t scalar_argmax(const float* a, size_t n){
+    return reduce_arg_extreme<vec_scalar<float>, true>(a, n);
+}
+
+float simd_sum(const float* a, size_t n, simd_sum_mode mode){
+    return active_kernels().sum(a, n, mode);
+}
+
+float simd_dot(const float* a, const float* b, size_t n, simd_sum_mode mode){
+    return active_kernels().dot(a, b, n, mode);
+}
+
+float simd_norm2(const float* a, size_t n, simd_sum_mode mode){
+    const kernel_table& kt = active_kernels();
+    float s = kt.dot(a, a, n, mode);
+    if(std::isnan(s) && mode == simd_sum_mode::compensated){
+        // TwoSum turns an overflow into inf - inf, the fast sum says if it was one:
+        s = kt.dot(a, a, n, simd_sum_mode::fast);
+    }
+    if(s >= std::numeric_limits<float>::min() && s <= std::numeric_limits<float>::max()){
+        return std::sqrt(s);
+    }
+    if(std::isnan(s) || n == 0){
+        return s;
+    }
+
+    // the squares overflowed or underflowed: scale by the largest magnitude
+    const float m = std::max(kt.maximum(a, n), -kt.minimum(a, n));
+    if(m == 0.0f || std::isinf(m)){
+        return m;
+    }
+    double acc = 0.0;
+    for(size_t i = 0; i < n; ++i){
+        const double x = a[i] / (double)m;
+        acc += x * x;
+    }
+    return (float)(m * std::sqrt(acc));
+}
+
+float simd_minimum(const float* a, size_t n){
+    return active_kernels().minimum(a, n);
+}
+
+float simd_maximum(const float* a, size_t n){
+    return active_kernels().maximum(a, n);
+}
+
+size_t simd_argmin(const float* a, size_t n){
+    return active_kernels().argmin(a, n);
+}
+
+size_t simd_argmax(const float* a, size_t n){
+    return active_kernels().argmax(a, n);
+}
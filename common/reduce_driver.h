@@ -0,0 +1,394 @@
+/**
+ * @file reduce_driver.h
+ * @author Sravan Senthilnathan
+ * @brief sum, dot product, min/max and argmin/argmax shared by the per instruction set kernels
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2023
+ * 
+ * A single accumulator makes every add wait for the previous one (4 cycles
+ * per vector on current cores), so the loops keep 4 independent vector
+ * accumulators and only fold them, and their lanes, at the end. The
+ * summation modes (see simd_sum_mode):
+ * 
+ *   fast:        4 accumulators of W lanes, error up to about n / (4 W) eps sum |x|
+ *   pairwise:    the fast loop on blocks of reduce_block elements, the block
+ *                sums added pairwise, error about (reduce_block + log2 n) eps sum |x|
+ *   compensated: TwoSum on every add and TwoProduct (an FMA, or Dekker's
+ *                split without one) on every product, the rounding errors
+ *                summed on the side (Ogita, Rump, Oishi "Sum2"/"Dot2"): as
+ *                accurate as summing in twice the precision; the errors of
+ *                the lane folds and the tail are summed in double
+ * 
+ * On masked backends the fast loop adds the elements after its last whole
+ * vector as one masked vector, the missing lanes loaded as zeros, rather
+ * than one at a time into the folded sum (see simd_set_tail()); that
+ * changes the order of the adds, not the error bound.
+ * 
+ * The extremes skip NaNs; argmin/argmax reduce blocks of reduce_block
+ * elements with the vector loop, keep the first block with the best
+ * value, and only scan that one for the index.
+ * 
+ * The driver is a template on a float backend V of simd_vec.h. Its min
+ * and max return the second operand when the first is NaN, which is what
+ * skips the NaNs; the product error a * b - p of p = fl(a * b) is one FMA
+ * on fused backends and Dekker's split on the others.
+ */
+#ifndef REDUCE_DRIVER_H
+#define REDUCE_DRIVER_H
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+
+#include "simd_playground.h"
+#include "dispatch.h"
+#include "simd_vec.h"
+
+// elements per block of the pairwise sums and of argmin/argmax:
+constexpr size_t reduce_block = 1024;
+
+/**
+ * @brief a * b - p exactly for p = fl(a * b), by Dekker's split into
+ * halves of 12 bits, for policies without an FMA (where nothing can be
+ * contracted into one either)
+ */
+template<class V>
+typename V::reg dekker_product_error(typename V::reg a, typename V::reg b, typename V::reg p){
+    using reg = typename V::reg;
+    const reg split = V::set1(4097.0f);
+    const reg ta = V::mul(a, split), tb = V::mul(b, split);
+    const reg ah = V::sub(ta, V::sub(ta, a)), bh = V::sub(tb, V::sub(tb, b));
+    const reg al = V::sub(a, ah), bl = V::sub(b, bh);
+    const reg e = V::sub(V::mul(ah, bh), p);
+    return V::add(V::mul(al, bl), V::add(V::mul(al, bh), V::add(V::mul(ah, bl), e)));
+}
+
+inline float dekker_product_error(float a, float b, float p){
+    const float ta = a * 4097.0f, tb = b * 4097.0f;
+    const float ah = ta - (ta - a), bh = tb - (tb - b);
+    const float al = a - ah, bl = b - bh;
+    return al * bl + (al * bh + (ah * bl + (ah * bh - p)));
+}
+
+/**
+ * @brief a * b - p exactly for p = fl(a * b)
+ */
+template<class V>
+typename V::reg reduce_product_error(typename V::reg a, typename V::reg b, typename V::reg p){
+    if(V::fused){
+        return V::mul_add(a, b, V::sub(V::zero(), p));
+    }
+    return dekker_product_error<V>(a, b, p);
+}
+
+/**
+ * @brief hides x from the optimiser, so a product feeding a TwoSum is not
+ * contracted with the add into an FMA (GCC contracts across intrinsics)
+ */
+template<class T>
+inline void reduce_opaque(T& x){
+#if defined(__x86_64__) || defined(__i386__)
+    __asm__("" : "+v"(x));
+#elif defined(__aarch64__)
+    __asm__("" : "+w"(x));
+#else
+    __asm__("" : "+m"(x));
+#endif
+}
+
+template<class T, size_t N>
+inline void reduce_opaque(vec_lanes<T, N>& x){
+    __asm__("" : "+m"(x));
+}
+
+/**
+ * @brief terms of a sum: the elements of a
+ */
+template<class V>
+struct reduce_sum_terms {
+    using reg = typename V::reg;
+    static constexpr bool masked = V::masked;
+    const float* a;
+
+    reg load(size_t i) const { return V::load(a + i); }
+    float at(size_t i) const { return a[i]; }
+    reg accumulate(reg s, size_t i) const { return V::add(s, V::load(a + i)); }
+    reg accumulate_partial(reg s, size_t i, size_t n) const { return V::add(s, V::load_partial(a + i, n)); }
+    float accumulate_at(float s, size_t i) const { return s + a[i]; }
+    // the terms are exact:
+    reg error(size_t) const { return V::zero(); }
+    float error_at(size_t) const { return 0.0f; }
+};
+
+/**
+ * @brief terms of a dot product: a[i] * b[i]
+ */
+template<class V>
+struct reduce_dot_terms {
+    using reg = typename V::reg;
+    static constexpr bool masked = V::masked;
+    const float* a;
+    const float* b;
+
+    reg load(size_t i) const {
+        reg p = V::mul(V::load(a + i), V::load(b + i));
+        reduce_opaque(p);
+        return p;
+    }
+    float at(size_t i) const {
+        float p = a[i] * b[i];
+        reduce_opaque(p);
+        return p;
+    }
+    reg accumulate(reg s, size_t i) const { return V::mul_add(V::load(a + i), V::load(b + i), s); }
+    reg accumulate_partial(reg s, size_t i, size_t n) const {
+        return V::mul_add(V::load_partial(a + i, n), V::load_partial(b + i, n), s);
+    }
+    float accumulate_at(float s, size_t i) const { return V::mul_add(a[i], b[i], s); }
+    reg error(size_t i) const {
+        const reg x = V::load(a + i), y = V::load(b + i);
+        return reduce_product_error<V>(x, y, V::mul(x, y));
+    }
+    float error_at(size_t i) const {
+        const float p = at(i);
+        return V::fused ? std::fma(a[i], b[i], -p) : dekker_product_error(a[i], b[i], p);
+    }
+};
+
+/**
+ * @brief fast mode over [begin, end)
+ */
+template<class V, class T>
+float reduce_fast(const T& t, size_t begin, size_t end){
+    using reg = typename V::reg;
+
+    reg s0 = V::zero(), s1 = V::zero(), s2 = V::zero(), s3 = V::zero();
+    size_t i = begin;
+    for(; i + 4 * V::W <= end; i += 4 * V::W){
+        s0 = t.accumulate(s0, i);
+        s1 = t.accumulate(s1, i + V::W);
+        s2 = t.accumulate(s2, i + 2 * V::W);
+        s3 = t.accumulate(s3, i + 3 * V::W);
+    }
+    for(; i + V::W <= end; i += V::W){
+        s0 = t.accumulate(s0, i);
+    }
+    if(T::masked && i < end && use_vector_tails()){
+        s1 = t.accumulate_partial(s1, i, end - i);
+        i = end;
+    }
+    float r = vec_reduce_add<V, float>(V::add(V::add(s0, s1), V::add(s2, s3)));
+    for(; i < end; ++i){
+        r = t.accumulate_at(r, i);
+    }
+    return r;
+}
+
+/**
+ * @brief pairwise mode: fast blocks, the block sums merged like a binary
+ * counter so every sum adds two of about the same size
+ */
+template<class V, class T>
+float reduce_pairwise(const T& t, size_t n){
+    float stack[64];
+    size_t top = 0;
+    for(size_t blocks = 0, i = 0; i < n; i += reduce_block, ++blocks){
+        float s = reduce_fast<V>(t, i, std::min(n, i + reduce_block));
+        for(size_t c = blocks; c & 1; c >>= 1){
+            s = stack[--top] + s;
+        }
+        stack[top++] = s;
+    }
+
+    float r = 0.0f;
+    while(top > 0){
+        r = stack[--top] + r;
+    }
+    return r;
+}
+
+/**
+ * @brief s + x = sum + err exactly (Knuth's TwoSum, no branch)
+ */
+template<class V>
+void reduce_two_sum(typename V::reg s, typename V::reg x, typename V::reg& sum, typename V::reg& err){
+    sum = V::add(s, x);
+    const typename V::reg z = V::sub(sum, s);
+    err = V::add(V::sub(s, V::sub(sum, z)), V::sub(x, z));
+}
+
+inline void reduce_two_sum(float s, float x, float& sum, float& err){
+    sum = s + x;
+    const float z = sum - s;
+    err = (s - (sum - z)) + (x - z);
+}
+
+/**
+ * @brief compensated mode: two (sum, error) accumulator pairs per lane,
+ * folded with the tail through one TwoSum chain whose errors add up in
+ * double; the scalar backend, whose float error accumulators would see
+ * every term, takes that chain for all of them
+ */
+template<class V, class T>
+float reduce_compensated(const T& t, size_t n){
+    using reg = typename V::reg;
+
+    reg s0 = V::zero(), c0 = V::zero(), s1 = V::zero(), c1 = V::zero();
+    size_t i = 0;
+    for(; V::W > 1 && i + 2 * V::W <= n; i += 2 * V::W){
+        reg e0, e1;
+        reduce_two_sum<V>(s0, t.load(i), s0, e0);
+        reduce_two_sum<V>(s1, t.load(i + V::W), s1, e1);
+        c0 = V::add(c0, V::add(e0, t.error(i)));
+        c1 = V::add(c1, V::add(e1, t.error(i + V::W)));
+    }
+    for(; V::W > 1 && i + V::W <= n; i += V::W){
+        reg e0;
+        reduce_two_sum<V>(s0, t.load(i), s0, e0);
+        c0 = V::add(c0, V::add(e0, t.error(i)));
+    }
+
+    // the lanes and the tail through the same scalar TwoSum:
+    alignas(64) float sums[2 * V::W], errs[2 * V::W];
+    V::store(sums, s0);
+    V::store(sums + V::W, s1);
+    V::store(errs, c0);
+    V::store(errs + V::W, c1);
+
+    float s = 0.0f;
+    double c = 0.0;
+    for(size_t l = 0; l < 2 * V::W; ++l){
+        float e;
+        reduce_two_sum(s, sums[l], s, e);
+        c += (double)e + errs[l];
+    }
+    for(; i < n; ++i){
+        float e;
+        reduce_two_sum(s, t.at(i), s, e);
+        c += (double)e + t.error_at(i);
+    }
+    return (float)(s + c);
+}
+
+template<class V, class T>
+float reduce_terms(const T& t, size_t n, simd_sum_mode mode){
+    switch(mode){
+        case simd_sum_mode::pairwise:    return reduce_pairwise<V>(t, n);
+        case simd_sum_mode::compensated: return reduce_compensated<V>(t, n);
+        default:                         return reduce_fast<V>(t, 0, n);
+    }
+}
+
+template<class V>
+float reduce_sum(const float* a, size_t n, simd_sum_mode mode){
+    return reduce_terms<V>(reduce_sum_terms<V>{a}, n, mode);
+}
+
+template<class V>
+float reduce_dot(const float* a, const float* b, size_t n, simd_sum_mode mode){
+    return reduce_terms<V>(reduce_dot_terms<V>{a, b}, n, mode);
+}
+
+/**
+ * @brief x if it is a number beyond acc, else acc (so NaNs are skipped)
+ */
+template<class V, bool Max>
+typename V::reg reduce_pick(typename V::reg x, typename V::reg acc){
+    return Max ? V::max(x, acc) : V::min(x, acc);
+}
+
+template<bool Max>
+float reduce_pick(float x, float acc){
+    return (Max ? x > acc : x < acc) ? x : acc;
+}
+
+/**
+ * @brief smallest (Max: largest) number in [begin, end), NaNs skipped,
+ * +inf (-inf) if there is none
+ */
+template<class V, bool Max>
+float reduce_extreme(const float* a, size_t begin, size_t end){
+    using reg = typename V::reg;
+    const float none = Max ? -std::numeric_limits<float>::infinity() : std::numeric_limits<float>::infinity();
+
+    reg m0 = V::set1(none), m1 = m0, m2 = m0, m3 = m0;
+    size_t i = begin;
+    for(; i + 4 * V::W <= end; i += 4 * V::W){
+        m0 = reduce_pick<V, Max>(V::load(a + i), m0);
+        m1 = reduce_pick<V, Max>(V::load(a + i + V::W), m1);
+        m2 = reduce_pick<V, Max>(V::load(a + i + 2 * V::W), m2);
+        m3 = reduce_pick<V, Max>(V::load(a + i + 3 * V::W), m3);
+    }
+    for(; i + V::W <= end; i += V::W){
+        m0 = reduce_pick<V, Max>(V::load(a + i), m0);
+    }
+    alignas(64) float lanes[V::W];
+    V::store(lanes, reduce_pick<V, Max>(reduce_pick<V, Max>(m0, m1), reduce_pick<V, Max>(m2, m3)));
+
+    float r = none;
+    for(size_t l = 0; l < V::W; ++l){
+        r = reduce_pick<Max>(lanes[l], r);
+    }
+    for(; i < end; ++i){
+        r = reduce_pick<Max>(a[i], r);
+    }
+    return r;
+}
+
+/**
+ * @brief index of the first smallest (Max: largest) number, n if there is none
+ */
+template<class V, bool Max>
+size_t reduce_arg_extreme(const float* a, size_t n){
+    const float none = Max ? -std::numeric_limits<float>::infinity() : std::numeric_limits<float>::infinity();
+
+    float best = none;
+    size_t best_block = n;
+    for(size_t i = 0; i < n; i += reduce_block){
+        const float m = reduce_extreme<V, Max>(a, i, std::min(n, i + reduce_block));
+        if(Max ? m > best : m < best){
+            best = m;
+            best_block = i;
+        }
+    }
+
+    // nothing beats the infinities: the first of them, if any
+    const size_t begin = best_block == n ? 0 : best_block;
+    const size_t end = best_block == n ? n : std::min(n, best_block + reduce_block);
+    for(size_t i = begin; i < end; ++i){
+        if(a[i] == best){
+            return i;
+        }
+    }
+    return n;
+}
+
+// scalar instantiations, the dispatcher's fallback:
+float scalar_sum(const float* a, size_t n, simd_sum_mode mode);
+float scalar_dot(const float* a, const float* b, size_t n, simd_sum_mode mode);
+float scalar_minimum(const float* a, size_t n);
+float scalar_maximum(const float* a, size_t n);
+size_t scalar_argmin(const float* a, size_t n);
+size_t scalar_argmax(const float* a, size_t n);
+
+// the generic level, see simd_vec.h:
+float generic_sum(const float* a, size_t n, simd_sum_mode mode);
+float generic_dot(const float* a, const float* b, size_t n, simd_sum_mode mode);
+float generic_minimum(const float* a, size_t n);
+float generic_maximum(const float* a, size_t n);
+size_t generic_argmin(const float* a, size_t n);
+size_t generic_argmax(const float* a, size_t n);
+
+#if defined(__aarch64__)
+float neon_sum(const float* a, size_t n, simd_sum_mode mode);
+float neon_dot(const float* a, const float* b, size_t n, simd_sum_mode mode);
+float neon_minimum(const float* a, size_t n);
+float neon_maximum(const float* a, size_t n);
+size_t neon_argmin(const float* a, size_t n);
+size_t neon_argmax(const float* a, size_t n);
+#endif
+
+#endif
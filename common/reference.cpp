@@ -0,0 +1,687 @@
+/**
+ * @file reference.cpp
+ * @author Sravan Senthilnathan
+ * @brief standard (scalar) reference implementations of every kernel
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2023
+ * 
+ */
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+#include "simd_playground.h"
+
+/**
+ * @brief Standard Vector Addition function:
+ * 
+ * @param a first operand array
+ * @param b second operand array
+ * @param c output array
+ * @param n number of elements
+ */
+void add(const float* a, const float* b, float* c, size_t n){
+    for(size_t i = 0; i < n; ++i){
+        c[i] = a[i] + b[i];
+    }
+}
+
+/**
+ * @brief Standard Vector Subtraction function:
+ * 
+ * @param a first operand array
+ * @param b second operand array
+ * @param c output array
+ * @param n number of elements
+ */
+void sub(const float* a, const float* b, float* c, size_t n){
+    for(size_t i = 0; i < n; ++i){
+        c[i] = a[i] - b[i];
+    }
+}
+
+/**
+ * @brief Standard Vector Multiply function:
+ * 
+ * @param a first operand array
+ * @param b second operand array
+ * @param c output array
+ * @param n number of elements
+ */
+void mul(const float* a, const float* b, float* c, size_t n){
+    for(size_t i = 0; i < n; ++i){
+        c[i] = a[i] * b[i];
+    }
+}
+
+/**
+ * @brief Standard Vector Multiply-Add function, d = a * b + c:
+ * 
+ * @param a first factor array
+ * @param b second factor array
+ * @param c addend array
+ * @param d output array
+ * @param n number of elements
+ */
+void mul_add(const float* a, const float* b, const float* c, float* d, size_t n){
+    for(size_t i = 0; i < n; ++i){
+        d[i] = a[i] * b[i] + c[i];
+    }
+}
+
+/**
+ * @brief Standard Vector Division function:
+ * 
+ * @param a first operand array
+ * @param b second operand array
+ * @param c output array
+ * @param n number of elements
+ */
+void div(const float* a, const float* b, float* c, size_t n){
+    for(size_t i = 0; i < n; ++i){
+        c[i] = a[i] / b[i];
+    }
+}
+
+/**
+ * @brief Standard Vector Sum, sequential:
+ * 
+ * @param a operand array
+ * @param n number of elements
+ * @return a[0] + a[1] + ... + a[n - 1]
+ */
+float sum(const float* a, size_t n){
+    float s = 0.0f;
+    for(size_t i = 0; i < n; ++i){
+        s += a[i];
+    }
+    return s;
+}
+
+/**
+ * @brief Standard Dot Product, sequential:
+ * 
+ * @param a first operand array
+ * @param b second operand array
+ * @param n number of elements
+ * @return a[0] * b[0] + ... + a[n - 1] * b[n - 1]
+ */
+float dot(const float* a, const float* b, size_t n){
+    float s = 0.0f;
+    for(size_t i = 0; i < n; ++i){
+        s += a[i] * b[i];
+    }
+    return s;
+}
+
+/**
+ * @brief Standard Euclidean Norm:
+ * 
+ * @param a operand array
+ * @param n number of elements
+ * @return sqrt(a[0]^2 + ... + a[n - 1]^2)
+ */
+float norm2(const float* a, size_t n){
+    return sqrtf(dot(a, a, n));
+}
+
+/**
+ * @brief Standard Vector Minimum, NaNs skipped:
+ * 
+ * @param a operand array
+ * @param n number of elements
+ * @return smallest number in a, +inf if there is none
+ */
+float minimum(const float* a, size_t n){
+    float m = INFINITY;
+    for(size_t i = 0; i < n; ++i){
+        if(a[i] < m){
+            m = a[i];
+        }
+    }
+    return m;
+}
+
+/**
+ * @brief Standard Vector Maximum, NaNs skipped:
+ * 
+ * @param a operand array
+ * @param n number of elements
+ * @return largest number in a, -inf if there is none
+ */
+float maximum(const float* a, size_t n){
+    float m = -INFINITY;
+    for(size_t i = 0; i < n; ++i){
+        if(a[i] > m){
+            m = a[i];
+        }
+    }
+    return m;
+}
+
+/**
+ * @brief Standard Vector Argmin, NaNs skipped:
+ * 
+ * @param a operand array
+ * @param n number of elements
+ * @return index of the first smallest number, n if there is none
+ */
+size_t argmin(const float* a, size_t n){
+    const float m = minimum(a, n);
+    for(size_t i = 0; i < n; ++i){
+        if(a[i] == m){
+            return i;
+        }
+    }
+    return n;
+}
+
+/**
+ * @brief Standard Vector Argmax, NaNs skipped:
+ * 
+ * @param a operand array
+ * @param n number of elements
+ * @return index of the first largest number, n if there is none
+ */
+size_t argmax(const float* a, size_t n){
+    const float m = maximum(a, n);
+    for(size_t i = 0; i < n; ++i){
+        if(a[i] == m){
+            return i;
+        }
+    }
+    return n;
+}
+
+/**
+ * @brief Standard half to float conversion, exact:
+ * 
+ * @param h 16 bit value
+ * @param format format of h
+ * @return h as a float
+ */
+float half_to_float(uint16_t h, simd_half_format format){
+    uint32_t bits;
+    if(format == simd_half_format::bf16){
+        bits = (uint32_t)h << 16;
+    }
+    else{
+        const uint32_t sign = (uint32_t)(h & 0x8000) << 16;
+        const uint32_t exponent = (h >> 10) & 0x1f;
+        const uint32_t mantissa = h & 0x3ff;
+        if(exponent == 0x1f){
+            // inf or NaN:
+            bits = sign | 0x7f800000 | (mantissa << 13);
+        }
+        else if(exponent == 0){
+            // zero or subnormal, mantissa * 2^-24:
+            const float f = (float)mantissa * 5.9604645e-8f;
+            memcpy(&bits, &f, sizeof(bits));
+            bits |= sign;
+        }
+        else{
+            bits = sign | ((exponent + 112) << 23) | (mantissa << 13);
+        }
+    }
+    float f;
+    memcpy(&f, &bits, sizeof(f));
+    return f;
+}
+
+/**
+ * @brief Standard float to half conversion, rounded to nearest even
+ * (overflowing to inf, NaNs stay quiet NaNs):
+ * 
+ * @param a float value
+ * @param format format of the result
+ * @return a as a 16 bit value
+ */
+uint16_t float_to_half(float a, simd_half_format format){
+    uint32_t x;
+    memcpy(&x, &a, sizeof(x));
+
+    if(format == simd_half_format::bf16){
+        if((x & 0x7fffffff) > 0x7f800000){
+            return (uint16_t)((x >> 16) | 0x40);
+        }
+        return (uint16_t)((x + 0x7fff + ((x >> 16) & 1)) >> 16);
+    }
+
+    const uint32_t sign = (x >> 16) & 0x8000;
+    x &= 0x7fffffff;
+    if(x > 0x7f800000){
+        return (uint16_t)(sign | 0x7e00 | ((x >> 13) & 0x3ff));
+    }
+    if(x >= 0x477ff000){
+        // 65520 and up round to inf:
+        return (uint16_t)(sign | 0x7c00);
+    }
+    if(x >= 0x38800000){
+        // normal, rebias the exponent from 127 to 15 and round off 13 bits:
+        const uint32_t r = x - (112u << 23);
+        return (uint16_t)(sign | ((r + 0xfff + ((r >> 13) & 1)) >> 13));
+    }
+    if(x < 0x33000000){
+        // at most half the smallest subnormal:
+        return (uint16_t)sign;
+    }
+    // subnormal, in units of 2^-24:
+    const uint32_t exponent = x >> 23;
+    const uint32_t mantissa = (x & 0x7fffff) | 0x800000;
+    const uint32_t shift = 126 - exponent;
+    const uint32_t q = mantissa >> shift;
+    const uint32_t rest = mantissa & ((1u << shift) - 1), halfway = 1u << (shift - 1);
+    return (uint16_t)(sign | (q + (rest > halfway || (rest == halfway && (q & 1)))));
+}
+
+namespace {
+
+/**
+ * @brief a wide result back to T, keeping its low bits or clamped to T's range
+ */
+template<class T>
+T narrow(int64_t r, simd_overflow overflow){
+    if(overflow == simd_overflow::saturate){
+        r = std::min<int64_t>(std::max<int64_t>(r, std::numeric_limits<T>::min()), std::numeric_limits<T>::max());
+    }
+    return (T)(uint64_t)r;
+}
+
+template<class T>
+void add_int(const T* a, const T* b, T* c, size_t n, simd_overflow overflow){
+    for(size_t i = 0; i < n; ++i){
+        c[i] = narrow<T>((int64_t)a[i] + b[i], overflow);
+    }
+}
+
+template<class T>
+void sub_int(const T* a, const T* b, T* c, size_t n, simd_overflow overflow){
+    for(size_t i = 0; i < n; ++i){
+        c[i] = narrow<T>((int64_t)a[i] - b[i], overflow);
+    }
+}
+
+template<class T>
+void mul_int(const T* a, const T* b, T* c, size_t n, simd_overflow overflow){
+    for(size_t i = 0; i < n; ++i){
+        c[i] = narrow<T>((int64_t)a[i] * b[i], overflow);
+    }
+}
+
+template<class A>
+int64_t dot_int(const A* a, const int8_t* b, size_t n){
+    int64_t s = 0;
+    for(size_t i = 0; i < n; ++i){
+        s += (int64_t)a[i] * b[i];
+    }
+    return s;
+}
+
+}
+
+/**
+ * @brief Standard integer Vector Addition function, int8, uint8, int16 and int32:
+ * 
+ * @param a first operand array
+ * @param b second operand array
+ * @param c output array
+ * @param n number of elements
+ * @param overflow whether sums out of range wrap or saturate
+ */
+void add(const int8_t* a, const int8_t* b, int8_t* c, size_t n, simd_overflow overflow){
+    add_int(a, b, c, n, overflow);
+}
+
+void add(const uint8_t* a, const uint8_t* b, uint8_t* c, size_t n, simd_overflow overflow){
+    add_int(a, b, c, n, overflow);
+}
+
+void add(const int16_t* a, const int16_t* b, int16_t* c, size_t n, simd_overflow overflow){
+    add_int(a, b, c, n, overflow);
+}
+
+void add(const int32_t* a, const int32_t* b, int32_t* c, size_t n, simd_overflow overflow){
+    add_int(a, b, c, n, overflow);
+}
+
+/**
+ * @brief Standard integer Vector Subtraction function, see the integer add()
+ */
+void sub(const int8_t* a, const int8_t* b, int8_t* c, size_t n, simd_overflow overflow){
+    sub_int(a, b, c, n, overflow);
+}
+
+void sub(const uint8_t* a, const uint8_t* b, uint8_t* c, size_t n, simd_overflow overflow){
+    sub_int(a, b, c, n, overflow);
+}
+
+void sub(const int16_t* a, const int16_t* b, int16_t* c, size_t n, simd_overflow overflow){
+    sub_int(a, b, c, n, overflow);
+}
+
+void sub(const int32_t* a, const int32_t* b, int32_t* c, size_t n, simd_overflow overflow){
+    sub_int(a, b, c, n, overflow);
+}
+
+/**
+ * @brief Standard integer Vector Multiply function, see the integer add()
+ */
+void mul(const int8_t* a, const int8_t* b, int8_t* c, size_t n, simd_overflow overflow){
+    mul_int(a, b, c, n, overflow);
+}
+
+void mul(const uint8_t* a, const uint8_t* b, uint8_t* c, size_t n, simd_overflow overflow){
+    mul_int(a, b, c, n, overflow);
+}
+
+void mul(const int16_t* a, const int16_t* b, int16_t* c, size_t n, simd_overflow overflow){
+    mul_int(a, b, c, n, overflow);
+}
+
+void mul(const int32_t* a, const int32_t* b, int32_t* c, size_t n, simd_overflow overflow){
+    mul_int(a, b, c, n, overflow);
+}
+
+/**
+ * @brief Standard 8 bit Dot Product, exact:
+ * 
+ * @param a first operand array
+ * @param b second operand array
+ * @param n number of elements
+ * @return a[0] * b[0] + ... + a[n - 1] * b[n - 1]
+ */
+int64_t dot(const uint8_t* a, const int8_t* b, size_t n){
+    return dot_int(a, b, n);
+}
+
+int64_t dot(const int8_t* a, const int8_t* b, size_t n){
+    return dot_int(a, b, n);
+}
+
+/**
+ * @brief Standard requantization of an int32 accumulator to uint8
+ * 
+ * @param acc accumulator
+ * @param multiplier input scales over the output scale
+ * @param zero_point zero point of the output
+ * @return round(acc * multiplier) + zero_point, clamped to 0..255
+ */
+uint8_t requantize(int32_t acc, float multiplier, int32_t zero_point){
+    // clamped first so the conversion to int32 cannot overflow:
+    const float p = std::min(std::max((float)acc * multiplier, -65536.0f), 65536.0f);
+    const int32_t q = (int32_t)std::nearbyint(p) + zero_point;
+    return (uint8_t)std::min(std::max(q, 0), 255);
+}
+
+/**
+ * @brief Standard quantized convolution, accumulated in int32:
+ * 
+ * @param x discrete time input signal
+ * @param l1 length of x
+ * @param xq quantization of x
+ * @param h discrete impulse response
+ * @param l2 length of h
+ * @param hq quantization of h
+ * @param y convoluted response, l1 + l2 - 1 elements (overwritten)
+ * @param yq quantization of y
+ */
+void conv_quant(const uint8_t* x, size_t l1, simd_quant xq, const int8_t* h, size_t l2, simd_quant hq,
+                uint8_t* y, simd_quant yq){
+    const float multiplier = xq.scale * hq.scale / yq.scale;
+    const size_t l = l1 + l2 - 1;
+
+    for(size_t n = 0; n < l; ++n){
+        int32_t acc = 0;
+        for(size_t k = 0; k < l1; ++k){
+            if(n >= k && n - k < l2){
+                acc += (x[k] - xq.zero_point) * (h[n - k] - hq.zero_point);
+            }
+        }
+        y[n] = requantize(acc, multiplier, yq.zero_point);
+    }
+}
+
+/**
+ * @brief Standard Tensor Addition function:
+ * 
+ * @param a first operand tensor
+ * @param b second operand tensor
+ * @param c output tensor
+ */
+void add(const Tensor a, const Tensor b, Tensor &c){
+    for(int i = 0; i < 4; ++i){
+        for(int j = 0; j < 4; ++j){
+            c[i][j] = a[i][j] + b[i][j];
+        }
+    }
+}
+
+/**
+ * @brief Standard Tensor Subtraction function:
+ * 
+ * @param a first operand tensor
+ * @param b second operand tensor
+ * @param c output tensor
+ */
+void sub(const Tensor a, const Tensor b, Tensor &c){
+    for(int i = 0; i < 4; ++i){
+        for(int j = 0; j < 4; ++j){
+            c[i][j] = a[i][j] - b[i][j];
+        }
+    }
+}
+
+/**
+ * @brief Standard Tensor Multiplication function:
+ * 
+ * @param a first operand tensor
+ * @param b second operand tensor
+ * @param c output tensor
+ */
+void mul(const Tensor a, const Tensor b, Tensor &c){
+    for(int i = 0; i < 4; ++i){
+        for(int j = 0; j < 4; ++j){
+            c[i][j] = 0;
+            for(int k = 0; k < 4; ++k){
+                c[i][j] += a[i][k] * b[k][j];
+            }
+        }
+    }
+}
+
+/**
+ * @brief normal function to compute the convolution of a given discrete time signal
+ * 
+ * @param x discrete time input signal
+ * @param l1 length of x
+ * @param h discrete impulse response
+ * @param l2 length of h
+ * @param y convoluted response, l1 + l2 - 1 zero initialised elements
+ */
+void conv(const float* x, size_t l1, const float* h, size_t l2, float* y){
+    const int l = (int)(l1 + l2 - 1);
+
+    for(int n = 0; n < l; n++){
+        for(int k = 0 ;k < (int)l1; k++){
+            if((n - k) >= 0 && (n - k) < (int)l2){
+                y[n] = y[n] + (x[k]*h[n - k]);
+            }
+        }
+    }
+}
+
+/**
+ * @brief Standard double precision Vector Addition function, see the float add()
+ */
+void add(const double* a, const double* b, double* c, size_t n){
+    for(size_t i = 0; i < n; ++i){
+        c[i] = a[i] + b[i];
+    }
+}
+
+/**
+ * @brief Standard double precision Vector Subtraction function, see the float sub()
+ */
+void sub(const double* a, const double* b, double* c, size_t n){
+    for(size_t i = 0; i < n; ++i){
+        c[i] = a[i] - b[i];
+    }
+}
+
+/**
+ * @brief Standard double precision Vector Multiply function, see the float mul()
+ */
+void mul(const double* a, const double* b, double* c, size_t n){
+    for(size_t i = 0; i < n; ++i){
+        c[i] = a[i] * b[i];
+    }
+}
+
+/**
+ * @brief Standard double precision Vector Division function, see the float div()
+ */
+void div(const double* a, const double* b, double* c, size_t n){
+    for(size_t i = 0; i < n; ++i){
+        c[i] = a[i] / b[i];
+    }
+}
+
+/**
+ * @brief Standard double precision Vector Multiply-Add function, d = a * b + c
+ */
+void mul_add(const double* a, const double* b, const double* c, double* d, size_t n){
+    for(size_t i = 0; i < n; ++i){
+        d[i] = a[i] * b[i] + c[i];
+    }
+}
+
+/**
+ * @brief Standard double precision Tensor Addition function
+ */
+void add(const Tensor64 a, const Tensor64 b, Tensor64 &c){
+    for(int i = 0; i < 4; ++i){
+        for(int j = 0; j < 4; ++j){
+            c[i][j] = a[i][j] + b[i][j];
+        }
+    }
+}
+
+/**
+ * @brief Standard double precision Tensor Subtraction function
+ */
+void sub(const Tensor64 a, const Tensor64 b, Tensor64 &c){
+    for(int i = 0; i < 4; ++i){
+        for(int j = 0; j < 4; ++j){
+            c[i][j] = a[i][j] - b[i][j];
+        }
+    }
+}
+
+/**
+ * @brief Standard double precision Tensor Multiplication function
+ */
+void mul(const Tensor64 a, const Tensor64 b, Tensor64 &c){
+    for(int i = 0; i < 4; ++i){
+        for(int j = 0; j < 4; ++j){
+            c[i][j] = 0;
+            for(int k = 0; k < 4; ++k){
+                c[i][j] += a[i][k] * b[k][j];
+            }
+        }
+    }
+}
+
+/**
+ * @brief Standard double precision convolution, see the float conv()
+ */
+void conv(const double* x, size_t l1, const double* h, size_t l2, double* y){
+    const size_t l = l1 + l2 - 1;
+    if(l1 == 0 || l2 == 0){
+        return;
+    }
+
+    for(size_t n = 0; n < l; ++n){
+        for(size_t k = 0; k < l1; ++k){
+            if(n >= k && n - k < l2){
+                y[n] = y[n] + x[k] * h[n - k];
+            }
+        }
+    }
+}
+
+/**
+ * @brief Standard single precision matrix multiply,
+ * C = alpha * op(A) * op(B) + beta * C on row-major matrices
+ * 
+ * @param trans_a use A transposed
+ * @param trans_b use B transposed
+ * @param m rows of op(A) and C
+ * @param n columns of op(B) and C
+ * @param k columns of op(A), rows of op(B)
+ * @param alpha scale of the product
+ * @param a A
+ * @param lda distance between the rows of A
+ * @param b B
+ * @param ldb distance between the rows of B
+ * @param beta scale of the previous C
+ * @param c C
+ * @param ldc distance between the rows of C
+ */
+void sgemm(bool trans_a, bool trans_b, size_t m, size_t n, size_t k,
+           float alpha, const float* a, size_t lda, const float* b, size_t ldb,
+           float beta, float* c, size_t ldc){
+    for(size_t i = 0; i < m; i++){
+        float* ci = c + i * ldc;
+        for(size_t j = 0; j < n; j++){
+            ci[j] = (beta == 0.0f) ? 0.0f : beta * ci[j];
+        }
+        for(size_t p = 0; p < k; p++){
+            const float aip = alpha * (trans_a ? a[p * lda + i] : a[i * lda + p]);
+            for(size_t j = 0; j < n; j++){
+                ci[j] += aip * (trans_b ? b[j * ldb + p] : b[p * ldb + j]);
+            }
+        }
+    }
+}
+
+/**
+ * @brief Standard batched Tensor Multiplication, c[m] = a[m] * b[m]
+ * 
+ * @param a first operand tensors
+ * @param b second operand tensors
+ * @param c output tensors
+ * @param count number of tensors
+ */
+void mul_batch(const Tensor* a, const Tensor* b, Tensor* c, size_t count){
+    for(size_t m = 0; m < count; m++){
+        mul(a[m], b[m], c[m]);
+    }
+}
+
+/**
+ * @brief Standard batched Tensor Multiplication on structure-of-arrays
+ * operands, element (i, j) of tensor m is at p[(4 * i + j) * stride + m]
+ * 
+ * @param a first operand planes
+ * @param b second operand planes
+ * @param c output planes
+ * @param count number of tensors
+ * @param stride distance between the planes in elements
+ */
+void mul_batch_soa(const float* a, const float* b, float* c, size_t count, size_t stride){
+    for(int i = 0; i < 4; i++){
+        for(int j = 0; j < 4; j++){
+            float* cij = c + (4 * i + j) * stride;
+            for(size_t m = 0; m < count; m++){
+                float sum = 0;
+                for(int k = 0; k < 4; k++){
+                    sum += a[(4 * i + k) * stride + m] * b[(4 * k + j) * stride + m];
+                }
+                cij[m] = sum;
+            }
+        }
+    }
+}
@@ -0,0 +1,848 @@
+/**
+ * @file simd_vec.h
+ * @author Sravan Senthilnathan
+ * @brief portable vector types, so a kernel is written once for every instruction set
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2023
+ * 
+ * The drivers are templates on a vector policy V. The backends below are
+ * those policies, one per instruction set and element type (float or
+ * double), all with the same members:
+ * 
+ *   W (lanes), reg, fused (whether mul_add rounds once)
+ *   load and store (unaligned), stream (non-temporal store to an aligned
+ *   address) and fence (orders the streamed stores before later ones)
+ *   zero, set1 (broadcast)
+ *   add, sub, mul, div, and min and max (returning the second operand
+ *   when the first is NaN, like minps)
+ *   mul_add(a, b, c) = a * b + c for reg and for T, rounded the same way,
+ *   so a scalar tail matches the lanes
+ *   load_partial and store_partial (the first n < W lanes, the others
+ *   loaded as zeros and left alone in memory) and masked, whether those
+ *   are single masked instructions (AVX maskload/maskstore, AVX-512 mask
+ *   registers) rather than copies through a lane buffer
+ * 
+ * and vec_reduce_add() adds the lanes of a register in order. The backends
+ * the elementwise math of math_driver.h runs on (SSE4.1, AVX2, AVX-512,
+ * NEON and generic) also have:
+ * 
+ *   mask, lt, le, eq, unord (either operand NaN), mask_and, mask_or, any
+ *   and select(m, a, b) = m ? a : b
+ *   abs, copysign, round (to nearest even) and floor
+ *   pow2i(k) = 2^k for an integral k in the normal exponent range, and
+ *   getexp and getmant splitting a positive normal a into 2^e * [1, 2)
+ *   load_float and store_float on the double ones, W floats converted
+ * 
+ * and their float backends (and vec_avx<float>, with just the mask, lt,
+ * mask_or, any, select and abs of the list above) the members of the
+ * division and square root modes of recip_driver.h:
+ * 
+ *   sqrt, correctly rounded
+ *   rcp(a) ~ 1/a and rsqrt(a) ~ 1/sqrt(a), the hardware estimates: about
+ *   12 bits on SSE and AVX, 14 on AVX-512 and 8 on NEON; generic truncates
+ *   the exact result to 8 bits after the leading one, as coarse as NEON
+ * 
+ *   vec_scalar   one lane, two roundings: the dispatcher's fallback
+ *   vec_generic  plain C++ lanes shaped like NEON (16 bytes, fused mul_add,
+ *                fminnm/fmaxnm, no non-temporal stores); it builds for any
+ *                target and backs the generic level, so the NEON code paths
+ *                run and are verified on x86
+ *   vec_sse      SSE4.1, no FMA
+ *   vec_avx      AVX, no FMA
+ *   vec_avx2     AVX2/FMA
+ *   vec_avx512   AVX-512F
+ *   vec_neon     AArch64 Advanced SIMD
+ * 
+ * A backend is only defined where its instructions are enabled, i.e. in the
+ * directories the Makefile builds with its flags. They sit in an anonymous
+ * namespace: the same inline member compiled in an AVX and an AVX2/FMA
+ * object (where GCC may contract a mul and an add) must not be merged by
+ * the linker, so every object keeps its own copy.
+ */
+#ifndef SIMD_VEC_H
+#define SIMD_VEC_H
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#endif
+#if defined(__aarch64__)
+#include <arm_neon.h>
+#endif
+
+namespace {
+
+/**
+ * @brief W lanes of T in memory, the register of vec_generic
+ */
+template<class T, size_t N>
+struct vec_lanes {
+    T v[N];
+};
+
+/**
+ * @brief load_partial of the backends without masked loads: the n lanes
+ * copied into a zeroed buffer
+ */
+template<class V, class T>
+typename V::reg vec_load_lanes(const T* p, size_t n){
+    T lanes[V::W] = {};
+    for(size_t l = 0; l < n; ++l){
+        lanes[l] = p[l];
+    }
+    return V::load(lanes);
+}
+
+/**
+ * @brief store_partial of the backends without masked stores
+ */
+template<class V, class T>
+void vec_store_lanes(T* p, typename V::reg a, size_t n){
+    T lanes[V::W];
+    V::store(lanes, a);
+    for(size_t l = 0; l < n; ++l){
+        p[l] = lanes[l];
+    }
+}
+
+#if defined(__AVX__)
+// -1 for the lanes to keep, then 0: the AVX maskload/maskstore mask of the
+// first n lanes starts at 8 - n (4 - n for double)
+alignas(64) constexpr int vec_mask32[16] = {-1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0};
+alignas(64) constexpr long long vec_mask64[8] = {-1, -1, -1, -1, 0, 0, 0, 0};
+
+inline __m256i vec_mask_ps(size_t n){
+    return _mm256_loadu_si256((const __m256i*)(vec_mask32 + 8 - n));
+}
+
+inline __m256i vec_mask_pd(size_t n){
+    return _mm256_loadu_si256((const __m256i*)(vec_mask64 + 4 - n));
+}
+#endif
+
+template<class T>
+struct vec_scalar {
+    static constexpr size_t W = 1;
+    static constexpr bool masked = false;
+    static constexpr bool fused = false;
+    using reg = T;
+
+    static reg load(const T* p) { return *p; }
+    static void store(T* p, reg a) { *p = a; }
+    static reg load_partial(const T* p, size_t n) { return vec_load_lanes<vec_scalar>(p, n); }
+    static void store_partial(T* p, reg a, size_t n) { vec_store_lanes<vec_scalar>(p, a, n); }
+    static void stream(T* p, reg a) { *p = a; }
+    static void fence() {}
+    static reg zero() { return T(0); }
+    static reg set1(T a) { return a; }
+    static reg add(reg a, reg b) { return a + b; }
+    static reg sub(reg a, reg b) { return a - b; }
+    static reg mul(reg a, reg b) { return a * b; }
+    static reg div(reg a, reg b) { return a / b; }
+    static reg min(reg a, reg b) { return a < b ? a : b; }
+    static reg max(reg a, reg b) { return a > b ? a : b; }
+    static reg mul_add(reg a, reg b, reg c) { return a * b + c; }
+};
+
+template<class T>
+struct vec_generic {
+    static constexpr size_t W = 16 / sizeof(T);
+    static constexpr bool masked = false;
+    static constexpr bool fused = true;
+    using reg = vec_lanes<T, W>;
+
+    template<class F>
+    static reg map(reg a, reg b, F f) {
+        reg r;
+        for(size_t l = 0; l < W; ++l){
+            r.v[l] = f(a.v[l], b.v[l]);
+        }
+        return r;
+    }
+
+    static reg load(const T* p) {
+        reg r;
+        for(size_t l = 0; l < W; ++l){
+            r.v[l] = p[l];
+        }
+        return r;
+    }
+    static void store(T* p, reg a) {
+        for(size_t l = 0; l < W; ++l){
+            p[l] = a.v[l];
+        }
+    }
+    static reg load_partial(const T* p, size_t n) { return vec_load_lanes<vec_generic>(p, n); }
+    static void store_partial(T* p, reg a, size_t n) { vec_store_lanes<vec_generic>(p, a, n); }
+    static void stream(T* p, reg a) { store(p, a); }
+    static void fence() {}
+    static reg zero() { return set1(T(0)); }
+    static reg set1(T a) {
+        reg r;
+        for(size_t l = 0; l < W; ++l){
+            r.v[l] = a;
+        }
+        return r;
+    }
+    static reg add(reg a, reg b) { return map(a, b, [](T x, T y) { return x + y; }); }
+    static reg sub(reg a, reg b) { return map(a, b, [](T x, T y) { return x - y; }); }
+    static reg mul(reg a, reg b) { return map(a, b, [](T x, T y) { return x * y; }); }
+    static reg div(reg a, reg b) { return map(a, b, [](T x, T y) { return x / y; }); }
+    static reg min(reg a, reg b) { return map(a, b, [](T x, T y) { return std::fmin(x, y); }); }
+    static reg max(reg a, reg b) { return map(a, b, [](T x, T y) { return std::fmax(x, y); }); }
+    static reg mul_add(reg a, reg b, reg c) {
+        reg r;
+        for(size_t l = 0; l < W; ++l){
+            r.v[l] = std::fma(a.v[l], b.v[l], c.v[l]);
+        }
+        return r;
+    }
+    static T mul_add(T a, T b, T c) { return std::fma(a, b, c); }
+
+    // math_driver.h:
+    using mask = vec_lanes<bool, W>;
+
+    template<class F>
+    static mask test(reg a, reg b, F f) {
+        mask m;
+        for(size_t l = 0; l < W; ++l){
+            m.v[l] = f(a.v[l], b.v[l]);
+        }
+        return m;
+    }
+    template<class F>
+    static reg each(reg a, F f) {
+        for(size_t l = 0; l < W; ++l){
+            a.v[l] = f(a.v[l]);
+        }
+        return a;
+    }
+
+    static mask lt(reg a, reg b) { return test(a, b, [](T x, T y) { return x < y; }); }
+    static mask le(reg a, reg b) { return test(a, b, [](T x, T y) { return x <= y; }); }
+    static mask eq(reg a, reg b) { return test(a, b, [](T x, T y) { return x == y; }); }
+    static mask unord(reg a, reg b) { return test(a, b, [](T x, T y) { return std::isnan(x) || std::isnan(y); }); }
+    static mask mask_and(mask a, mask b) {
+        for(size_t l = 0; l < W; ++l){
+            a.v[l] = a.v[l] && b.v[l];
+        }
+        return a;
+    }
+    static mask mask_or(mask a, mask b) {
+        for(size_t l = 0; l < W; ++l){
+            a.v[l] = a.v[l] || b.v[l];
+        }
+        return a;
+    }
+    static bool any(mask a) {
+        bool r = false;
+        for(size_t l = 0; l < W; ++l){
+            r = r || a.v[l];
+        }
+        return r;
+    }
+    static reg select(mask m, reg a, reg b) {
+        for(size_t l = 0; l < W; ++l){
+            a.v[l] = m.v[l] ? a.v[l] : b.v[l];
+        }
+        return a;
+    }
+    static reg abs(reg a) { return each(a, [](T x) { return std::fabs(x); }); }
+    static reg copysign(reg a, reg s) { return map(a, s, [](T x, T y) { return std::copysign(x, y); }); }
+    static reg round(reg a) { return each(a, [](T x) { return std::nearbyint(x); }); }
+    static reg floor(reg a) { return each(a, [](T x) { return std::floor(x); }); }
+    static reg pow2i(reg k) { return each(k, [](T x) { return std::ldexp(T(1), (int)x); }); }
+    static reg getexp(reg a) {
+        return each(a, [](T x) {
+            int e = 0;
+            std::frexp(x, &e);
+            return T(e - 1);
+        });
+    }
+    static reg getmant(reg a) {
+        return each(a, [](T x) {
+            int e = 0;
+            return 2 * std::frexp(x, &e);
+        });
+    }
+    static reg load_float(const float* p) {
+        reg r;
+        for(size_t l = 0; l < W; ++l){
+            r.v[l] = p[l];
+        }
+        return r;
+    }
+    static void store_float(float* p, reg a) {
+        for(size_t l = 0; l < W; ++l){
+            p[l] = (float)a.v[l];
+        }
+    }
+
+    // recip_driver.h:
+    static T estimate(T x) {
+        int e = 0;
+        const T m = std::frexp(x, &e);
+        return std::ldexp(std::trunc(m * 512) / 512, e);
+    }
+    static reg sqrt(reg a) { return each(a, [](T x) { return std::sqrt(x); }); }
+    static reg rcp(reg a) { return each(a, [](T x) { return estimate(1 / x); }); }
+    static reg rsqrt(reg a) { return each(a, [](T x) { return estimate(1 / std::sqrt(x)); }); }
+};
+
+#if defined(__SSE4_1__)
+
+template<class T> struct vec_sse;
+
+template<>
+struct vec_sse<float> {
+    static constexpr size_t W = 4;
+    static constexpr bool masked = false;
+    static constexpr bool fused = false;
+    using reg = __m128;
+
+    static reg load(const float* p) { return _mm_loadu_ps(p); }
+    static void store(float* p, reg a) { _mm_storeu_ps(p, a); }
+    static reg load_partial(const float* p, size_t n) { return vec_load_lanes<vec_sse<float>>(p, n); }
+    static void store_partial(float* p, reg a, size_t n) { vec_store_lanes<vec_sse<float>>(p, a, n); }
+    static void stream(float* p, reg a) { _mm_stream_ps(p, a); }
+    static void fence() { _mm_sfence(); }
+    static reg zero() { return _mm_setzero_ps(); }
+    static reg set1(float a) { return _mm_set1_ps(a); }
+    static reg add(reg a, reg b) { return _mm_add_ps(a, b); }
+    static reg sub(reg a, reg b) { return _mm_sub_ps(a, b); }
+    static reg mul(reg a, reg b) { return _mm_mul_ps(a, b); }
+    static reg div(reg a, reg b) { return _mm_div_ps(a, b); }
+    static reg min(reg a, reg b) { return _mm_min_ps(a, b); }
+    static reg max(reg a, reg b) { return _mm_max_ps(a, b); }
+    static reg mul_add(reg a, reg b, reg c) { return _mm_add_ps(_mm_mul_ps(a, b), c); }
+    static float mul_add(float a, float b, float c) { return a * b + c; }
+
+    // math_driver.h:
+    using mask = __m128;
+    static mask lt(reg a, reg b) { return _mm_cmplt_ps(a, b); }
+    static mask le(reg a, reg b) { return _mm_cmple_ps(a, b); }
+    static mask eq(reg a, reg b) { return _mm_cmpeq_ps(a, b); }
+    static mask unord(reg a, reg b) { return _mm_cmpunord_ps(a, b); }
+    static mask mask_and(mask a, mask b) { return _mm_and_ps(a, b); }
+    static mask mask_or(mask a, mask b) { return _mm_or_ps(a, b); }
+    static bool any(mask a) { return _mm_movemask_ps(a) != 0; }
+    static reg select(mask m, reg a, reg b) { return _mm_blendv_ps(b, a, m); }
+    static reg abs(reg a) { return _mm_andnot_ps(_mm_set1_ps(-0.0f), a); }
+    static reg copysign(reg a, reg s) {
+        const reg sign = _mm_set1_ps(-0.0f);
+        return _mm_or_ps(_mm_andnot_ps(sign, a), _mm_and_ps(sign, s));
+    }
+    static reg round(reg a) { return _mm_round_ps(a, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC); }
+    static reg floor(reg a) { return _mm_floor_ps(a); }
+    static reg pow2i(reg k) {
+        return _mm_castsi128_ps(_mm_slli_epi32(_mm_add_epi32(_mm_cvtps_epi32(k), _mm_set1_epi32(127)), 23));
+    }
+    static reg getexp(reg a) {
+        return _mm_cvtepi32_ps(_mm_sub_epi32(_mm_srli_epi32(_mm_castps_si128(a), 23), _mm_set1_epi32(127)));
+    }
+    static reg getmant(reg a) {
+        return _mm_or_ps(_mm_and_ps(a, _mm_castsi128_ps(_mm_set1_epi32(0x007fffff))), _mm_set1_ps(1.0f));
+    }
+
+    // recip_driver.h:
+    static reg sqrt(reg a) { return _mm_sqrt_ps(a); }
+    static reg rcp(reg a) { return _mm_rcp_ps(a); }
+    static reg rsqrt(reg a) { return _mm_rsqrt_ps(a); }
+};
+
+template<>
+struct vec_sse<double> {
+    static constexpr size_t W = 2;
+    static constexpr bool masked = false;
+    static constexpr bool fused = false;
+    using reg = __m128d;
+
+    static reg load(const double* p) { return _mm_loadu_pd(p); }
+    static void store(double* p, reg a) { _mm_storeu_pd(p, a); }
+    static reg load_partial(const double* p, size_t n) { return vec_load_lanes<vec_sse<double>>(p, n); }
+    static void store_partial(double* p, reg a, size_t n) { vec_store_lanes<vec_sse<double>>(p, a, n); }
+    static void stream(double* p, reg a) { _mm_stream_pd(p, a); }
+    static void fence() { _mm_sfence(); }
+    static reg zero() { return _mm_setzero_pd(); }
+    static reg set1(double a) { return _mm_set1_pd(a); }
+    static reg add(reg a, reg b) { return _mm_add_pd(a, b); }
+    static reg sub(reg a, reg b) { return _mm_sub_pd(a, b); }
+    static reg mul(reg a, reg b) { return _mm_mul_pd(a, b); }
+    static reg div(reg a, reg b) { return _mm_div_pd(a, b); }
+    static reg min(reg a, reg b) { return _mm_min_pd(a, b); }
+    static reg max(reg a, reg b) { return _mm_max_pd(a, b); }
+    static reg mul_add(reg a, reg b, reg c) { return _mm_add_pd(_mm_mul_pd(a, b), c); }
+    static double mul_add(double a, double b, double c) { return a * b + c; }
+
+    // math_driver.h; without 64 bit integer conversions the exponent goes
+    // through the low bits of 2^52 + e:
+    using mask = __m128d;
+    static mask lt(reg a, reg b) { return _mm_cmplt_pd(a, b); }
+    static mask le(reg a, reg b) { return _mm_cmple_pd(a, b); }
+    static mask eq(reg a, reg b) { return _mm_cmpeq_pd(a, b); }
+    static mask unord(reg a, reg b) { return _mm_cmpunord_pd(a, b); }
+    static mask mask_and(mask a, mask b) { return _mm_and_pd(a, b); }
+    static mask mask_or(mask a, mask b) { return _mm_or_pd(a, b); }
+    static bool any(mask a) { return _mm_movemask_pd(a) != 0; }
+    static reg select(mask m, reg a, reg b) { return _mm_blendv_pd(b, a, m); }
+    static reg abs(reg a) { return _mm_andnot_pd(_mm_set1_pd(-0.0), a); }
+    static reg copysign(reg a, reg s) {
+        const reg sign = _mm_set1_pd(-0.0);
+        return _mm_or_pd(_mm_andnot_pd(sign, a), _mm_and_pd(sign, s));
+    }
+    static reg round(reg a) { return _mm_round_pd(a, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC); }
+    static reg floor(reg a) { return _mm_floor_pd(a); }
+    static reg pow2i(reg k) {
+        const reg biased = _mm_add_pd(k, _mm_set1_pd(0x1p52 + 1023.0));
+        return _mm_castsi128_pd(_mm_slli_epi64(_mm_castpd_si128(biased), 52));
+    }
+    static reg getexp(reg a) {
+        const __m128i e = _mm_srli_epi64(_mm_castpd_si128(a), 52);
+        const reg magic = _mm_set1_pd(0x1p52);
+        return _mm_sub_pd(_mm_castsi128_pd(_mm_or_si128(e, _mm_castpd_si128(magic))), _mm_set1_pd(0x1p52 + 1023.0));
+    }
+    static reg getmant(reg a) {
+        const reg mantissa = _mm_castsi128_pd(_mm_set1_epi64x(0x000fffffffffffff));
+        return _mm_or_pd(_mm_and_pd(a, mantissa), _mm_set1_pd(1.0));
+    }
+    static reg load_float(const float* p) { return _mm_cvtps_pd(_mm_castsi128_ps(_mm_loadl_epi64((const __m128i*)p))); }
+    static void store_float(float* p, reg a) { _mm_storel_pi((__m64*)p, _mm_cvtpd_ps(a)); }
+};
+
+#endif
+
+#if defined(__AVX__)
+
+template<class T> struct vec_avx;
+
+template<>
+struct vec_avx<float> {
+    static constexpr size_t W = 8;
+    static constexpr bool masked = true;
+    static constexpr bool fused = false;
+    using reg = __m256;
+
+    static reg load(const float* p) { return _mm256_loadu_ps(p); }
+    static void store(float* p, reg a) { _mm256_storeu_ps(p, a); }
+    static reg load_partial(const float* p, size_t n) { return _mm256_maskload_ps(p, vec_mask_ps(n)); }
+    static void store_partial(float* p, reg a, size_t n) { _mm256_maskstore_ps(p, vec_mask_ps(n), a); }
+    static void stream(float* p, reg a) { _mm256_stream_ps(p, a); }
+    static void fence() { _mm_sfence(); }
+    static reg zero() { return _mm256_setzero_ps(); }
+    static reg set1(float a) { return _mm256_set1_ps(a); }
+    static reg add(reg a, reg b) { return _mm256_add_ps(a, b); }
+    static reg sub(reg a, reg b) { return _mm256_sub_ps(a, b); }
+    static reg mul(reg a, reg b) { return _mm256_mul_ps(a, b); }
+    static reg div(reg a, reg b) { return _mm256_div_ps(a, b); }
+    static reg min(reg a, reg b) { return _mm256_min_ps(a, b); }
+    static reg max(reg a, reg b) { return _mm256_max_ps(a, b); }
+    static reg mul_add(reg a, reg b, reg c) { return _mm256_add_ps(_mm256_mul_ps(a, b), c); }
+    static float mul_add(float a, float b, float c) { return a * b + c; }
+
+    // recip_driver.h:
+    using mask = __m256;
+    static mask lt(reg a, reg b) { return _mm256_cmp_ps(a, b, _CMP_LT_OQ); }
+    static mask mask_or(mask a, mask b) { return _mm256_or_ps(a, b); }
+    static bool any(mask a) { return _mm256_movemask_ps(a) != 0; }
+    static reg select(mask m, reg a, reg b) { return _mm256_blendv_ps(b, a, m); }
+    static reg abs(reg a) { return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), a); }
+    static reg sqrt(reg a) { return _mm256_sqrt_ps(a); }
+    static reg rcp(reg a) { return _mm256_rcp_ps(a); }
+    static reg rsqrt(reg a) { return _mm256_rsqrt_ps(a); }
+};
+
+template<>
+struct vec_avx<double> {
+    static constexpr size_t W = 4;
+    static constexpr bool masked = true;
+    static constexpr bool fused = false;
+    using reg = __m256d;
+
+    static reg load(const double* p) { return _mm256_loadu_pd(p); }
+    static void store(double* p, reg a) { _mm256_storeu_pd(p, a); }
+    static reg load_partial(const double* p, size_t n) { return _mm256_maskload_pd(p, vec_mask_pd(n)); }
+    static void store_partial(double* p, reg a, size_t n) { _mm256_maskstore_pd(p, vec_mask_pd(n), a); }
+    static void stream(double* p, reg a) { _mm256_stream_pd(p, a); }
+    static void fence() { _mm_sfence(); }
+    static reg zero() { return _mm256_setzero_pd(); }
+    static reg set1(double a) { return _mm256_set1_pd(a); }
+    static reg add(reg a, reg b) { return _mm256_add_pd(a, b); }
+    static reg sub(reg a, reg b) { return _mm256_sub_pd(a, b); }
+    static reg mul(reg a, reg b) { return _mm256_mul_pd(a, b); }
+    static reg div(reg a, reg b) { return _mm256_div_pd(a, b); }
+    static reg min(reg a, reg b) { return _mm256_min_pd(a, b); }
+    static reg max(reg a, reg b) { return _mm256_max_pd(a, b); }
+    static reg mul_add(reg a, reg b, reg c) { return _mm256_add_pd(_mm256_mul_pd(a, b), c); }
+    static double mul_add(double a, double b, double c) { return a * b + c; }
+};
+
+#endif
+
+#if defined(__AVX2__) && defined(__FMA__)
+
+template<class T> struct vec_avx2;
+
+template<>
+struct vec_avx2<float> {
+    static constexpr size_t W = 8;
+    static constexpr bool masked = true;
+    static constexpr bool fused = true;
+    using reg = __m256;
+
+    static reg load(const float* p) { return _mm256_loadu_ps(p); }
+    static void store(float* p, reg a) { _mm256_storeu_ps(p, a); }
+    static reg load_partial(const float* p, size_t n) { return _mm256_maskload_ps(p, vec_mask_ps(n)); }
+    static void store_partial(float* p, reg a, size_t n) { _mm256_maskstore_ps(p, vec_mask_ps(n), a); }
+    static void stream(float* p, reg a) { _mm256_stream_ps(p, a); }
+    static void fence() { _mm_sfence(); }
+    static reg zero() { return _mm256_setzero_ps(); }
+    static reg set1(float a) { return _mm256_set1_ps(a); }
+    static reg add(reg a, reg b) { return _mm256_add_ps(a, b); }
+    static reg sub(reg a, reg b) { return _mm256_sub_ps(a, b); }
+    static reg mul(reg a, reg b) { return _mm256_mul_ps(a, b); }
+    static reg div(reg a, reg b) { return _mm256_div_ps(a, b); }
+    static reg min(reg a, reg b) { return _mm256_min_ps(a, b); }
+    static reg max(reg a, reg b) { return _mm256_max_ps(a, b); }
+    static reg mul_add(reg a, reg b, reg c) { return _mm256_fmadd_ps(a, b, c); }
+    static float mul_add(float a, float b, float c) { return std::fma(a, b, c); }
+
+    // math_driver.h:
+    using mask = __m256;
+    static mask lt(reg a, reg b) { return _mm256_cmp_ps(a, b, _CMP_LT_OQ); }
+    static mask le(reg a, reg b) { return _mm256_cmp_ps(a, b, _CMP_LE_OQ); }
+    static mask eq(reg a, reg b) { return _mm256_cmp_ps(a, b, _CMP_EQ_OQ); }
+    static mask unord(reg a, reg b) { return _mm256_cmp_ps(a, b, _CMP_UNORD_Q); }
+    static mask mask_and(mask a, mask b) { return _mm256_and_ps(a, b); }
+    static mask mask_or(mask a, mask b) { return _mm256_or_ps(a, b); }
+    static bool any(mask a) { return _mm256_movemask_ps(a) != 0; }
+    static reg select(mask m, reg a, reg b) { return _mm256_blendv_ps(b, a, m); }
+    static reg abs(reg a) { return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), a); }
+    static reg copysign(reg a, reg s) {
+        const reg sign = _mm256_set1_ps(-0.0f);
+        return _mm256_or_ps(_mm256_andnot_ps(sign, a), _mm256_and_ps(sign, s));
+    }
+    static reg round(reg a) { return _mm256_round_ps(a, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC); }
+    static reg floor(reg a) { return _mm256_floor_ps(a); }
+    static reg pow2i(reg k) {
+        return _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_add_epi32(_mm256_cvtps_epi32(k), _mm256_set1_epi32(127)), 23));
+    }
+    static reg getexp(reg a) {
+        return _mm256_cvtepi32_ps(_mm256_sub_epi32(_mm256_srli_epi32(_mm256_castps_si256(a), 23), _mm256_set1_epi32(127)));
+    }
+    static reg getmant(reg a) {
+        return _mm256_or_ps(_mm256_and_ps(a, _mm256_castsi256_ps(_mm256_set1_epi32(0x007fffff))), _mm256_set1_ps(1.0f));
+    }
+
+    // recip_driver.h:
+    static reg sqrt(reg a) { return _mm256_sqrt_ps(a); }
+    static reg rcp(reg a) { return _mm256_rcp_ps(a); }
+    static reg rsqrt(reg a) { return _mm256_rsqrt_ps(a); }
+};
+
+template<>
+struct vec_avx2<double> {
+    static constexpr size_t W = 4;
+    static constexpr bool masked = true;
+    static constexpr bool fused = true;
+    using reg = __m256d;
+
+    static reg load(const double* p) { return _mm256_loadu_pd(p); }
+    static void store(double* p, reg a) { _mm256_storeu_pd(p, a); }
+    static reg load_partial(const double* p, size_t n) { return _mm256_maskload_pd(p, vec_mask_pd(n)); }
+    static void store_partial(double* p, reg a, size_t n) { _mm256_maskstore_pd(p, vec_mask_pd(n), a); }
+    static void stream(double* p, reg a) { _mm256_stream_pd(p, a); }
+    static void fence() { _mm_sfence(); }
+    static reg zero() { return _mm256_setzero_pd(); }
+    static reg set1(double a) { return _mm256_set1_pd(a); }
+    static reg add(reg a, reg b) { return _mm256_add_pd(a, b); }
+    static reg sub(reg a, reg b) { return _mm256_sub_pd(a, b); }
+    static reg mul(reg a, reg b) { return _mm256_mul_pd(a, b); }
+    static reg div(reg a, reg b) { return _mm256_div_pd(a, b); }
+    static reg min(reg a, reg b) { return _mm256_min_pd(a, b); }
+    static reg max(reg a, reg b) { return _mm256_max_pd(a, b); }
+    static reg mul_add(reg a, reg b, reg c) { return _mm256_fmadd_pd(a, b, c); }
+    static double mul_add(double a, double b, double c) { return std::fma(a, b, c); }
+
+    // math_driver.h, the exponent through 2^52 + e like vec_sse<double>:
+    using mask = __m256d;
+    static mask lt(reg a, reg b) { return _mm256_cmp_pd(a, b, _CMP_LT_OQ); }
+    static mask le(reg a, reg b) { return _mm256_cmp_pd(a, b, _CMP_LE_OQ); }
+    static mask eq(reg a, reg b) { return _mm256_cmp_pd(a, b, _CMP_EQ_OQ); }
+    static mask unord(reg a, reg b) { return _mm256_cmp_pd(a, b, _CMP_UNORD_Q); }
+    static mask mask_and(mask a, mask b) { return _mm256_and_pd(a, b); }
+    static mask mask_or(mask a, mask b) { return _mm256_or_pd(a, b); }
+    static bool any(mask a) { return _mm256_movemask_pd(a) != 0; }
+    static reg select(mask m, reg a, reg b) { return _mm256_blendv_pd(b, a, m); }
+    static reg abs(reg a) { return _mm256_andnot_pd(_mm256_set1_pd(-0.0), a); }
+    static reg copysign(reg a, reg s) {
+        const reg sign = _mm256_set1_pd(-0.0);
+        return _mm256_or_pd(_mm256_andnot_pd(sign, a), _mm256_and_pd(sign, s));
+    }
+    static reg round(reg a) { return _mm256_round_pd(a, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC); }
+    static reg floor(reg a) { return _mm256_floor_pd(a); }
+    static reg pow2i(reg k) {
+        const reg biased = _mm256_add_pd(k, _mm256_set1_pd(0x1p52 + 1023.0));
+        return _mm256_castsi256_pd(_mm256_slli_epi64(_mm256_castpd_si256(biased), 52));
+    }
+    static reg getexp(reg a) {
+        const __m256i e = _mm256_srli_epi64(_mm256_castpd_si256(a), 52);
+        const reg magic = _mm256_set1_pd(0x1p52);
+        return _mm256_sub_pd(_mm256_castsi256_pd(_mm256_or_si256(e, _mm256_castpd_si256(magic))), _mm256_set1_pd(0x1p52 + 1023.0));
+    }
+    static reg getmant(reg a) {
+        const reg mantissa = _mm256_castsi256_pd(_mm256_set1_epi64x(0x000fffffffffffff));
+        return _mm256_or_pd(_mm256_and_pd(a, mantissa), _mm256_set1_pd(1.0));
+    }
+    static reg load_float(const float* p) { return _mm256_cvtps_pd(_mm_loadu_ps(p)); }
+    static void store_float(float* p, reg a) { _mm_storeu_ps(p, _mm256_cvtpd_ps(a)); }
+};
+
+#endif
+
+#if defined(__AVX512F__)
+
+template<class T> struct vec_avx512;
+
+template<>
+struct vec_avx512<float> {
+    static constexpr size_t W = 16;
+    static constexpr bool masked = true;
+    static constexpr bool fused = true;
+    using reg = __m512;
+
+    static reg load(const float* p) { return _mm512_loadu_ps(p); }
+    static void store(float* p, reg a) { _mm512_storeu_ps(p, a); }
+    static reg load_partial(const float* p, size_t n) { return _mm512_maskz_loadu_ps((__mmask16)((1u << n) - 1), p); }
+    static void store_partial(float* p, reg a, size_t n) { _mm512_mask_storeu_ps(p, (__mmask16)((1u << n) - 1), a); }
+    static void stream(float* p, reg a) { _mm512_stream_ps(p, a); }
+    static void fence() { _mm_sfence(); }
+    static reg zero() { return _mm512_setzero_ps(); }
+    static reg set1(float a) { return _mm512_set1_ps(a); }
+    static reg add(reg a, reg b) { return _mm512_add_ps(a, b); }
+    static reg sub(reg a, reg b) { return _mm512_sub_ps(a, b); }
+    static reg mul(reg a, reg b) { return _mm512_mul_ps(a, b); }
+    static reg div(reg a, reg b) { return _mm512_div_ps(a, b); }
+    static reg min(reg a, reg b) { return _mm512_min_ps(a, b); }
+    static reg max(reg a, reg b) { return _mm512_max_ps(a, b); }
+    static reg mul_add(reg a, reg b, reg c) { return _mm512_fmadd_ps(a, b, c); }
+    static float mul_add(float a, float b, float c) { return std::fma(a, b, c); }
+
+    // math_driver.h:
+    using mask = __mmask16;
+    static mask lt(reg a, reg b) { return _mm512_cmp_ps_mask(a, b, _CMP_LT_OQ); }
+    static mask le(reg a, reg b) { return _mm512_cmp_ps_mask(a, b, _CMP_LE_OQ); }
+    static mask eq(reg a, reg b) { return _mm512_cmp_ps_mask(a, b, _CMP_EQ_OQ); }
+    static mask unord(reg a, reg b) { return _mm512_cmp_ps_mask(a, b, _CMP_UNORD_Q); }
+    static mask mask_and(mask a, mask b) { return (mask)(a & b); }
+    static mask mask_or(mask a, mask b) { return (mask)(a | b); }
+    static bool any(mask a) { return a != 0; }
+    static reg select(mask m, reg a, reg b) { return _mm512_mask_blend_ps(m, b, a); }
+    static reg abs(reg a) { return _mm512_abs_ps(a); }
+    static reg copysign(reg a, reg s) {
+        const __m512i magnitude = _mm512_and_si512(_mm512_castps_si512(a), _mm512_set1_epi32(0x7fffffff));
+        const __m512i sign = _mm512_and_si512(_mm512_castps_si512(s), _mm512_set1_epi32(INT32_MIN));
+        return _mm512_castsi512_ps(_mm512_or_si512(magnitude, sign));
+    }
+    static reg round(reg a) { return _mm512_roundscale_ps(a, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC); }
+    static reg floor(reg a) { return _mm512_roundscale_ps(a, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC); }
+    static reg pow2i(reg k) { return _mm512_scalef_ps(_mm512_set1_ps(1.0f), k); }
+    static reg getexp(reg a) { return _mm512_getexp_ps(a); }
+    static reg getmant(reg a) { return _mm512_getmant_ps(a, _MM_MANT_NORM_1_2, _MM_MANT_SIGN_src); }
+
+    // recip_driver.h:
+    static reg sqrt(reg a) { return _mm512_sqrt_ps(a); }
+    static reg rcp(reg a) { return _mm512_rcp14_ps(a); }
+    static reg rsqrt(reg a) { return _mm512_rsqrt14_ps(a); }
+};
+
+template<>
+struct vec_avx512<double> {
+    static constexpr size_t W = 8;
+    static constexpr bool masked = true;
+    static constexpr bool fused = true;
+    using reg = __m512d;
+
+    static reg load(const double* p) { return _mm512_loadu_pd(p); }
+    static void store(double* p, reg a) { _mm512_storeu_pd(p, a); }
+    static reg load_partial(const double* p, size_t n) { return _mm512_maskz_loadu_pd((__mmask8)((1u << n) - 1), p); }
+    static void store_partial(double* p, reg a, size_t n) { _mm512_mask_storeu_pd(p, (__mmask8)((1u << n) - 1), a); }
+    static void stream(double* p, reg a) { _mm512_stream_pd(p, a); }
+    static void fence() { _mm_sfence(); }
+    static reg zero() { return _mm512_setzero_pd(); }
+    static reg set1(double a) { return _mm512_set1_pd(a); }
+    static reg add(reg a, reg b) { return _mm512_add_pd(a, b); }
+    static reg sub(reg a, reg b) { return _mm512_sub_pd(a, b); }
+    static reg mul(reg a, reg b) { return _mm512_mul_pd(a, b); }
+    static reg div(reg a, reg b) { return _mm512_div_pd(a, b); }
+    static reg min(reg a, reg b) { return _mm512_min_pd(a, b); }
+    static reg max(reg a, reg b) { return _mm512_max_pd(a, b); }
+    static reg mul_add(reg a, reg b, reg c) { return _mm512_fmadd_pd(a, b, c); }
+    static double mul_add(double a, double b, double c) { return std::fma(a, b, c); }
+
+    // math_driver.h:
+    using mask = __mmask8;
+    static mask lt(reg a, reg b) { return _mm512_cmp_pd_mask(a, b, _CMP_LT_OQ); }
+    static mask le(reg a, reg b) { return _mm512_cmp_pd_mask(a, b, _CMP_LE_OQ); }
+    static mask eq(reg a, reg b) { return _mm512_cmp_pd_mask(a, b, _CMP_EQ_OQ); }
+    static mask unord(reg a, reg b) { return _mm512_cmp_pd_mask(a, b, _CMP_UNORD_Q); }
+    static mask mask_and(mask a, mask b) { return (mask)(a & b); }
+    static mask mask_or(mask a, mask b) { return (mask)(a | b); }
+    static bool any(mask a) { return a != 0; }
+    static reg select(mask m, reg a, reg b) { return _mm512_mask_blend_pd(m, b, a); }
+    static reg abs(reg a) { return _mm512_abs_pd(a); }
+    static reg copysign(reg a, reg s) {
+        const __m512i magnitude = _mm512_and_si512(_mm512_castpd_si512(a), _mm512_set1_epi64(INT64_MAX));
+        const __m512i sign = _mm512_and_si512(_mm512_castpd_si512(s), _mm512_set1_epi64(INT64_MIN));
+        return _mm512_castsi512_pd(_mm512_or_si512(magnitude, sign));
+    }
+    static reg round(reg a) { return _mm512_roundscale_pd(a, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC); }
+    static reg floor(reg a) { return _mm512_roundscale_pd(a, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC); }
+    static reg pow2i(reg k) { return _mm512_scalef_pd(_mm512_set1_pd(1.0), k); }
+    static reg getexp(reg a) { return _mm512_getexp_pd(a); }
+    static reg getmant(reg a) { return _mm512_getmant_pd(a, _MM_MANT_NORM_1_2, _MM_MANT_SIGN_src); }
+    static reg load_float(const float* p) { return _mm512_cvtps_pd(_mm256_loadu_ps(p)); }
+    static void store_float(float* p, reg a) { _mm256_storeu_ps(p, _mm512_cvtpd_ps(a)); }
+};
+
+#endif
+
+#if defined(__aarch64__)
+
+template<class T> struct vec_neon;
+
+template<>
+struct vec_neon<float> {
+    static constexpr size_t W = 4;
+    static constexpr bool masked = false;
+    static constexpr bool fused = true;
+    using reg = float32x4_t;
+
+    static reg load(const float* p) { return vld1q_f32(p); }
+    static void store(float* p, reg a) { vst1q_f32(p, a); }
+    static reg load_partial(const float* p, size_t n) { return vec_load_lanes<vec_neon<float>>(p, n); }
+    static void store_partial(float* p, reg a, size_t n) { vec_store_lanes<vec_neon<float>>(p, a, n); }
+    // there is no non-temporal store intrinsic (STNP is only a hint most
+    // cores ignore): regular stores, the driver still prefetches
+    static void stream(float* p, reg a) { vst1q_f32(p, a); }
+    static void fence() {}
+    static reg zero() { return vdupq_n_f32(0.0f); }
+    static reg set1(float a) { return vdupq_n_f32(a); }
+    static reg add(reg a, reg b) { return vaddq_f32(a, b); }
+    static reg sub(reg a, reg b) { return vsubq_f32(a, b); }
+    static reg mul(reg a, reg b) { return vmulq_f32(a, b); }
+    static reg div(reg a, reg b) { return vdivq_f32(a, b); }
+    static reg min(reg a, reg b) { return vminnmq_f32(a, b); }
+    static reg max(reg a, reg b) { return vmaxnmq_f32(a, b); }
+    static reg mul_add(reg a, reg b, reg c) { return vfmaq_f32(c, a, b); }
+    static float mul_add(float a, float b, float c) { return std::fma(a, b, c); }
+
+    // math_driver.h:
+    using mask = uint32x4_t;
+    static mask lt(reg a, reg b) { return vcltq_f32(a, b); }
+    static mask le(reg a, reg b) { return vcleq_f32(a, b); }
+    static mask eq(reg a, reg b) { return vceqq_f32(a, b); }
+    static mask unord(reg a, reg b) { return vmvnq_u32(vandq_u32(vceqq_f32(a, a), vceqq_f32(b, b))); }
+    static mask mask_and(mask a, mask b) { return vandq_u32(a, b); }
+    static mask mask_or(mask a, mask b) { return vorrq_u32(a, b); }
+    static bool any(mask a) { return vmaxvq_u32(a) != 0; }
+    static reg select(mask m, reg a, reg b) { return vbslq_f32(m, a, b); }
+    static reg abs(reg a) { return vabsq_f32(a); }
+    static reg copysign(reg a, reg s) { return vbslq_f32(vdupq_n_u32(0x80000000u), s, a); }
+    static reg round(reg a) { return vrndnq_f32(a); }
+    static reg floor(reg a) { return vrndmq_f32(a); }
+    static reg pow2i(reg k) {
+        return vreinterpretq_f32_s32(vshlq_n_s32(vaddq_s32(vcvtnq_s32_f32(k), vdupq_n_s32(127)), 23));
+    }
+    static reg getexp(reg a) {
+        return vcvtq_f32_s32(vsubq_s32(vshrq_n_s32(vreinterpretq_s32_f32(a), 23), vdupq_n_s32(127)));
+    }
+    static reg getmant(reg a) {
+        const uint32x4_t bits = vandq_u32(vreinterpretq_u32_f32(a), vdupq_n_u32(0x007fffffu));
+        return vreinterpretq_f32_u32(vorrq_u32(bits, vdupq_n_u32(0x3f800000u)));
+    }
+
+    // recip_driver.h:
+    static reg sqrt(reg a) { return vsqrtq_f32(a); }
+    static reg rcp(reg a) { return vrecpeq_f32(a); }
+    static reg rsqrt(reg a) { return vrsqrteq_f32(a); }
+};
+
+template<>
+struct vec_neon<double> {
+    static constexpr size_t W = 2;
+    static constexpr bool masked = false;
+    static constexpr bool fused = true;
+    using reg = float64x2_t;
+
+    static reg load(const double* p) { return vld1q_f64(p); }
+    static void store(double* p, reg a) { vst1q_f64(p, a); }
+    static reg load_partial(const double* p, size_t n) { return vec_load_lanes<vec_neon<double>>(p, n); }
+    static void store_partial(double* p, reg a, size_t n) { vec_store_lanes<vec_neon<double>>(p, a, n); }
+    static void stream(double* p, reg a) { vst1q_f64(p, a); }
+    static void fence() {}
+    static reg zero() { return vdupq_n_f64(0.0); }
+    static reg set1(double a) { return vdupq_n_f64(a); }
+    static reg add(reg a, reg b) { return vaddq_f64(a, b); }
+    static reg sub(reg a, reg b) { return vsubq_f64(a, b); }
+    static reg mul(reg a, reg b) { return vmulq_f64(a, b); }
+    static reg div(reg a, reg b) { return vdivq_f64(a, b); }
+    static reg min(reg a, reg b) { return vminnmq_f64(a, b); }
+    static reg max(reg a, reg b) { return vmaxnmq_f64(a, b); }
+    static reg mul_add(reg a, reg b, reg c) { return vfmaq_f64(c, a, b); }
+    static double mul_add(double a, double b, double c) { return std::fma(a, b, c); }
+
+    // math_driver.h:
+    using mask = uint64x2_t;
+    static mask lt(reg a, reg b) { return vcltq_f64(a, b); }
+    static mask le(reg a, reg b) { return vcleq_f64(a, b); }
+    static mask eq(reg a, reg b) { return vceqq_f64(a, b); }
+    static mask unord(reg a, reg b) {
+        const uint32x4_t ordered = vreinterpretq_u32_u64(vandq_u64(vceqq_f64(a, a), vceqq_f64(b, b)));
+        return vreinterpretq_u64_u32(vmvnq_u32(ordered));
+    }
+    static mask mask_and(mask a, mask b) { return vandq_u64(a, b); }
+    static mask mask_or(mask a, mask b) { return vorrq_u64(a, b); }
+    static bool any(mask a) { return vmaxvq_u32(vreinterpretq_u32_u64(a)) != 0; }
+    static reg select(mask m, reg a, reg b) { return vbslq_f64(m, a, b); }
+    static reg abs(reg a) { return vabsq_f64(a); }
+    static reg copysign(reg a, reg s) { return vbslq_f64(vdupq_n_u64(0x8000000000000000ull), s, a); }
+    static reg round(reg a) { return vrndnq_f64(a); }
+    static reg floor(reg a) { return vrndmq_f64(a); }
+    static reg pow2i(reg k) {
+        return vreinterpretq_f64_s64(vshlq_n_s64(vaddq_s64(vcvtnq_s64_f64(k), vdupq_n_s64(1023)), 52));
+    }
+    static reg getexp(reg a) {
+        return vcvtq_f64_s64(vsubq_s64(vshrq_n_s64(vreinterpretq_s64_f64(a), 52), vdupq_n_s64(1023)));
+    }
+    static reg getmant(reg a) {
+        const uint64x2_t bits = vandq_u64(vreinterpretq_u64_f64(a), vdupq_n_u64(0x000fffffffffffffull));
+        return vreinterpretq_f64_u64(vorrq_u64(bits, vdupq_n_u64(0x3ff0000000000000ull)));
+    }
+    static reg load_float(const float* p) { return vcvt_f64_f32(vld1_f32(p)); }
+    static void store_float(float* p, reg a) { vst1_f32(p, vcvt_f32_f64(a)); }
+};
+
+#endif
+
+/**
+ * @brief lanes of a added in order, lane 0 first
+ */
+template<class V, class T>
+T vec_reduce_add(typename V::reg a){
+    T lanes[V::W];
+    V::store(lanes, a);
+    T r = lanes[0];
+    for(size_t l = 1; l < V::W; ++l){
+        r += lanes[l];
+    }
+    return r;
+}
+
+}
+
+#endif
@@ -0,0 +1,93 @@
+/**
+ * @file stream_driver.h
+ * @author Sravan Senthilnathan
+ * @brief elementwise kernels with non-temporal stores, for outputs larger than the LLC
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2023
+ *
+ * A regular store to a line that is not cached first reads the line from
+ * memory (write-allocate), so c = a op b on arrays that do not fit in the
+ * last level cache moves 4 floats per element instead of 3, and the output
+ * evicts data that might have been reused. Non-temporal stores write whole
+ * lines around the caches instead: the loop writes c scalar up to a 64 byte
+ * boundary, then one cache line per iteration with streaming stores, and
+ * prefetches the inputs 2 KB ahead (into every level: a non-temporal
+ * prefetch hint made the loop slower than the regular stores on AVX-512).
+ *
+ * The driver is a template on a float backend V of simd_vec.h: W, load,
+ * stream, fence, and add, sub, mul, div.
+ */
+#ifndef STREAM_DRIVER_H
+#define STREAM_DRIVER_H
+
+#include <cstddef>
+#include <cstdint>
+
+// how far ahead of the loads the inputs are prefetched, in floats (2 KB):
+constexpr size_t stream_prefetch = 512;
+
+struct stream_add {
+    template<class V> static typename V::reg apply(typename V::reg a, typename V::reg b) { return V::add(a, b); }
+    static float apply(float a, float b) { return a + b; }
+};
+
+struct stream_sub {
+    template<class V> static typename V::reg apply(typename V::reg a, typename V::reg b) { return V::sub(a, b); }
+    static float apply(float a, float b) { return a - b; }
+};
+
+struct stream_mul {
+    template<class V> static typename V::reg apply(typename V::reg a, typename V::reg b) { return V::mul(a, b); }
+    static float apply(float a, float b) { return a * b; }
+};
+
+struct stream_div {
+    template<class V> static typename V::reg apply(typename V::reg a, typename V::reg b) { return V::div(a, b); }
+    static float apply(float a, float b) { return a / b; }
+};
+
+/**
+ * @brief c[i] = a[i] op b[i] with non-temporal stores to c, c may alias a or b
+ */
+template<class V, class Op>
+void stream_run(const float* a, const float* b, float* c, size_t n){
+    constexpr size_t line = 64 / sizeof(float);
+    static_assert(line % V::W == 0, "a cache line holds whole vectors");
+
+    size_t i = 0;
+    // up to the first line boundary of c (c is at least float aligned):
+    const size_t head = ((64 - reinterpret_cast<uintptr_t>(c) % 64) % 64) / sizeof(float);
+    for(; i < head && i < n; ++i){
+        c[i] = Op::apply(a[i], b[i]);
+    }
+
+    for(; i + line <= n; i += line){
+        __builtin_prefetch(a + i + stream_prefetch, 0, 3);
+        __builtin_prefetch(b + i + stream_prefetch, 0, 3);
+        for(size_t j = 0; j < line; j += V::W){
+            V::stream(c + i + j, Op::template apply<V>(V::load(a + i + j), V::load(b + i + j)));
+        }
+    }
+    V::fence();
+
+    for(; i < n; ++i){
+        c[i] = Op::apply(a[i], b[i]);
+    }
+}
+
+// the generic level, see simd_vec.h:
+void generic_add_stream(const float* a, const float* b, float* c, size_t n);
+void generic_sub_stream(const float* a, const float* b, float* c, size_t n);
+void generic_mul_stream(const float* a, const float* b, float* c, size_t n);
+void generic_div_stream(const float* a, const float* b, float* c, size_t n);
+
+#if defined(__aarch64__)
+void neon_add_stream(const float* a, const float* b, float* c, size_t n);
+void neon_sub_stream(const float* a, const float* b, float* c, size_t n);
+void neon_mul_stream(const float* a, const float* b, float* c, size_t n);
+void neon_div_stream(const float* a, const float* b, float* c, size_t n);
+#endif
+
+#endif
@@ -0,0 +1,241 @@
+/**
+ * @file thread_pool.cpp
+ * @author Sravan Senthilnathan
+ * @brief persistent worker pool, CPU pinning and NUMA ordering
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2023
+ * 
+ */
+#include "thread_pool.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace {
+
+thread_local bool inside_job = false;
+
+#if defined(__linux__)
+
+/**
+ * @brief parses a sysfs cpu list such as "0-3,8-11"
+ */
+std::vector<int> parse_cpulist(const char* path){
+    std::vector<int> cpus;
+    FILE* f = std::fopen(path, "r");
+    if(!f){
+        return cpus;
+    }
+    int lo, hi;
+    while(std::fscanf(f, "%d", &lo) == 1){
+        hi = lo;
+        int c = std::fgetc(f);
+        if(c == '-'){
+            if(std::fscanf(f, "%d", &hi) != 1){
+                break;
+            }
+            c = std::fgetc(f);
+        }
+        for(int i = lo; i <= hi; ++i){
+            cpus.push_back(i);
+        }
+        if(c != ','){
+            break;
+        }
+    }
+    std::fclose(f);
+    return cpus;
+}
+
+/**
+ * @brief CPUs this process may run on, grouped by NUMA node
+ */
+std::vector<int> cpu_order(){
+    cpu_set_t allowed;
+    CPU_ZERO(&allowed);
+    if(sched_getaffinity(0, sizeof(allowed), &allowed) != 0){
+        return {};
+    }
+
+    std::vector<int> order;
+    std::vector<bool> seen(CPU_SETSIZE, false);
+    for(int node = 0; node < 1024; ++node){
+        char path[96];
+        std::snprintf(path, sizeof(path), "/sys/devices/system/node/node%d/cpulist", node);
+        const std::vector<int> cpus = parse_cpulist(path);
+        if(cpus.empty() && node > 0){
+            break;
+        }
+        for(int cpu : cpus){
+            if(cpu < CPU_SETSIZE && CPU_ISSET(cpu, &allowed) && !seen[cpu]){
+                seen[cpu] = true;
+                order.push_back(cpu);
+            }
+        }
+    }
+    // no sysfs topology: plain affinity order
+    for(int cpu = 0; cpu < CPU_SETSIZE; ++cpu){
+        if(CPU_ISSET(cpu, &allowed) && !seen[cpu]){
+            order.push_back(cpu);
+        }
+    }
+    return order;
+}
+
+void pin_to(int cpu){
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+    pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+}
+
+#else
+
+std::vector<int> cpu_order(){
+    std::vector<int> order(std::max(1u, std::thread::hardware_concurrency()));
+    for(size_t i = 0; i < order.size(); ++i){
+        order[i] = -1;
+    }
+    return order;
+}
+
+void pin_to(int){}
+
+#endif
+
+}
+
+thread_pool::thread_pool(size_t threads){
+    const std::vector<int> cpus = cpu_order();
+    if(threads == 0){
+        threads = std::max<size_t>(1, cpus.size());
+    }
+
+    // worker 0 is the caller, which stays wherever the application put it
+    for(size_t i = 1; i < threads; ++i){
+        const int cpu = cpus.empty() || threads > cpus.size() ? -1 : cpus[i];
+        workers_.emplace_back([this, i, cpu]{ worker_loop(i, cpu); });
+    }
+}
+
+thread_pool::~thread_pool(){
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    wake_.notify_all();
+    for(auto& t : workers_){
+        t.join();
+    }
+}
+
+void thread_pool::worker_loop(size_t id, int cpu){
+    if(cpu >= 0){
+        pin_to(cpu);
+    }
+    inside_job = true;
+
+    uint64_t seen = 0;
+    for(;;){
+        void (*fn)(void*, size_t);
+        void* ctx;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            wake_.wait(lock, [&]{ return stop_ || generation_ != seen; });
+            if(stop_){
+                return;
+            }
+            seen = generation_;
+            fn = fn_;
+            ctx = ctx_;
+        }
+
+        fn(ctx, id);
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        if(--pending_ == 0){
+            done_.notify_one();
+        }
+    }
+}
+
+void thread_pool::run_job(void (*fn)(void*, size_t), void* ctx){
+    if(workers_.empty() || inside_job){
+        for(size_t i = 0; i < size(); ++i){
+            fn(ctx, i);
+        }
+        return;
+    }
+
+    std::lock_guard<std::mutex> job(job_lock_);
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        fn_ = fn;
+        ctx_ = ctx;
+        pending_ = workers_.size();
+        ++generation_;
+    }
+    wake_.notify_all();
+
+    inside_job = true;
+    fn(ctx, 0);
+    inside_job = false;
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    done_.wait(lock, [&]{ return pending_ == 0; });
+}
+
+namespace {
+
+std::mutex pool_lock;
+std::unique_ptr<thread_pool> pool;
+std::atomic<thread_pool*> pool_ptr{nullptr};
+
+}
+
+thread_pool& shared_pool(){
+    if(thread_pool* p = pool_ptr.load(std::memory_order_acquire)){
+        return *p;
+    }
+    std::lock_guard<std::mutex> lock(pool_lock);
+    if(!pool){
+        const char* env = std::getenv("SIMD_PLAYGROUND_THREADS");
+        pool.reset(new thread_pool(env ? (size_t)std::strtoul(env, nullptr, 10) : 0));
+        pool_ptr.store(pool.get(), std::memory_order_release);
+    }
+    return *pool;
+}
+
+void resize_shared_pool(size_t threads){
+    std::lock_guard<std::mutex> lock(pool_lock);
+    pool_ptr.store(nullptr, std::memory_order_release);
+    pool.reset(new thread_pool(threads));
+    pool_ptr.store(pool.get(), std::memory_order_release);
+}
+
+void chunk_range(const float* base, size_t n, size_t parts, size_t part, size_t& begin, size_t& end){
+    const size_t line = 64 / sizeof(float);
+
+    // elements before base reaches the first line boundary:
+    const size_t misalign = ((uintptr_t)base % 64) / sizeof(float);
+    const size_t head = std::min(n, misalign == 0 ? 0 : line - misalign);
+    const size_t lines = (n - head + line - 1) / line;
+
+    auto boundary = [&](size_t p){
+        if(p == 0) return (size_t)0;
+        if(p >= parts) return n;
+        return std::min(n, head + (lines * p / parts) * line);
+    };
+    begin = boundary(part);
+    end = boundary(part + 1);
+}
@@ -0,0 +1,91 @@
+/**
+ * @file thread_pool.h
+ * @author Sravan Senthilnathan
+ * @brief persistent worker pool behind the multi-threaded kernels
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2023
+ * 
+ * Workers are started once and then sleep between jobs, a job costs a wake
+ * up instead of a thread spawn. The calling thread takes part as worker 0.
+ * On Linux worker i is pinned to the i-th allowed CPU in NUMA node order, so
+ * consecutive workers (and with chunk_range() consecutive memory) stay on
+ * the same node.
+ */
+#ifndef THREAD_POOL_H
+#define THREAD_POOL_H
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+class thread_pool {
+public:
+    /**
+     * @param threads number of workers including the calling thread, 0 picks
+     * one per CPU the process may run on
+     */
+    explicit thread_pool(size_t threads);
+    ~thread_pool();
+
+    thread_pool(const thread_pool&) = delete;
+    thread_pool& operator=(const thread_pool&) = delete;
+
+    /**
+     * @brief number of workers including the calling thread
+     */
+    size_t size() const { return workers_.size() + 1; }
+
+    /**
+     * @brief calls f(worker) for every worker in [0, size()) and returns
+     * once all of them are done, the caller runs worker 0 itself
+     * 
+     * concurrent callers take turns, a call from inside a job runs every
+     * worker index serially on the calling thread.
+     */
+    template<class F>
+    void run(F&& f){
+        run_job([](void* ctx, size_t worker){ (*(F*)ctx)(worker); }, (void*)&f);
+    }
+
+private:
+    void run_job(void (*fn)(void*, size_t), void* ctx);
+    void worker_loop(size_t id, int cpu);
+
+    std::vector<std::thread> workers_;
+
+    std::mutex job_lock_;           // one job at a time
+    std::mutex mutex_;
+    std::condition_variable wake_;
+    std::condition_variable done_;
+    void (*fn_)(void*, size_t) = nullptr;
+    void* ctx_ = nullptr;
+    uint64_t generation_ = 0;
+    size_t pending_ = 0;
+    bool stop_ = false;
+};
+
+/**
+ * @brief pool shared by all multi-threaded kernels, created on first use
+ * with SIMD_PLAYGROUND_THREADS (or one per CPU) workers
+ */
+thread_pool& shared_pool();
+
+/**
+ * @brief replaces the shared pool, 0 = one worker per CPU
+ */
+void resize_shared_pool(size_t threads);
+
+/**
+ * @brief part of [0, n) handled by one of `parts` workers
+ * 
+ * the inner boundaries are placed where base + boundary starts a 64 byte
+ * cache line, so no two workers write to the same line of base.
+ */
+void chunk_range(const float* base, size_t n, size_t parts, size_t part, size_t& begin, size_t& end);
+
+#endif
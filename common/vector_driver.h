@@ -0,0 +1,157 @@
+/**
+ * @file vector_driver.h
+ * @author Sravan Senthilnathan
+ * @brief elementwise float and double kernels shared by the per instruction set kernels
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2023
+ * 
+ * c = a op b and d = a * b + c, written once on the backends of simd_vec.h
+ * and instantiated per instruction set and element type. The n % W
+ * elements after the last whole vector (see simd_set_tail()) are:
+ * 
+ *   n > W:            the last W elements once more as one vector, which
+ *                     overlaps the previous one; computed before the loops
+ *                     so an output aliasing an input still reads it intact
+ *   n < W, masked V:  one masked load per input and a masked store
+ *   otherwise:        a scalar loop, through the backend's mul_add for T,
+ *                     which rounds like a lane of the vector one (fused or
+ *                     not)
+ * 
+ * so every way gives the same bits.
+ * 
+ * The 4x4 Tensor64 kernels are written out per instruction set like the
+ * float ones, the direct convolution is conv_driver.h on the same backends.
+ */
+#ifndef VECTOR_DRIVER_H
+#define VECTOR_DRIVER_H
+
+#include <cstddef>
+
+#include "simd_playground.h"
+#include "dispatch.h"
+
+enum class vec_op { add, sub, mul, div };
+
+template<class V, vec_op Op>
+typename V::reg vec_apply(typename V::reg a, typename V::reg b){
+    switch(Op){
+        case vec_op::add: return V::add(a, b);
+        case vec_op::sub: return V::sub(a, b);
+        case vec_op::mul: return V::mul(a, b);
+        default:          return V::div(a, b);
+    }
+}
+
+template<vec_op Op, class T>
+T vec_scalar_apply(T a, T b){
+    switch(Op){
+        case vec_op::add: return a + b;
+        case vec_op::sub: return a - b;
+        case vec_op::mul: return a * b;
+        default:          return a / b;
+    }
+}
+
+/**
+ * @brief c[i] = a[i] op b[i], c may alias a or b
+ */
+template<class V, vec_op Op, class T>
+void vec_binary(const T* a, const T* b, T* c, size_t n){
+    using reg = typename V::reg;
+
+    const size_t tail = n % V::W;
+    const bool vector_tail = tail != 0 && use_vector_tails();
+    const bool overlap = vector_tail && n > V::W;
+    reg last = V::zero();
+    if(overlap){
+        last = vec_apply<V, Op>(V::load(a + n - V::W), V::load(b + n - V::W));
+    }
+
+    size_t i = 0;
+    for(; i + 2 * V::W <= n; i += 2 * V::W){
+        const reg r0 = vec_apply<V, Op>(V::load(a + i), V::load(b + i));
+        const reg r1 = vec_apply<V, Op>(V::load(a + i + V::W), V::load(b + i + V::W));
+        V::store(c + i, r0);
+        V::store(c + i + V::W, r1);
+    }
+    for(; i + V::W <= n; i += V::W){
+        V::store(c + i, vec_apply<V, Op>(V::load(a + i), V::load(b + i)));
+    }
+    if(overlap){
+        V::store(c + n - V::W, last);
+        return;
+    }
+    if(vector_tail && V::masked){
+        V::store_partial(c, vec_apply<V, Op>(V::load_partial(a, n), V::load_partial(b, n)), n);
+        return;
+    }
+    for(; i < n; ++i){
+        c[i] = vec_scalar_apply<Op>(a[i], b[i]);
+    }
+}
+
+/**
+ * @brief d[i] = a[i] * b[i] + c[i], d may alias any input
+ */
+template<class V, class T>
+void vec_mul_add(const T* a, const T* b, const T* c, T* d, size_t n){
+    using reg = typename V::reg;
+
+    const size_t tail = n % V::W;
+    const bool vector_tail = tail != 0 && use_vector_tails();
+    const bool overlap = vector_tail && n > V::W;
+    reg last = V::zero();
+    if(overlap){
+        const size_t j = n - V::W;
+        last = V::mul_add(V::load(a + j), V::load(b + j), V::load(c + j));
+    }
+
+    size_t i = 0;
+    for(; i + 2 * V::W <= n; i += 2 * V::W){
+        const reg r0 = V::mul_add(V::load(a + i), V::load(b + i), V::load(c + i));
+        const reg r1 = V::mul_add(V::load(a + i + V::W), V::load(b + i + V::W), V::load(c + i + V::W));
+        V::store(d + i, r0);
+        V::store(d + i + V::W, r1);
+    }
+    for(; i + V::W <= n; i += V::W){
+        V::store(d + i, V::mul_add(V::load(a + i), V::load(b + i), V::load(c + i)));
+    }
+    if(overlap){
+        V::store(d + n - V::W, last);
+        return;
+    }
+    if(vector_tail && V::masked){
+        V::store_partial(d, V::mul_add(V::load_partial(a, n), V::load_partial(b, n), V::load_partial(c, n)), n);
+        return;
+    }
+    for(; i < n; ++i){
+        d[i] = V::mul_add(a[i], b[i], c[i]);
+    }
+}
+
+// the generic level, see simd_vec.h:
+void generic_add(const float* a, const float* b, float* c, size_t n);
+void generic_sub(const float* a, const float* b, float* c, size_t n);
+void generic_mul(const float* a, const float* b, float* c, size_t n);
+void generic_div(const float* a, const float* b, float* c, size_t n);
+void generic_mul_add(const float* a, const float* b, const float* c, float* d, size_t n);
+void generic_add(const double* a, const double* b, double* c, size_t n);
+void generic_sub(const double* a, const double* b, double* c, size_t n);
+void generic_mul(const double* a, const double* b, double* c, size_t n);
+void generic_div(const double* a, const double* b, double* c, size_t n);
+void generic_mul_add(const double* a, const double* b, const double* c, double* d, size_t n);
+
+#if defined(__aarch64__)
+void neon_add(const double* a, const double* b, double* c, size_t n);
+void neon_sub(const double* a, const double* b, double* c, size_t n);
+void neon_mul(const double* a, const double* b, double* c, size_t n);
+void neon_div(const double* a, const double* b, double* c, size_t n);
+void neon_mul_add(const double* a, const double* b, const double* c, double* d, size_t n);
+void neon_add(const Tensor64 a, const Tensor64 b, Tensor64 &c);
+void neon_sub(const Tensor64 a, const Tensor64 b, Tensor64 &c);
+void neon_mul(const Tensor64 a, const Tensor64 b, Tensor64 &c);
+#endif
+
+#endif
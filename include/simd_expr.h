@@ -0,0 +1,241 @@
+/**
+ * @file simd_expr.h
+ * @author Sravan Senthilnathan
+ * @brief lazy elementwise expressions over float arrays, fused into one pass
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2023
+ * 
+ * Chaining simd_mul, simd_add and simd_sub over whole arrays makes one pass
+ * over memory per operation and needs full length temporaries. Here the
+ * operators only build an expression tree (in its type, nothing is
+ * computed), and assigning it to a simd_dest evaluates the whole tree in
+ * one pass:
+ * 
+ *   simd_dest(d, n) = simd_ref(a) * simd_ref(b) + simd_ref(c) - simd_ref(e);
+ * 
+ * The arrays are walked in blocks of simd_expr_block elements. Every node
+ * runs its dispatched simd_* kernel over the block, with intermediates in a
+ * stack buffer that stays in L1, so every input is read from memory once
+ * and the output written once, and the kernels keep their runtime
+ * dispatch. x * y + z (in either order) is contracted into simd_mul_add(),
+ * one FMA where the CPU has it.
+ * 
+ * All operands must have at least n elements. The destination may be one
+ * of the inputs (d = d * b + c), partially overlapping ranges are not
+ * supported.
+ */
+#ifndef SIMD_EXPR_H
+#define SIMD_EXPR_H
+
+#include <algorithm>
+#include <cstddef>
+#include <type_traits>
+
+#include "simd_playground.h"
+
+// elements per block and intermediate, 2 KB:
+constexpr size_t simd_expr_block = 512;
+
+/**
+ * @brief base of every expression node, what the operators look for
+ * 
+ * a node N has the number of block sized intermediates it needs (temps)
+ * and
+ * 
+ *   const float* eval(size_t i, size_t len, float* scratch) const;
+ *   void store(size_t i, size_t len, float* scratch, float* dst) const;
+ * 
+ * returning, or writing to dst, the elements [i, i + len) of its value,
+ * using scratch[0, N::temps * simd_expr_block) for intermediates.
+ */
+struct simd_expr_base {};
+
+template<class T>
+using simd_is_expr = std::is_base_of<simd_expr_base, T>;
+
+/**
+ * @brief an input array
+ */
+struct simd_ref_expr : simd_expr_base {
+    static constexpr size_t temps = 0;
+    const float* p;
+
+    explicit simd_ref_expr(const float* p) : p(p) {}
+
+    const float* eval(size_t i, size_t, float*) const { return p + i; }
+    void store(size_t i, size_t len, float*, float* dst) const {
+        if(dst != p + i){
+            std::copy(p + i, p + i + len, dst);
+        }
+    }
+};
+
+/**
+ * @brief a float broadcast to every element
+ */
+struct simd_scalar_expr : simd_expr_base {
+    static constexpr size_t temps = 1;
+    float v;
+
+    explicit simd_scalar_expr(float v) : v(v) {}
+
+    const float* eval(size_t i, size_t len, float* scratch) const {
+        store(i, len, scratch, scratch);
+        return scratch;
+    }
+    void store(size_t, size_t len, float*, float* dst) const { std::fill(dst, dst + len, v); }
+};
+
+struct simd_op_add { static void apply(const float* a, const float* b, float* c, size_t n) { simd_add(a, b, c, n); } };
+struct simd_op_sub { static void apply(const float* a, const float* b, float* c, size_t n) { simd_sub(a, b, c, n); } };
+struct simd_op_mul { static void apply(const float* a, const float* b, float* c, size_t n) { simd_mul(a, b, c, n); } };
+struct simd_op_div { static void apply(const float* a, const float* b, float* c, size_t n) { simd_div(a, b, c, n); } };
+
+/**
+ * @brief l op r
+ */
+template<class Op, class L, class R>
+struct simd_binary_expr : simd_expr_base {
+    static constexpr size_t temps = L::temps + R::temps + 1;
+    L l;
+    R r;
+
+    simd_binary_expr(const L& l, const R& r) : l(l), r(r) {}
+
+    const float* eval(size_t i, size_t len, float* scratch) const {
+        float* dst = scratch + (L::temps + R::temps) * simd_expr_block;
+        store(i, len, scratch, dst);
+        return dst;
+    }
+    void store(size_t i, size_t len, float* scratch, float* dst) const {
+        const float* a = l.eval(i, len, scratch);
+        const float* b = r.eval(i, len, scratch + L::temps * simd_expr_block);
+        Op::apply(a, b, dst, len);
+    }
+};
+
+/**
+ * @brief a * b + c, see simd_mul_add()
+ */
+template<class A, class B, class C>
+struct simd_mul_add_expr : simd_expr_base {
+    static constexpr size_t temps = A::temps + B::temps + C::temps + 1;
+    A a;
+    B b;
+    C c;
+
+    simd_mul_add_expr(const A& a, const B& b, const C& c) : a(a), b(b), c(c) {}
+
+    const float* eval(size_t i, size_t len, float* scratch) const {
+        float* dst = scratch + (A::temps + B::temps + C::temps) * simd_expr_block;
+        store(i, len, scratch, dst);
+        return dst;
+    }
+    void store(size_t i, size_t len, float* scratch, float* dst) const {
+        const float* x = a.eval(i, len, scratch);
+        const float* y = b.eval(i, len, scratch + A::temps * simd_expr_block);
+        const float* z = c.eval(i, len, scratch + (A::temps + B::temps) * simd_expr_block);
+        simd_mul_add(x, y, z, dst, len);
+    }
+};
+
+/**
+ * @brief lazy view of an input array
+ */
+inline simd_ref_expr simd_ref(const float* p){
+    return simd_ref_expr(p);
+}
+
+/**
+ * @brief evaluates e into out[0, n) in one blocked pass
+ */
+template<class E>
+void simd_eval(float* out, size_t n, const E& e){
+    static_assert(simd_is_expr<E>::value, "simd_eval needs an expression");
+    alignas(64) float scratch[(E::temps > 0 ? E::temps : 1) * simd_expr_block];
+
+    for(size_t i = 0; i < n; i += simd_expr_block){
+        const size_t len = std::min(simd_expr_block, n - i);
+        e.store(i, len, scratch, out + i);
+    }
+}
+
+/**
+ * @brief output array, evaluates an expression when assigned one
+ */
+struct simd_dest {
+    float* p;
+    size_t n;
+
+    simd_dest(float* p, size_t n) : p(p), n(n) {}
+
+    template<class E, class = std::enable_if_t<simd_is_expr<E>::value>>
+    simd_dest& operator=(const E& e){
+        simd_eval(p, n, e);
+        return *this;
+    }
+};
+
+/* -------------------------------- operators --------------------------------- */
+
+// expressions stay as they are, numbers become broadcasts:
+template<class T>
+using simd_expr_t = std::conditional_t<simd_is_expr<T>::value, T, simd_scalar_expr>;
+
+inline simd_scalar_expr simd_expr_wrap(float v){ return simd_scalar_expr(v); }
+
+template<class E, class = std::enable_if_t<simd_is_expr<E>::value>>
+const E& simd_expr_wrap(const E& e){ return e; }
+
+// at least one side an expression, the other an expression or a number:
+template<class L, class R>
+using simd_expr_operands = std::enable_if_t<
+    (simd_is_expr<L>::value || simd_is_expr<R>::value) &&
+    (simd_is_expr<L>::value || std::is_arithmetic<L>::value) &&
+    (simd_is_expr<R>::value || std::is_arithmetic<R>::value)>;
+
+// x + y, with products on either side contracted into a multiply-add:
+template<class L, class R>
+simd_binary_expr<simd_op_add, L, R> simd_make_add(const L& l, const R& r){
+    return simd_binary_expr<simd_op_add, L, R>(l, r);
+}
+
+template<class A, class B, class R>
+simd_mul_add_expr<A, B, R> simd_make_add(const simd_binary_expr<simd_op_mul, A, B>& l, const R& r){
+    return simd_mul_add_expr<A, B, R>(l.l, l.r, r);
+}
+
+template<class L, class A, class B>
+simd_mul_add_expr<A, B, L> simd_make_add(const L& l, const simd_binary_expr<simd_op_mul, A, B>& r){
+    return simd_mul_add_expr<A, B, L>(r.l, r.r, l);
+}
+
+template<class A, class B, class C, class D>
+simd_mul_add_expr<A, B, simd_binary_expr<simd_op_mul, C, D>>
+simd_make_add(const simd_binary_expr<simd_op_mul, A, B>& l, const simd_binary_expr<simd_op_mul, C, D>& r){
+    return simd_mul_add_expr<A, B, simd_binary_expr<simd_op_mul, C, D>>(l.l, l.r, r);
+}
+
+template<class L, class R, class = simd_expr_operands<L, R>>
+auto operator+(const L& l, const R& r){
+    return simd_make_add(simd_expr_wrap(l), simd_expr_wrap(r));
+}
+
+template<class L, class R, class = simd_expr_operands<L, R>>
+simd_binary_expr<simd_op_sub, simd_expr_t<L>, simd_expr_t<R>> operator-(const L& l, const R& r){
+    return simd_binary_expr<simd_op_sub, simd_expr_t<L>, simd_expr_t<R>>(simd_expr_wrap(l), simd_expr_wrap(r));
+}
+
+template<class L, class R, class = simd_expr_operands<L, R>>
+simd_binary_expr<simd_op_mul, simd_expr_t<L>, simd_expr_t<R>> operator*(const L& l, const R& r){
+    return simd_binary_expr<simd_op_mul, simd_expr_t<L>, simd_expr_t<R>>(simd_expr_wrap(l), simd_expr_wrap(r));
+}
+
+template<class L, class R, class = simd_expr_operands<L, R>>
+simd_binary_expr<simd_op_div, simd_expr_t<L>, simd_expr_t<R>> operator/(const L& l, const R& r){
+    return simd_binary_expr<simd_op_div, simd_expr_t<L>, simd_expr_t<R>>(simd_expr_wrap(l), simd_expr_wrap(r));
+}
+
+#endif
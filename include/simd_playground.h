@@ -0,0 +1,1675 @@
+/**
+ * @file simd_playground.h
+ * @author Sravan Senthilnathan
+ * @brief public interface of libsimdplayground
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2023
+ * 
+ * Declares the scalar reference kernels and the SIMD kernels for the
+ * architecture the library was built for (AVX on x86, NEON on arm64).
+ * 
+ * The simd_* entry points pick the best implementation for the running CPU
+ * at startup, the arch specific kernels can be called directly as well.
+ * 
+ * Array kernels take non-owning views (pointer + element count). Unless
+ * noted otherwise an output may alias an input exactly for in-place
+ * operation, partially overlapping ranges are not supported.
+ */
+#ifndef SIMD_PLAYGROUND_H
+#define SIMD_PLAYGROUND_H
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// implicit Tensor Declaration:
+using Tensor = float[4][4];
+
+// double precision Tensor:
+using Tensor64 = double[4][4];
+
+/* ------------------------- scalar reference kernels ------------------------- */
+
+/**
+ * @brief Standard Vector Addition function:
+ * 
+ * @param a first operand array
+ * @param b second operand array
+ * @param c output array
+ * @param n number of elements
+ */
+void add(const float* a, const float* b, float* c, size_t n);
+
+/**
+ * @brief Standard Vector Subtraction function:
+ * 
+ * @param a first operand array
+ * @param b second operand array
+ * @param c output array
+ * @param n number of elements
+ */
+void sub(const float* a, const float* b, float* c, size_t n);
+
+/**
+ * @brief Standard Vector Multiply function:
+ * 
+ * @param a first operand array
+ * @param b second operand array
+ * @param c output array
+ * @param n number of elements
+ */
+void mul(const float* a, const float* b, float* c, size_t n);
+
+/**
+ * @brief Standard Vector Multiply-Add function, d = a * b + c:
+ * 
+ * @param a first factor array
+ * @param b second factor array
+ * @param c addend array
+ * @param d output array
+ * @param n number of elements
+ */
+void mul_add(const float* a, const float* b, const float* c, float* d, size_t n);
+
+/**
+ * @brief Standard Vector Division function:
+ * 
+ * @param a first operand array
+ * @param b second operand array
+ * @param c output array
+ * @param n number of elements
+ */
+void div(const float* a, const float* b, float* c, size_t n);
+
+/**
+ * @brief Standard Vector Sum, sequential:
+ * 
+ * @param a operand array
+ * @param n number of elements
+ * @return a[0] + a[1] + ... + a[n - 1]
+ */
+float sum(const float* a, size_t n);
+
+/**
+ * @brief Standard Dot Product, sequential:
+ * 
+ * @param a first operand array
+ * @param b second operand array
+ * @param n number of elements
+ * @return a[0] * b[0] + ... + a[n - 1] * b[n - 1]
+ */
+float dot(const float* a, const float* b, size_t n);
+
+/**
+ * @brief Standard Euclidean Norm:
+ * 
+ * @param a operand array
+ * @param n number of elements
+ * @return sqrt(a[0]^2 + ... + a[n - 1]^2)
+ */
+float norm2(const float* a, size_t n);
+
+/**
+ * @brief Standard Vector Minimum, NaNs skipped:
+ * 
+ * @param a operand array
+ * @param n number of elements
+ * @return smallest number in a, +inf if there is none
+ */
+float minimum(const float* a, size_t n);
+
+/**
+ * @brief Standard Vector Maximum, NaNs skipped:
+ * 
+ * @param a operand array
+ * @param n number of elements
+ * @return largest number in a, -inf if there is none
+ */
+float maximum(const float* a, size_t n);
+
+/**
+ * @brief Standard Vector Argmin, NaNs skipped:
+ * 
+ * @param a operand array
+ * @param n number of elements
+ * @return index of the first smallest number, n if there is none
+ */
+size_t argmin(const float* a, size_t n);
+
+/**
+ * @brief Standard Vector Argmax, NaNs skipped:
+ * 
+ * @param a operand array
+ * @param n number of elements
+ * @return index of the first largest number, n if there is none
+ */
+size_t argmax(const float* a, size_t n);
+
+/**
+ * @brief 16 bit storage formats of the *_half kernels, both widened to
+ * float for arithmetic:
+ * 
+ * fp16: IEEE binary16, 5 exponent and 10 mantissa bits (up to 65504)
+ * bf16: bfloat16, the upper half of a float, 8 exponent and 7 mantissa bits
+ */
+enum class simd_half_format {
+    fp16,
+    bf16
+};
+
+/**
+ * @brief Standard half to float conversion, exact
+ * 
+ * @param h 16 bit value
+ * @param format format of h
+ * @return h as a float
+ */
+float half_to_float(uint16_t h, simd_half_format format);
+
+/**
+ * @brief Standard float to half conversion, rounded to nearest even
+ * (overflowing to inf, NaNs stay quiet NaNs):
+ * 
+ * @param a float value
+ * @param format format of the result
+ * @return a as a 16 bit value
+ */
+uint16_t float_to_half(float a, simd_half_format format);
+
+/**
+ * @brief what the integer kernels do with results outside their type:
+ * 
+ * wrap:     keep the low bits, two's complement like the C++ types do
+ * saturate: clamp to the smallest or largest value of the type
+ */
+enum class simd_overflow {
+    wrap,
+    saturate
+};
+
+/**
+ * @brief Standard integer Vector Addition function, int8, uint8, int16 and int32:
+ * 
+ * @param a first operand array
+ * @param b second operand array
+ * @param c output array
+ * @param n number of elements
+ * @param overflow whether sums out of range wrap or saturate
+ */
+void add(const int8_t* a, const int8_t* b, int8_t* c, size_t n, simd_overflow overflow = simd_overflow::wrap);
+void add(const uint8_t* a, const uint8_t* b, uint8_t* c, size_t n, simd_overflow overflow = simd_overflow::wrap);
+void add(const int16_t* a, const int16_t* b, int16_t* c, size_t n, simd_overflow overflow = simd_overflow::wrap);
+void add(const int32_t* a, const int32_t* b, int32_t* c, size_t n, simd_overflow overflow = simd_overflow::wrap);
+
+/**
+ * @brief Standard integer Vector Subtraction function, see the integer add()
+ */
+void sub(const int8_t* a, const int8_t* b, int8_t* c, size_t n, simd_overflow overflow = simd_overflow::wrap);
+void sub(const uint8_t* a, const uint8_t* b, uint8_t* c, size_t n, simd_overflow overflow = simd_overflow::wrap);
+void sub(const int16_t* a, const int16_t* b, int16_t* c, size_t n, simd_overflow overflow = simd_overflow::wrap);
+void sub(const int32_t* a, const int32_t* b, int32_t* c, size_t n, simd_overflow overflow = simd_overflow::wrap);
+
+/**
+ * @brief Standard integer Vector Multiply function (the product in the
+ * operand type, not widened), see the integer add()
+ */
+void mul(const int8_t* a, const int8_t* b, int8_t* c, size_t n, simd_overflow overflow = simd_overflow::wrap);
+void mul(const uint8_t* a, const uint8_t* b, uint8_t* c, size_t n, simd_overflow overflow = simd_overflow::wrap);
+void mul(const int16_t* a, const int16_t* b, int16_t* c, size_t n, simd_overflow overflow = simd_overflow::wrap);
+void mul(const int32_t* a, const int32_t* b, int32_t* c, size_t n, simd_overflow overflow = simd_overflow::wrap);
+
+/**
+ * @brief Standard 8 bit Dot Product, exact (unsigned activations times
+ * signed weights, or both signed):
+ * 
+ * @param a first operand array
+ * @param b second operand array
+ * @param n number of elements
+ * @return a[0] * b[0] + ... + a[n - 1] * b[n - 1]
+ */
+int64_t dot(const uint8_t* a, const int8_t* b, size_t n);
+int64_t dot(const int8_t* a, const int8_t* b, size_t n);
+
+/**
+ * @brief per tensor quantization of 8 bit data, the value of q is
+ * scale * (q - zero_point)
+ */
+struct simd_quant {
+    float scale;
+    int32_t zero_point;
+};
+
+/**
+ * @brief Standard requantization of an int32 accumulator: acc * multiplier
+ * in float, rounded to nearest even, plus zero_point, clamped to 0..255
+ */
+uint8_t requantize(int32_t acc, float multiplier, int32_t zero_point);
+
+/**
+ * @brief Standard quantized convolution, uint8 signal and int8 filter
+ * accumulated exactly in int32 and requantized to uint8:
+ * 
+ * y[n] = requantize(sum (x[k] - xq.zero_point) * (h[n - k] - hq.zero_point),
+ *                   xq.scale * hq.scale / yq.scale, yq.zero_point)
+ * 
+ * @param x discrete time input signal
+ * @param l1 length of x
+ * @param xq quantization of x
+ * @param h discrete impulse response
+ * @param l2 length of h; the shorter of l1 and l2 at most 33025, which
+ * keeps the int32 accumulator exact
+ * @param hq quantization of h
+ * @param y convoluted response, l1 + l2 - 1 elements (overwritten)
+ * @param yq quantization of y
+ */
+void conv_quant(const uint8_t* x, size_t l1, simd_quant xq, const int8_t* h, size_t l2, simd_quant hq,
+                uint8_t* y, simd_quant yq);
+
+/**
+ * @brief Standard Tensor Addition function:
+ * 
+ * @param a first operand tensor
+ * @param b second operand tensor
+ * @param c output tensor
+ */
+void add(const Tensor a, const Tensor b, Tensor &c);
+
+/**
+ * @brief Standard Tensor Subtraction function:
+ * 
+ * @param a first operand tensor
+ * @param b second operand tensor
+ * @param c output tensor
+ */
+void sub(const Tensor a, const Tensor b, Tensor &c);
+
+/**
+ * @brief Standard Tensor Multiplication function:
+ * 
+ * @param a first operand tensor
+ * @param b second operand tensor
+ * @param c output tensor, must not alias a or b
+ */
+void mul(const Tensor a, const Tensor b, Tensor &c);
+
+/**
+ * @brief normal function to compute the convolution of a given discrete time signal
+ * 
+ * @param x discrete time input signal
+ * @param l1 length of x
+ * @param h discrete impulse response
+ * @param l2 length of h
+ * @param y convoluted response, l1 + l2 - 1 zero initialised elements
+ */
+void conv(const float* x, size_t l1, const float* h, size_t l2, float* y);
+
+/**
+ * @brief Standard double precision Vector Addition, Subtraction, Multiply
+ * and Division functions, see the float add()
+ * 
+ * @param a first operand array
+ * @param b second operand array
+ * @param c output array
+ * @param n number of elements
+ */
+void add(const double* a, const double* b, double* c, size_t n);
+void sub(const double* a, const double* b, double* c, size_t n);
+void mul(const double* a, const double* b, double* c, size_t n);
+void div(const double* a, const double* b, double* c, size_t n);
+
+/**
+ * @brief Standard double precision Vector Multiply-Add function, d = a * b + c
+ * 
+ * @param a first factor array
+ * @param b second factor array
+ * @param c addend array
+ * @param d output array
+ * @param n number of elements
+ */
+void mul_add(const double* a, const double* b, const double* c, double* d, size_t n);
+
+/**
+ * @brief Standard double precision Tensor Addition, Subtraction and
+ * Multiplication functions, see the float ones
+ * 
+ * @param a first operand tensor
+ * @param b second operand tensor
+ * @param c output tensor, must not alias a or b for mul()
+ */
+void add(const Tensor64 a, const Tensor64 b, Tensor64 &c);
+void sub(const Tensor64 a, const Tensor64 b, Tensor64 &c);
+void mul(const Tensor64 a, const Tensor64 b, Tensor64 &c);
+
+/**
+ * @brief Standard double precision convolution, see the float conv()
+ * 
+ * @param x discrete time input signal
+ * @param l1 length of x
+ * @param h discrete impulse response
+ * @param l2 length of h
+ * @param y convoluted response, l1 + l2 - 1 zero initialised elements
+ */
+void conv(const double* x, size_t l1, const double* h, size_t l2, double* y);
+
+/**
+ * @brief Standard batched Tensor Multiplication, c[m] = a[m] * b[m]
+ * 
+ * @param a first operand tensors
+ * @param b second operand tensors
+ * @param c output tensors, must not overlap a or b
+ * @param count number of tensors
+ */
+void mul_batch(const Tensor* a, const Tensor* b, Tensor* c, size_t count);
+
+/**
+ * @brief Standard batched Tensor Multiplication on structure-of-arrays
+ * operands: 16 planes of one element each, element (i, j) of tensor m is at
+ * p[(4 * i + j) * stride + m]
+ * 
+ * @param a first operand planes
+ * @param b second operand planes
+ * @param c output planes, must not overlap a or b
+ * @param count number of tensors
+ * @param stride distance between the planes in elements, at least count;
+ * avoid multiples of 1024 (4 KiB), planes that far apart share cache sets
+ */
+void mul_batch_soa(const float* a, const float* b, float* c, size_t count, size_t stride);
+
+/**
+ * @brief Standard single precision matrix multiply,
+ * C = alpha * op(A) * op(B) + beta * C on row-major matrices
+ * 
+ * @param trans_a use A transposed, op(A) = A^T
+ * @param trans_b use B transposed, op(B) = B^T
+ * @param m rows of op(A) and C
+ * @param n columns of op(B) and C
+ * @param k columns of op(A), rows of op(B)
+ * @param alpha scale of the product
+ * @param a A, m x k (k x m when transposed)
+ * @param lda distance between the rows of A in elements
+ * @param b B, k x n (n x k when transposed)
+ * @param ldb distance between the rows of B in elements
+ * @param beta scale of the previous C, 0 overwrites C without reading it
+ * @param c C, m x n, must not overlap A or B
+ * @param ldc distance between the rows of C in elements
+ */
+void sgemm(bool trans_a, bool trans_b, size_t m, size_t n, size_t k,
+           float alpha, const float* a, size_t lda, const float* b, size_t ldb,
+           float beta, float* c, size_t ldc);
+
+/* ----------------------------- runtime dispatch ----------------------------- */
+
+/**
+ * @brief instruction set levels the dispatcher can route to, every x86 level
+ * includes the ones before it (avx2 means AVX2 + FMA, avx512 means F/VL/BW/DQ)
+ * 
+ * generic runs the kernels written on the portable vector types with plain
+ * C++ lanes shaped like NEON ones, on any CPU: the NEON code paths, built
+ * and checked on x86. It is a testing level, not tuned for speed.
+ */
+enum class simd_isa { scalar, generic, sse, avx, avx2, avx512, neon };
+
+/**
+ * @brief best instruction set level supported by this CPU and OS
+ */
+simd_isa simd_detected_isa();
+
+/**
+ * @brief instruction set level the simd_* kernels currently route to
+ * 
+ * it defaults to simd_detected_isa() and can be lowered with the
+ * SIMD_PLAYGROUND_ISA environment variable (scalar, generic, sse, avx, avx2, avx512,
+ * neon).
+ */
+simd_isa simd_active_isa();
+
+/**
+ * @brief routes the simd_* kernels to the given level
+ * 
+ * @param isa requested level
+ * @return false (and nothing changes) if the CPU does not support it
+ */
+bool simd_set_isa(simd_isa isa);
+
+/**
+ * @brief printable name of a level, e.g. "avx2"
+ */
+const char* simd_isa_name(simd_isa isa);
+
+/**
+ * @brief size of the last level cache in bytes as the OS reports it, 8 MB
+ * when it does not
+ */
+size_t simd_llc_size();
+
+/**
+ * @brief element count from which simd_add/sub/mul/div (and their
+ * simd_parallel_* versions) write the output with non-temporal stores
+ * 
+ * streaming stores skip the read of every output line (write-allocate) and
+ * leave the cache to the data around the call, but the output is then not
+ * cached for whoever reads it next. The default is where a, b and c
+ * together take more than half of simd_llc_size(); 0 streams always,
+ * SIZE_MAX never.
+ */
+void simd_set_streaming_threshold(size_t n);
+
+/**
+ * @brief see simd_set_streaming_threshold()
+ */
+size_t simd_streaming_threshold();
+
+/**
+ * @brief how the vector kernels finish the elements after their last whole vector
+ * 
+ * vector: from W elements on, the last W are computed once more as a whole
+ * vector overlapping the ones before (computed up front, so outputs that
+ * alias an input still see it unchanged); below W, levels with masked
+ * loads and stores (avx, avx2, avx512) use one masked vector and the
+ * others a scalar loop. scalar: always a scalar loop, the way to compare.
+ * Both give the same bits, except for the fast mode sum and dot product,
+ * whose masked tail adds its elements in another order.
+ */
+enum class simd_tail { vector, scalar };
+
+/**
+ * @brief selects the tail handling of the elementwise, multiply-add, direct
+ * convolution and fast mode sum/dot kernels, simd_tail::vector by default
+ */
+void simd_set_tail(simd_tail tail);
+
+/**
+ * @brief see simd_set_tail()
+ */
+simd_tail simd_tail_handling();
+
+/**
+ * @brief dispatched Vector Addition function, see add()
+ */
+void simd_add(const float* a, const float* b, float* c, size_t n);
+
+/**
+ * @brief dispatched Vector Subtraction function, see sub()
+ */
+void simd_sub(const float* a, const float* b, float* c, size_t n);
+
+/**
+ * @brief dispatched Vector Multiply function, see mul()
+ */
+void simd_mul(const float* a, const float* b, float* c, size_t n);
+
+/**
+ * @brief dispatched Vector Division function, see div()
+ */
+void simd_div(const float* a, const float* b, float* c, size_t n);
+
+/**
+ * @brief dispatched Vector Multiply-Add function, see mul_add(); a single
+ * rounding (FMA) from AVX2 and on NEON, d may alias any input
+ */
+void simd_mul_add(const float* a, const float* b, const float* c, float* d, size_t n);
+
+/**
+ * @brief dispatched Tensor Addition function, see add()
+ */
+void simd_add(const Tensor a, const Tensor b, Tensor &c);
+
+/**
+ * @brief dispatched Tensor Subtraction function, see sub()
+ */
+void simd_sub(const Tensor a, const Tensor b, Tensor &c);
+
+/**
+ * @brief dispatched Tensor Multiplication function, see mul()
+ */
+void simd_mul(const Tensor a, const Tensor b, Tensor &c);
+
+/**
+ * @brief how the sums of simd_sum(), simd_dot() and simd_norm2() accumulate
+ * 
+ * fast:        independent vector accumulators, error grows with n / lanes
+ * pairwise:    the fast loop on blocks of 1024, the block sums added
+ *              pairwise; a little slower, error grows with log n
+ * compensated: every rounding error is recovered (TwoSum/TwoProduct) and
+ *              added back, as accurate as summing in double precision;
+ *              about 2-4x the work of fast
+ * 
+ * none of them sums in the order of sum()/dot(), so results differ from
+ * the sequential references in the last bits (fast and pairwise also
+ * between instruction set levels).
+ */
+enum class simd_sum_mode {
+    fast,
+    pairwise,
+    compensated
+};
+
+/**
+ * @brief dispatched Vector Sum, see sum()
+ */
+float simd_sum(const float* a, size_t n, simd_sum_mode mode = simd_sum_mode::fast);
+
+/**
+ * @brief dispatched Dot Product, see dot()
+ */
+float simd_dot(const float* a, const float* b, size_t n, simd_sum_mode mode = simd_sum_mode::fast);
+
+/**
+ * @brief dispatched Euclidean Norm, see norm2(); rescaled when the sum of
+ * squares would overflow or underflow
+ */
+float simd_norm2(const float* a, size_t n, simd_sum_mode mode = simd_sum_mode::fast);
+
+/**
+ * @brief dispatched Vector Minimum, see minimum()
+ */
+float simd_minimum(const float* a, size_t n);
+
+/**
+ * @brief dispatched Vector Maximum, see maximum()
+ */
+float simd_maximum(const float* a, size_t n);
+
+/**
+ * @brief dispatched Vector Argmin, see argmin()
+ */
+size_t simd_argmin(const float* a, size_t n);
+
+/**
+ * @brief dispatched Vector Argmax, see argmax()
+ */
+size_t simd_argmax(const float* a, size_t n);
+
+/**
+ * @brief accuracy of the elementwise math functions (simd_exp() ...)
+ * 
+ * precise: within the ulp bound given on each function of the correctly
+ *          rounded result, for every float input (subnormals, infinities
+ *          and NaNs included)
+ * fast:    shorter polynomials and less range handling; on the normal
+ *          range a relative error up to 5.5e-6 (exp, sigmoid), 1.3e-5
+ *          (log) and 1.8e-5 * max(1, |y log x|) (pow), an absolute error
+ *          up to 1.4e-6 (sin, cos) and 2.9e-6 (tanh, erf); exp() results
+ *          below FLT_MIN are flushed to zero and from x = 88.376 on
+ *          overflow, sin() and cos() are only meant for |x| <= 8192
+ * 
+ * the bounds were measured on every 13th float (on random inputs for
+ * pow) against the C library in double precision. The scalar level is
+ * that reference, whatever the mode.
+ */
+enum class simd_math_mode {
+    precise,
+    fast
+};
+
+/**
+ * @brief b[i] = e^a[i]; precise: at most 1 ulp, b may alias a
+ */
+void simd_exp(const float* a, float* b, size_t n, simd_math_mode mode = simd_math_mode::precise);
+
+/**
+ * @brief b[i] = log a[i], the natural logarithm; precise: at most 1 ulp
+ */
+void simd_log(const float* a, float* b, size_t n, simd_math_mode mode = simd_math_mode::precise);
+
+/**
+ * @brief b[i] = sin a[i]; precise: at most 2 ulp, beyond |a| = 8192
+ * through the C library
+ */
+void simd_sin(const float* a, float* b, size_t n, simd_math_mode mode = simd_math_mode::precise);
+
+/**
+ * @brief b[i] = cos a[i], see simd_sin(); precise: at most 2 ulp
+ */
+void simd_cos(const float* a, float* b, size_t n, simd_math_mode mode = simd_math_mode::precise);
+
+/**
+ * @brief b[i] = tanh a[i]; precise: at most 1 ulp
+ */
+void simd_tanh(const float* a, float* b, size_t n, simd_math_mode mode = simd_math_mode::precise);
+
+/**
+ * @brief b[i] = 1 / (1 + e^-a[i]); precise: at most 3 ulp
+ */
+void simd_sigmoid(const float* a, float* b, size_t n, simd_math_mode mode = simd_math_mode::precise);
+
+/**
+ * @brief b[i] = erf a[i]; precise: at most 2 ulp
+ */
+void simd_erf(const float* a, float* b, size_t n, simd_math_mode mode = simd_math_mode::precise);
+
+/**
+ * @brief c[i] = a[i]^b[i] with the special cases of C99 pow(); precise: at
+ * most 1 ulp (computed in double precision), c may alias a or b
+ */
+void simd_pow(const float* a, const float* b, float* c, size_t n, simd_math_mode mode = simd_math_mode::precise);
+
+/**
+ * @brief how simd_div(), simd_sqrt() and simd_rsqrt() divide
+ * 
+ * exact:   the divide and square root instructions, correctly rounded
+ *          (rsqrt as 1 / sqrt, within 1 ulp)
+ * newton2: the reciprocal (square root) estimate instruction refined by
+ *          two Newton-Raphson steps and multiplied out: within 3 ulp
+ * newton1: the same with one step: within 3 ulp on the 12 and 14 bit
+ *          estimates of x86, a relative error up to 2.3e-5 on the 8 bit
+ *          ones of NEON (and the generic level)
+ * 
+ * the estimates cover the normal range only; zeros, infinities,
+ * subnormals, divisors beyond 2^125 and negative square roots are
+ * computed as in the exact mode. The bounds were measured against
+ * double precision on every 13th float (random quotients for the
+ * division). The scalar level is exact whatever the mode.
+ */
+enum class simd_div_mode {
+    exact,
+    newton2,
+    newton1
+};
+
+/**
+ * @brief dispatched Vector Division in the given mode, see simd_div_mode;
+ * c may alias a or b
+ */
+void simd_div(const float* a, const float* b, float* c, size_t n, simd_div_mode mode);
+
+/**
+ * @brief b[i] = sqrt(a[i]), see simd_div_mode; b may alias a
+ */
+void simd_sqrt(const float* a, float* b, size_t n, simd_div_mode mode = simd_div_mode::exact);
+
+/**
+ * @brief b[i] = 1 / sqrt(a[i]), see simd_div_mode; b may alias a
+ */
+void simd_rsqrt(const float* a, float* b, size_t n, simd_div_mode mode = simd_div_mode::exact);
+
+/**
+ * @brief softmax of every row of a row-major rows x cols batch:
+ * y = e^(x - max) / sum of e^(x - max) over the row
+ * 
+ * the fused kernels below read a row once from memory and keep it in
+ * cache for their remaining passes; y may alias x. Rows holding +inf, a
+ * NaN or only -inf come out NaN.
+ */
+void simd_softmax(const float* x, float* y, size_t rows, size_t cols);
+
+/**
+ * @brief log of simd_softmax(), computed as (x - max) - log(sum of
+ * e^(x - max)) so it does not underflow
+ */
+void simd_log_softmax(const float* x, float* y, size_t rows, size_t cols);
+
+/**
+ * @brief layer normalization of every row:
+ * y = (x - mean) / sqrt(var + eps) * gamma + beta, the mean and (biased)
+ * variance taken over the row, gamma and beta one per column
+ */
+void simd_layer_norm(const float* x, const float* gamma, const float* beta, float* y,
+                     size_t rows, size_t cols, float eps = 1e-5f);
+
+/**
+ * @brief RMS normalization of every row:
+ * y = x / sqrt(mean of x^2 + eps) * gamma, gamma one per column
+ */
+void simd_rms_norm(const float* x, const float* gamma, float* y, size_t rows, size_t cols, float eps = 1e-6f);
+
+/**
+ * @brief activation of simd_bias_activation()
+ * 
+ * relu:      max(0, a), NaNs stay NaN
+ * gelu:      a / 2 (1 + erf(a / sqrt(2)))
+ * gelu_tanh: a / 2 (1 + tanh(sqrt(2 / pi) (a + 0.044715 a^3))), the
+ *            approximation some models are trained with
+ */
+enum class simd_activation {
+    relu,
+    gelu,
+    gelu_tanh
+};
+
+/**
+ * @brief y = act(x + bias) on every row, bias one per column, in a single
+ * pass; y may alias x
+ */
+void simd_bias_activation(const float* x, const float* bias, float* y, size_t rows, size_t cols,
+                          simd_activation act);
+
+/**
+ * @brief dispatched float to half conversion of n elements, see float_to_half()
+ */
+void simd_to_half(const float* a, uint16_t* h, size_t n, simd_half_format format);
+
+/**
+ * @brief dispatched half to float conversion of n elements, see half_to_float()
+ */
+void simd_from_half(const uint16_t* h, float* a, size_t n, simd_half_format format);
+
+/**
+ * @brief Vector Addition on half storage: c = a + b computed in float,
+ * rounded once to the format (c may alias a or b)
+ */
+void simd_add_half(const uint16_t* a, const uint16_t* b, uint16_t* c, size_t n, simd_half_format format);
+
+/**
+ * @brief Vector Multiply on half storage, see simd_add_half()
+ */
+void simd_mul_half(const uint16_t* a, const uint16_t* b, uint16_t* c, size_t n, simd_half_format format);
+
+/**
+ * @brief Dot Product of half operands, accumulated in float like
+ * simd_dot() in fast mode
+ */
+float simd_dot_half(const uint16_t* a, const uint16_t* b, size_t n, simd_half_format format);
+
+/**
+ * @brief convolution of half operands into a float output, same contract
+ * as conv() (y is accumulated into); the result is bit for bit the one
+ * simd_conv() gives on the operands converted to float
+ */
+void simd_conv_half(const uint16_t* x, size_t l1, const uint16_t* h, size_t l2, float* y,
+                    simd_half_format format);
+
+/**
+ * @brief which outputs of the convolution simd_conv() computes
+ */
+enum class simd_conv_mode {
+    full,           // every overlap, l1 + l2 - 1 outputs (conv())
+    same,           // max(l1, l2) outputs, centred in full
+    valid           // only complete overlaps, max(l1, l2) - min(l1, l2) + 1 outputs
+};
+
+/**
+ * @brief number of outputs of simd_conv() in the given mode
+ */
+size_t simd_conv_size(size_t l1, size_t l2, simd_conv_mode mode);
+
+/**
+ * @brief dispatched convolution function, see conv()
+ * 
+ * same and valid give the outputs from (min(l1, l2) - 1) / 2 and
+ * min(l1, l2) - 1 of the full convolution on, as numpy.convolve does.
+ * 
+ * @param x discrete time input signal
+ * @param l1 length of x
+ * @param h discrete impulse response
+ * @param l2 length of h
+ * @param y convoluted response, simd_conv_size() zero initialised elements
+ * @param mode outputs to compute
+ */
+void simd_conv(const float* x, size_t l1, const float* h, size_t l2, float* y,
+               simd_conv_mode mode = simd_conv_mode::full);
+
+/**
+ * @brief dispatched double precision Vector Addition, Subtraction, Multiply
+ * and Division, see the double add()
+ * 
+ * two lanes per SSE/NEON register, four per ymm and eight per zmm; no
+ * streaming variants, the regular stores are used at every size.
+ */
+void simd_add(const double* a, const double* b, double* c, size_t n);
+void simd_sub(const double* a, const double* b, double* c, size_t n);
+void simd_mul(const double* a, const double* b, double* c, size_t n);
+void simd_div(const double* a, const double* b, double* c, size_t n);
+
+/**
+ * @brief dispatched double precision Vector Multiply-Add, see the double
+ * mul_add(); a single rounding (FMA) from AVX2 and on NEON
+ */
+void simd_mul_add(const double* a, const double* b, const double* c, double* d, size_t n);
+
+/**
+ * @brief dispatched double precision Tensor Addition, Subtraction and
+ * Multiplication, see the double add(), sub() and mul()
+ */
+void simd_add(const Tensor64 a, const Tensor64 b, Tensor64 &c);
+void simd_sub(const Tensor64 a, const Tensor64 b, Tensor64 &c);
+void simd_mul(const Tensor64 a, const Tensor64 b, Tensor64 &c);
+
+/**
+ * @brief dispatched double precision direct convolution, see simd_conv();
+ * the same driver and modes as the float one
+ * 
+ * @param x discrete time input signal
+ * @param l1 length of x
+ * @param h discrete impulse response
+ * @param l2 length of h
+ * @param y convoluted response, simd_conv_size() zero initialised elements
+ * @param mode outputs to compute
+ */
+void simd_conv(const double* x, size_t l1, const double* h, size_t l2, double* y,
+               simd_conv_mode mode = simd_conv_mode::full);
+
+/**
+ * @brief dispatched integer Vector Addition, see the integer add()
+ * 
+ * 8 and 16 bit lanes saturate in hardware (padds/paddus, sqadd/uqadd),
+ * int32 saturation is emulated with an overflow test on the sign bits.
+ */
+void simd_add(const int8_t* a, const int8_t* b, int8_t* c, size_t n, simd_overflow overflow = simd_overflow::wrap);
+void simd_add(const uint8_t* a, const uint8_t* b, uint8_t* c, size_t n, simd_overflow overflow = simd_overflow::wrap);
+void simd_add(const int16_t* a, const int16_t* b, int16_t* c, size_t n, simd_overflow overflow = simd_overflow::wrap);
+void simd_add(const int32_t* a, const int32_t* b, int32_t* c, size_t n, simd_overflow overflow = simd_overflow::wrap);
+
+/**
+ * @brief dispatched integer Vector Subtraction, see the integer sub()
+ */
+void simd_sub(const int8_t* a, const int8_t* b, int8_t* c, size_t n, simd_overflow overflow = simd_overflow::wrap);
+void simd_sub(const uint8_t* a, const uint8_t* b, uint8_t* c, size_t n, simd_overflow overflow = simd_overflow::wrap);
+void simd_sub(const int16_t* a, const int16_t* b, int16_t* c, size_t n, simd_overflow overflow = simd_overflow::wrap);
+void simd_sub(const int32_t* a, const int32_t* b, int32_t* c, size_t n, simd_overflow overflow = simd_overflow::wrap);
+
+/**
+ * @brief dispatched integer Vector Multiply, see the integer mul(); 8 bit
+ * lanes are multiplied widened to 16 bits and narrowed again
+ */
+void simd_mul(const int8_t* a, const int8_t* b, int8_t* c, size_t n, simd_overflow overflow = simd_overflow::wrap);
+void simd_mul(const uint8_t* a, const uint8_t* b, uint8_t* c, size_t n, simd_overflow overflow = simd_overflow::wrap);
+void simd_mul(const int16_t* a, const int16_t* b, int16_t* c, size_t n, simd_overflow overflow = simd_overflow::wrap);
+void simd_mul(const int32_t* a, const int32_t* b, int32_t* c, size_t n, simd_overflow overflow = simd_overflow::wrap);
+
+/**
+ * @brief dispatched 8 bit Dot Product, see the 8 bit dot(); exact for any n
+ * 
+ * int32 lane sums are flushed to int64 every 64K elements. vpdpbusd with
+ * AVX512_VNNI, else the bytes are widened and multiplied with pmaddwd
+ * (smull/sadalp on NEON): pmaddubsw would be one instruction less but
+ * saturates its 16 bit pair sums once activations go past 128.
+ */
+int64_t simd_dot(const uint8_t* a, const int8_t* b, size_t n);
+int64_t simd_dot(const int8_t* a, const int8_t* b, size_t n);
+
+/**
+ * @brief dispatched quantized convolution, see conv_quant(); the same
+ * outputs bit for bit, in the given mode (see simd_conv())
+ * 
+ * @param x discrete time input signal
+ * @param l1 length of x
+ * @param xq quantization of x
+ * @param h discrete impulse response
+ * @param l2 length of h
+ * @param hq quantization of h
+ * @param y convoluted response, simd_conv_size() elements (overwritten)
+ * @param yq quantization of y
+ * @param mode outputs to compute
+ */
+void simd_conv_quant(const uint8_t* x, size_t l1, simd_quant xq, const int8_t* h, size_t l2, simd_quant hq,
+                     uint8_t* y, simd_quant yq, simd_conv_mode mode = simd_conv_mode::full);
+
+/**
+ * @brief algorithms of simd_convolve()
+ */
+enum class simd_conv_method {
+    automatic,      // cheapest of the others for the given sizes
+    direct,         // the dispatched simd_conv(), O(l1 * l2)
+    overlap_add,    // FFT of blocks of the longer operand, O(l log m)
+    fft             // one FFT over the whole output, O(l log l)
+};
+
+/**
+ * @brief convolution engine for long signals and filters, same contract
+ * as conv() (y is accumulated into)
+ * 
+ * picks direct, overlap-add or single FFT convolution from a cost model
+ * of the two lengths unless a method is given. FFT plans are cached and
+ * shared by all calls and threads. The FFT paths round differently from
+ * the direct ones: the error is bounded by the norms of x and h rather
+ * than per output sample.
+ * 
+ * @param x discrete time input signal
+ * @param l1 length of x
+ * @param h discrete impulse response
+ * @param l2 length of h
+ * @param y convoluted response, l1 + l2 - 1 zero initialised elements
+ * @param method algorithm to use
+ */
+void simd_convolve(const float* x, size_t l1, const float* h, size_t l2, float* y,
+                   simd_conv_method method = simd_conv_method::automatic);
+
+/**
+ * @brief algorithm simd_convolve() picks for the given lengths
+ */
+simd_conv_method simd_conv_choice(size_t l1, size_t l2);
+
+/**
+ * @brief what simd_conv2d() reads outside the image
+ */
+enum class simd_border {
+    zero,           // 0
+    clamp,          // the nearest edge pixel: a a | a b c d | d d
+    reflect         // mirrored about the edge pixel: c b | a b c d | c b
+};
+
+/**
+ * @brief dispatched 2D convolution of a single channel image with a
+ * kw x kh filter, the output the size of the input:
+ * 
+ *   y[r][c] = sum_{i < kh, j < kw} h[i kw + j] x[r + kh / 2 - i][c + kw / 2 - j]
+ * 
+ * (the filter's centre on the output pixel). Rows are computed from a
+ * ring of kh padded input rows, every output once.
+ * 
+ * @param x input image, height rows of width floats
+ * @param x_stride floats from one row of x to the next
+ * @param h filter, kh rows of kw taps
+ * @param y output image (overwritten), must not overlap x
+ * @param y_stride floats from one row of y to the next
+ * @param border what the filter reads beyond the edges of x
+ */
+void simd_conv2d(const float* x, size_t width, size_t height, size_t x_stride,
+                 const float* h, size_t kw, size_t kh,
+                 float* y, size_t y_stride, simd_border border = simd_border::zero);
+
+/**
+ * @brief simd_conv2d() with the separable filter h[i kw + j] = hy[i] hx[j]
+ * in kw + kh multiply-adds per pixel: a row pass with hx into a ring of kh
+ * filtered rows, then a column pass with hy over it
+ */
+void simd_conv2d_separable(const float* x, size_t width, size_t height, size_t x_stride,
+                           const float* hx, size_t kw, const float* hy, size_t kh,
+                           float* y, size_t y_stride, simd_border border = simd_border::zero);
+
+/**
+ * @brief memory layout of the activations of simd_conv_layer_forward()
+ */
+enum class simd_layout {
+    nchw,           // planes: x[((n C + c) H + r) W + col], filters OIHW
+    nhwc            // interleaved: x[((n H + r) W + col) C + c], filters OHWI
+};
+
+/**
+ * @brief shape of a convolution layer of a CNN, every image of the batch
+ * channels x height x width in, filters x output height x output width out
+ * 
+ * every filter sees channels / groups input channels (groups = channels is
+ * the depthwise convolution); groups must divide channels and filters,
+ * strides and dilations are at least 1. The filters are
+ * filters x channels / groups x kernel_h x kernel_w in the nchw layout and
+ * filters x kernel_h x kernel_w x channels / groups in the nhwc one.
+ */
+struct simd_conv_layer {
+    size_t batch;
+    size_t channels;
+    size_t height;
+    size_t width;
+    size_t filters;
+    size_t kernel_h;
+    size_t kernel_w;
+    size_t stride_h = 1;
+    size_t stride_w = 1;
+    size_t pad_h = 0;           // zero rows above and below the image
+    size_t pad_w = 0;           // zero columns left and right of it
+    size_t dilation_h = 1;
+    size_t dilation_w = 1;
+    size_t groups = 1;
+    simd_layout layout = simd_layout::nchw;
+};
+
+/**
+ * @brief output height and width of a layer,
+ * (height + 2 pad_h - dilation_h (kernel_h - 1) - 1) / stride_h + 1 (0 when
+ * the dilated kernel does not fit the padded image)
+ */
+size_t simd_conv_layer_height(const simd_conv_layer& l);
+size_t simd_conv_layer_width(const simd_conv_layer& l);
+
+/**
+ * @brief floats of workspace simd_conv_layer_forward() needs for a layer,
+ * 0 for the 1 x 1 layers with stride 1 and no padding, which need none
+ */
+size_t simd_conv_layer_workspace(const simd_conv_layer& l);
+
+/**
+ * @brief forward pass of a convolution layer (cross-correlation, as CNN
+ * frameworks define it): per image, output channel f and output pixel
+ * 
+ *   y[f][r][col] = bias[f] + sum_{c, i, j} w[f][c][i][j]
+ *                  x[g C / groups + c][r stride_h - pad_h + i dilation_h][col stride_w - pad_w + j dilation_w]
+ * 
+ * with g the group of f and pixels outside the image 0, in the layer's
+ * layout. Runs as implicit GEMM on the dispatched simd_sgemm(): the
+ * filters of a group times tiles of output pixels whose
+ * im2col columns are gathered into the workspace one tile at a time,
+ * never the whole im2col matrix; 1 x 1 layers with stride 1 and no
+ * padding multiply x in place.
+ * 
+ * @param x input activations, batch x channels x height x width
+ * @param w filters, see simd_conv_layer
+ * @param bias one float per filter added to its outputs, or nullptr
+ * @param y output activations (overwritten), must not overlap x or w
+ * @param workspace simd_conv_layer_workspace() floats, or nullptr to take
+ * them from the calling thread's scratch arena
+ */
+void simd_conv_layer_forward(const simd_conv_layer& l, const float* x, const float* w, const float* bias,
+                             float* y, float* workspace = nullptr);
+
+/**
+ * @brief dispatched batched Tensor Multiplication, see mul_batch()
+ */
+void simd_mul_batch(const Tensor* a, const Tensor* b, Tensor* c, size_t count);
+
+/**
+ * @brief dispatched structure-of-arrays batched Tensor Multiplication, see mul_batch_soa()
+ */
+void simd_mul_batch_soa(const float* a, const float* b, float* c, size_t count, size_t stride);
+
+/**
+ * @brief dispatched matrix multiply, see sgemm()
+ * 
+ * cache blocked, with packed panels and a register tiled FMA micro-kernel
+ * (6x16 on AVX/AVX2, 12x32 on AVX-512, 8x12 on NEON)
+ */
+void simd_sgemm(bool trans_a, bool trans_b, size_t m, size_t n, size_t k,
+                float alpha, const float* a, size_t lda, const float* b, size_t ldb,
+                float beta, float* c, size_t ldc);
+
+/* ------------------------------ aligned memory ------------------------------ */
+
+// alignment of simd_alloc(), simd_buffer and simd_arena, one cache line and one zmm register:
+constexpr size_t simd_alignment = 64;
+
+/**
+ * @brief bytes of uninitialised memory aligned to simd_alignment, or
+ * rounded up to whole 2 MB pages, aligned to them and advised as
+ * transparent huge pages (Linux) when huge_pages is set; nullptr when out
+ * of memory. Release with simd_free().
+ */
+void* simd_alloc(size_t bytes, bool huge_pages = false);
+
+/**
+ * @brief releases memory from simd_alloc(), nullptr is ignored
+ */
+void simd_free(void* p);
+
+/**
+ * @brief owning fixed size array of T aligned to simd_alignment
+ * 
+ * for kernel operands: aligned loads and stores (and non-temporal stores)
+ * are safe on data(), and whole vectors never straddle a cache line. The
+ * elements are not initialised, so the pages are first touched by whoever
+ * writes them first (see simd_parallel_first_touch()). data() is nullptr
+ * and size() 0 when the allocation failed.
+ */
+template<class T>
+class simd_buffer {
+    static_assert(std::is_trivially_copyable<T>::value && std::is_trivially_destructible<T>::value,
+                  "simd_buffer holds plain data");
+
+public:
+    simd_buffer() = default;
+
+    /**
+     * @param n number of elements
+     * @param huge_pages back the buffer with 2 MB pages where the OS allows it
+     */
+    explicit simd_buffer(size_t n, bool huge_pages = false)
+        : p_(static_cast<T*>(simd_alloc(n * sizeof(T), huge_pages))), n_(p_ ? n : 0) {}
+
+    simd_buffer(simd_buffer&& o) noexcept : p_(o.p_), n_(o.n_) { o.p_ = nullptr; o.n_ = 0; }
+    simd_buffer& operator=(simd_buffer&& o) noexcept {
+        std::swap(p_, o.p_);
+        std::swap(n_, o.n_);
+        return *this;
+    }
+    simd_buffer(const simd_buffer&) = delete;
+    simd_buffer& operator=(const simd_buffer&) = delete;
+    ~simd_buffer(){ simd_free(p_); }
+
+    T* data() { return p_; }
+    const T* data() const { return p_; }
+    size_t size() const { return n_; }
+    bool empty() const { return n_ == 0; }
+
+    T& operator[](size_t i) { return p_[i]; }
+    const T& operator[](size_t i) const { return p_[i]; }
+    T* begin() { return p_; }
+    T* end() { return p_ + n_; }
+    const T* begin() const { return p_; }
+    const T* end() const { return p_ + n_; }
+
+private:
+    T* p_ = nullptr;
+    size_t n_ = 0;
+};
+
+/**
+ * @brief bump allocator for scratch space
+ * 
+ * alloc() hands out simd_alignment aligned pieces of one block by moving an
+ * offset, and rewind() gives back everything allocated after a position()
+ * at once (simd_arena_scope does it on scope exit). What does not fit in
+ * the block gets its own allocation until the arena is next empty, then
+ * the block is regrown to the peak, so a workload that repeats allocates
+ * only while warming up. One arena per thread, see simd_scratch().
+ */
+class simd_arena {
+public:
+    struct mark {
+        size_t used;
+        size_t spills;
+    };
+
+    /**
+     * @param bytes initial size of the block (0 waits for the first use)
+     */
+    explicit simd_arena(size_t bytes = 0);
+    ~simd_arena();
+    simd_arena(const simd_arena&) = delete;
+    simd_arena& operator=(const simd_arena&) = delete;
+
+    /**
+     * @brief bytes of uninitialised memory, nullptr when out of memory
+     */
+    void* alloc(size_t bytes);
+
+    template<class T>
+    T* alloc(size_t n){ return static_cast<T*>(alloc(n * sizeof(T))); }
+
+    /**
+     * @brief current position, to rewind() to later
+     */
+    mark position() const { return {used_, spills_.size()}; }
+
+    /**
+     * @brief frees everything allocated since m was taken
+     */
+    void rewind(mark m);
+
+    /**
+     * @brief frees everything
+     */
+    void reset(){ rewind({0, 0}); }
+
+    size_t capacity() const { return size_; }
+    // most bytes ever live at once:
+    size_t peak() const { return peak_; }
+
+private:
+    char* block_ = nullptr;
+    size_t size_ = 0;
+    size_t used_ = 0;
+    std::vector<std::pair<void*, size_t>> spills_;
+    size_t spilled_ = 0;
+    size_t peak_ = 0;
+};
+
+/**
+ * @brief rewinds an arena to where it was at construction when going out of scope
+ */
+class simd_arena_scope {
+public:
+    explicit simd_arena_scope(simd_arena& a) : arena_(a), mark_(a.position()) {}
+    ~simd_arena_scope(){ arena_.rewind(mark_); }
+    simd_arena_scope(const simd_arena_scope&) = delete;
+    simd_arena_scope& operator=(const simd_arena_scope&) = delete;
+
+private:
+    simd_arena& arena_;
+    simd_arena::mark mark_;
+};
+
+/**
+ * @brief the calling thread's scratch arena, also used by the library for
+ * its temporaries; take a simd_arena_scope around every use
+ */
+simd_arena& simd_scratch();
+
+/* ---------------------------- streaming filters ----------------------------- */
+
+/**
+ * @brief FIR filter over a signal that arrives in chunks
+ * 
+ * keeps the last taps - 1 input samples between calls, so the outputs of
+ * the successive process() calls followed by flush() are the full
+ * convolution of the concatenated input with h, bit for bit the same as
+ * one simd_conv() over the whole input (on the same instruction set level,
+ * for inputs at least as long as the filter). Every chunk runs through the
+ * dispatched direct convolution kernel.
+ * 
+ * process() does not allocate: its working buffer is sized for max_chunk
+ * samples up front and longer chunks are cut into pieces of that size, so
+ * the work per call is bounded by the chunk length times the taps. One
+ * object per stream, the calls must not overlap.
+ */
+class simd_fir {
+public:
+    /**
+     * @param h impulse response, copied
+     * @param taps length of h (0 acts as a single zero tap)
+     * @param max_chunk samples processed per kernel call
+     */
+    simd_fir(const float* h, size_t taps, size_t max_chunk = 4096);
+
+    /**
+     * @brief filters the next n input samples into n outputs
+     * 
+     * @param in next input samples
+     * @param out output samples, may alias in
+     * @param n number of samples
+     */
+    void process(const float* in, float* out, size_t n);
+
+    /**
+     * @brief the taps - 1 outputs still owed after the last sample (as if
+     * the input was followed by zeros), then reset()
+     * 
+     * @param out taps - 1 output samples
+     */
+    void flush(float* out);
+
+    /**
+     * @brief forgets the history, the next process() starts a new signal
+     */
+    void reset();
+
+    size_t taps() const { return h_.size(); }
+
+private:
+    void run(float* out, size_t n);
+
+    std::vector<float> h_;
+    std::vector<float> buf_;    // taps - 1 samples of history, then the chunk
+    size_t max_chunk_;
+};
+
+/* ------------------------- multi-threaded kernels ------------------------- */
+
+/**
+ * @brief multi-threaded Vector Addition, see simd_add()
+ * 
+ * the simd_parallel_* kernels split the arrays into cache line aligned
+ * chunks, one per worker of a persistent pool, and run the dispatched kernel
+ * on each. Below simd_parallel_threshold() elements they stay on the
+ * calling thread.
+ */
+void simd_parallel_add(const float* a, const float* b, float* c, size_t n);
+
+/**
+ * @brief multi-threaded Vector Subtraction, see simd_sub()
+ */
+void simd_parallel_sub(const float* a, const float* b, float* c, size_t n);
+
+/**
+ * @brief multi-threaded Vector Multiply, see simd_mul()
+ */
+void simd_parallel_mul(const float* a, const float* b, float* c, size_t n);
+
+/**
+ * @brief multi-threaded Vector Division, see simd_div()
+ */
+void simd_parallel_div(const float* a, const float* b, float* c, size_t n);
+
+/**
+ * @brief multi-threaded batched Tensor Multiplication, see simd_mul_batch()
+ * 
+ * the threshold counts output floats, 16 per tensor.
+ */
+void simd_parallel_mul_batch(const Tensor* a, const Tensor* b, Tensor* c, size_t count);
+
+/**
+ * @brief multi-threaded structure-of-arrays batched Tensor Multiplication,
+ * see simd_mul_batch_soa()
+ */
+void simd_parallel_mul_batch_soa(const float* a, const float* b, float* c, size_t count, size_t stride);
+
+/**
+ * @brief multi-threaded softmax, see simd_softmax()
+ * 
+ * the row kernels give every worker a range of whole rows; the threshold
+ * counts the floats of the batch.
+ */
+void simd_parallel_softmax(const float* x, float* y, size_t rows, size_t cols);
+
+/**
+ * @brief multi-threaded log-softmax, see simd_log_softmax()
+ */
+void simd_parallel_log_softmax(const float* x, float* y, size_t rows, size_t cols);
+
+/**
+ * @brief multi-threaded layer normalization, see simd_layer_norm()
+ */
+void simd_parallel_layer_norm(const float* x, const float* gamma, const float* beta, float* y,
+                              size_t rows, size_t cols, float eps = 1e-5f);
+
+/**
+ * @brief multi-threaded RMS normalization, see simd_rms_norm()
+ */
+void simd_parallel_rms_norm(const float* x, const float* gamma, float* y, size_t rows, size_t cols,
+                            float eps = 1e-6f);
+
+/**
+ * @brief multi-threaded bias plus activation, see simd_bias_activation()
+ */
+void simd_parallel_bias_activation(const float* x, const float* bias, float* y, size_t rows, size_t cols,
+                                   simd_activation act);
+
+/**
+ * @brief multi-threaded 2D convolution, see simd_conv2d()
+ * 
+ * every worker takes a band of output rows with its own ring of input
+ * rows; the threshold counts output pixels.
+ */
+void simd_parallel_conv2d(const float* x, size_t width, size_t height, size_t x_stride,
+                          const float* h, size_t kw, size_t kh,
+                          float* y, size_t y_stride, simd_border border = simd_border::zero);
+
+/**
+ * @brief multi-threaded separable 2D convolution, see simd_conv2d_separable()
+ */
+void simd_parallel_conv2d_separable(const float* x, size_t width, size_t height, size_t x_stride,
+                                    const float* hx, size_t kw, const float* hy, size_t kh,
+                                    float* y, size_t y_stride, simd_border border = simd_border::zero);
+
+/**
+ * @brief zeroes a freshly allocated array with the same chunking the
+ * simd_parallel_* kernels use
+ * 
+ * on NUMA machines the first write decides which node a page lives on, so
+ * touching the operands this way keeps every worker on node local memory.
+ * 
+ * @param p array to initialise
+ * @param n number of elements
+ */
+void simd_parallel_first_touch(float* p, size_t n);
+
+/**
+ * @brief restarts the worker pool with the given number of threads
+ * (including the caller), 0 = one per CPU the process may run on
+ * 
+ * the default comes from SIMD_PLAYGROUND_THREADS. Must not be called while
+ * a multi-threaded kernel is running.
+ */
+void simd_set_threads(size_t threads);
+
+/**
+ * @brief number of threads the multi-threaded kernels use
+ */
+size_t simd_threads();
+
+/**
+ * @brief element count from which the simd_parallel_* kernels use the pool
+ * (default 65536)
+ */
+void simd_set_parallel_threshold(size_t n);
+
+/**
+ * @brief see simd_set_parallel_threshold()
+ */
+size_t simd_parallel_threshold();
+
+/* ------------------------------- AVX kernels -------------------------------- */
+#if defined(__x86_64__) || defined(__i386__)
+
+// these are built with -mavx and must only be called on CPUs with AVX,
+// simd_* checks that for you.
+
+/**
+ * @brief AVX accelerated Vector Addition function:
+ * 
+ * @param a first operand array
+ * @param b second operand array
+ * @param c output array
+ * @param n number of elements
+ */
+void avx_add(const float* a, const float* b, float* c, size_t n);
+
+/**
+ * @brief AVX accelerated Vector Subtraction function:
+ * 
+ * @param a first operand array
+ * @param b second operand array
+ * @param c output array
+ * @param n number of elements
+ */
+void avx_sub(const float* a, const float* b, float* c, size_t n);
+
+/**
+ * @brief AVX accelerated Vector Multiply function:
+ * 
+ * @param a first operand array
+ * @param b second operand array
+ * @param c output array
+ * @param n number of elements
+ */
+void avx_mul(const float* a, const float* b, float* c, size_t n);
+
+/**
+ * @brief AVX accelerated Vector Multiply-Add function, d = a * b + c:
+ * 
+ * @param a first factor array
+ * @param b second factor array
+ * @param c addend array
+ * @param d output array
+ * @param n number of elements
+ */
+void avx_mul_add(const float* a, const float* b, const float* c, float* d, size_t n);
+
+/**
+ * @brief AVX accelerated Vector Division function:
+ * 
+ * @param a first operand array
+ * @param b second operand array
+ * @param c output array
+ * @param n number of elements
+ */
+void avx_div(const float* a, const float* b, float* c, size_t n);
+
+/**
+ * @brief AVX accelerated Vector Division function in the given mode, see
+ * simd_div_mode:
+ * 
+ * @param a first operand array
+ * @param b second operand array
+ * @param c output array (may alias a or b)
+ * @param n number of elements
+ * @param mode exact, or the reciprocal estimate and Newton-Raphson steps
+ */
+void avx_div(const float* a, const float* b, float* c, size_t n, simd_div_mode mode);
+
+/**
+ * @brief AVX accelerated Vector Square Root function, see simd_div_mode:
+ * 
+ * @param a operand array
+ * @param b output array (may alias a)
+ * @param n number of elements
+ * @param mode exact, or the reciprocal square root estimate and Newton-Raphson steps
+ */
+void avx_sqrt(const float* a, float* b, size_t n, simd_div_mode mode);
+
+/**
+ * @brief AVX accelerated Vector Reciprocal Square Root function, see simd_div_mode:
+ * 
+ * @param a operand array
+ * @param b output array (may alias a)
+ * @param n number of elements
+ * @param mode exact, or the reciprocal square root estimate and Newton-Raphson steps
+ */
+void avx_rsqrt(const float* a, float* b, size_t n, simd_div_mode mode);
+
+/**
+ * @brief AVX accelerated Tensor Addition function:
+ * 
+ * @param a first operand tensor
+ * @param b second operand tensor
+ * @param c output tensor
+ */
+void avx_add(const Tensor a, const Tensor b, Tensor &c);
+
+/**
+ * @brief AVX accelerated Tensor Subtraction function:
+ * 
+ * @param a first operand tensor
+ * @param b second operand tensor
+ * @param c output tensor
+ */
+void avx_sub(const Tensor a, const Tensor b, Tensor &c);
+
+/**
+ * @brief AVX accelerated Tensor Multiplication function:
+ * 
+ * @param a first operand tensor
+ * @param b second operand tensor
+ * @param c output tensor, must not alias a or b
+ */
+void avx_mul(const Tensor a, const Tensor b, Tensor &c);
+
+/**
+ * @brief AVX accelerated convolution function:
+ * 
+ * @param x discrete time input signal
+ * @param l1 length of x
+ * @param h discrete impulse response
+ * @param l2 length of h
+ * @param y convoluted response, l1 + l2 - 1 zero initialised elements
+ */
+void avx_conv(const float* x, size_t l1, const float* h, size_t l2, float* y);
+
+#endif
+
+/* ------------------------------- NEON kernels ------------------------------- */
+#if defined(__aarch64__)
+
+/**
+ * @brief NEON accelerated Vector Addition function:
+ * 
+ * @param a first operand array
+ * @param b second operand array
+ * @param c output array
+ * @param n number of elements
+ */
+void neon_add(const float* a, const float* b, float* c, size_t n);
+
+/**
+ * @brief NEON accelerated Vector Subtraction function:
+ * 
+ * @param a first operand array
+ * @param b second operand array
+ * @param c output array
+ * @param n number of elements
+ */
+void neon_sub(const float* a, const float* b, float* c, size_t n);
+
+/**
+ * @brief NEON accelerated Vector Multiply function:
+ * 
+ * @param a first operand array
+ * @param b second operand array
+ * @param c output array
+ * @param n number of elements
+ */
+void neon_mul(const float* a, const float* b, float* c, size_t n);
+
+/**
+ * @brief NEON accelerated Vector Multiply-Add function, d = a * b + c:
+ * 
+ * @param a first factor array
+ * @param b second factor array
+ * @param c addend array
+ * @param d output array
+ * @param n number of elements
+ */
+void neon_mul_add(const float* a, const float* b, const float* c, float* d, size_t n);
+
+/**
+ * @brief NEON accelerated Vector Division function:
+ * 
+ * @param a first operand array
+ * @param b second operand array
+ * @param c output array
+ * @param n number of elements
+ */
+void neon_div(const float* a, const float* b, float* c, size_t n);
+
+/**
+ * @brief NEON accelerated Vector Division function in the given mode, see
+ * simd_div_mode:
+ * 
+ * @param a first operand array
+ * @param b second operand array
+ * @param c output array (may alias a or b)
+ * @param n number of elements
+ * @param mode exact, or the reciprocal estimate and Newton-Raphson steps
+ */
+void neon_div(const float* a, const float* b, float* c, size_t n, simd_div_mode mode);
+
+/**
+ * @brief NEON accelerated Vector Square Root function, see simd_div_mode:
+ * 
+ * @param a operand array
+ * @param b output array (may alias a)
+ * @param n number of elements
+ * @param mode exact, or the reciprocal square root estimate and Newton-Raphson steps
+ */
+void neon_sqrt(const float* a, float* b, size_t n, simd_div_mode mode);
+
+/**
+ * @brief NEON accelerated Vector Reciprocal Square Root function, see simd_div_mode:
+ * 
+ * @param a operand array
+ * @param b output array (may alias a)
+ * @param n number of elements
+ * @param mode exact, or the reciprocal square root estimate and Newton-Raphson steps
+ */
+void neon_rsqrt(const float* a, float* b, size_t n, simd_div_mode mode);
+
+/**
+ * @brief NEON_SIMD accelerated Tensor Addition function:
+ * 
+ * @param a first operand tensor
+ * @param b second operand tensor
+ * @param c output tensor
+ */
+void neon_add(const Tensor a, const Tensor b, Tensor &c);
+
+/**
+ * @brief NEON_SIMD accelerated Tensor Subtraction function:
+ * 
+ * @param a first operand tensor
+ * @param b second operand tensor
+ * @param c output tensor
+ */
+void neon_sub(const Tensor a, const Tensor b, Tensor &c);
+
+/**
+ * @brief NEON_SIMD accelerated Tensor Multiplication function:
+ * 
+ * @param a first operand tensor
+ * @param b second operand tensor
+ * @param c output tensor, must not alias a or b
+ */
+void neon_mul(const Tensor a, const Tensor b, Tensor &c);
+
+/**
+ * @brief NEON accelerated convolution function:
+ * 
+ * @param x discrete time input signal
+ * @param l1 length of x
+ * @param h discrete impulse response
+ * @param l2 length of h
+ * @param y convoluted response, l1 + l2 - 1 elements
+ */
+void neon_conv(const float* x, size_t l1, const float* h, size_t l2, float* y);
+
+/**
+ * @brief NEON accelerated batched Tensor Multiplication, see mul_batch()
+ */
+void neon_mul_batch(const Tensor* a, const Tensor* b, Tensor* c, size_t count);
+
+/**
+ * @brief NEON accelerated structure-of-arrays batched Tensor Multiplication, see mul_batch_soa()
+ */
+void neon_mul_batch_soa(const float* a, const float* b, float* c, size_t count, size_t stride);
+
+/**
+ * @brief NEON accelerated matrix multiply, see sgemm()
+ */
+void neon_sgemm(bool trans_a, bool trans_b, size_t m, size_t n, size_t k,
+                float alpha, const float* a, size_t lda, const float* b, size_t ldb,
+                float beta, float* c, size_t ldc);
+
+#endif
+
+#endif
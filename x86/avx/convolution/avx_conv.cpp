@@ -8,120 +8,47 @@
  * @copyright Copyright (c) 2023
  * 
  */
+#include "x86_kernels.h"
+#include "simd_vec.h"
+#include "conv_driver.h"
+#include "conv2d_driver.h"
 
-#include <iostream>
-#include <immintrin.h>
-#include <vector>
-
-// misc lib:
-#include <algorithm>
-#include <numeric>
-#include <chrono>
-
-using namespace std;
+/**
+ * @brief AVX accelerated direct convolution over a range of the full
+ * output, see conv_direct()
+ */
+void avx_conv(const float* x, size_t l1, const float* h, size_t l2, float* y,
+              size_t first, size_t count){
+    conv_direct<vec_avx<float>>(x, l1, h, l2, y, first, count);
+}
 
 /**
- * @brief normal function to compute the convolution of a given discrete time signal
- * 
- * @param x discrete time input signal
- * @param h discrete impulse response
- * @param y convoluted response
+ * @brief AVX accelerated double precision direct convolution, see conv_direct()
  */
-void conv(const vector<float> x, const vector<float> h, vector<float>& y){
-    const auto l1 = x.size();
-    const auto l2 = h.size();
-    const auto l = l1 + l2 - 1;
+void avx_conv(const double* x, size_t l1, const double* h, size_t l2, double* y,
+              size_t first, size_t count){
+    conv_direct<vec_avx<double>>(x, l1, h, l2, y, first, count);
+}
 
-    for(int n = 0; n < l; n++){
-        for(int k = 0 ;k < l1; k++){
-            if((n - k) >= 0 && (n - k) <= l2){
-                y[n] = y[n] + (x[k]*h[n - k]);
-            }
-        }
-    }
+/**
+ * @brief AVX accelerated row of a 2D convolution, see conv2d_run()
+ */
+void avx_conv2d_rows(const float* const* rows, const float* h, size_t kw, size_t kh, float* y, size_t count){
+    conv2d_run<vec_avx<float>>(rows, h, kw, kh, y, count);
 }
 
 /**
  * @brief AVX accelerated convolution function (uses AVX1):
  * 
  * @param x discrete time input signal
+ * @param l1 length of x
  * @param h discrete impulse response
- * @param y convoluted response
+ * @param l2 length of h
+ * @param y convoluted response, l1 + l2 - 1 zero initialised elements
  */
-void avx_conv(const vector<float> x, const vector<float> h, vector<float>& y){
-    const auto l1 = x.size();
-    const auto l2 = h.size();
-    const auto l = l1 + l2 - 1;
-
-    int i = 0;
-    __m128 a, b, c;
-
-    for(int n = 0; n < l; n++){
-        i = 0;
-        c = _mm_set_ps(0.0f, 0.0f, 0.0f, 0.0f);
-        for(int k = 0 ;k < l1; k++){
-            if((n - k) >= 0 && (n - k) <= l2){  
-                a[i] = x[k];
-                b[i] = h[n - k];
-                i++;
-
-                if(i > 3){
-                    c = _mm_mul_ps(a, b);
-                    c = _mm_hadd_ps(c, c);
-                    c = _mm_hadd_ps(c, c);
-                    
-                    y[n] += c[0];
-
-                    c = _mm_set_ps(0.0f, 0.0f, 0.0f, 0.0f);
-                    i = 0;
-                }
-            }
-        }    
-        if (i != 0){
-            a[i] = 0;
-
-            c = _mm_mul_ps(a, b);
-            c = _mm_hadd_ps(c, c);
-            c = _mm_hadd_ps(c, c);
-            y[n] += c[0];
-        }
+void avx_conv(const float* x, size_t l1, const float* h, size_t l2, float* y){
+    if(l1 == 0 || l2 == 0){
+        return;
     }
+    avx_conv(x, l1, h, l2, y, 0, l1 + l2 - 1);
 }
-
-int main(){
-    const vector<float> a = {1.0f, 2.0f, 3.0f, 4.0f, 1.0f, 2.0f, 3.0f, 4.0f, 1.0f, 2.0f, 3.0f, 4.0f, 1.0f, 2.0f, 3.0f, 4.0f};
-    const vector<float> b = {1.0f, 2.0f, 3.0f, 4.0f};
-    vector<float> c  = {0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f};
-    vector<float> d  = {0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f};
-
-    // normal implementation:
-    auto st1 = chrono::high_resolution_clock::now();
-    conv(a, b, c); 
-    auto sp1 = chrono::high_resolution_clock::now();
-
-    // vectorized implementation:
-    auto st2 = chrono::high_resolution_clock::now();
-    avx_conv(a, b, d); 
-    auto sp2 = chrono::high_resolution_clock::now();
-
-    cout << "------------------AVX-CONVOLUTION------------------" << endl;
-
-    auto d1 = chrono::duration_cast<std::chrono::nanoseconds>(sp1 - st1);
-
-    cout << "Time taken by normal function: "
-         << d1.count() << " nanoseconds" << endl;
-    
-    auto d2 = chrono::duration_cast<std::chrono::nanoseconds>(sp2 - st2);
- 
-    cout << "Time taken by AVX function: "
-         << d2.count() << " nanoseconds" << endl;
-
-    const float percent = (float)d1.count()/(float)d2.count() * 100;
-
-    cout << "Speed Uplift: "
-        << percent << " %" << endl;
-
-    cout << "---------------------------------------------------" << endl;
-
-    return(0);
-}
\ No newline at end of file
@@ -0,0 +1,67 @@
+/**
+ * @file avx_f64.cpp
+ * @author Sravan Senthilnathan
+ * @brief AVX implementation of double precision 4x4 Tensor arithmetic
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2023
+ * 
+ */
+#include <immintrin.h>
+
+#include "x86_kernels.h"
+
+/**
+ * @brief AVX accelerated double precision Tensor Addition function:
+ * 
+ * one row per 256 bit register.
+ * 
+ * @param a first operand tensor
+ * @param b second operand tensor
+ * @param c output tensor
+ */
+void avx_add(const Tensor64 a, const Tensor64 b, Tensor64 &c){
+    for(int i = 0; i < 4; ++i){
+        _mm256_storeu_pd(c[i], _mm256_add_pd(_mm256_loadu_pd(a[i]), _mm256_loadu_pd(b[i])));
+    }
+}
+
+/**
+ * @brief AVX accelerated double precision Tensor Subtraction function:
+ * 
+ * @param a first operand tensor
+ * @param b second operand tensor
+ * @param c output tensor
+ */
+void avx_sub(const Tensor64 a, const Tensor64 b, Tensor64 &c){
+    for(int i = 0; i < 4; ++i){
+        _mm256_storeu_pd(c[i], _mm256_sub_pd(_mm256_loadu_pd(a[i]), _mm256_loadu_pd(b[i])));
+    }
+}
+
+/**
+ * @brief AVX accelerated double precision Tensor Multiplication function:
+ * 
+ * row i of c is the sum of the rows of b weighted by a[i][k], each weight
+ * broadcast from memory.
+ * 
+ * @param a first operand tensor
+ * @param b second operand tensor
+ * @param c output tensor
+ */
+void avx_mul(const Tensor64 a, const Tensor64 b, Tensor64 &c){
+    const __m256d Tb0 = _mm256_loadu_pd(b[0]);
+    const __m256d Tb1 = _mm256_loadu_pd(b[1]);
+    const __m256d Tb2 = _mm256_loadu_pd(b[2]);
+    const __m256d Tb3 = _mm256_loadu_pd(b[3]);
+
+    for(int i = 0; i < 4; ++i){
+        __m256d Row = _mm256_mul_pd(_mm256_broadcast_sd(&a[i][0]), Tb0);
+        Row = _mm256_add_pd(Row, _mm256_mul_pd(_mm256_broadcast_sd(&a[i][1]), Tb1));
+        Row = _mm256_add_pd(Row, _mm256_mul_pd(_mm256_broadcast_sd(&a[i][2]), Tb2));
+        Row = _mm256_add_pd(Row, _mm256_mul_pd(_mm256_broadcast_sd(&a[i][3]), Tb3));
+
+        _mm256_storeu_pd(c[i], Row);
+    }
+}
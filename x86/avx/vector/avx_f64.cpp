@@ -0,0 +1,48 @@
+/**
+ * @file avx_f64.cpp
+ * @author Sravan Senthilnathan
+ * @brief AVX implementation of double precision vector arithmetic
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2023
+ * 
+ */
+#include "x86_kernels.h"
+#include "simd_vec.h"
+#include "vector_driver.h"
+
+/**
+ * @brief AVX accelerated double precision Vector Addition, see vec_binary()
+ */
+void avx_add(const double* a, const double* b, double* c, size_t n){
+    vec_binary<vec_avx<double>, vec_op::add>(a, b, c, n);
+}
+
+/**
+ * @brief AVX accelerated double precision Vector Subtraction, see vec_binary()
+ */
+void avx_sub(const double* a, const double* b, double* c, size_t n){
+    vec_binary<vec_avx<double>, vec_op::sub>(a, b, c, n);
+}
+
+/**
+ * @brief AVX accelerated double precision Vector Multiply, see vec_binary()
+ */
+void avx_mul(const double* a, const double* b, double* c, size_t n){
+    vec_binary<vec_avx<double>, vec_op::mul>(a, b, c, n);
+}
+
+/**
+ * @brief AVX accelerated double precision Vector Division, see vec_binary()
+ */
+void avx_div(const double* a, const double* b, double* c, size_t n){
+    vec_binary<vec_avx<double>, vec_op::div>(a, b, c, n);
+}
+
+/**
+ * @brief AVX accelerated double precision Vector Multiply-Add, two roundings
+ */
+void avx_mul_add(const double* a, const double* b, const double* c, double* d, size_t n){
+    vec_mul_add<vec_avx<double>>(a, b, c, d, n);
+}
@@ -0,0 +1,26 @@
+/**
+ * @file avx_mul_add.cpp
+ * @author Sravan Senthilnathan
+ * @brief AVX implementation of parallel floating point multiply-add
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2023
+ * 
+ */
+#include "simd_playground.h"
+#include "simd_vec.h"
+#include "vector_driver.h"
+
+/**
+ * @brief AVX accelerated Vector Multiply-Add function, d = a * b + c (two roundings, AVX has no FMA):
+ * 
+ * @param a first factor array
+ * @param b second factor array
+ * @param c addend array
+ * @param d output array (may alias a, b or c)
+ * @param n number of elements
+ */
+void avx_mul_add(const float* a, const float* b, const float* c, float* d, size_t n){
+    vec_mul_add<vec_avx<float>>(a, b, c, d, n);
+}
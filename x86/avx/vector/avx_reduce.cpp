@@ -0,0 +1,55 @@
+/**
+ * @file avx_reduce.cpp
+ * @author Sravan Senthilnathan
+ * @brief AVX sum, dot product, min/max and argmin/argmax
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2023
+ * 
+ */
+#include "x86_kernels.h"
+#include "simd_vec.h"
+#include "reduce_driver.h"
+
+/**
+ * @brief AVX Vector Sum, see reduce_driver.h for the modes
+ */
+float avx_sum(const float* a, size_t n, simd_sum_mode mode){
+    return reduce_sum<vec_avx<float>>(a, n, mode);
+}
+
+/**
+ * @brief AVX Dot Product, see reduce_driver.h for the modes
+ */
+float avx_dot(const float* a, const float* b, size_t n, simd_sum_mode mode){
+    return reduce_dot<vec_avx<float>>(a, b, n, mode);
+}
+
+/**
+ * @brief AVX Vector Minimum, NaNs skipped
+ */
+float avx_minimum(const float* a, size_t n){
+    return reduce_extreme<vec_avx<float>, false>(a, 0, n);
+}
+
+/**
+ * @brief AVX Vector Maximum, NaNs skipped
+ */
+float avx_maximum(const float* a, size_t n){
+    return reduce_extreme<vec_avx<float>, true>(a, 0, n);
+}
+
+/**
+ * @brief AVX Vector Argmin, the first index of the minimum
+ */
+size_t avx_argmin(const float* a, size_t n){
+    return reduce_arg_extreme<vec_avx<float>, false>(a, n);
+}
+
+/**
+ * @brief AVX Vector Argmax, the first index of the maximum
+ */
+size_t avx_argmax(const float* a, size_t n){
+    return reduce_arg_extreme<vec_avx<float>, true>(a, n);
+}
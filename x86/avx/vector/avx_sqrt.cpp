@@ -0,0 +1,37 @@
+/**
+ * @file avx_sqrt.cpp
+ * @author Sravan Senthilnathan
+ * @brief AVX implementation of parallel floating point square roots
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2023
+ * 
+ */
+#include "simd_playground.h"
+#include "simd_vec.h"
+#include "recip_driver.h"
+
+/**
+ * @brief AVX accelerated Vector Square Root function, see recip_driver.h:
+ * 
+ * @param a operand array
+ * @param b output array (may alias a)
+ * @param n number of elements
+ * @param mode exact, or the reciprocal square root estimate and Newton-Raphson steps
+ */
+void avx_sqrt(const float* a, float* b, size_t n, simd_div_mode mode){
+    recip_unary<vec_avx<float>, recip_fn::sqrt>(a, b, n, mode);
+}
+
+/**
+ * @brief AVX accelerated Vector Reciprocal Square Root function, see recip_driver.h:
+ * 
+ * @param a operand array
+ * @param b output array (may alias a)
+ * @param n number of elements
+ * @param mode exact, or the reciprocal square root estimate and Newton-Raphson steps
+ */
+void avx_rsqrt(const float* a, float* b, size_t n, simd_div_mode mode){
+    recip_unary<vec_avx<float>, recip_fn::rsqrt>(a, b, n, mode);
+}
@@ -8,91 +8,18 @@
  * @copyright Copyright (c) 2023
  * 
  */
-#include <iostream>
-#include <immintrin.h>
-#include <vector>
-
-// misc lib:
-#include <algorithm>
-#include <numeric>
-#include <chrono>
-
-using namespace std;
-
-/**
- * @brief Standard Vector Subtraction function:
- * 
- * @param a first operand vector 
- * @param b second operand vector
- * @param c output vector
- */
-void sub(const vector<float> a, const vector<float> b, vector<float>& c){
-    for(int i = 0; i < a.size(); ++i){
-        c[i] = a[i] - b[i];
-    }
-}
+#include "simd_playground.h"
+#include "simd_vec.h"
+#include "vector_driver.h"
 
 /**
- * @brief AVX accelerated Vector Subtraction function (uses AVX2):
+ * @brief AVX accelerated Vector Subtraction function:
  * 
- * @param a first operand vector
- * @param b second operand vector
- * @param c output vector
+ * @param a first operand array
+ * @param b second operand array
+ * @param c output array (may alias a or b)
+ * @param n number of elements
  */
-void avx_sub(const vector<float> a, const vector<float> b, vector<float>& c){
-
-    const int vectorize = (a.size() / 8u) * 8u;
-
-    int i = 0;
-
-    for(; i < vectorize; i += 8u){
-        __m256 aReg = _mm256_loadu_ps(a.data() + i);
-        __m256 bReg = _mm256_loadu_ps(a.data() + i);
-        __m256 cReg = _mm256_sub_ps(aReg, bReg);
-
-        _mm256_storeu_ps(c.data() + i, cReg);
-    }
-    for(; i < a.size(); ++i){
-       c[i] = a[i] - b[i];
-    }
-}
-
-int main(){
-    vector<float> a(1000000);
-    vector<float> b(1000000);
-    vector<float> c(1000000);
-
-    iota(a.begin(), a.end(), 1.5);
-    iota(b.begin(), b.end(), 1);
-
-    // normal implementation:
-    auto st1 = chrono::high_resolution_clock::now();
-    sub(a, b, c); 
-    auto sp1 = chrono::high_resolution_clock::now();
-
-    // vectorized implementation:
-    auto st2 = chrono::high_resolution_clock::now();
-    avx_sub(a, b, c); 
-    auto sp2 = chrono::high_resolution_clock::now();
-
-    cout << "-------------------AVX-TENSOR-SUB------------------" << endl;
-
-    auto d1 = chrono::duration_cast<std::chrono::microseconds>(sp1 - st1);
- 
-    cout << "Time taken by normal function: "
-         << d1.count() << " microseconds" << endl;
-
-    auto d2 = chrono::duration_cast<std::chrono::microseconds>(sp2 - st2);
- 
-    cout << "Time taken by AVX function: "
-         << d2.count() << " microseconds" << endl;
-
-    const float percent = (float)d1.count()/(float)d2.count() * 100;
-
-    cout << "Speed Uplift: "
-        << percent << " %" << endl;
-
-    cout << "---------------------------------------------------" << endl;
-
-    return(0);
+void avx_sub(const float* a, const float* b, float* c, size_t n){
+    vec_binary<vec_avx<float>, vec_op::sub>(a, b, c, n);
 }
@@ -0,0 +1,37 @@
+/**
+ * @file avx2_conv.cpp
+ * @author Sravan Senthilnathan
+ * @brief AVX2/FMA implementation of the direct and the 2D convolution
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2023
+ * 
+ */
+#include "x86_kernels.h"
+#include "simd_vec.h"
+#include "conv_driver.h"
+#include "conv2d_driver.h"
+
+/**
+ * @brief AVX2/FMA accelerated direct convolution, see conv_direct()
+ */
+void avx2_conv(const float* x, size_t l1, const float* h, size_t l2, float* y,
+               size_t first, size_t count){
+    conv_direct<vec_avx2<float>>(x, l1, h, l2, y, first, count);
+}
+
+/**
+ * @brief AVX2/FMA accelerated double precision direct convolution, see conv_direct()
+ */
+void avx2_conv(const double* x, size_t l1, const double* h, size_t l2, double* y,
+               size_t first, size_t count){
+    conv_direct<vec_avx2<double>>(x, l1, h, l2, y, first, count);
+}
+
+/**
+ * @brief AVX2/FMA accelerated row of a 2D convolution, see conv2d_run()
+ */
+void avx2_conv2d_rows(const float* const* rows, const float* h, size_t kw, size_t kh, float* y, size_t count){
+    conv2d_run<vec_avx2<float>>(rows, h, kw, kh, y, count);
+}
@@ -0,0 +1,48 @@
+/**
+ * @file avx2_f64.cpp
+ * @author Sravan Senthilnathan
+ * @brief AVX2/FMA implementation of double precision vector and 4x4 Tensor arithmetic
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2023
+ * 
+ * Only what FMA changes: add, sub, mul and div stay on the AVX kernels.
+ */
+#include <immintrin.h>
+
+#include "x86_kernels.h"
+#include "simd_vec.h"
+#include "vector_driver.h"
+
+/**
+ * @brief AVX2/FMA accelerated double precision Vector Multiply-Add, one rounding
+ */
+void avx2_mul_add(const double* a, const double* b, const double* c, double* d, size_t n){
+    vec_mul_add<vec_avx2<double>>(a, b, c, d, n);
+}
+
+/**
+ * @brief AVX2/FMA accelerated double precision Tensor Multiplication function:
+ * 
+ * same row form as the AVX one with the multiply and accumulate fused.
+ * 
+ * @param a first operand tensor
+ * @param b second operand tensor
+ * @param c output tensor
+ */
+void avx2_mul(const Tensor64 a, const Tensor64 b, Tensor64 &c){
+    const __m256d Tb0 = _mm256_loadu_pd(b[0]);
+    const __m256d Tb1 = _mm256_loadu_pd(b[1]);
+    const __m256d Tb2 = _mm256_loadu_pd(b[2]);
+    const __m256d Tb3 = _mm256_loadu_pd(b[3]);
+
+    for(int i = 0; i < 4; ++i){
+        __m256d Row = _mm256_mul_pd(_mm256_broadcast_sd(&a[i][0]), Tb0);
+        Row = _mm256_fmadd_pd(_mm256_broadcast_sd(&a[i][1]), Tb1, Row);
+        Row = _mm256_fmadd_pd(_mm256_broadcast_sd(&a[i][2]), Tb2, Row);
+        Row = _mm256_fmadd_pd(_mm256_broadcast_sd(&a[i][3]), Tb3, Row);
+
+        _mm256_storeu_pd(c[i], Row);
+    }
+}
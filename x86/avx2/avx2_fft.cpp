@@ -0,0 +1,46 @@
+/**
+ * @file avx2_fft.cpp
+ * @author Sravan Senthilnathan
+ * @brief AVX2/FMA implementation of the FFT passes
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2023
+ * 
+ */
+#include <immintrin.h>
+
+#include "x86_kernels.h"
+#include "fft.h"
+
+/**
+ * @brief 8 lanes, complex products with FMA
+ */
+struct avx2_vec {
+    static constexpr size_t W = 8;
+    using reg = __m256;
+
+    static reg load(const float* p) { return _mm256_loadu_ps(p); }
+    static void store(float* p, reg a) { _mm256_storeu_ps(p, a); }
+    static reg add(reg a, reg b) { return _mm256_add_ps(a, b); }
+    static reg sub(reg a, reg b) { return _mm256_sub_ps(a, b); }
+    static reg mul(reg a, reg b) { return _mm256_mul_ps(a, b); }
+    static reg mul_add(reg a, reg b, reg c) { return _mm256_fmadd_ps(a, b, c); }
+    static reg mul_sub(reg a, reg b, reg c) { return _mm256_fmsub_ps(a, b, c); }
+};
+
+/**
+ * @brief AVX2/FMA accelerated complex FFT, see fft_forward()
+ */
+void avx2_fft(const fft_plan& p, const float* in_re, const float* in_im, size_t stride,
+              float* re, float* im){
+    fft_forward<avx2_vec>(p, in_re, in_im, stride, re, im);
+}
+
+/**
+ * @brief AVX2/FMA accelerated spectrum product, see fft_spectrum_mul()
+ */
+void avx2_spectrum_mul(const float* ar, const float* ai, const float* br, const float* bi,
+                       float* cr, float* ci, size_t n){
+    fft_spectrum_mul<avx2_vec>(ar, ai, br, bi, cr, ci, n);
+}
@@ -0,0 +1,70 @@
+/**
+ * @file avx2_gemm.cpp
+ * @author Sravan Senthilnathan
+ * @brief AVX2/FMA implementation of the blocked SGEMM
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2023
+ * 
+ */
+#include <immintrin.h>
+
+#include "x86_kernels.h"
+#include "gemm_driver.h"
+
+/**
+ * @brief 6x16 FMA micro-kernel: 12 ymm accumulators, two B loads and one
+ * broadcast of A per row and step, 12 FMAs per 8 loads/broadcasts
+ */
+struct avx2_gemm_6x16 {
+    static constexpr size_t MR = 6, NR = 16;
+    static constexpr size_t MC = 144, KC = 256, NC = 4080;
+
+    static void kernel(size_t kc, const float* a, const float* b,
+                       float* c, size_t ldc, float alpha, float beta){
+        __m256 acc[MR][2];
+#pragma GCC unroll 6
+        for(size_t i = 0; i < MR; ++i){
+            acc[i][0] = _mm256_setzero_ps();
+            acc[i][1] = _mm256_setzero_ps();
+        }
+
+        for(size_t p = 0; p < kc; ++p){
+            const __m256 b0 = _mm256_load_ps(b);
+            const __m256 b1 = _mm256_load_ps(b + 8);
+#pragma GCC unroll 6
+            for(size_t i = 0; i < MR; ++i){
+                const __m256 ai = _mm256_broadcast_ss(a + i);
+                acc[i][0] = _mm256_fmadd_ps(ai, b0, acc[i][0]);
+                acc[i][1] = _mm256_fmadd_ps(ai, b1, acc[i][1]);
+            }
+            a += MR;
+            b += NR;
+        }
+
+        const __m256 va = _mm256_set1_ps(alpha);
+        const __m256 vb = _mm256_set1_ps(beta);
+#pragma GCC unroll 6
+        for(size_t i = 0; i < MR; ++i){
+            float* ci = c + i * ldc;
+            __m256 c0 = _mm256_mul_ps(va, acc[i][0]);
+            __m256 c1 = _mm256_mul_ps(va, acc[i][1]);
+            if(beta != 0.0f){
+                c0 = _mm256_fmadd_ps(vb, _mm256_loadu_ps(ci), c0);
+                c1 = _mm256_fmadd_ps(vb, _mm256_loadu_ps(ci + 8), c1);
+            }
+            _mm256_storeu_ps(ci, c0);
+            _mm256_storeu_ps(ci + 8, c1);
+        }
+    }
+};
+
+/**
+ * @brief AVX2/FMA accelerated SGEMM function, see sgemm()
+ */
+void avx2_sgemm(bool trans_a, bool trans_b, size_t m, size_t n, size_t k,
+                float alpha, const float* a, size_t lda, const float* b, size_t ldb,
+                float beta, float* c, size_t ldc){
+    gemm_blocked<avx2_gemm_6x16>(trans_a, trans_b, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+}
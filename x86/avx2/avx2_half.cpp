@@ -0,0 +1,90 @@
+/**
+ * @file avx2_half.cpp
+ * @author Sravan Senthilnathan
+ * @brief AVX2/F16C FP16/BF16 storage kernels
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2023
+ * 
+ */
+#include <cmath>
+#include <immintrin.h>
+
+#include "x86_kernels.h"
+#include "half_driver.h"
+
+/**
+ * @brief 8 lanes, FP16 through F16C, BF16 widened by a shift and narrowed
+ * with an integer round to nearest even
+ */
+struct avx2_half_vec {
+    static constexpr size_t W = 8;
+    using reg = __m256;
+
+    static reg load(const float* p) { return _mm256_loadu_ps(p); }
+    static void store(float* p, reg a) { _mm256_storeu_ps(p, a); }
+    static reg zero() { return _mm256_setzero_ps(); }
+    static reg add(reg a, reg b) { return _mm256_add_ps(a, b); }
+    static reg mul(reg a, reg b) { return _mm256_mul_ps(a, b); }
+    static reg mul_add(reg a, reg b, reg c) { return _mm256_fmadd_ps(a, b, c); }
+    static float mul_add(float a, float b, float c) { return std::fma(a, b, c); }
+
+    static reg load_fp16(const uint16_t* p) {
+        return _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p)));
+    }
+    static void store_fp16(uint16_t* p, reg a) {
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(p), _mm256_cvtps_ph(a, _MM_FROUND_TO_NEAREST_INT));
+    }
+    static reg load_bf16(const uint16_t* p) {
+        const __m256i h = _mm256_cvtepu16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p)));
+        return _mm256_castsi256_ps(_mm256_slli_epi32(h, 16));
+    }
+    static void store_bf16(uint16_t* p, reg a) {
+        const __m256i x = _mm256_castps_si256(a);
+        const __m256i lsb = _mm256_and_si256(_mm256_srli_epi32(x, 16), _mm256_set1_epi32(1));
+        const __m256i rounded = _mm256_add_epi32(x, _mm256_add_epi32(lsb, _mm256_set1_epi32(0x7fff)));
+        // NaNs keep their upper half, made quiet:
+        const __m256i nan = _mm256_castps_si256(_mm256_cmp_ps(a, a, _CMP_UNORD_Q));
+        const __m256i quiet = _mm256_or_si256(x, _mm256_set1_epi32(0x400000));
+        const __m256i r = _mm256_srli_epi32(_mm256_blendv_epi8(rounded, quiet, nan), 16);
+        // packus works per 128 bit lane: halves 0 and 2 hold the 8 results
+        const __m256i packed = _mm256_permute4x64_epi64(_mm256_packus_epi32(r, r), 0x08);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(p), _mm256_castsi256_si128(packed));
+    }
+};
+
+/**
+ * @brief AVX2/F16C float to half conversion, see float_to_half()
+ */
+void avx2_to_half(const float* a, uint16_t* h, size_t n, simd_half_format format){
+    half_to<avx2_half_vec>(a, h, n, format);
+}
+
+/**
+ * @brief AVX2/F16C half to float conversion, see half_to_float()
+ */
+void avx2_from_half(const uint16_t* h, float* a, size_t n, simd_half_format format){
+    half_from<avx2_half_vec>(h, a, n, format);
+}
+
+/**
+ * @brief AVX2/F16C Vector Addition on half storage, see half_driver.h
+ */
+void avx2_add_half(const uint16_t* a, const uint16_t* b, uint16_t* c, size_t n, simd_half_format format){
+    half_binary<avx2_half_vec, false>(a, b, c, n, format);
+}
+
+/**
+ * @brief AVX2/F16C Vector Multiply on half storage, see half_driver.h
+ */
+void avx2_mul_half(const uint16_t* a, const uint16_t* b, uint16_t* c, size_t n, simd_half_format format){
+    half_binary<avx2_half_vec, true>(a, b, c, n, format);
+}
+
+/**
+ * @brief AVX2/F16C Dot Product of half operands, accumulated in float
+ */
+float avx2_dot_half(const uint16_t* a, const uint16_t* b, size_t n, simd_half_format format){
+    return half_dot<avx2_half_vec>(a, b, n, format);
+}
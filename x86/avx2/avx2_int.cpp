@@ -0,0 +1,290 @@
+/**
+ * @file avx2_int.cpp
+ * @author Sravan Senthilnathan
+ * @brief AVX2 integer, 8 bit dot product and quantized convolution kernels
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2023
+ * 
+ */
+#include <cstdint>
+#include <immintrin.h>
+
+#include "x86_kernels.h"
+#include "int_driver.h"
+
+namespace {
+
+__m256i load256(const void* p){
+    return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+}
+
+void store256(void* p, __m256i a){
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), a);
+}
+
+/**
+ * @brief the 16 bit products of the low and high 16 bytes of a and b,
+ * widened with the given extension
+ */
+template<__m256i (*Widen)(__m128i)>
+void mul8(__m256i a, __m256i b, __m256i& lo, __m256i& hi){
+    lo = _mm256_mullo_epi16(Widen(_mm256_castsi256_si128(a)), Widen(_mm256_castsi256_si128(b)));
+    hi = _mm256_mullo_epi16(Widen(_mm256_extracti128_si256(a, 1)), Widen(_mm256_extracti128_si256(b, 1)));
+}
+
+__m256i sign8(__m128i a) { return _mm256_cvtepi8_epi16(a); }
+__m256i zero8(__m128i a) { return _mm256_cvtepu8_epi16(a); }
+
+/**
+ * @brief packs work per 128 bit lane, this puts the 64 bit quarters of
+ * pack(lo, hi) back in the order of lo then hi
+ */
+__m256i in_order(__m256i packed){
+    return _mm256_permute4x64_epi64(packed, 0xd8);
+}
+
+/**
+ * @brief lanes of a + b (or a - b, given the operand signs that overflow)
+ * that overflowed, replaced by INT32_MAX or INT32_MIN from the sign of a
+ */
+__m256i saturate32(__m256i a, __m256i r, __m256i overflow){
+    const __m256i limit = _mm256_xor_si256(_mm256_srai_epi32(a, 31), _mm256_set1_epi32(INT32_MAX));
+    return _mm256_castps_si256(_mm256_blendv_ps(_mm256_castsi256_ps(r), _mm256_castsi256_ps(limit), _mm256_castsi256_ps(overflow)));
+}
+
+/**
+ * @brief 4 int32 products in double (exact wherever they fit int32), clamped and truncated back
+ */
+__m128i mul_sat4(__m128i a, __m128i b){
+    const __m256d p = _mm256_mul_pd(_mm256_cvtepi32_pd(a), _mm256_cvtepi32_pd(b));
+    return _mm256_cvttpd_epi32(_mm256_min_pd(_mm256_max_pd(p, _mm256_set1_pd(INT32_MIN)), _mm256_set1_pd(INT32_MAX)));
+}
+
+}
+
+struct avx2_i8_vec {
+    static constexpr size_t W = 32;
+    using reg = __m256i;
+
+    static reg load(const int8_t* p) { return load256(p); }
+    static void store(int8_t* p, reg a) { store256(p, a); }
+    static reg add(reg a, reg b) { return _mm256_add_epi8(a, b); }
+    static reg adds(reg a, reg b) { return _mm256_adds_epi8(a, b); }
+    static reg sub(reg a, reg b) { return _mm256_sub_epi8(a, b); }
+    static reg subs(reg a, reg b) { return _mm256_subs_epi8(a, b); }
+    static reg mul(reg a, reg b) {
+        reg lo, hi;
+        mul8<sign8>(a, b, lo, hi);
+        const reg low_bytes = _mm256_set1_epi16(0xff);
+        return in_order(_mm256_packus_epi16(_mm256_and_si256(lo, low_bytes), _mm256_and_si256(hi, low_bytes)));
+    }
+    static reg muls(reg a, reg b) {
+        reg lo, hi;
+        mul8<sign8>(a, b, lo, hi);
+        return in_order(_mm256_packs_epi16(lo, hi));
+    }
+};
+
+struct avx2_u8_vec {
+    static constexpr size_t W = 32;
+    using reg = __m256i;
+
+    static reg load(const uint8_t* p) { return load256(p); }
+    static void store(uint8_t* p, reg a) { store256(p, a); }
+    static reg add(reg a, reg b) { return _mm256_add_epi8(a, b); }
+    static reg adds(reg a, reg b) { return _mm256_adds_epu8(a, b); }
+    static reg sub(reg a, reg b) { return _mm256_sub_epi8(a, b); }
+    static reg subs(reg a, reg b) { return _mm256_subs_epu8(a, b); }
+    static reg mul(reg a, reg b) {
+        reg lo, hi;
+        mul8<zero8>(a, b, lo, hi);
+        const reg low_bytes = _mm256_set1_epi16(0xff);
+        return in_order(_mm256_packus_epi16(_mm256_and_si256(lo, low_bytes), _mm256_and_si256(hi, low_bytes)));
+    }
+    static reg muls(reg a, reg b) {
+        // the products are unsigned 16 bit, packus would read them as signed:
+        reg lo, hi;
+        mul8<zero8>(a, b, lo, hi);
+        const reg max = _mm256_set1_epi16(0xff);
+        return in_order(_mm256_packus_epi16(_mm256_min_epu16(lo, max), _mm256_min_epu16(hi, max)));
+    }
+};
+
+struct avx2_i16_vec {
+    static constexpr size_t W = 16;
+    using reg = __m256i;
+
+    static reg load(const int16_t* p) { return load256(p); }
+    static void store(int16_t* p, reg a) { store256(p, a); }
+    static reg add(reg a, reg b) { return _mm256_add_epi16(a, b); }
+    static reg adds(reg a, reg b) { return _mm256_adds_epi16(a, b); }
+    static reg sub(reg a, reg b) { return _mm256_sub_epi16(a, b); }
+    static reg subs(reg a, reg b) { return _mm256_subs_epi16(a, b); }
+    static reg mul(reg a, reg b) { return _mm256_mullo_epi16(a, b); }
+    static reg muls(reg a, reg b) {
+        // unpack and pack are both per lane, so the order survives:
+        const reg lo = _mm256_mullo_epi16(a, b), hi = _mm256_mulhi_epi16(a, b);
+        return _mm256_packs_epi32(_mm256_unpacklo_epi16(lo, hi), _mm256_unpackhi_epi16(lo, hi));
+    }
+};
+
+struct avx2_i32_vec {
+    static constexpr size_t W = 8;
+    using reg = __m256i;
+
+    static reg load(const int32_t* p) { return load256(p); }
+    static void store(int32_t* p, reg a) { store256(p, a); }
+    static reg add(reg a, reg b) { return _mm256_add_epi32(a, b); }
+    static reg adds(reg a, reg b) {
+        // overflow where a and b have the same sign and the sum another:
+        const reg s = _mm256_add_epi32(a, b);
+        return saturate32(a, s, _mm256_andnot_si256(_mm256_xor_si256(a, b), _mm256_xor_si256(a, s)));
+    }
+    static reg sub(reg a, reg b) { return _mm256_sub_epi32(a, b); }
+    static reg subs(reg a, reg b) {
+        // overflow where a and b differ in sign and the difference differs from a:
+        const reg d = _mm256_sub_epi32(a, b);
+        return saturate32(a, d, _mm256_and_si256(_mm256_xor_si256(a, b), _mm256_xor_si256(a, d)));
+    }
+    static reg mul(reg a, reg b) { return _mm256_mullo_epi32(a, b); }
+    static reg muls(reg a, reg b) {
+        const __m128i lo = mul_sat4(_mm256_castsi256_si128(a), _mm256_castsi256_si128(b));
+        const __m128i hi = mul_sat4(_mm256_extracti128_si256(a, 1), _mm256_extracti128_si256(b, 1));
+        return _mm256_set_m128i(hi, lo);
+    }
+};
+
+/**
+ * @brief 32 bytes per step, widened to 16 bits and multiplied pairwise
+ * into 8 int32 lanes with vpmaddwd
+ */
+struct avx2_dot_vec {
+    static constexpr size_t W = 32;
+    using reg = __m256i;
+
+    static reg zero() { return _mm256_setzero_si256(); }
+    static reg dot(reg acc, const uint8_t* a, const int8_t* b) {
+        const reg x = load256(a), y = load256(b);
+        const reg lo = _mm256_madd_epi16(_mm256_cvtepu8_epi16(_mm256_castsi256_si128(x)), _mm256_cvtepi8_epi16(_mm256_castsi256_si128(y)));
+        const reg hi = _mm256_madd_epi16(_mm256_cvtepu8_epi16(_mm256_extracti128_si256(x, 1)), _mm256_cvtepi8_epi16(_mm256_extracti128_si256(y, 1)));
+        return _mm256_add_epi32(acc, _mm256_add_epi32(lo, hi));
+    }
+    static reg dot(reg acc, const int8_t* a, const int8_t* b) {
+        const reg x = load256(a), y = load256(b);
+        const reg lo = _mm256_madd_epi16(_mm256_cvtepi8_epi16(_mm256_castsi256_si128(x)), _mm256_cvtepi8_epi16(_mm256_castsi256_si128(y)));
+        const reg hi = _mm256_madd_epi16(_mm256_cvtepi8_epi16(_mm256_extracti128_si256(x, 1)), _mm256_cvtepi8_epi16(_mm256_extracti128_si256(y, 1)));
+        return _mm256_add_epi32(acc, _mm256_add_epi32(lo, hi));
+    }
+    static int64_t hsum(reg a) {
+        // widened first, two full lanes can overflow int32:
+        const reg wide = _mm256_add_epi64(_mm256_cvtepi32_epi64(_mm256_castsi256_si128(a)),
+                                          _mm256_cvtepi32_epi64(_mm256_extracti128_si256(a, 1)));
+        const __m128i s = _mm_add_epi64(_mm256_castsi256_si128(wide), _mm256_extracti128_si256(wide, 1));
+        return _mm_cvtsi128_si64(s) + _mm_extract_epi64(s, 1);
+    }
+};
+
+/**
+ * @brief 16 outputs per step, the pairs of sse_quant_vec per 128 bit
+ * lane: lo holds outputs 0-3 and 8-11, hi 4-7 and 12-15, which the per
+ * lane packs of requantize() put back in order
+ */
+struct avx2_quant_vec {
+    static constexpr size_t W = 16;
+    using reg = __m256i;
+
+    static reg zero() { return _mm256_setzero_si256(); }
+    static reg load(const int16_t* p) { return load256(p); }
+    static reg taps(int16_t h0, int16_t h1) { return _mm256_set1_epi32((int32_t)(((uint32_t)(uint16_t)h1 << 16) | (uint16_t)h0)); }
+    static void madd(reg& lo, reg& hi, reg x0, reg x1, reg t) {
+        lo = _mm256_add_epi32(lo, _mm256_madd_epi16(_mm256_unpacklo_epi16(x0, x1), t));
+        hi = _mm256_add_epi32(hi, _mm256_madd_epi16(_mm256_unpackhi_epi16(x0, x1), t));
+    }
+    static reg requantize32(reg acc, float multiplier, int32_t zero_point) {
+        const __m256 p = _mm256_mul_ps(_mm256_cvtepi32_ps(acc), _mm256_set1_ps(multiplier));
+        const __m256 clamped = _mm256_min_ps(_mm256_max_ps(p, _mm256_set1_ps(-65536.0f)), _mm256_set1_ps(65536.0f));
+        return _mm256_add_epi32(_mm256_cvtps_epi32(clamped), _mm256_set1_epi32(zero_point));
+    }
+    static void requantize(uint8_t* y, reg lo, reg hi, float multiplier, int32_t zero_point) {
+        const reg q = _mm256_packs_epi32(requantize32(lo, multiplier, zero_point), requantize32(hi, multiplier, zero_point));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(y), _mm_packus_epi16(_mm256_castsi256_si128(q), _mm256_extracti128_si256(q, 1)));
+    }
+};
+
+/**
+ * @brief AVX2 integer Vector Addition, see the integer add()
+ */
+void avx2_add(const int8_t* a, const int8_t* b, int8_t* c, size_t n, simd_overflow overflow){
+    int_binary<avx2_i8_vec, int_op::add>(a, b, c, n, overflow);
+}
+
+void avx2_add(const uint8_t* a, const uint8_t* b, uint8_t* c, size_t n, simd_overflow overflow){
+    int_binary<avx2_u8_vec, int_op::add>(a, b, c, n, overflow);
+}
+
+void avx2_add(const int16_t* a, const int16_t* b, int16_t* c, size_t n, simd_overflow overflow){
+    int_binary<avx2_i16_vec, int_op::add>(a, b, c, n, overflow);
+}
+
+void avx2_add(const int32_t* a, const int32_t* b, int32_t* c, size_t n, simd_overflow overflow){
+    int_binary<avx2_i32_vec, int_op::add>(a, b, c, n, overflow);
+}
+
+/**
+ * @brief AVX2 integer Vector Subtraction, see the integer sub()
+ */
+void avx2_sub(const int8_t* a, const int8_t* b, int8_t* c, size_t n, simd_overflow overflow){
+    int_binary<avx2_i8_vec, int_op::sub>(a, b, c, n, overflow);
+}
+
+void avx2_sub(const uint8_t* a, const uint8_t* b, uint8_t* c, size_t n, simd_overflow overflow){
+    int_binary<avx2_u8_vec, int_op::sub>(a, b, c, n, overflow);
+}
+
+void avx2_sub(const int16_t* a, const int16_t* b, int16_t* c, size_t n, simd_overflow overflow){
+    int_binary<avx2_i16_vec, int_op::sub>(a, b, c, n, overflow);
+}
+
+void avx2_sub(const int32_t* a, const int32_t* b, int32_t* c, size_t n, simd_overflow overflow){
+    int_binary<avx2_i32_vec, int_op::sub>(a, b, c, n, overflow);
+}
+
+/**
+ * @brief AVX2 integer Vector Multiply, see the integer mul()
+ */
+void avx2_mul(const int8_t* a, const int8_t* b, int8_t* c, size_t n, simd_overflow overflow){
+    int_binary<avx2_i8_vec, int_op::mul>(a, b, c, n, overflow);
+}
+
+void avx2_mul(const uint8_t* a, const uint8_t* b, uint8_t* c, size_t n, simd_overflow overflow){
+    int_binary<avx2_u8_vec, int_op::mul>(a, b, c, n, overflow);
+}
+
+void avx2_mul(const int16_t* a, const int16_t* b, int16_t* c, size_t n, simd_overflow overflow){
+    int_binary<avx2_i16_vec, int_op::mul>(a, b, c, n, overflow);
+}
+
+void avx2_mul(const int32_t* a, const int32_t* b, int32_t* c, size_t n, simd_overflow overflow){
+    int_binary<avx2_i32_vec, int_op::mul>(a, b, c, n, overflow);
+}
+
+/**
+ * @brief AVX2 8 bit Dot Product, see the 8 bit dot()
+ */
+int64_t avx2_dot(const uint8_t* a, const int8_t* b, size_t n){
+    return int_dot<avx2_dot_vec>(a, b, n);
+}
+
+int64_t avx2_dot(const int8_t* a, const int8_t* b, size_t n){
+    return int_dot<avx2_dot_vec>(a, b, n);
+}
+
+/**
+ * @brief AVX2 quantized convolution of widened operands, see int_driver.h
+ */
+void avx2_conv_quant(const int16_t* x, const int16_t* h, size_t m, uint8_t* y, size_t count,
+                     float multiplier, int32_t zero_point){
+    quant_conv_run<avx2_quant_vec>(x, h, m, y, count, multiplier, zero_point);
+}
@@ -0,0 +1,69 @@
+/**
+ * @file avx2_math.cpp
+ * @author Sravan Senthilnathan
+ * @brief AVX2/FMA elementwise exp, log, sin, cos, tanh, sigmoid, erf and pow
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2023
+ * 
+ */
+#include "x86_kernels.h"
+#include "simd_vec.h"
+#include "math_driver.h"
+
+/**
+ * @brief AVX2/FMA e^x, see math_driver.h
+ */
+void avx2_exp(const float* a, float* b, size_t n, simd_math_mode mode){
+    math_unary<vec_avx2<float>, math_fn::exp>(a, b, n, mode);
+}
+
+/**
+ * @brief AVX2/FMA natural logarithm, see math_driver.h
+ */
+void avx2_log(const float* a, float* b, size_t n, simd_math_mode mode){
+    math_unary<vec_avx2<float>, math_fn::log>(a, b, n, mode);
+}
+
+/**
+ * @brief AVX2/FMA sine, see math_driver.h
+ */
+void avx2_sin(const float* a, float* b, size_t n, simd_math_mode mode){
+    math_unary<vec_avx2<float>, math_fn::sin>(a, b, n, mode);
+}
+
+/**
+ * @brief AVX2/FMA cosine, see math_driver.h
+ */
+void avx2_cos(const float* a, float* b, size_t n, simd_math_mode mode){
+    math_unary<vec_avx2<float>, math_fn::cos>(a, b, n, mode);
+}
+
+/**
+ * @brief AVX2/FMA hyperbolic tangent, see math_driver.h
+ */
+void avx2_tanh(const float* a, float* b, size_t n, simd_math_mode mode){
+    math_unary<vec_avx2<float>, math_fn::tanh>(a, b, n, mode);
+}
+
+/**
+ * @brief AVX2/FMA logistic function, see math_driver.h
+ */
+void avx2_sigmoid(const float* a, float* b, size_t n, simd_math_mode mode){
+    math_unary<vec_avx2<float>, math_fn::sigmoid>(a, b, n, mode);
+}
+
+/**
+ * @brief AVX2/FMA error function, see math_driver.h
+ */
+void avx2_erf(const float* a, float* b, size_t n, simd_math_mode mode){
+    math_unary<vec_avx2<float>, math_fn::erf>(a, b, n, mode);
+}
+
+/**
+ * @brief AVX2/FMA power function, see math_driver.h
+ */
+void avx2_pow(const float* a, const float* b, float* c, size_t n, simd_math_mode mode){
+    math_pow<vec_avx2<float>, vec_avx2<double>>(a, b, c, n, mode);
+}
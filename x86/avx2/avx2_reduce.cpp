@@ -0,0 +1,55 @@
+/**
+ * @file avx2_reduce.cpp
+ * @author Sravan Senthilnathan
+ * @brief AVX2/FMA sum, dot product, min/max and argmin/argmax
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2023
+ * 
+ */
+#include "x86_kernels.h"
+#include "simd_vec.h"
+#include "reduce_driver.h"
+
+/**
+ * @brief AVX2/FMA Vector Sum, see reduce_driver.h for the modes
+ */
+float avx2_sum(const float* a, size_t n, simd_sum_mode mode){
+    return reduce_sum<vec_avx2<float>>(a, n, mode);
+}
+
+/**
+ * @brief AVX2/FMA Dot Product, see reduce_driver.h for the modes
+ */
+float avx2_dot(const float* a, const float* b, size_t n, simd_sum_mode mode){
+    return reduce_dot<vec_avx2<float>>(a, b, n, mode);
+}
+
+/**
+ * @brief AVX2/FMA Vector Minimum, NaNs skipped
+ */
+float avx2_minimum(const float* a, size_t n){
+    return reduce_extreme<vec_avx2<float>, false>(a, 0, n);
+}
+
+/**
+ * @brief AVX2/FMA Vector Maximum, NaNs skipped
+ */
+float avx2_maximum(const float* a, size_t n){
+    return reduce_extreme<vec_avx2<float>, true>(a, 0, n);
+}
+
+/**
+ * @brief AVX2/FMA Vector Argmin, the first index of the minimum
+ */
+size_t avx2_argmin(const float* a, size_t n){
+    return reduce_arg_extreme<vec_avx2<float>, false>(a, n);
+}
+
+/**
+ * @brief AVX2/FMA Vector Argmax, the first index of the maximum
+ */
+size_t avx2_argmax(const float* a, size_t n){
+    return reduce_arg_extreme<vec_avx2<float>, true>(a, n);
+}
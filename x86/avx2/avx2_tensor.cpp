@@ -0,0 +1,107 @@
+/**
+ * @file avx2_tensor.cpp
+ * @author Sravan Senthilnathan
+ * @brief AVX2/FMA implementation of 4x4 Tensor arithmetic, single and batched
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2023
+ * 
+ */
+#include <immintrin.h>
+
+#include "x86_kernels.h"
+
+/**
+ * @brief AVX2/FMA accelerated Tensor Multiplication function:
+ * 
+ * same two-rows-per-register layout as avx_mul with the multiply and
+ * accumulate fused.
+ * 
+ * @param a first operand tensor
+ * @param b second operand tensor
+ * @param c output tensor
+ */
+void avx2_mul(const Tensor a, const Tensor b, Tensor &c){
+    const __m256 Ta01 = _mm256_loadu_ps(a[0]);
+    const __m256 Ta23 = _mm256_loadu_ps(a[2]);
+
+    const __m256 Tb0 = _mm256_broadcast_ps((const __m128*)b[0]);
+    const __m256 Tb1 = _mm256_broadcast_ps((const __m128*)b[1]);
+    const __m256 Tb2 = _mm256_broadcast_ps((const __m128*)b[2]);
+    const __m256 Tb3 = _mm256_broadcast_ps((const __m128*)b[3]);
+
+    __m256 Tc01 = _mm256_mul_ps(_mm256_permute_ps(Ta01, 0x00), Tb0);
+    Tc01 = _mm256_fmadd_ps(_mm256_permute_ps(Ta01, 0x55), Tb1, Tc01);
+    Tc01 = _mm256_fmadd_ps(_mm256_permute_ps(Ta01, 0xAA), Tb2, Tc01);
+    Tc01 = _mm256_fmadd_ps(_mm256_permute_ps(Ta01, 0xFF), Tb3, Tc01);
+
+    __m256 Tc23 = _mm256_mul_ps(_mm256_permute_ps(Ta23, 0x00), Tb0);
+    Tc23 = _mm256_fmadd_ps(_mm256_permute_ps(Ta23, 0x55), Tb1, Tc23);
+    Tc23 = _mm256_fmadd_ps(_mm256_permute_ps(Ta23, 0xAA), Tb2, Tc23);
+    Tc23 = _mm256_fmadd_ps(_mm256_permute_ps(Ta23, 0xFF), Tb3, Tc23);
+
+    _mm256_storeu_ps(c[0], Tc01);
+    _mm256_storeu_ps(c[2], Tc23);
+}
+
+/**
+ * @brief AVX2/FMA accelerated batched Tensor Multiplication function, see mul_batch()
+ * 
+ * two tensors per pass: the low 128 bit lane holds a row of tensor m, the
+ * high lane the same row of tensor m + 1, so the row form of avx2_mul
+ * needs no cross lane broadcasts of b.
+ */
+void avx2_mul_batch(const Tensor* a, const Tensor* b, Tensor* c, size_t count){
+    size_t m = 0;
+    for(; m + 2 <= count; m += 2){
+        const __m256 Tb0 = _mm256_loadu2_m128(b[m + 1][0], b[m][0]);
+        const __m256 Tb1 = _mm256_loadu2_m128(b[m + 1][1], b[m][1]);
+        const __m256 Tb2 = _mm256_loadu2_m128(b[m + 1][2], b[m][2]);
+        const __m256 Tb3 = _mm256_loadu2_m128(b[m + 1][3], b[m][3]);
+
+        for(int i = 0; i < 4; ++i){
+            const __m256 Ta = _mm256_loadu2_m128(a[m + 1][i], a[m][i]);
+
+            __m256 Tc = _mm256_mul_ps(_mm256_permute_ps(Ta, 0x00), Tb0);
+            Tc = _mm256_fmadd_ps(_mm256_permute_ps(Ta, 0x55), Tb1, Tc);
+            Tc = _mm256_fmadd_ps(_mm256_permute_ps(Ta, 0xAA), Tb2, Tc);
+            Tc = _mm256_fmadd_ps(_mm256_permute_ps(Ta, 0xFF), Tb3, Tc);
+
+            _mm256_storeu2_m128(c[m + 1][i], c[m][i], Tc);
+        }
+    }
+    if(m < count){
+        avx2_mul(a[m], b[m], c[m]);
+    }
+}
+
+/**
+ * @brief AVX2/FMA accelerated structure-of-arrays batched Tensor
+ * Multiplication function, see mul_batch_soa()
+ * 
+ * 8 tensors per pass, every element plane is one ymm register, so there is
+ * no shuffling at all; the remainder goes to the scalar reference.
+ */
+void avx2_mul_batch_soa(const float* a, const float* b, float* c, size_t count, size_t stride){
+    size_t m = 0;
+    for(; m + 8 <= count; m += 8){
+        for(int i = 0; i < 4; ++i){
+            const __m256 Ta0 = _mm256_loadu_ps(a + (4 * i + 0) * stride + m);
+            const __m256 Ta1 = _mm256_loadu_ps(a + (4 * i + 1) * stride + m);
+            const __m256 Ta2 = _mm256_loadu_ps(a + (4 * i + 2) * stride + m);
+            const __m256 Ta3 = _mm256_loadu_ps(a + (4 * i + 3) * stride + m);
+
+            for(int j = 0; j < 4; ++j){
+                __m256 Tc = _mm256_mul_ps(Ta0, _mm256_loadu_ps(b + (0 + j) * stride + m));
+                Tc = _mm256_fmadd_ps(Ta1, _mm256_loadu_ps(b + (4 + j) * stride + m), Tc);
+                Tc = _mm256_fmadd_ps(Ta2, _mm256_loadu_ps(b + (8 + j) * stride + m), Tc);
+                Tc = _mm256_fmadd_ps(Ta3, _mm256_loadu_ps(b + (12 + j) * stride + m), Tc);
+                _mm256_storeu_ps(c + (4 * i + j) * stride + m, Tc);
+            }
+        }
+    }
+    if(m < count){
+        mul_batch_soa(a + m, b + m, c + m, count - m, stride);
+    }
+}
@@ -0,0 +1,65 @@
+/**
+ * @file avx2_vector.cpp
+ * @author Sravan Senthilnathan
+ * @brief AVX2/FMA implementation of parallel floating point vector arithmetic
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2023
+ * 
+ */
+#include "x86_kernels.h"
+#include "simd_vec.h"
+#include "recip_driver.h"
+#include "vector_driver.h"
+
+/**
+ * @brief AVX2/FMA accelerated Vector Multiply-Add function, d = a * b + c:
+ * 
+ * @param a first factor array
+ * @param b second factor array
+ * @param c addend array
+ * @param d output array (may alias a, b or c)
+ * @param n number of elements
+ */
+void avx2_mul_add(const float* a, const float* b, const float* c, float* d, size_t n){
+    vec_mul_add<vec_avx2<float>>(a, b, c, d, n);
+}
+
+/**
+ * @brief AVX2/FMA accelerated Vector Division function in the given mode, see
+ * recip_driver.h:
+ * 
+ * @param a first operand array
+ * @param b second operand array
+ * @param c output array (may alias a or b)
+ * @param n number of elements
+ * @param mode exact, or the reciprocal estimate and Newton-Raphson steps
+ */
+void avx2_div(const float* a, const float* b, float* c, size_t n, simd_div_mode mode){
+    recip_div<vec_avx2<float>>(a, b, c, n, mode);
+}
+
+/**
+ * @brief AVX2/FMA accelerated Vector Square Root function, see recip_driver.h:
+ * 
+ * @param a operand array
+ * @param b output array (may alias a)
+ * @param n number of elements
+ * @param mode exact, or the reciprocal square root estimate and Newton-Raphson steps
+ */
+void avx2_sqrt(const float* a, float* b, size_t n, simd_div_mode mode){
+    recip_unary<vec_avx2<float>, recip_fn::sqrt>(a, b, n, mode);
+}
+
+/**
+ * @brief AVX2/FMA accelerated Vector Reciprocal Square Root function, see recip_driver.h:
+ * 
+ * @param a operand array
+ * @param b output array (may alias a)
+ * @param n number of elements
+ * @param mode exact, or the reciprocal square root estimate and Newton-Raphson steps
+ */
+void avx2_rsqrt(const float* a, float* b, size_t n, simd_div_mode mode){
+    recip_unary<vec_avx2<float>, recip_fn::rsqrt>(a, b, n, mode);
+}
@@ -0,0 +1,112 @@
+/**
+ * @file avx512_f64.cpp
+ * @author Sravan Senthilnathan
+ * @brief AVX-512 implementation of double precision vector and 4x4 Tensor arithmetic
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2023
+ * 
+ */
+#include <immintrin.h>
+
+#include "x86_kernels.h"
+#include "simd_vec.h"
+#include "vector_driver.h"
+
+/**
+ * @brief AVX-512 accelerated double precision Vector Addition, see vec_binary()
+ */
+void avx512_add(const double* a, const double* b, double* c, size_t n){
+    vec_binary<vec_avx512<double>, vec_op::add>(a, b, c, n);
+}
+
+/**
+ * @brief AVX-512 accelerated double precision Vector Subtraction, see vec_binary()
+ */
+void avx512_sub(const double* a, const double* b, double* c, size_t n){
+    vec_binary<vec_avx512<double>, vec_op::sub>(a, b, c, n);
+}
+
+/**
+ * @brief AVX-512 accelerated double precision Vector Multiply, see vec_binary()
+ */
+void avx512_mul(const double* a, const double* b, double* c, size_t n){
+    vec_binary<vec_avx512<double>, vec_op::mul>(a, b, c, n);
+}
+
+/**
+ * @brief AVX-512 accelerated double precision Vector Division, see vec_binary()
+ */
+void avx512_div(const double* a, const double* b, double* c, size_t n){
+    vec_binary<vec_avx512<double>, vec_op::div>(a, b, c, n);
+}
+
+/**
+ * @brief AVX-512 accelerated double precision Vector Multiply-Add, one rounding
+ */
+void avx512_mul_add(const double* a, const double* b, const double* c, double* d, size_t n){
+    vec_mul_add<vec_avx512<double>>(a, b, c, d, n);
+}
+
+/**
+ * @brief AVX-512 accelerated double precision Tensor Addition function:
+ * 
+ * two rows per 512 bit register.
+ * 
+ * @param a first operand tensor
+ * @param b second operand tensor
+ * @param c output tensor
+ */
+void avx512_add(const Tensor64 a, const Tensor64 b, Tensor64 &c){
+    _mm512_storeu_pd(c[0], _mm512_add_pd(_mm512_loadu_pd(a[0]), _mm512_loadu_pd(b[0])));
+    _mm512_storeu_pd(c[2], _mm512_add_pd(_mm512_loadu_pd(a[2]), _mm512_loadu_pd(b[2])));
+}
+
+/**
+ * @brief AVX-512 accelerated double precision Tensor Subtraction function:
+ * 
+ * two rows per 512 bit register.
+ * 
+ * @param a first operand tensor
+ * @param b second operand tensor
+ * @param c output tensor
+ */
+void avx512_sub(const Tensor64 a, const Tensor64 b, Tensor64 &c){
+    _mm512_storeu_pd(c[0], _mm512_sub_pd(_mm512_loadu_pd(a[0]), _mm512_loadu_pd(b[0])));
+    _mm512_storeu_pd(c[2], _mm512_sub_pd(_mm512_loadu_pd(a[2]), _mm512_loadu_pd(b[2])));
+}
+
+/**
+ * @brief AVX-512 accelerated double precision Tensor Multiplication function:
+ * 
+ * the float AVX layout one size up: two rows of a per 512 bit register,
+ * _mm512_permutex_pd spreads a[i][k] over its 256 bit row and b[k] is
+ * broadcast into both halves.
+ * 
+ * @param a first operand tensor
+ * @param b second operand tensor
+ * @param c output tensor
+ */
+void avx512_mul(const Tensor64 a, const Tensor64 b, Tensor64 &c){
+    const __m512d Ta01 = _mm512_loadu_pd(a[0]);
+    const __m512d Ta23 = _mm512_loadu_pd(a[2]);
+
+    const __m512d Tb0 = _mm512_broadcast_f64x4(_mm256_loadu_pd(b[0]));
+    const __m512d Tb1 = _mm512_broadcast_f64x4(_mm256_loadu_pd(b[1]));
+    const __m512d Tb2 = _mm512_broadcast_f64x4(_mm256_loadu_pd(b[2]));
+    const __m512d Tb3 = _mm512_broadcast_f64x4(_mm256_loadu_pd(b[3]));
+
+    __m512d Tc01 = _mm512_mul_pd(_mm512_permutex_pd(Ta01, 0x00), Tb0);
+    Tc01 = _mm512_fmadd_pd(_mm512_permutex_pd(Ta01, 0x55), Tb1, Tc01);
+    Tc01 = _mm512_fmadd_pd(_mm512_permutex_pd(Ta01, 0xAA), Tb2, Tc01);
+    Tc01 = _mm512_fmadd_pd(_mm512_permutex_pd(Ta01, 0xFF), Tb3, Tc01);
+
+    __m512d Tc23 = _mm512_mul_pd(_mm512_permutex_pd(Ta23, 0x00), Tb0);
+    Tc23 = _mm512_fmadd_pd(_mm512_permutex_pd(Ta23, 0x55), Tb1, Tc23);
+    Tc23 = _mm512_fmadd_pd(_mm512_permutex_pd(Ta23, 0xAA), Tb2, Tc23);
+    Tc23 = _mm512_fmadd_pd(_mm512_permutex_pd(Ta23, 0xFF), Tb3, Tc23);
+
+    _mm512_storeu_pd(c[0], Tc01);
+    _mm512_storeu_pd(c[2], Tc23);
+}
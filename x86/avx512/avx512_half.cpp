@@ -0,0 +1,87 @@
+/**
+ * @file avx512_half.cpp
+ * @author Sravan Senthilnathan
+ * @brief AVX-512 FP16/BF16 storage kernels
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2023
+ * 
+ */
+#include <cmath>
+#include <immintrin.h>
+
+#include "x86_kernels.h"
+#include "half_driver.h"
+
+/**
+ * @brief 16 lanes, FP16 through the AVX-512F vcvtph2ps/vcvtps2ph, BF16
+ * widened by a shift and narrowed by vpmovdw after rounding
+ */
+struct avx512_half_vec {
+    static constexpr size_t W = 16;
+    using reg = __m512;
+
+    static reg load(const float* p) { return _mm512_loadu_ps(p); }
+    static void store(float* p, reg a) { _mm512_storeu_ps(p, a); }
+    static reg zero() { return _mm512_setzero_ps(); }
+    static reg add(reg a, reg b) { return _mm512_add_ps(a, b); }
+    static reg mul(reg a, reg b) { return _mm512_mul_ps(a, b); }
+    static reg mul_add(reg a, reg b, reg c) { return _mm512_fmadd_ps(a, b, c); }
+    static float mul_add(float a, float b, float c) { return std::fma(a, b, c); }
+
+    static reg load_fp16(const uint16_t* p) {
+        return _mm512_cvtph_ps(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)));
+    }
+    static void store_fp16(uint16_t* p, reg a) {
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), _mm512_cvtps_ph(a, _MM_FROUND_TO_NEAREST_INT));
+    }
+    static reg load_bf16(const uint16_t* p) {
+        const __m512i h = _mm512_cvtepu16_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)));
+        return _mm512_castsi512_ps(_mm512_slli_epi32(h, 16));
+    }
+    static void store_bf16(uint16_t* p, reg a) {
+        const __m512i x = _mm512_castps_si512(a);
+        const __m512i lsb = _mm512_and_si512(_mm512_srli_epi32(x, 16), _mm512_set1_epi32(1));
+        const __m512i rounded = _mm512_add_epi32(x, _mm512_add_epi32(lsb, _mm512_set1_epi32(0x7fff)));
+        // NaNs keep their upper half, made quiet:
+        const __mmask16 nan = _mm512_cmp_ps_mask(a, a, _CMP_UNORD_Q);
+        const __m512i r = _mm512_mask_or_epi32(rounded, nan, x, _mm512_set1_epi32(0x400000));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), _mm512_cvtepi32_epi16(_mm512_srli_epi32(r, 16)));
+    }
+};
+
+/**
+ * @brief AVX-512 float to half conversion, see float_to_half()
+ */
+void avx512_to_half(const float* a, uint16_t* h, size_t n, simd_half_format format){
+    half_to<avx512_half_vec>(a, h, n, format);
+}
+
+/**
+ * @brief AVX-512 half to float conversion, see half_to_float()
+ */
+void avx512_from_half(const uint16_t* h, float* a, size_t n, simd_half_format format){
+    half_from<avx512_half_vec>(h, a, n, format);
+}
+
+/**
+ * @brief AVX-512 Vector Addition on half storage, see half_driver.h
+ */
+void avx512_add_half(const uint16_t* a, const uint16_t* b, uint16_t* c, size_t n, simd_half_format format){
+    half_binary<avx512_half_vec, false>(a, b, c, n, format);
+}
+
+/**
+ * @brief AVX-512 Vector Multiply on half storage, see half_driver.h
+ */
+void avx512_mul_half(const uint16_t* a, const uint16_t* b, uint16_t* c, size_t n, simd_half_format format){
+    half_binary<avx512_half_vec, true>(a, b, c, n, format);
+}
+
+/**
+ * @brief AVX-512 Dot Product of half operands, accumulated in float
+ */
+float avx512_dot_half(const uint16_t* a, const uint16_t* b, size_t n, simd_half_format format){
+    return half_dot<avx512_half_vec>(a, b, n, format);
+}
@@ -0,0 +1,272 @@
+/**
+ * @file avx512_int.cpp
+ * @author Sravan Senthilnathan
+ * @brief AVX-512 integer, 8 bit dot product and quantized convolution kernels
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2023
+ * 
+ */
+#include <cstdint>
+#include <immintrin.h>
+
+#include "x86_kernels.h"
+#include "int_driver.h"
+
+namespace {
+
+/**
+ * @brief the 16 bit products of the low and high 32 bytes of a and b,
+ * widened with the given extension
+ */
+template<__m512i (*Widen)(__m256i)>
+void mul8(__m512i a, __m512i b, __m512i& lo, __m512i& hi){
+    lo = _mm512_mullo_epi16(Widen(_mm512_castsi512_si256(a)), Widen(_mm512_castsi512_si256(b)));
+    hi = _mm512_mullo_epi16(Widen(_mm512_extracti64x4_epi64(a, 1)), Widen(_mm512_extracti64x4_epi64(b, 1)));
+}
+
+__m512i sign8(__m256i a) { return _mm512_cvtepi8_epi16(a); }
+__m512i zero8(__m256i a) { return _mm512_cvtepu8_epi16(a); }
+
+__m512i join(__m256i lo, __m256i hi){
+    return _mm512_inserti64x4(_mm512_castsi256_si512(lo), hi, 1);
+}
+
+/**
+ * @brief lanes of a + b (or a - b) flagged in the sign bits of overflow,
+ * replaced by INT32_MAX or INT32_MIN from the sign of a
+ */
+__m512i saturate32(__m512i a, __m512i r, __m512i overflow){
+    const __m512i limit = _mm512_xor_si512(_mm512_srai_epi32(a, 31), _mm512_set1_epi32(INT32_MAX));
+    return _mm512_mask_blend_epi32(_mm512_movepi32_mask(overflow), r, limit);
+}
+
+/**
+ * @brief 8 int32 products in double (exact wherever they fit int32), clamped and truncated back
+ */
+__m256i mul_sat8(__m256i a, __m256i b){
+    const __m512d p = _mm512_mul_pd(_mm512_cvtepi32_pd(a), _mm512_cvtepi32_pd(b));
+    return _mm512_cvttpd_epi32(_mm512_min_pd(_mm512_max_pd(p, _mm512_set1_pd(INT32_MIN)), _mm512_set1_pd(INT32_MAX)));
+}
+
+}
+
+struct avx512_i8_vec {
+    static constexpr size_t W = 64;
+    using reg = __m512i;
+
+    static reg load(const int8_t* p) { return _mm512_loadu_si512(p); }
+    static void store(int8_t* p, reg a) { _mm512_storeu_si512(p, a); }
+    static reg add(reg a, reg b) { return _mm512_add_epi8(a, b); }
+    static reg adds(reg a, reg b) { return _mm512_adds_epi8(a, b); }
+    static reg sub(reg a, reg b) { return _mm512_sub_epi8(a, b); }
+    static reg subs(reg a, reg b) { return _mm512_subs_epi8(a, b); }
+    static reg mul(reg a, reg b) {
+        reg lo, hi;
+        mul8<sign8>(a, b, lo, hi);
+        return join(_mm512_cvtepi16_epi8(lo), _mm512_cvtepi16_epi8(hi));
+    }
+    static reg muls(reg a, reg b) {
+        reg lo, hi;
+        mul8<sign8>(a, b, lo, hi);
+        return join(_mm512_cvtsepi16_epi8(lo), _mm512_cvtsepi16_epi8(hi));
+    }
+};
+
+struct avx512_u8_vec {
+    static constexpr size_t W = 64;
+    using reg = __m512i;
+
+    static reg load(const uint8_t* p) { return _mm512_loadu_si512(p); }
+    static void store(uint8_t* p, reg a) { _mm512_storeu_si512(p, a); }
+    static reg add(reg a, reg b) { return _mm512_add_epi8(a, b); }
+    static reg adds(reg a, reg b) { return _mm512_adds_epu8(a, b); }
+    static reg sub(reg a, reg b) { return _mm512_sub_epi8(a, b); }
+    static reg subs(reg a, reg b) { return _mm512_subs_epu8(a, b); }
+    static reg mul(reg a, reg b) {
+        reg lo, hi;
+        mul8<zero8>(a, b, lo, hi);
+        return join(_mm512_cvtepi16_epi8(lo), _mm512_cvtepi16_epi8(hi));
+    }
+    static reg muls(reg a, reg b) {
+        reg lo, hi;
+        mul8<zero8>(a, b, lo, hi);
+        return join(_mm512_cvtusepi16_epi8(lo), _mm512_cvtusepi16_epi8(hi));
+    }
+};
+
+struct avx512_i16_vec {
+    static constexpr size_t W = 32;
+    using reg = __m512i;
+
+    static reg load(const int16_t* p) { return _mm512_loadu_si512(p); }
+    static void store(int16_t* p, reg a) { _mm512_storeu_si512(p, a); }
+    static reg add(reg a, reg b) { return _mm512_add_epi16(a, b); }
+    static reg adds(reg a, reg b) { return _mm512_adds_epi16(a, b); }
+    static reg sub(reg a, reg b) { return _mm512_sub_epi16(a, b); }
+    static reg subs(reg a, reg b) { return _mm512_subs_epi16(a, b); }
+    static reg mul(reg a, reg b) { return _mm512_mullo_epi16(a, b); }
+    static reg muls(reg a, reg b) {
+        const reg lo = _mm512_mullo_epi32(_mm512_cvtepi16_epi32(_mm512_castsi512_si256(a)), _mm512_cvtepi16_epi32(_mm512_castsi512_si256(b)));
+        const reg hi = _mm512_mullo_epi32(_mm512_cvtepi16_epi32(_mm512_extracti64x4_epi64(a, 1)), _mm512_cvtepi16_epi32(_mm512_extracti64x4_epi64(b, 1)));
+        return join(_mm512_cvtsepi32_epi16(lo), _mm512_cvtsepi32_epi16(hi));
+    }
+};
+
+struct avx512_i32_vec {
+    static constexpr size_t W = 16;
+    using reg = __m512i;
+
+    static reg load(const int32_t* p) { return _mm512_loadu_si512(p); }
+    static void store(int32_t* p, reg a) { _mm512_storeu_si512(p, a); }
+    static reg add(reg a, reg b) { return _mm512_add_epi32(a, b); }
+    static reg adds(reg a, reg b) {
+        // overflow where a and b have the same sign and the sum another:
+        const reg s = _mm512_add_epi32(a, b);
+        return saturate32(a, s, _mm512_andnot_si512(_mm512_xor_si512(a, b), _mm512_xor_si512(a, s)));
+    }
+    static reg sub(reg a, reg b) { return _mm512_sub_epi32(a, b); }
+    static reg subs(reg a, reg b) {
+        // overflow where a and b differ in sign and the difference differs from a:
+        const reg d = _mm512_sub_epi32(a, b);
+        return saturate32(a, d, _mm512_and_si512(_mm512_xor_si512(a, b), _mm512_xor_si512(a, d)));
+    }
+    static reg mul(reg a, reg b) { return _mm512_mullo_epi32(a, b); }
+    static reg muls(reg a, reg b) {
+        return join(mul_sat8(_mm512_castsi512_si256(a), _mm512_castsi512_si256(b)),
+                    mul_sat8(_mm512_extracti64x4_epi64(a, 1), _mm512_extracti64x4_epi64(b, 1)));
+    }
+};
+
+/**
+ * @brief 64 bytes per step, widened to 16 bits and multiplied pairwise
+ * into 16 int32 lanes with vpmaddwd
+ */
+struct avx512_dot_vec {
+    static constexpr size_t W = 64;
+    using reg = __m512i;
+
+    static reg zero() { return _mm512_setzero_si512(); }
+    static reg dot(reg acc, const uint8_t* a, const int8_t* b) {
+        const reg x = _mm512_loadu_si512(a), y = _mm512_loadu_si512(b);
+        const reg lo = _mm512_madd_epi16(_mm512_cvtepu8_epi16(_mm512_castsi512_si256(x)), _mm512_cvtepi8_epi16(_mm512_castsi512_si256(y)));
+        const reg hi = _mm512_madd_epi16(_mm512_cvtepu8_epi16(_mm512_extracti64x4_epi64(x, 1)), _mm512_cvtepi8_epi16(_mm512_extracti64x4_epi64(y, 1)));
+        return _mm512_add_epi32(acc, _mm512_add_epi32(lo, hi));
+    }
+    static reg dot(reg acc, const int8_t* a, const int8_t* b) {
+        const reg x = _mm512_loadu_si512(a), y = _mm512_loadu_si512(b);
+        const reg lo = _mm512_madd_epi16(_mm512_cvtepi8_epi16(_mm512_castsi512_si256(x)), _mm512_cvtepi8_epi16(_mm512_castsi512_si256(y)));
+        const reg hi = _mm512_madd_epi16(_mm512_cvtepi8_epi16(_mm512_extracti64x4_epi64(x, 1)), _mm512_cvtepi8_epi16(_mm512_extracti64x4_epi64(y, 1)));
+        return _mm512_add_epi32(acc, _mm512_add_epi32(lo, hi));
+    }
+    static int64_t hsum(reg a) {
+        // widened first, two full lanes can overflow int32:
+        return _mm512_reduce_add_epi64(_mm512_add_epi64(_mm512_cvtepi32_epi64(_mm512_castsi512_si256(a)),
+                                                        _mm512_cvtepi32_epi64(_mm512_extracti64x4_epi64(a, 1))));
+    }
+};
+
+/**
+ * @brief 32 outputs per step, the pairs of sse_quant_vec per 128 bit
+ * lane: lo holds outputs 8 L + 0-3 of lane L, hi 8 L + 4-7, which the
+ * per lane packs of requantize() put back in order
+ */
+struct avx512_quant_vec {
+    static constexpr size_t W = 32;
+    using reg = __m512i;
+
+    static reg zero() { return _mm512_setzero_si512(); }
+    static reg load(const int16_t* p) { return _mm512_loadu_si512(p); }
+    static reg taps(int16_t h0, int16_t h1) { return _mm512_set1_epi32((int32_t)(((uint32_t)(uint16_t)h1 << 16) | (uint16_t)h0)); }
+    static void madd(reg& lo, reg& hi, reg x0, reg x1, reg t) {
+        lo = _mm512_add_epi32(lo, _mm512_madd_epi16(_mm512_unpacklo_epi16(x0, x1), t));
+        hi = _mm512_add_epi32(hi, _mm512_madd_epi16(_mm512_unpackhi_epi16(x0, x1), t));
+    }
+    static reg requantize32(reg acc, float multiplier, int32_t zero_point) {
+        const __m512 p = _mm512_mul_ps(_mm512_cvtepi32_ps(acc), _mm512_set1_ps(multiplier));
+        const __m512 clamped = _mm512_min_ps(_mm512_max_ps(p, _mm512_set1_ps(-65536.0f)), _mm512_set1_ps(65536.0f));
+        return _mm512_add_epi32(_mm512_cvtps_epi32(clamped), _mm512_set1_epi32(zero_point));
+    }
+    static void requantize(uint8_t* y, reg lo, reg hi, float multiplier, int32_t zero_point) {
+        const reg q = _mm512_packs_epi32(requantize32(lo, multiplier, zero_point), requantize32(hi, multiplier, zero_point));
+        const __m256i bytes = _mm512_cvtusepi16_epi8(_mm512_max_epi16(q, _mm512_setzero_si512()));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(y), bytes);
+    }
+};
+
+/**
+ * @brief AVX-512 integer Vector Addition, see the integer add()
+ */
+void avx512_add(const int8_t* a, const int8_t* b, int8_t* c, size_t n, simd_overflow overflow){
+    int_binary<avx512_i8_vec, int_op::add>(a, b, c, n, overflow);
+}
+
+void avx512_add(const uint8_t* a, const uint8_t* b, uint8_t* c, size_t n, simd_overflow overflow){
+    int_binary<avx512_u8_vec, int_op::add>(a, b, c, n, overflow);
+}
+
+void avx512_add(const int16_t* a, const int16_t* b, int16_t* c, size_t n, simd_overflow overflow){
+    int_binary<avx512_i16_vec, int_op::add>(a, b, c, n, overflow);
+}
+
+void avx512_add(const int32_t* a, const int32_t* b, int32_t* c, size_t n, simd_overflow overflow){
+    int_binary<avx512_i32_vec, int_op::add>(a, b, c, n, overflow);
+}
+
+/**
+ * @brief AVX-512 integer Vector Subtraction, see the integer sub()
+ */
+void avx512_sub(const int8_t* a, const int8_t* b, int8_t* c, size_t n, simd_overflow overflow){
+    int_binary<avx512_i8_vec, int_op::sub>(a, b, c, n, overflow);
+}
+
+void avx512_sub(const uint8_t* a, const uint8_t* b, uint8_t* c, size_t n, simd_overflow overflow){
+    int_binary<avx512_u8_vec, int_op::sub>(a, b, c, n, overflow);
+}
+
+void avx512_sub(const int16_t* a, const int16_t* b, int16_t* c, size_t n, simd_overflow overflow){
+    int_binary<avx512_i16_vec, int_op::sub>(a, b, c, n, overflow);
+}
+
+void avx512_sub(const int32_t* a, const int32_t* b, int32_t* c, size_t n, simd_overflow overflow){
+    int_binary<avx512_i32_vec, int_op::sub>(a, b, c, n, overflow);
+}
+
+/**
+ * @brief AVX-512 integer Vector Multiply, see the integer mul()
+ */
+void avx512_mul(const int8_t* a, const int8_t* b, int8_t* c, size_t n, simd_overflow overflow){
+    int_binary<avx512_i8_vec, int_op::mul>(a, b, c, n, overflow);
+}
+
+void avx512_mul(const uint8_t* a, const uint8_t* b, uint8_t* c, size_t n, simd_overflow overflow){
+    int_binary<avx512_u8_vec, int_op::mul>(a, b, c, n, overflow);
+}
+
+void avx512_mul(const int16_t* a, const int16_t* b, int16_t* c, size_t n, simd_overflow overflow){
+    int_binary<avx512_i16_vec, int_op::mul>(a, b, c, n, overflow);
+}
+
+void avx512_mul(const int32_t* a, const int32_t* b, int32_t* c, size_t n, simd_overflow overflow){
+    int_binary<avx512_i32_vec, int_op::mul>(a, b, c, n, overflow);
+}
+
+/**
+ * @brief AVX-512 8 bit Dot Product, see the 8 bit dot()
+ */
+int64_t avx512_dot(const uint8_t* a, const int8_t* b, size_t n){
+    return int_dot<avx512_dot_vec>(a, b, n);
+}
+
+int64_t avx512_dot(const int8_t* a, const int8_t* b, size_t n){
+    return int_dot<avx512_dot_vec>(a, b, n);
+}
+
+/**
+ * @brief AVX-512 quantized convolution of widened operands, see int_driver.h
+ */
+void avx512_conv_quant(const int16_t* x, const int16_t* h, size_t m, uint8_t* y, size_t count,
+                       float multiplier, int32_t zero_point){
+    quant_conv_run<avx512_quant_vec>(x, h, m, y, count, multiplier, zero_point);
+}
@@ -0,0 +1,69 @@
+/**
+ * @file avx512_math.cpp
+ * @author Sravan Senthilnathan
+ * @brief AVX-512 elementwise exp, log, sin, cos, tanh, sigmoid, erf and pow
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2023
+ * 
+ */
+#include "x86_kernels.h"
+#include "simd_vec.h"
+#include "math_driver.h"
+
+/**
+ * @brief AVX-512 e^x, see math_driver.h
+ */
+void avx512_exp(const float* a, float* b, size_t n, simd_math_mode mode){
+    math_unary<vec_avx512<float>, math_fn::exp>(a, b, n, mode);
+}
+
+/**
+ * @brief AVX-512 natural logarithm, see math_driver.h
+ */
+void avx512_log(const float* a, float* b, size_t n, simd_math_mode mode){
+    math_unary<vec_avx512<float>, math_fn::log>(a, b, n, mode);
+}
+
+/**
+ * @brief AVX-512 sine, see math_driver.h
+ */
+void avx512_sin(const float* a, float* b, size_t n, simd_math_mode mode){
+    math_unary<vec_avx512<float>, math_fn::sin>(a, b, n, mode);
+}
+
+/**
+ * @brief AVX-512 cosine, see math_driver.h
+ */
+void avx512_cos(const float* a, float* b, size_t n, simd_math_mode mode){
+    math_unary<vec_avx512<float>, math_fn::cos>(a, b, n, mode);
+}
+
+/**
+ * @brief AVX-512 hyperbolic tangent, see math_driver.h
+ */
+void avx512_tanh(const float* a, float* b, size_t n, simd_math_mode mode){
+    math_unary<vec_avx512<float>, math_fn::tanh>(a, b, n, mode);
+}
+
+/**
+ * @brief AVX-512 logistic function, see math_driver.h
+ */
+void avx512_sigmoid(const float* a, float* b, size_t n, simd_math_mode mode){
+    math_unary<vec_avx512<float>, math_fn::sigmoid>(a, b, n, mode);
+}
+
+/**
+ * @brief AVX-512 error function, see math_driver.h
+ */
+void avx512_erf(const float* a, float* b, size_t n, simd_math_mode mode){
+    math_unary<vec_avx512<float>, math_fn::erf>(a, b, n, mode);
+}
+
+/**
+ * @brief AVX-512 power function, see math_driver.h
+ */
+void avx512_pow(const float* a, const float* b, float* c, size_t n, simd_math_mode mode){
+    math_pow<vec_avx512<float>, vec_avx512<double>>(a, b, c, n, mode);
+}
@@ -0,0 +1,41 @@
+/**
+ * @file avx512_stream.cpp
+ * @author Sravan Senthilnathan
+ * @brief AVX-512 elementwise kernels with non-temporal stores
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2023
+ * 
+ */
+#include "x86_kernels.h"
+#include "simd_vec.h"
+#include "stream_driver.h"
+
+/**
+ * @brief AVX-512 Vector Addition with streaming stores, see stream_driver.h
+ */
+void avx512_add_stream(const float* a, const float* b, float* c, size_t n){
+    stream_run<vec_avx512<float>, stream_add>(a, b, c, n);
+}
+
+/**
+ * @brief AVX-512 Vector Subtraction with streaming stores, see stream_driver.h
+ */
+void avx512_sub_stream(const float* a, const float* b, float* c, size_t n){
+    stream_run<vec_avx512<float>, stream_sub>(a, b, c, n);
+}
+
+/**
+ * @brief AVX-512 Vector Multiply with streaming stores, see stream_driver.h
+ */
+void avx512_mul_stream(const float* a, const float* b, float* c, size_t n){
+    stream_run<vec_avx512<float>, stream_mul>(a, b, c, n);
+}
+
+/**
+ * @brief AVX-512 Vector Division with streaming stores, see stream_driver.h
+ */
+void avx512_div_stream(const float* a, const float* b, float* c, size_t n){
+    stream_run<vec_avx512<float>, stream_div>(a, b, c, n);
+}
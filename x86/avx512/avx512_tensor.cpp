@@ -0,0 +1,104 @@
+/**
+ * @file avx512_tensor.cpp
+ * @author Sravan Senthilnathan
+ * @brief AVX-512 implementation of 4x4 Tensor arithmetic
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2023
+ * 
+ */
+#include <immintrin.h>
+
+#include "x86_kernels.h"
+
+/**
+ * @brief AVX-512 accelerated Tensor Addition function:
+ * 
+ * the whole tensor fits one 512 bit register.
+ * 
+ * @param a first operand tensor
+ * @param b second operand tensor
+ * @param c output tensor
+ */
+void avx512_add(const Tensor a, const Tensor b, Tensor &c){
+    _mm512_storeu_ps(c[0], _mm512_add_ps(_mm512_loadu_ps(a[0]), _mm512_loadu_ps(b[0])));
+}
+
+/**
+ * @brief AVX-512 accelerated Tensor Subtraction function:
+ * 
+ * the whole tensor fits one 512 bit register.
+ * 
+ * @param a first operand tensor
+ * @param b second operand tensor
+ * @param c output tensor
+ */
+void avx512_sub(const Tensor a, const Tensor b, Tensor &c){
+    _mm512_storeu_ps(c[0], _mm512_sub_ps(_mm512_loadu_ps(a[0]), _mm512_loadu_ps(b[0])));
+}
+
+/**
+ * @brief AVX-512 accelerated Tensor Multiplication function:
+ * 
+ * all four rows of a are held in one register, _mm512_permute_ps spreads
+ * a[i][k] over row i and b[k] is broadcast into every 128 bit lane.
+ * 
+ * @param a first operand tensor
+ * @param b second operand tensor
+ * @param c output tensor
+ */
+void avx512_mul(const Tensor a, const Tensor b, Tensor &c){
+    const __m512 Ta = _mm512_loadu_ps(a[0]);
+
+    const __m512 Tb0 = _mm512_broadcast_f32x4(_mm_loadu_ps(b[0]));
+    const __m512 Tb1 = _mm512_broadcast_f32x4(_mm_loadu_ps(b[1]));
+    const __m512 Tb2 = _mm512_broadcast_f32x4(_mm_loadu_ps(b[2]));
+    const __m512 Tb3 = _mm512_broadcast_f32x4(_mm_loadu_ps(b[3]));
+
+    __m512 Tc = _mm512_mul_ps(_mm512_permute_ps(Ta, 0x00), Tb0);
+    Tc = _mm512_fmadd_ps(_mm512_permute_ps(Ta, 0x55), Tb1, Tc);
+    Tc = _mm512_fmadd_ps(_mm512_permute_ps(Ta, 0xAA), Tb2, Tc);
+    Tc = _mm512_fmadd_ps(_mm512_permute_ps(Ta, 0xFF), Tb3, Tc);
+
+    _mm512_storeu_ps(c[0], Tc);
+}
+
+/**
+ * @brief AVX-512 accelerated batched Tensor Multiplication function, see mul_batch()
+ * 
+ * one tensor per zmm register as in avx512_mul, which is inlined here.
+ */
+void avx512_mul_batch(const Tensor* a, const Tensor* b, Tensor* c, size_t count){
+    for(size_t m = 0; m < count; ++m){
+        avx512_mul(a[m], b[m], c[m]);
+    }
+}
+
+/**
+ * @brief AVX-512 accelerated structure-of-arrays batched Tensor
+ * Multiplication function, see mul_batch_soa()
+ * 
+ * 16 tensors per pass, every element plane is one zmm register; the last
+ * partial pass is masked.
+ */
+void avx512_mul_batch_soa(const float* a, const float* b, float* c, size_t count, size_t stride){
+    for(size_t m = 0; m < count; m += 16){
+        const __mmask16 k = count - m >= 16 ? (__mmask16)0xFFFF : (__mmask16)((1u << (count - m)) - 1);
+
+        for(int i = 0; i < 4; ++i){
+            const __m512 Ta0 = _mm512_maskz_loadu_ps(k, a + (4 * i + 0) * stride + m);
+            const __m512 Ta1 = _mm512_maskz_loadu_ps(k, a + (4 * i + 1) * stride + m);
+            const __m512 Ta2 = _mm512_maskz_loadu_ps(k, a + (4 * i + 2) * stride + m);
+            const __m512 Ta3 = _mm512_maskz_loadu_ps(k, a + (4 * i + 3) * stride + m);
+
+            for(int j = 0; j < 4; ++j){
+                __m512 Tc = _mm512_mul_ps(Ta0, _mm512_maskz_loadu_ps(k, b + (0 + j) * stride + m));
+                Tc = _mm512_fmadd_ps(Ta1, _mm512_maskz_loadu_ps(k, b + (4 + j) * stride + m), Tc);
+                Tc = _mm512_fmadd_ps(Ta2, _mm512_maskz_loadu_ps(k, b + (8 + j) * stride + m), Tc);
+                Tc = _mm512_fmadd_ps(Ta3, _mm512_maskz_loadu_ps(k, b + (12 + j) * stride + m), Tc);
+                _mm512_mask_storeu_ps(c + (4 * i + j) * stride + m, k, Tc);
+            }
+        }
+    }
+}
@@ -0,0 +1,113 @@
+/**
+ * @file avx512_vector.cpp
+ * @author Sravan Senthilnathan
+ * @brief AVX-512 implementation of parallel floating point vector arithmetic
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2023
+ * 
+ */
+#include "x86_kernels.h"
+#include "simd_vec.h"
+#include "recip_driver.h"
+#include "vector_driver.h"
+
+/**
+ * @brief AVX-512 accelerated Vector Addition function:
+ * 
+ * @param a first operand array
+ * @param b second operand array
+ * @param c output array (may alias a or b)
+ * @param n number of elements
+ */
+void avx512_add(const float* a, const float* b, float* c, size_t n){
+    vec_binary<vec_avx512<float>, vec_op::add>(a, b, c, n);
+}
+
+/**
+ * @brief AVX-512 accelerated Vector Subtraction function:
+ * 
+ * @param a first operand array
+ * @param b second operand array
+ * @param c output array (may alias a or b)
+ * @param n number of elements
+ */
+void avx512_sub(const float* a, const float* b, float* c, size_t n){
+    vec_binary<vec_avx512<float>, vec_op::sub>(a, b, c, n);
+}
+
+/**
+ * @brief AVX-512 accelerated Vector Multiply function:
+ * 
+ * @param a first operand array
+ * @param b second operand array
+ * @param c output array (may alias a or b)
+ * @param n number of elements
+ */
+void avx512_mul(const float* a, const float* b, float* c, size_t n){
+    vec_binary<vec_avx512<float>, vec_op::mul>(a, b, c, n);
+}
+
+/**
+ * @brief AVX-512 accelerated Vector Division function:
+ * 
+ * @param a first operand array
+ * @param b second operand array
+ * @param c output array (may alias a or b)
+ * @param n number of elements
+ */
+void avx512_div(const float* a, const float* b, float* c, size_t n){
+    vec_binary<vec_avx512<float>, vec_op::div>(a, b, c, n);
+}
+
+/**
+ * @brief AVX-512 accelerated Vector Multiply-Add function, d = a * b + c:
+ * 
+ * @param a first factor array
+ * @param b second factor array
+ * @param c addend array
+ * @param d output array (may alias a, b or c)
+ * @param n number of elements
+ */
+void avx512_mul_add(const float* a, const float* b, const float* c, float* d, size_t n){
+    vec_mul_add<vec_avx512<float>>(a, b, c, d, n);
+}
+
+/**
+ * @brief AVX-512 accelerated Vector Division function in the given mode, see
+ * recip_driver.h:
+ * 
+ * @param a first operand array
+ * @param b second operand array
+ * @param c output array (may alias a or b)
+ * @param n number of elements
+ * @param mode exact, or the reciprocal estimate and Newton-Raphson steps
+ */
+void avx512_div(const float* a, const float* b, float* c, size_t n, simd_div_mode mode){
+    recip_div<vec_avx512<float>>(a, b, c, n, mode);
+}
+
+/**
+ * @brief AVX-512 accelerated Vector Square Root function, see recip_driver.h:
+ * 
+ * @param a operand array
+ * @param b output array (may alias a)
+ * @param n number of elements
+ * @param mode exact, or the reciprocal square root estimate and Newton-Raphson steps
+ */
+void avx512_sqrt(const float* a, float* b, size_t n, simd_div_mode mode){
+    recip_unary<vec_avx512<float>, recip_fn::sqrt>(a, b, n, mode);
+}
+
+/**
+ * @brief AVX-512 accelerated Vector Reciprocal Square Root function, see recip_driver.h:
+ * 
+ * @param a operand array
+ * @param b output array (may alias a)
+ * @param n number of elements
+ * @param mode exact, or the reciprocal square root estimate and Newton-Raphson steps
+ */
+void avx512_rsqrt(const float* a, float* b, size_t n, simd_div_mode mode){
+    recip_unary<vec_avx512<float>, recip_fn::rsqrt>(a, b, n, mode);
+}
@@ -0,0 +1,54 @@
+/**
+ * @file avx512_vnni.cpp
+ * @author Sravan Senthilnathan
+ * @brief AVX512_VNNI 8 bit dot products
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2023
+ * 
+ * Built with -mavx512vnni on top of the AVX-512 flags, the dispatcher only
+ * takes these where CPUID reports AVX512_VNNI as well.
+ */
+#include <cstdint>
+#include <immintrin.h>
+
+#include "x86_kernels.h"
+#include "int_driver.h"
+
+/**
+ * @brief 64 bytes per step: vpdpbusd multiplies unsigned by signed bytes
+ * and adds each group of 4 products to an int32 lane, without the 16 bit
+ * saturation of vpmaddubsw; signed by signed goes through vpdpwssd on the
+ * bytes widened to 16 bits
+ */
+struct avx512_vnni_dot_vec {
+    static constexpr size_t W = 64;
+    using reg = __m512i;
+
+    static reg zero() { return _mm512_setzero_si512(); }
+    static reg dot(reg acc, const uint8_t* a, const int8_t* b) {
+        return _mm512_dpbusd_epi32(acc, _mm512_loadu_si512(a), _mm512_loadu_si512(b));
+    }
+    static reg dot(reg acc, const int8_t* a, const int8_t* b) {
+        const reg x = _mm512_loadu_si512(a), y = _mm512_loadu_si512(b);
+        acc = _mm512_dpwssd_epi32(acc, _mm512_cvtepi8_epi16(_mm512_castsi512_si256(x)), _mm512_cvtepi8_epi16(_mm512_castsi512_si256(y)));
+        return _mm512_dpwssd_epi32(acc, _mm512_cvtepi8_epi16(_mm512_extracti64x4_epi64(x, 1)), _mm512_cvtepi8_epi16(_mm512_extracti64x4_epi64(y, 1)));
+    }
+    static int64_t hsum(reg a) {
+        // widened first, two full lanes can overflow int32:
+        return _mm512_reduce_add_epi64(_mm512_add_epi64(_mm512_cvtepi32_epi64(_mm512_castsi512_si256(a)),
+                                                        _mm512_cvtepi32_epi64(_mm512_extracti64x4_epi64(a, 1))));
+    }
+};
+
+/**
+ * @brief AVX512_VNNI 8 bit Dot Product, see the 8 bit dot()
+ */
+int64_t avx512_vnni_dot(const uint8_t* a, const int8_t* b, size_t n){
+    return int_dot<avx512_vnni_dot_vec>(a, b, n);
+}
+
+int64_t avx512_vnni_dot(const int8_t* a, const int8_t* b, size_t n){
+    return int_dot<avx512_vnni_dot_vec>(a, b, n);
+}
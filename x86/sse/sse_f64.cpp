@@ -0,0 +1,111 @@
+/**
+ * @file sse_f64.cpp
+ * @author Sravan Senthilnathan
+ * @brief SSE implementation of double precision vector and 4x4 Tensor arithmetic
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2023
+ * 
+ */
+#include <immintrin.h>
+
+#include "x86_kernels.h"
+#include "simd_vec.h"
+#include "vector_driver.h"
+
+/**
+ * @brief SSE accelerated double precision Vector Addition, see vec_binary()
+ */
+void sse_add(const double* a, const double* b, double* c, size_t n){
+    vec_binary<vec_sse<double>, vec_op::add>(a, b, c, n);
+}
+
+/**
+ * @brief SSE accelerated double precision Vector Subtraction, see vec_binary()
+ */
+void sse_sub(const double* a, const double* b, double* c, size_t n){
+    vec_binary<vec_sse<double>, vec_op::sub>(a, b, c, n);
+}
+
+/**
+ * @brief SSE accelerated double precision Vector Multiply, see vec_binary()
+ */
+void sse_mul(const double* a, const double* b, double* c, size_t n){
+    vec_binary<vec_sse<double>, vec_op::mul>(a, b, c, n);
+}
+
+/**
+ * @brief SSE accelerated double precision Vector Division, see vec_binary()
+ */
+void sse_div(const double* a, const double* b, double* c, size_t n){
+    vec_binary<vec_sse<double>, vec_op::div>(a, b, c, n);
+}
+
+/**
+ * @brief SSE accelerated double precision Vector Multiply-Add, two roundings
+ */
+void sse_mul_add(const double* a, const double* b, const double* c, double* d, size_t n){
+    vec_mul_add<vec_sse<double>>(a, b, c, d, n);
+}
+
+/**
+ * @brief SSE accelerated double precision Tensor Addition function:
+ * 
+ * every row is two xmm registers.
+ * 
+ * @param a first operand tensor
+ * @param b second operand tensor
+ * @param c output tensor
+ */
+void sse_add(const Tensor64 a, const Tensor64 b, Tensor64 &c){
+    for(int i = 0; i < 4; ++i){
+        _mm_storeu_pd(c[i], _mm_add_pd(_mm_loadu_pd(a[i]), _mm_loadu_pd(b[i])));
+        _mm_storeu_pd(c[i] + 2, _mm_add_pd(_mm_loadu_pd(a[i] + 2), _mm_loadu_pd(b[i] + 2)));
+    }
+}
+
+/**
+ * @brief SSE accelerated double precision Tensor Subtraction function:
+ * 
+ * @param a first operand tensor
+ * @param b second operand tensor
+ * @param c output tensor
+ */
+void sse_sub(const Tensor64 a, const Tensor64 b, Tensor64 &c){
+    for(int i = 0; i < 4; ++i){
+        _mm_storeu_pd(c[i], _mm_sub_pd(_mm_loadu_pd(a[i]), _mm_loadu_pd(b[i])));
+        _mm_storeu_pd(c[i] + 2, _mm_sub_pd(_mm_loadu_pd(a[i] + 2), _mm_loadu_pd(b[i] + 2)));
+    }
+}
+
+/**
+ * @brief SSE accelerated double precision Tensor Multiplication function:
+ * 
+ * the row form of sse_mul, with both halves of row i of c accumulated
+ * from a[i][k] broadcast against the halves of row k of b.
+ * 
+ * @param a first operand tensor
+ * @param b second operand tensor
+ * @param c output tensor
+ */
+void sse_mul(const Tensor64 a, const Tensor64 b, Tensor64 &c){
+    __m128d Tlo[4], Thi[4];
+    for(int k = 0; k < 4; ++k){
+        Tlo[k] = _mm_loadu_pd(b[k]);
+        Thi[k] = _mm_loadu_pd(b[k] + 2);
+    }
+
+    for(int i = 0; i < 4; ++i){
+        __m128d Ta = _mm_set1_pd(a[i][0]);
+        __m128d Lo = _mm_mul_pd(Ta, Tlo[0]);
+        __m128d Hi = _mm_mul_pd(Ta, Thi[0]);
+        for(int k = 1; k < 4; ++k){
+            Ta = _mm_set1_pd(a[i][k]);
+            Lo = _mm_add_pd(Lo, _mm_mul_pd(Ta, Tlo[k]));
+            Hi = _mm_add_pd(Hi, _mm_mul_pd(Ta, Thi[k]));
+        }
+        _mm_storeu_pd(c[i], Lo);
+        _mm_storeu_pd(c[i] + 2, Hi);
+    }
+}
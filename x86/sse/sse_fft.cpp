@@ -0,0 +1,46 @@
+/**
+ * @file sse_fft.cpp
+ * @author Sravan Senthilnathan
+ * @brief SSE implementation of the FFT passes
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2023
+ * 
+ */
+#include <immintrin.h>
+
+#include "x86_kernels.h"
+#include "fft.h"
+
+/**
+ * @brief 4 lanes, separate multiply and add
+ */
+struct sse_vec {
+    static constexpr size_t W = 4;
+    using reg = __m128;
+
+    static reg load(const float* p) { return _mm_loadu_ps(p); }
+    static void store(float* p, reg a) { _mm_storeu_ps(p, a); }
+    static reg add(reg a, reg b) { return _mm_add_ps(a, b); }
+    static reg sub(reg a, reg b) { return _mm_sub_ps(a, b); }
+    static reg mul(reg a, reg b) { return _mm_mul_ps(a, b); }
+    static reg mul_add(reg a, reg b, reg c) { return _mm_add_ps(_mm_mul_ps(a, b), c); }
+    static reg mul_sub(reg a, reg b, reg c) { return _mm_sub_ps(_mm_mul_ps(a, b), c); }
+};
+
+/**
+ * @brief SSE accelerated complex FFT, see fft_forward()
+ */
+void sse_fft(const fft_plan& p, const float* in_re, const float* in_im, size_t stride,
+             float* re, float* im){
+    fft_forward<sse_vec>(p, in_re, in_im, stride, re, im);
+}
+
+/**
+ * @brief SSE accelerated spectrum product, see fft_spectrum_mul()
+ */
+void sse_spectrum_mul(const float* ar, const float* ai, const float* br, const float* bi,
+                      float* cr, float* ci, size_t n){
+    fft_spectrum_mul<sse_vec>(ar, ai, br, bi, cr, ci, n);
+}
@@ -0,0 +1,118 @@
+/**
+ * @file sse_half.cpp
+ * @author Sravan Senthilnathan
+ * @brief SSE4.1 FP16/BF16 storage kernels, conversions emulated
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2023
+ * 
+ */
+#include <immintrin.h>
+
+#include "x86_kernels.h"
+#include "half_driver.h"
+
+/**
+ * @brief 4 lanes; without F16C, FP16 is widened by moving the exponent and
+ * mantissa into place and rebiasing with a multiply by 2^112 (exact, also
+ * for subnormals), and narrowed with the integer round to nearest even of
+ * the reference, subnormals rounded by the float add of 0.5
+ */
+struct sse_half_vec {
+    static constexpr size_t W = 4;
+    using reg = __m128;
+
+    static reg load(const float* p) { return _mm_loadu_ps(p); }
+    static void store(float* p, reg a) { _mm_storeu_ps(p, a); }
+    static reg zero() { return _mm_setzero_ps(); }
+    static reg add(reg a, reg b) { return _mm_add_ps(a, b); }
+    static reg mul(reg a, reg b) { return _mm_mul_ps(a, b); }
+    static reg mul_add(reg a, reg b, reg c) { return _mm_add_ps(_mm_mul_ps(a, b), c); }
+    static float mul_add(float a, float b, float c) { return a * b + c; }
+
+    static __m128i load4(const uint16_t* p) {
+        return _mm_cvtepu16_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(p)));
+    }
+    static void store4(uint16_t* p, __m128i a) {
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(p), _mm_packus_epi32(a, a));
+    }
+
+    static reg load_fp16(const uint16_t* p) {
+        const __m128i h = load4(p);
+        const __m128i sign = _mm_slli_epi32(_mm_and_si128(h, _mm_set1_epi32(0x8000)), 16);
+        const __m128i bits = _mm_slli_epi32(_mm_and_si128(h, _mm_set1_epi32(0x7fff)), 13);
+        const __m128 scaled = _mm_mul_ps(_mm_castsi128_ps(bits), _mm_castsi128_ps(_mm_set1_epi32(0x77800000)));
+        // inf and NaN keep the mantissa under an all ones exponent:
+        const __m128i special = _mm_cmpgt_epi32(bits, _mm_set1_epi32(0x0f7fffff));
+        const __m128i infnan = _mm_or_si128(bits, _mm_set1_epi32(0x7f800000));
+        return _mm_castsi128_ps(_mm_or_si128(_mm_blendv_epi8(_mm_castps_si128(scaled), infnan, special), sign));
+    }
+    static void store_fp16(uint16_t* p, reg a) {
+        const __m128i x = _mm_castps_si128(a);
+        const __m128i sign = _mm_and_si128(x, _mm_set1_epi32((int)0x80000000u));
+        const __m128i ax = _mm_xor_si128(x, sign);
+
+        // normal: rebias from 127 to 15, round off 13 bits to nearest even
+        const __m128i odd = _mm_and_si128(_mm_srli_epi32(ax, 13), _mm_set1_epi32(1));
+        const __m128i rebiased = _mm_add_epi32(ax, _mm_set1_epi32((int)(0xc8000fffu)));
+        const __m128i normal = _mm_srli_epi32(_mm_add_epi32(rebiased, odd), 13);
+        // subnormal: 0.5 + x leaves x in units of 2^-24 in the low bits, rounded by the add
+        const __m128 half = _mm_set1_ps(0.5f);
+        const __m128i subnormal = _mm_sub_epi32(_mm_castps_si128(_mm_add_ps(_mm_castsi128_ps(ax), half)),
+                                                _mm_castps_si128(half));
+        const __m128i nan = _mm_or_si128(_mm_set1_epi32(0x7e00), _mm_and_si128(_mm_srli_epi32(ax, 13), _mm_set1_epi32(0x3ff)));
+
+        __m128i r = _mm_blendv_epi8(normal, subnormal, _mm_cmplt_epi32(ax, _mm_set1_epi32(0x38800000)));
+        r = _mm_blendv_epi8(r, _mm_set1_epi32(0x7c00), _mm_cmpgt_epi32(ax, _mm_set1_epi32(0x477fefff)));
+        r = _mm_blendv_epi8(r, nan, _mm_cmpgt_epi32(ax, _mm_set1_epi32(0x7f800000)));
+        store4(p, _mm_or_si128(r, _mm_srli_epi32(sign, 16)));
+    }
+    static reg load_bf16(const uint16_t* p) {
+        return _mm_castsi128_ps(_mm_slli_epi32(load4(p), 16));
+    }
+    static void store_bf16(uint16_t* p, reg a) {
+        const __m128i x = _mm_castps_si128(a);
+        const __m128i lsb = _mm_and_si128(_mm_srli_epi32(x, 16), _mm_set1_epi32(1));
+        const __m128i rounded = _mm_add_epi32(x, _mm_add_epi32(lsb, _mm_set1_epi32(0x7fff)));
+        // NaNs keep their upper half, made quiet:
+        const __m128i nan = _mm_castps_si128(_mm_cmpunord_ps(a, a));
+        const __m128i quiet = _mm_or_si128(x, _mm_set1_epi32(0x400000));
+        store4(p, _mm_srli_epi32(_mm_blendv_epi8(rounded, quiet, nan), 16));
+    }
+};
+
+/**
+ * @brief SSE4.1 float to half conversion, see float_to_half()
+ */
+void sse_to_half(const float* a, uint16_t* h, size_t n, simd_half_format format){
+    half_to<sse_half_vec>(a, h, n, format);
+}
+
+/**
+ * @brief SSE4.1 half to float conversion, see half_to_float()
+ */
+void sse_from_half(const uint16_t* h, float* a, size_t n, simd_half_format format){
+    half_from<sse_half_vec>(h, a, n, format);
+}
+
+/**
+ * @brief SSE4.1 Vector Addition on half storage, see half_driver.h
+ */
+void sse_add_half(const uint16_t* a, const uint16_t* b, uint16_t* c, size_t n, simd_half_format format){
+    half_binary<sse_half_vec, false>(a, b, c, n, format);
+}
+
+/**
+ * @brief SSE4.1 Vector Multiply on half storage, see half_driver.h
+ */
+void sse_mul_half(const uint16_t* a, const uint16_t* b, uint16_t* c, size_t n, simd_half_format format){
+    half_binary<sse_half_vec, true>(a, b, c, n, format);
+}
+
+/**
+ * @brief SSE4.1 Dot Product of half operands, accumulated in float
+ */
+float sse_dot_half(const uint16_t* a, const uint16_t* b, size_t n, simd_half_format format){
+    return half_dot<sse_half_vec>(a, b, n, format);
+}
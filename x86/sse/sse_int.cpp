@@ -0,0 +1,277 @@
+/**
+ * @file sse_int.cpp
+ * @author Sravan Senthilnathan
+ * @brief SSE4.1 integer, 8 bit dot product and quantized convolution kernels
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2023
+ * 
+ */
+#include <cstdint>
+#include <immintrin.h>
+
+#include "x86_kernels.h"
+#include "int_driver.h"
+
+namespace {
+
+__m128i load128(const void* p){
+    return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+}
+
+void store128(void* p, __m128i a){
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(p), a);
+}
+
+/**
+ * @brief the 16 bit products of the low and high 8 bytes of a and b,
+ * widened with the given extension
+ */
+template<__m128i (*Widen)(__m128i)>
+void mul8(__m128i a, __m128i b, __m128i& lo, __m128i& hi){
+    lo = _mm_mullo_epi16(Widen(a), Widen(b));
+    hi = _mm_mullo_epi16(Widen(_mm_srli_si128(a, 8)), Widen(_mm_srli_si128(b, 8)));
+}
+
+__m128i sign8(__m128i a) { return _mm_cvtepi8_epi16(a); }
+__m128i zero8(__m128i a) { return _mm_cvtepu8_epi16(a); }
+
+/**
+ * @brief lanes of a + b (or a - b, given the operand signs that overflow)
+ * that overflowed, replaced by INT32_MAX or INT32_MIN from the sign of a
+ */
+__m128i saturate32(__m128i a, __m128i r, __m128i overflow){
+    const __m128i limit = _mm_xor_si128(_mm_srai_epi32(a, 31), _mm_set1_epi32(INT32_MAX));
+    return _mm_castps_si128(_mm_blendv_ps(_mm_castsi128_ps(r), _mm_castsi128_ps(limit), _mm_castsi128_ps(overflow)));
+}
+
+/**
+ * @brief 2 int32 products in double (exact wherever they fit int32), clamped and truncated back
+ */
+__m128i mul_sat2(__m128i a, __m128i b){
+    const __m128d p = _mm_mul_pd(_mm_cvtepi32_pd(a), _mm_cvtepi32_pd(b));
+    return _mm_cvttpd_epi32(_mm_min_pd(_mm_max_pd(p, _mm_set1_pd(INT32_MIN)), _mm_set1_pd(INT32_MAX)));
+}
+
+}
+
+struct sse_i8_vec {
+    static constexpr size_t W = 16;
+    using reg = __m128i;
+
+    static reg load(const int8_t* p) { return load128(p); }
+    static void store(int8_t* p, reg a) { store128(p, a); }
+    static reg add(reg a, reg b) { return _mm_add_epi8(a, b); }
+    static reg adds(reg a, reg b) { return _mm_adds_epi8(a, b); }
+    static reg sub(reg a, reg b) { return _mm_sub_epi8(a, b); }
+    static reg subs(reg a, reg b) { return _mm_subs_epi8(a, b); }
+    static reg mul(reg a, reg b) {
+        reg lo, hi;
+        mul8<sign8>(a, b, lo, hi);
+        const reg low_bytes = _mm_set1_epi16(0xff);
+        return _mm_packus_epi16(_mm_and_si128(lo, low_bytes), _mm_and_si128(hi, low_bytes));
+    }
+    static reg muls(reg a, reg b) {
+        reg lo, hi;
+        mul8<sign8>(a, b, lo, hi);
+        return _mm_packs_epi16(lo, hi);
+    }
+};
+
+struct sse_u8_vec {
+    static constexpr size_t W = 16;
+    using reg = __m128i;
+
+    static reg load(const uint8_t* p) { return load128(p); }
+    static void store(uint8_t* p, reg a) { store128(p, a); }
+    static reg add(reg a, reg b) { return _mm_add_epi8(a, b); }
+    static reg adds(reg a, reg b) { return _mm_adds_epu8(a, b); }
+    static reg sub(reg a, reg b) { return _mm_sub_epi8(a, b); }
+    static reg subs(reg a, reg b) { return _mm_subs_epu8(a, b); }
+    static reg mul(reg a, reg b) {
+        reg lo, hi;
+        mul8<zero8>(a, b, lo, hi);
+        const reg low_bytes = _mm_set1_epi16(0xff);
+        return _mm_packus_epi16(_mm_and_si128(lo, low_bytes), _mm_and_si128(hi, low_bytes));
+    }
+    static reg muls(reg a, reg b) {
+        // the products are unsigned 16 bit, packus would read them as signed:
+        reg lo, hi;
+        mul8<zero8>(a, b, lo, hi);
+        const reg max = _mm_set1_epi16(0xff);
+        return _mm_packus_epi16(_mm_min_epu16(lo, max), _mm_min_epu16(hi, max));
+    }
+};
+
+struct sse_i16_vec {
+    static constexpr size_t W = 8;
+    using reg = __m128i;
+
+    static reg load(const int16_t* p) { return load128(p); }
+    static void store(int16_t* p, reg a) { store128(p, a); }
+    static reg add(reg a, reg b) { return _mm_add_epi16(a, b); }
+    static reg adds(reg a, reg b) { return _mm_adds_epi16(a, b); }
+    static reg sub(reg a, reg b) { return _mm_sub_epi16(a, b); }
+    static reg subs(reg a, reg b) { return _mm_subs_epi16(a, b); }
+    static reg mul(reg a, reg b) { return _mm_mullo_epi16(a, b); }
+    static reg muls(reg a, reg b) {
+        const reg lo = _mm_mullo_epi16(a, b), hi = _mm_mulhi_epi16(a, b);
+        return _mm_packs_epi32(_mm_unpacklo_epi16(lo, hi), _mm_unpackhi_epi16(lo, hi));
+    }
+};
+
+struct sse_i32_vec {
+    static constexpr size_t W = 4;
+    using reg = __m128i;
+
+    static reg load(const int32_t* p) { return load128(p); }
+    static void store(int32_t* p, reg a) { store128(p, a); }
+    static reg add(reg a, reg b) { return _mm_add_epi32(a, b); }
+    static reg adds(reg a, reg b) {
+        // overflow where a and b have the same sign and the sum another:
+        const reg s = _mm_add_epi32(a, b);
+        return saturate32(a, s, _mm_andnot_si128(_mm_xor_si128(a, b), _mm_xor_si128(a, s)));
+    }
+    static reg sub(reg a, reg b) { return _mm_sub_epi32(a, b); }
+    static reg subs(reg a, reg b) {
+        // overflow where a and b differ in sign and the difference differs from a:
+        const reg d = _mm_sub_epi32(a, b);
+        return saturate32(a, d, _mm_and_si128(_mm_xor_si128(a, b), _mm_xor_si128(a, d)));
+    }
+    static reg mul(reg a, reg b) { return _mm_mullo_epi32(a, b); }
+    static reg muls(reg a, reg b) {
+        const reg lo = mul_sat2(a, b);
+        const reg hi = mul_sat2(_mm_unpackhi_epi64(a, a), _mm_unpackhi_epi64(b, b));
+        return _mm_unpacklo_epi64(lo, hi);
+    }
+};
+
+/**
+ * @brief 16 bytes per step, widened to 16 bits and multiplied pairwise
+ * into 4 int32 lanes with pmaddwd
+ */
+struct sse_dot_vec {
+    static constexpr size_t W = 16;
+    using reg = __m128i;
+
+    static reg zero() { return _mm_setzero_si128(); }
+    static reg dot(reg acc, const uint8_t* a, const int8_t* b) {
+        const reg x = load128(a), y = load128(b);
+        const reg lo = _mm_madd_epi16(_mm_cvtepu8_epi16(x), _mm_cvtepi8_epi16(y));
+        const reg hi = _mm_madd_epi16(_mm_cvtepu8_epi16(_mm_srli_si128(x, 8)), _mm_cvtepi8_epi16(_mm_srli_si128(y, 8)));
+        return _mm_add_epi32(acc, _mm_add_epi32(lo, hi));
+    }
+    static reg dot(reg acc, const int8_t* a, const int8_t* b) {
+        const reg x = load128(a), y = load128(b);
+        const reg lo = _mm_madd_epi16(_mm_cvtepi8_epi16(x), _mm_cvtepi8_epi16(y));
+        const reg hi = _mm_madd_epi16(_mm_cvtepi8_epi16(_mm_srli_si128(x, 8)), _mm_cvtepi8_epi16(_mm_srli_si128(y, 8)));
+        return _mm_add_epi32(acc, _mm_add_epi32(lo, hi));
+    }
+    static int64_t hsum(reg a) {
+        return (int64_t)_mm_cvtsi128_si32(a) + _mm_extract_epi32(a, 1) + (int64_t)_mm_extract_epi32(a, 2) + _mm_extract_epi32(a, 3);
+    }
+};
+
+/**
+ * @brief 8 outputs per step: x[i - k] and x[i - k - 1] interleaved, so
+ * pmaddwd with the tap pair gives both taps' terms of 4 outputs; lo holds
+ * outputs 0-3, hi outputs 4-7
+ */
+struct sse_quant_vec {
+    static constexpr size_t W = 8;
+    using reg = __m128i;
+
+    static reg zero() { return _mm_setzero_si128(); }
+    static reg load(const int16_t* p) { return load128(p); }
+    static reg taps(int16_t h0, int16_t h1) { return _mm_set1_epi32((int32_t)(((uint32_t)(uint16_t)h1 << 16) | (uint16_t)h0)); }
+    static void madd(reg& lo, reg& hi, reg x0, reg x1, reg t) {
+        lo = _mm_add_epi32(lo, _mm_madd_epi16(_mm_unpacklo_epi16(x0, x1), t));
+        hi = _mm_add_epi32(hi, _mm_madd_epi16(_mm_unpackhi_epi16(x0, x1), t));
+    }
+    static reg requantize32(reg acc, float multiplier, int32_t zero_point) {
+        const __m128 p = _mm_mul_ps(_mm_cvtepi32_ps(acc), _mm_set1_ps(multiplier));
+        const __m128 clamped = _mm_min_ps(_mm_max_ps(p, _mm_set1_ps(-65536.0f)), _mm_set1_ps(65536.0f));
+        return _mm_add_epi32(_mm_cvtps_epi32(clamped), _mm_set1_epi32(zero_point));
+    }
+    static void requantize(uint8_t* y, reg lo, reg hi, float multiplier, int32_t zero_point) {
+        const reg q = _mm_packs_epi32(requantize32(lo, multiplier, zero_point), requantize32(hi, multiplier, zero_point));
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(y), _mm_packus_epi16(q, q));
+    }
+};
+
+/**
+ * @brief SSE4.1 integer Vector Addition, see the integer add()
+ */
+void sse_add(const int8_t* a, const int8_t* b, int8_t* c, size_t n, simd_overflow overflow){
+    int_binary<sse_i8_vec, int_op::add>(a, b, c, n, overflow);
+}
+
+void sse_add(const uint8_t* a, const uint8_t* b, uint8_t* c, size_t n, simd_overflow overflow){
+    int_binary<sse_u8_vec, int_op::add>(a, b, c, n, overflow);
+}
+
+void sse_add(const int16_t* a, const int16_t* b, int16_t* c, size_t n, simd_overflow overflow){
+    int_binary<sse_i16_vec, int_op::add>(a, b, c, n, overflow);
+}
+
+void sse_add(const int32_t* a, const int32_t* b, int32_t* c, size_t n, simd_overflow overflow){
+    int_binary<sse_i32_vec, int_op::add>(a, b, c, n, overflow);
+}
+
+/**
+ * @brief SSE4.1 integer Vector Subtraction, see the integer sub()
+ */
+void sse_sub(const int8_t* a, const int8_t* b, int8_t* c, size_t n, simd_overflow overflow){
+    int_binary<sse_i8_vec, int_op::sub>(a, b, c, n, overflow);
+}
+
+void sse_sub(const uint8_t* a, const uint8_t* b, uint8_t* c, size_t n, simd_overflow overflow){
+    int_binary<sse_u8_vec, int_op::sub>(a, b, c, n, overflow);
+}
+
+void sse_sub(const int16_t* a, const int16_t* b, int16_t* c, size_t n, simd_overflow overflow){
+    int_binary<sse_i16_vec, int_op::sub>(a, b, c, n, overflow);
+}
+
+void sse_sub(const int32_t* a, const int32_t* b, int32_t* c, size_t n, simd_overflow overflow){
+    int_binary<sse_i32_vec, int_op::sub>(a, b, c, n, overflow);
+}
+
+/**
+ * @brief SSE4.1 integer Vector Multiply, see the integer mul()
+ */
+void sse_mul(const int8_t* a, const int8_t* b, int8_t* c, size_t n, simd_overflow overflow){
+    int_binary<sse_i8_vec, int_op::mul>(a, b, c, n, overflow);
+}
+
+void sse_mul(const uint8_t* a, const uint8_t* b, uint8_t* c, size_t n, simd_overflow overflow){
+    int_binary<sse_u8_vec, int_op::mul>(a, b, c, n, overflow);
+}
+
+void sse_mul(const int16_t* a, const int16_t* b, int16_t* c, size_t n, simd_overflow overflow){
+    int_binary<sse_i16_vec, int_op::mul>(a, b, c, n, overflow);
+}
+
+void sse_mul(const int32_t* a, const int32_t* b, int32_t* c, size_t n, simd_overflow overflow){
+    int_binary<sse_i32_vec, int_op::mul>(a, b, c, n, overflow);
+}
+
+/**
+ * @brief SSE4.1 8 bit Dot Product, see the 8 bit dot()
+ */
+int64_t sse_dot(const uint8_t* a, const int8_t* b, size_t n){
+    return int_dot<sse_dot_vec>(a, b, n);
+}
+
+int64_t sse_dot(const int8_t* a, const int8_t* b, size_t n){
+    return int_dot<sse_dot_vec>(a, b, n);
+}
+
+/**
+ * @brief SSE4.1 quantized convolution of widened operands, see int_driver.h
+ */
+void sse_conv_quant(const int16_t* x, const int16_t* h, size_t m, uint8_t* y, size_t count,
+                    float multiplier, int32_t zero_point){
+    quant_conv_run<sse_quant_vec>(x, h, m, y, count, multiplier, zero_point);
+}
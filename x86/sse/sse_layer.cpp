@@ -0,0 +1,50 @@
+/**
+ * @file sse_layer.cpp
+ * @author Sravan Senthilnathan
+ * @brief SSE4.1 fused softmax, log-softmax, layer-norm, RMS-norm and bias plus activation
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2023
+ * 
+ */
+#include "x86_kernels.h"
+#include "simd_vec.h"
+#include "layer_driver.h"
+
+/**
+ * @brief SSE4.1 softmax of every row, see layer_driver.h
+ */
+void sse_softmax(const float* x, float* y, size_t rows, size_t cols){
+    layer_softmax<vec_sse<float>>(x, y, rows, cols);
+}
+
+/**
+ * @brief SSE4.1 log-softmax of every row, see layer_driver.h
+ */
+void sse_log_softmax(const float* x, float* y, size_t rows, size_t cols){
+    layer_log_softmax<vec_sse<float>>(x, y, rows, cols);
+}
+
+/**
+ * @brief SSE4.1 layer normalization of every row, see layer_driver.h
+ */
+void sse_layer_norm(const float* x, const float* gamma, const float* beta, float* y,
+                    size_t rows, size_t cols, float eps){
+    layer_layer_norm<vec_sse<float>>(x, gamma, beta, y, rows, cols, eps);
+}
+
+/**
+ * @brief SSE4.1 RMS normalization of every row, see layer_driver.h
+ */
+void sse_rms_norm(const float* x, const float* gamma, float* y, size_t rows, size_t cols, float eps){
+    layer_rms_norm<vec_sse<float>>(x, gamma, y, rows, cols, eps);
+}
+
+/**
+ * @brief SSE4.1 y = act(x + bias) on every row, see layer_driver.h
+ */
+void sse_bias_activation(const float* x, const float* bias, float* y, size_t rows, size_t cols,
+                         simd_activation act){
+    layer_bias_activation<vec_sse<float>>(x, bias, y, rows, cols, act);
+}
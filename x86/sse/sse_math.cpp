@@ -0,0 +1,69 @@
+/**
+ * @file sse_math.cpp
+ * @author Sravan Senthilnathan
+ * @brief SSE4.1 elementwise exp, log, sin, cos, tanh, sigmoid, erf and pow
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2023
+ * 
+ */
+#include "x86_kernels.h"
+#include "simd_vec.h"
+#include "math_driver.h"
+
+/**
+ * @brief SSE4.1 e^x, see math_driver.h
+ */
+void sse_exp(const float* a, float* b, size_t n, simd_math_mode mode){
+    math_unary<vec_sse<float>, math_fn::exp>(a, b, n, mode);
+}
+
+/**
+ * @brief SSE4.1 natural logarithm, see math_driver.h
+ */
+void sse_log(const float* a, float* b, size_t n, simd_math_mode mode){
+    math_unary<vec_sse<float>, math_fn::log>(a, b, n, mode);
+}
+
+/**
+ * @brief SSE4.1 sine, see math_driver.h
+ */
+void sse_sin(const float* a, float* b, size_t n, simd_math_mode mode){
+    math_unary<vec_sse<float>, math_fn::sin>(a, b, n, mode);
+}
+
+/**
+ * @brief SSE4.1 cosine, see math_driver.h
+ */
+void sse_cos(const float* a, float* b, size_t n, simd_math_mode mode){
+    math_unary<vec_sse<float>, math_fn::cos>(a, b, n, mode);
+}
+
+/**
+ * @brief SSE4.1 hyperbolic tangent, see math_driver.h
+ */
+void sse_tanh(const float* a, float* b, size_t n, simd_math_mode mode){
+    math_unary<vec_sse<float>, math_fn::tanh>(a, b, n, mode);
+}
+
+/**
+ * @brief SSE4.1 logistic function, see math_driver.h
+ */
+void sse_sigmoid(const float* a, float* b, size_t n, simd_math_mode mode){
+    math_unary<vec_sse<float>, math_fn::sigmoid>(a, b, n, mode);
+}
+
+/**
+ * @brief SSE4.1 error function, see math_driver.h
+ */
+void sse_erf(const float* a, float* b, size_t n, simd_math_mode mode){
+    math_unary<vec_sse<float>, math_fn::erf>(a, b, n, mode);
+}
+
+/**
+ * @brief SSE4.1 power function, see math_driver.h
+ */
+void sse_pow(const float* a, const float* b, float* c, size_t n, simd_math_mode mode){
+    math_pow<vec_sse<float>, vec_sse<double>>(a, b, c, n, mode);
+}
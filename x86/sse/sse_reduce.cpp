@@ -0,0 +1,55 @@
+/**
+ * @file sse_reduce.cpp
+ * @author Sravan Senthilnathan
+ * @brief SSE4.1 sum, dot product, min/max and argmin/argmax
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2023
+ * 
+ */
+#include "x86_kernels.h"
+#include "simd_vec.h"
+#include "reduce_driver.h"
+
+/**
+ * @brief SSE Vector Sum, see reduce_driver.h for the modes
+ */
+float sse_sum(const float* a, size_t n, simd_sum_mode mode){
+    return reduce_sum<vec_sse<float>>(a, n, mode);
+}
+
+/**
+ * @brief SSE Dot Product, see reduce_driver.h for the modes
+ */
+float sse_dot(const float* a, const float* b, size_t n, simd_sum_mode mode){
+    return reduce_dot<vec_sse<float>>(a, b, n, mode);
+}
+
+/**
+ * @brief SSE Vector Minimum, NaNs skipped
+ */
+float sse_minimum(const float* a, size_t n){
+    return reduce_extreme<vec_sse<float>, false>(a, 0, n);
+}
+
+/**
+ * @brief SSE Vector Maximum, NaNs skipped
+ */
+float sse_maximum(const float* a, size_t n){
+    return reduce_extreme<vec_sse<float>, true>(a, 0, n);
+}
+
+/**
+ * @brief SSE Vector Argmin, the first index of the minimum
+ */
+size_t sse_argmin(const float* a, size_t n){
+    return reduce_arg_extreme<vec_sse<float>, false>(a, n);
+}
+
+/**
+ * @brief SSE Vector Argmax, the first index of the maximum
+ */
+size_t sse_argmax(const float* a, size_t n){
+    return reduce_arg_extreme<vec_sse<float>, true>(a, n);
+}
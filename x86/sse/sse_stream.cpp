@@ -0,0 +1,41 @@
+/**
+ * @file sse_stream.cpp
+ * @author Sravan Senthilnathan
+ * @brief SSE elementwise kernels with non-temporal stores
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2023
+ * 
+ */
+#include "x86_kernels.h"
+#include "simd_vec.h"
+#include "stream_driver.h"
+
+/**
+ * @brief SSE Vector Addition with streaming stores, see stream_driver.h
+ */
+void sse_add_stream(const float* a, const float* b, float* c, size_t n){
+    stream_run<vec_sse<float>, stream_add>(a, b, c, n);
+}
+
+/**
+ * @brief SSE Vector Subtraction with streaming stores, see stream_driver.h
+ */
+void sse_sub_stream(const float* a, const float* b, float* c, size_t n){
+    stream_run<vec_sse<float>, stream_sub>(a, b, c, n);
+}
+
+/**
+ * @brief SSE Vector Multiply with streaming stores, see stream_driver.h
+ */
+void sse_mul_stream(const float* a, const float* b, float* c, size_t n){
+    stream_run<vec_sse<float>, stream_mul>(a, b, c, n);
+}
+
+/**
+ * @brief SSE Vector Division with streaming stores, see stream_driver.h
+ */
+void sse_div_stream(const float* a, const float* b, float* c, size_t n){
+    stream_run<vec_sse<float>, stream_div>(a, b, c, n);
+}
@@ -0,0 +1,273 @@
+/**
+ * @file x86_kernels.h
+ * @author Sravan Senthilnathan
+ * @brief internal declarations of the per instruction set x86 kernel variants
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2023
+ * 
+ * Every variant is compiled with the flags of its instruction set (see the
+ * avx-Makefile) and may only be called once the dispatcher has confirmed the
+ * CPU supports it. The AVX variants keep their public avx_* names.
+ */
+#ifndef X86_KERNELS_H
+#define X86_KERNELS_H
+
+#include "simd_playground.h"
+
+struct fft_plan;
+
+// SSE (up to SSE4.1):
+void sse_add(const float* a, const float* b, float* c, size_t n);
+void sse_sub(const float* a, const float* b, float* c, size_t n);
+void sse_mul(const float* a, const float* b, float* c, size_t n);
+void sse_div(const float* a, const float* b, float* c, size_t n);
+void sse_mul_add(const float* a, const float* b, const float* c, float* d, size_t n);
+void sse_add_stream(const float* a, const float* b, float* c, size_t n);
+void sse_sub_stream(const float* a, const float* b, float* c, size_t n);
+void sse_mul_stream(const float* a, const float* b, float* c, size_t n);
+void sse_div_stream(const float* a, const float* b, float* c, size_t n);
+float sse_sum(const float* a, size_t n, simd_sum_mode mode);
+float sse_dot(const float* a, const float* b, size_t n, simd_sum_mode mode);
+float sse_minimum(const float* a, size_t n);
+float sse_maximum(const float* a, size_t n);
+size_t sse_argmin(const float* a, size_t n);
+size_t sse_argmax(const float* a, size_t n);
+void sse_exp(const float* a, float* b, size_t n, simd_math_mode mode);
+void sse_log(const float* a, float* b, size_t n, simd_math_mode mode);
+void sse_sin(const float* a, float* b, size_t n, simd_math_mode mode);
+void sse_cos(const float* a, float* b, size_t n, simd_math_mode mode);
+void sse_tanh(const float* a, float* b, size_t n, simd_math_mode mode);
+void sse_sigmoid(const float* a, float* b, size_t n, simd_math_mode mode);
+void sse_erf(const float* a, float* b, size_t n, simd_math_mode mode);
+void sse_pow(const float* a, const float* b, float* c, size_t n, simd_math_mode mode);
+void sse_div(const float* a, const float* b, float* c, size_t n, simd_div_mode mode);
+void sse_sqrt(const float* a, float* b, size_t n, simd_div_mode mode);
+void sse_rsqrt(const float* a, float* b, size_t n, simd_div_mode mode);
+void sse_softmax(const float* x, float* y, size_t rows, size_t cols);
+void sse_log_softmax(const float* x, float* y, size_t rows, size_t cols);
+void sse_layer_norm(const float* x, const float* gamma, const float* beta, float* y,
+                    size_t rows, size_t cols, float eps);
+void sse_rms_norm(const float* x, const float* gamma, float* y, size_t rows, size_t cols, float eps);
+void sse_bias_activation(const float* x, const float* bias, float* y, size_t rows, size_t cols,
+                         simd_activation act);
+void sse_to_half(const float* a, uint16_t* h, size_t n, simd_half_format format);
+void sse_from_half(const uint16_t* h, float* a, size_t n, simd_half_format format);
+void sse_add_half(const uint16_t* a, const uint16_t* b, uint16_t* c, size_t n, simd_half_format format);
+void sse_mul_half(const uint16_t* a, const uint16_t* b, uint16_t* c, size_t n, simd_half_format format);
+float sse_dot_half(const uint16_t* a, const uint16_t* b, size_t n, simd_half_format format);
+void sse_add(const int8_t* a, const int8_t* b, int8_t* c, size_t n, simd_overflow overflow);
+void sse_add(const uint8_t* a, const uint8_t* b, uint8_t* c, size_t n, simd_overflow overflow);
+void sse_add(const int16_t* a, const int16_t* b, int16_t* c, size_t n, simd_overflow overflow);
+void sse_add(const int32_t* a, const int32_t* b, int32_t* c, size_t n, simd_overflow overflow);
+void sse_sub(const int8_t* a, const int8_t* b, int8_t* c, size_t n, simd_overflow overflow);
+void sse_sub(const uint8_t* a, const uint8_t* b, uint8_t* c, size_t n, simd_overflow overflow);
+void sse_sub(const int16_t* a, const int16_t* b, int16_t* c, size_t n, simd_overflow overflow);
+void sse_sub(const int32_t* a, const int32_t* b, int32_t* c, size_t n, simd_overflow overflow);
+void sse_mul(const int8_t* a, const int8_t* b, int8_t* c, size_t n, simd_overflow overflow);
+void sse_mul(const uint8_t* a, const uint8_t* b, uint8_t* c, size_t n, simd_overflow overflow);
+void sse_mul(const int16_t* a, const int16_t* b, int16_t* c, size_t n, simd_overflow overflow);
+void sse_mul(const int32_t* a, const int32_t* b, int32_t* c, size_t n, simd_overflow overflow);
+int64_t sse_dot(const uint8_t* a, const int8_t* b, size_t n);
+int64_t sse_dot(const int8_t* a, const int8_t* b, size_t n);
+void sse_conv_quant(const int16_t* x, const int16_t* h, size_t m, uint8_t* y, size_t count,
+                    float multiplier, int32_t zero_point);
+void sse_add(const Tensor a, const Tensor b, Tensor &c);
+void sse_sub(const Tensor a, const Tensor b, Tensor &c);
+void sse_mul(const Tensor a, const Tensor b, Tensor &c);
+void sse_mul_batch(const Tensor* a, const Tensor* b, Tensor* c, size_t count);
+void sse_mul_batch_soa(const float* a, const float* b, float* c, size_t count, size_t stride);
+void sse_conv(const float* x, size_t l1, const float* h, size_t l2, float* y,
+              size_t first, size_t count);
+void sse_conv2d_rows(const float* const* rows, const float* h, size_t kw, size_t kh, float* y, size_t count);
+void sse_add(const double* a, const double* b, double* c, size_t n);
+void sse_sub(const double* a, const double* b, double* c, size_t n);
+void sse_mul(const double* a, const double* b, double* c, size_t n);
+void sse_div(const double* a, const double* b, double* c, size_t n);
+void sse_mul_add(const double* a, const double* b, const double* c, double* d, size_t n);
+void sse_add(const Tensor64 a, const Tensor64 b, Tensor64 &c);
+void sse_sub(const Tensor64 a, const Tensor64 b, Tensor64 &c);
+void sse_mul(const Tensor64 a, const Tensor64 b, Tensor64 &c);
+void sse_conv(const double* x, size_t l1, const double* h, size_t l2, double* y,
+              size_t first, size_t count);
+void sse_fft(const fft_plan& p, const float* in_re, const float* in_im, size_t stride,
+             float* re, float* im);
+void sse_spectrum_mul(const float* ar, const float* ai, const float* br, const float* bi,
+                      float* cr, float* ci, size_t n);
+
+// AVX (without FMA):
+void avx_add_stream(const float* a, const float* b, float* c, size_t n);
+void avx_sub_stream(const float* a, const float* b, float* c, size_t n);
+void avx_mul_stream(const float* a, const float* b, float* c, size_t n);
+void avx_div_stream(const float* a, const float* b, float* c, size_t n);
+float avx_sum(const float* a, size_t n, simd_sum_mode mode);
+float avx_dot(const float* a, const float* b, size_t n, simd_sum_mode mode);
+float avx_minimum(const float* a, size_t n);
+float avx_maximum(const float* a, size_t n);
+size_t avx_argmin(const float* a, size_t n);
+size_t avx_argmax(const float* a, size_t n);
+void avx_conv(const float* x, size_t l1, const float* h, size_t l2, float* y,
+              size_t first, size_t count);
+void avx_conv2d_rows(const float* const* rows, const float* h, size_t kw, size_t kh, float* y, size_t count);
+void avx_add(const double* a, const double* b, double* c, size_t n);
+void avx_sub(const double* a, const double* b, double* c, size_t n);
+void avx_mul(const double* a, const double* b, double* c, size_t n);
+void avx_div(const double* a, const double* b, double* c, size_t n);
+void avx_mul_add(const double* a, const double* b, const double* c, double* d, size_t n);
+void avx_add(const Tensor64 a, const Tensor64 b, Tensor64 &c);
+void avx_sub(const Tensor64 a, const Tensor64 b, Tensor64 &c);
+void avx_mul(const Tensor64 a, const Tensor64 b, Tensor64 &c);
+void avx_conv(const double* x, size_t l1, const double* h, size_t l2, double* y,
+              size_t first, size_t count);
+void avx_sgemm(bool trans_a, bool trans_b, size_t m, size_t n, size_t k,
+               float alpha, const float* a, size_t lda, const float* b, size_t ldb,
+               float beta, float* c, size_t ldc);
+
+// AVX2 + FMA + F16C:
+void avx2_mul_add(const float* a, const float* b, const float* c, float* d, size_t n);
+float avx2_sum(const float* a, size_t n, simd_sum_mode mode);
+float avx2_dot(const float* a, const float* b, size_t n, simd_sum_mode mode);
+float avx2_minimum(const float* a, size_t n);
+float avx2_maximum(const float* a, size_t n);
+size_t avx2_argmin(const float* a, size_t n);
+size_t avx2_argmax(const float* a, size_t n);
+void avx2_exp(const float* a, float* b, size_t n, simd_math_mode mode);
+void avx2_log(const float* a, float* b, size_t n, simd_math_mode mode);
+void avx2_sin(const float* a, float* b, size_t n, simd_math_mode mode);
+void avx2_cos(const float* a, float* b, size_t n, simd_math_mode mode);
+void avx2_tanh(const float* a, float* b, size_t n, simd_math_mode mode);
+void avx2_sigmoid(const float* a, float* b, size_t n, simd_math_mode mode);
+void avx2_erf(const float* a, float* b, size_t n, simd_math_mode mode);
+void avx2_pow(const float* a, const float* b, float* c, size_t n, simd_math_mode mode);
+void avx2_div(const float* a, const float* b, float* c, size_t n, simd_div_mode mode);
+void avx2_sqrt(const float* a, float* b, size_t n, simd_div_mode mode);
+void avx2_rsqrt(const float* a, float* b, size_t n, simd_div_mode mode);
+void avx2_softmax(const float* x, float* y, size_t rows, size_t cols);
+void avx2_log_softmax(const float* x, float* y, size_t rows, size_t cols);
+void avx2_layer_norm(const float* x, const float* gamma, const float* beta, float* y,
+                     size_t rows, size_t cols, float eps);
+void avx2_rms_norm(const float* x, const float* gamma, float* y, size_t rows, size_t cols, float eps);
+void avx2_bias_activation(const float* x, const float* bias, float* y, size_t rows, size_t cols,
+                          simd_activation act);
+void avx2_to_half(const float* a, uint16_t* h, size_t n, simd_half_format format);
+void avx2_from_half(const uint16_t* h, float* a, size_t n, simd_half_format format);
+void avx2_add_half(const uint16_t* a, const uint16_t* b, uint16_t* c, size_t n, simd_half_format format);
+void avx2_mul_half(const uint16_t* a, const uint16_t* b, uint16_t* c, size_t n, simd_half_format format);
+float avx2_dot_half(const uint16_t* a, const uint16_t* b, size_t n, simd_half_format format);
+void avx2_add(const int8_t* a, const int8_t* b, int8_t* c, size_t n, simd_overflow overflow);
+void avx2_add(const uint8_t* a, const uint8_t* b, uint8_t* c, size_t n, simd_overflow overflow);
+void avx2_add(const int16_t* a, const int16_t* b, int16_t* c, size_t n, simd_overflow overflow);
+void avx2_add(const int32_t* a, const int32_t* b, int32_t* c, size_t n, simd_overflow overflow);
+void avx2_sub(const int8_t* a, const int8_t* b, int8_t* c, size_t n, simd_overflow overflow);
+void avx2_sub(const uint8_t* a, const uint8_t* b, uint8_t* c, size_t n, simd_overflow overflow);
+void avx2_sub(const int16_t* a, const int16_t* b, int16_t* c, size_t n, simd_overflow overflow);
+void avx2_sub(const int32_t* a, const int32_t* b, int32_t* c, size_t n, simd_overflow overflow);
+void avx2_mul(const int8_t* a, const int8_t* b, int8_t* c, size_t n, simd_overflow overflow);
+void avx2_mul(const uint8_t* a, const uint8_t* b, uint8_t* c, size_t n, simd_overflow overflow);
+void avx2_mul(const int16_t* a, const int16_t* b, int16_t* c, size_t n, simd_overflow overflow);
+void avx2_mul(const int32_t* a, const int32_t* b, int32_t* c, size_t n, simd_overflow overflow);
+int64_t avx2_dot(const uint8_t* a, const int8_t* b, size_t n);
+int64_t avx2_dot(const int8_t* a, const int8_t* b, size_t n);
+void avx2_conv_quant(const int16_t* x, const int16_t* h, size_t m, uint8_t* y, size_t count,
+                     float multiplier, int32_t zero_point);
+void avx2_mul(const Tensor a, const Tensor b, Tensor &c);
+void avx2_mul_batch(const Tensor* a, const Tensor* b, Tensor* c, size_t count);
+void avx2_mul_batch_soa(const float* a, const float* b, float* c, size_t count, size_t stride);
+void avx2_conv(const float* x, size_t l1, const float* h, size_t l2, float* y,
+               size_t first, size_t count);
+void avx2_conv2d_rows(const float* const* rows, const float* h, size_t kw, size_t kh, float* y, size_t count);
+void avx2_mul_add(const double* a, const double* b, const double* c, double* d, size_t n);
+void avx2_mul(const Tensor64 a, const Tensor64 b, Tensor64 &c);
+void avx2_conv(const double* x, size_t l1, const double* h, size_t l2, double* y,
+               size_t first, size_t count);
+void avx2_fft(const fft_plan& p, const float* in_re, const float* in_im, size_t stride,
+              float* re, float* im);
+void avx2_spectrum_mul(const float* ar, const float* ai, const float* br, const float* bi,
+                       float* cr, float* ci, size_t n);
+void avx2_sgemm(bool trans_a, bool trans_b, size_t m, size_t n, size_t k,
+                float alpha, const float* a, size_t lda, const float* b, size_t ldb,
+                float beta, float* c, size_t ldc);
+
+// AVX-512 (F, VL, BW, DQ):
+void avx512_add(const float* a, const float* b, float* c, size_t n);
+void avx512_sub(const float* a, const float* b, float* c, size_t n);
+void avx512_mul(const float* a, const float* b, float* c, size_t n);
+void avx512_div(const float* a, const float* b, float* c, size_t n);
+void avx512_mul_add(const float* a, const float* b, const float* c, float* d, size_t n);
+void avx512_add_stream(const float* a, const float* b, float* c, size_t n);
+void avx512_sub_stream(const float* a, const float* b, float* c, size_t n);
+void avx512_mul_stream(const float* a, const float* b, float* c, size_t n);
+void avx512_div_stream(const float* a, const float* b, float* c, size_t n);
+float avx512_sum(const float* a, size_t n, simd_sum_mode mode);
+float avx512_dot(const float* a, const float* b, size_t n, simd_sum_mode mode);
+float avx512_minimum(const float* a, size_t n);
+float avx512_maximum(const float* a, size_t n);
+size_t avx512_argmin(const float* a, size_t n);
+size_t avx512_argmax(const float* a, size_t n);
+void avx512_exp(const float* a, float* b, size_t n, simd_math_mode mode);
+void avx512_log(const float* a, float* b, size_t n, simd_math_mode mode);
+void avx512_sin(const float* a, float* b, size_t n, simd_math_mode mode);
+void avx512_cos(const float* a, float* b, size_t n, simd_math_mode mode);
+void avx512_tanh(const float* a, float* b, size_t n, simd_math_mode mode);
+void avx512_sigmoid(const float* a, float* b, size_t n, simd_math_mode mode);
+void avx512_erf(const float* a, float* b, size_t n, simd_math_mode mode);
+void avx512_pow(const float* a, const float* b, float* c, size_t n, simd_math_mode mode);
+void avx512_div(const float* a, const float* b, float* c, size_t n, simd_div_mode mode);
+void avx512_sqrt(const float* a, float* b, size_t n, simd_div_mode mode);
+void avx512_rsqrt(const float* a, float* b, size_t n, simd_div_mode mode);
+void avx512_softmax(const float* x, float* y, size_t rows, size_t cols);
+void avx512_log_softmax(const float* x, float* y, size_t rows, size_t cols);
+void avx512_layer_norm(const float* x, const float* gamma, const float* beta, float* y,
+                       size_t rows, size_t cols, float eps);
+void avx512_rms_norm(const float* x, const float* gamma, float* y, size_t rows, size_t cols, float eps);
+void avx512_bias_activation(const float* x, const float* bias, float* y, size_t rows, size_t cols,
+                            simd_activation act);
+void avx512_to_half(const float* a, uint16_t* h, size_t n, simd_half_format format);
+void avx512_from_half(const uint16_t* h, float* a, size_t n, simd_half_format format);
+void avx512_add_half(const uint16_t* a, const uint16_t* b, uint16_t* c, size_t n, simd_half_format format);
+void avx512_mul_half(const uint16_t* a, const uint16_t* b, uint16_t* c, size_t n, simd_half_format format);
+float avx512_dot_half(const uint16_t* a, const uint16_t* b, size_t n, simd_half_format format);
+void avx512_add(const int8_t* a, const int8_t* b, int8_t* c, size_t n, simd_overflow overflow);
+void avx512_add(const uint8_t* a, const uint8_t* b, uint8_t* c, size_t n, simd_overflow overflow);
+void avx512_add(const int16_t* a, const int16_t* b, int16_t* c, size_t n, simd_overflow overflow);
+void avx512_add(const int32_t* a, const int32_t* b, int32_t* c, size_t n, simd_overflow overflow);
+void avx512_sub(const int8_t* a, const int8_t* b, int8_t* c, size_t n, simd_overflow overflow);
+void avx512_sub(const uint8_t* a, const uint8_t* b, uint8_t* c, size_t n, simd_overflow overflow);
+void avx512_sub(const int16_t* a, const int16_t* b, int16_t* c, size_t n, simd_overflow overflow);
+void avx512_sub(const int32_t* a, const int32_t* b, int32_t* c, size_t n, simd_overflow overflow);
+void avx512_mul(const int8_t* a, const int8_t* b, int8_t* c, size_t n, simd_overflow overflow);
+void avx512_mul(const uint8_t* a, const uint8_t* b, uint8_t* c, size_t n, simd_overflow overflow);
+void avx512_mul(const int16_t* a, const int16_t* b, int16_t* c, size_t n, simd_overflow overflow);
+void avx512_mul(const int32_t* a, const int32_t* b, int32_t* c, size_t n, simd_overflow overflow);
+int64_t avx512_dot(const uint8_t* a, const int8_t* b, size_t n);
+int64_t avx512_dot(const int8_t* a, const int8_t* b, size_t n);
+void avx512_conv_quant(const int16_t* x, const int16_t* h, size_t m, uint8_t* y, size_t count,
+                       float multiplier, int32_t zero_point);
+void avx512_add(const Tensor a, const Tensor b, Tensor &c);
+void avx512_sub(const Tensor a, const Tensor b, Tensor &c);
+void avx512_mul(const Tensor a, const Tensor b, Tensor &c);
+void avx512_mul_batch(const Tensor* a, const Tensor* b, Tensor* c, size_t count);
+void avx512_mul_batch_soa(const float* a, const float* b, float* c, size_t count, size_t stride);
+void avx512_conv(const float* x, size_t l1, const float* h, size_t l2, float* y,
+                 size_t first, size_t count);
+void avx512_conv2d_rows(const float* const* rows, const float* h, size_t kw, size_t kh, float* y, size_t count);
+void avx512_add(const double* a, const double* b, double* c, size_t n);
+void avx512_sub(const double* a, const double* b, double* c, size_t n);
+void avx512_mul(const double* a, const double* b, double* c, size_t n);
+void avx512_div(const double* a, const double* b, double* c, size_t n);
+void avx512_mul_add(const double* a, const double* b, const double* c, double* d, size_t n);
+void avx512_add(const Tensor64 a, const Tensor64 b, Tensor64 &c);
+void avx512_sub(const Tensor64 a, const Tensor64 b, Tensor64 &c);
+void avx512_mul(const Tensor64 a, const Tensor64 b, Tensor64 &c);
+void avx512_conv(const double* x, size_t l1, const double* h, size_t l2, double* y,
+                 size_t first, size_t count);
+void avx512_sgemm(bool trans_a, bool trans_b, size_t m, size_t n, size_t k,
+                  float alpha, const float* a, size_t lda, const float* b, size_t ldb,
+                  float beta, float* c, size_t ldc);
+
+// AVX-512 + AVX512_VNNI (vpdpbusd), checked on its own by the dispatcher:
+int64_t avx512_vnni_dot(const uint8_t* a, const int8_t* b, size_t n);
+int64_t avx512_vnni_dot(const int8_t* a, const int8_t* b, size_t n);
+
+#endif